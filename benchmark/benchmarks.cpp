@@ -0,0 +1,385 @@
+#include <QtTest>
+#include <QApplication>
+#include <QImage>
+#include <QPainter>
+
+#include <QFontIcon>
+
+#include "embedded_icons.h"
+
+/*
+ * Microbenchmarks of the QFontIconEngine hot paths.
+ *
+ * Run headless with QT_QPA_PLATFORM=offscreen (the default when unset) and
+ * pass "-o results.xml,xml" or "-csv" for machine-readable results, which is
+ * what the run_benchmarks target does.
+ *
+ * Cold variants reload the font right before the measured call, so nothing
+ * derived from it is cached yet. They run a single iteration each. fa::solid
+ * has the metrics generated for it registered; cold variants reading the
+ * font's own tables load the same file as plainFont, which has none.
+ */
+class QFontIconBenchmarks : public QObject
+{
+    Q_OBJECT
+
+private:
+    static const QString fontFile;
+    static const int plainFont = 101;
+
+    static void addSizes()
+    {
+        QTest::addColumn<int>("size");
+        QTest::addColumn<qreal>("dpr");
+
+        for(int size : { 16, 24, 32, 48, 64, 128 })
+        {
+            for(qreal dpr : { 1.0, 2.0 })
+                QTest::addRow("%dpx@%gx", size, dpr) << size << dpr;
+        }
+    }
+
+    static void coldStart(int font)
+    {
+        QFontIconEngine::loadFont(fontFile, font);
+    }
+
+private slots:
+    void initTestCase()
+    {
+        QFontIconEngine::setDefaultFont(fa::solid);
+        QVERIFY(QFontIconEngine::loadFont(fontFile, fa::solid, QStringLiteral("solid")));
+        QVERIFY(QFontIconEngine::loadFont(fontFile, plainFont));
+        QVERIFY(fa::v5::register_awesome_names());
+        QVERIFY(fa::register_awesome_metrics());
+    }
+
+    // === Rendering ===========================================================
+
+    void paint_data() { addSizes(); }
+    void paint()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QImage image(QSize(size, size) * dpr, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        QFontIconEngine engine(fa::v5::beer);
+        QPainter p(&image);
+
+        QBENCHMARK {
+            engine.paint(&p, QRect(0, 0, size, size), QIcon::Normal, QIcon::Off);
+        }
+    }
+
+    void paintCold_data() { addSizes(); }
+    void paintCold()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QImage image(QSize(size, size) * dpr, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        QFontIconEngine engine(fa::v5::beer, plainFont);
+        QPainter p(&image);
+
+        coldStart(plainFont);
+        QBENCHMARK_ONCE {
+            engine.paint(&p, QRect(0, 0, size, size), QIcon::Normal, QIcon::Off);
+        }
+    }
+
+    void pixmap_data() { addSizes(); }
+    void pixmap()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QFontIconEngine engine(fa::v5::beer);
+        QSize s = QSize(size, size) * dpr;
+
+        QBENCHMARK {
+            auto pm = engine.pixmap(s, QIcon::Normal, QIcon::Off);
+            Q_UNUSED(pm);
+        }
+    }
+
+    void pixmapCold_data() { addSizes(); }
+    void pixmapCold()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QFontIconEngine engine(fa::v5::beer, plainFont);
+        QSize s = QSize(size, size) * dpr;
+
+        coldStart(plainFont);
+        QBENCHMARK_ONCE {
+            auto pm = engine.pixmap(s, QIcon::Normal, QIcon::Off);
+            Q_UNUSED(pm);
+        }
+    }
+
+    void iconPixmap_data() { addSizes(); }
+    void iconPixmap()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QIcon icon = QFontIconEngine::icon(fa::v5::beer);
+
+        QBENCHMARK {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+            auto pm = icon.pixmap(QSize(size, size), dpr);
+#else
+            auto pm = icon.pixmap(QSize(size, size) * dpr);
+#endif
+            Q_UNUSED(pm);
+        }
+    }
+
+    void fontIconPaint_data() { addSizes(); }
+    void fontIconPaint()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QImage image(QSize(size, size) * dpr, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        QFontIcon icon(fa::v5::beer, fa::solid, Qt::black);
+        QPainter p(&image);
+
+        QBENCHMARK {
+            icon.paint(&p, QRectF(0, 0, size, size));
+        }
+    }
+
+    void paintMany_data() { addSizes(); }
+    void paintMany()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        // A 10x10 grid of icons in two colors
+        QImage image(QSize(size, size) * 10 * dpr, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        QVector<QFontIconEngine::PaintItem> items(100);
+        for(int i = 0; i < items.size(); ++i)
+        {
+            items[i].rect  = QRectF((i % 10) * size, (i / 10) * size, size, size);
+            items[i].icon  = fa::v5::beer;
+            items[i].font  = fa::solid;
+            items[i].color = i % 2 ? Qt::black : Qt::darkYellow;
+        }
+
+        QPainter p(&image);
+
+        QBENCHMARK {
+            QFontIconEngine::paintMany(&p, items);
+        }
+    }
+
+    void atlasDraw_data() { addSizes(); }
+    void atlasDraw()
+    {
+        QFETCH(int, size);
+        QFETCH(qreal, dpr);
+
+        QImage image(QSize(size, size) * dpr, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr);
+        image.fill(Qt::transparent);
+
+        QFontIconAtlas atlas;
+        QPainter p(&image);
+
+        QBENCHMARK {
+            atlas.draw(&p, QRectF(0, 0, size, size), fa::v5::beer, fa::solid, Qt::black);
+        }
+    }
+
+    void glyphIndex()
+    {
+        QFontIconEngine engine(fa::v5::beer);
+
+        QBENCHMARK {
+            auto g = engine.glyphIndex();
+            Q_UNUSED(g);
+        }
+    }
+
+    void glyphIndexCold()
+    {
+        QFontIconEngine engine(fa::v5::beer, plainFont);
+
+        coldStart(plainFont);
+        QBENCHMARK_ONCE {
+            auto g = engine.glyphIndex();
+            Q_UNUSED(g);
+        }
+    }
+
+    // Same with the metrics generated for the font: no cmap or metrics read
+    void glyphIndexColdMetrics()
+    {
+        QFontIconEngine engine(fa::v5::beer);
+
+        coldStart(fa::solid);
+        QBENCHMARK_ONCE {
+            auto g = engine.glyphIndex();
+            Q_UNUSED(g);
+        }
+    }
+
+    // === Names ===============================================================
+
+    void setIconByQString()
+    {
+        QFontIconEngine engine;
+        QString name = QStringLiteral("beer");
+
+        QBENCHMARK {
+            engine.setIcon(name);
+        }
+    }
+
+    void setIconByLiteral()
+    {
+        QFontIconEngine engine;
+
+        QBENCHMARK {
+            engine.setIcon(QLatin1String("beer"));
+        }
+    }
+
+    void iconName()
+    {
+        QFontIconEngine engine(fa::v5::beer);
+
+        QBENCHMARK {
+            auto n = engine.iconName(QIcon::Normal, QIcon::Off);
+            Q_UNUSED(n);
+        }
+    }
+
+    void fontName()
+    {
+        QFontIconEngine engine(fa::v5::beer);
+
+        QBENCHMARK {
+            auto n = engine.fontName();
+            Q_UNUSED(n);
+        }
+    }
+
+    void registerAwesomeNames()
+    {
+        QBENCHMARK {
+            fa::v6::register_awesome_names();
+        }
+    }
+
+    void registerAwesomeNamesLazy()
+    {
+        QBENCHMARK {
+            fa::v6::register_awesome_names(true);
+        }
+    }
+
+    void searchTyping()
+    {
+        fa::v6::register_awesome_names();
+        QFontIconSearch index;
+
+        // One search per keystroke, then erase it all
+        const QString query = QStringLiteral("mug-hot");
+
+        QBENCHMARK {
+            for(int i = 1; i <= query.size(); ++i)
+                index.search(QStringView(query).left(i), 50);
+            for(int i = query.size() - 1; i >= 0; --i)
+                index.search(QStringView(query).left(i), 50);
+        }
+    }
+
+    // === Engine and fonts ====================================================
+
+    void clone()
+    {
+        QFontIconEngine engine(fa::v5::beer);
+        engine.setColor(Qt::red);
+        engine.setIcon(fa::v5::beer, QIcon::Normal, QIcon::On);
+
+        QBENCHMARK {
+            delete engine.clone();
+        }
+    }
+
+    void findFont()
+    {
+        QBENCHMARK {
+            auto f = QFontIconEngine::findFont(fa::v5::beer);
+            Q_UNUSED(f);
+        }
+    }
+
+    void loadFont()
+    {
+        QBENCHMARK {
+            QFontIconEngine::loadFont(fontFile, fa::solid);
+        }
+    }
+
+    // Outlines compiled in by generate_fa.py --embed, under their own font id
+    // so the other benchmarks keep drawing fa::solid from the font.
+    void glyphIndexColdEmbedded()
+    {
+        const int embeddedFont = 100;
+        QVERIFY(fa::register_embedded_icons(embeddedFont));
+        QFontIconEngine engine(fa::v5::beer, embeddedFont);
+
+        QFontIconEngine::trimCaches(QFontIconEngine::TrimFonts);
+        QBENCHMARK_ONCE {
+            auto g = engine.glyphIndex();
+            Q_UNUSED(g);
+        }
+    }
+
+    // === Last ================================================================
+
+    // The resolver stays registered, no other benchmark may run after it
+    void setIconByResolver()
+    {
+        QFontIconEngine::registerIconNameResolver([](QStringView name)
+        {
+            return name.compare(QLatin1String("not-registered")) == 0 ? int(fa::v5::beer) : int(QFontIconEngine::InvalidIcon);
+        });
+
+        QFontIconEngine engine;
+
+        QBENCHMARK {
+            engine.setIcon(QLatin1String("not-registered"));
+        }
+    }
+};
+
+const QString QFontIconBenchmarks::fontFile = QStringLiteral(":/fonts/fa-solid-900.ttf");
+
+int main(int argc, char* argv[])
+{
+    if(!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    QFontIconBenchmarks benchmarks;
+    return QTest::qExec(&benchmarks, argc, argv);
+}
+
+#include "benchmarks.moc"
@@ -0,0 +1,46 @@
+#include "embedded_icons.h"
+
+#include <awesome.h>
+#include <qfonticon.h>
+
+/**
+ * This file has been automatically generated from fa-solid-900.ttf.
+ */
+
+namespace fa {
+
+namespace {
+
+constexpr qint16 points_f0fc[] = {
+    368, 352, 401, 352, 424, 328, 448, 305, 448, 272, 448, 143, 448, 119, 435, 100,
+    422, 80, 401, 70, 320, 34, 320, -8, 320, -18, 313, -25, 306, -32, 296, -32,
+    24, -32, 14, -32, 7, -25, 0, -18, 0, -8, 0, 392, 0, 402, 7, 409,
+    14, 416, 24, 416, 296, 416, 306, 416, 313, 409, 320, 402, 320, 392, 320, 352,
+    384, 143, 384, 272, 384, 279, 380, 284, 375, 288, 368, 288, 320, 288, 320, 104,
+    375, 129, 384, 133, 384, 143, 224, 80, 224, 304, 224, 311, 220, 316, 215, 320,
+    208, 320, 201, 320, 196, 316, 192, 311, 192, 304, 192, 80, 192, 73, 196, 68,
+    201, 64, 208, 64, 215, 64, 220, 68, 224, 73, 224, 80, 128, 80, 128, 304,
+    128, 311, 124, 316, 119, 320, 112, 320, 105, 320, 100, 316, 96, 311, 96, 304,
+    96, 80, 96, 73, 100, 68, 105, 64, 112, 64, 119, 64, 124, 68, 128, 73,
+    128, 80,
+};
+
+constexpr quint8 commands_f0fc[] = {
+    0, 2, 2, 1, 2, 2, 1, 1, 2, 2, 1, 2, 2, 1, 2, 2, 1, 2, 2, 1, 3, 0, 1, 2,
+    2, 1, 1, 1, 2, 3, 0, 1, 2, 2, 2, 2, 1, 2, 2, 2, 2, 3, 0, 1, 2, 2, 2, 2,
+    1, 2, 2, 2, 2, 3,
+};
+
+constexpr QFontIconEngine::Outline outlines[] = {
+    { 0xf0fc, 217, { 0, -32, 448, 416 }, points_f0fc, commands_f0fc, 54 },
+};
+
+}
+
+bool register_embedded_icons(int font)
+{
+    return QFontIconEngine::registerOutlines(font, 512, outlines,
+                                             int(sizeof(outlines) / sizeof(outlines[0])));
+}
+
+}
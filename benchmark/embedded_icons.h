@@ -0,0 +1,18 @@
+#ifndef EMBEDDED_ICONS_H
+#define EMBEDDED_ICONS_H
+
+#include <awesome.h>
+
+/**
+ * This file has been automatically generated.
+ */
+
+namespace fa {
+
+// Registers 1 solid icons drawn without loading fa-solid-900.ttf, as
+// icons of the given font id.
+bool register_embedded_icons(int font = solid);
+
+}
+
+#endif // EMBEDDED_ICONS_H
@@ -0,0 +1,426 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QGridLayout>
+#include <QHeaderView>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+#include <QProcess>
+#include <QRawFont>
+#include <QScrollArea>
+#include <QScrollBar>
+#include <QTableView>
+#include <QToolButton>
+
+#include <QFontIcon>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+/*
+ * Scenario benchmarks: realistic offscreen scenes rendered frame by frame, so
+ * that engine clones, style calls to pixmap(), animation ticks and viewport
+ * repaints are measured together. Results are printed as JSON.
+ *
+ * Each scene runs in its own process, started with --scenario, so that its
+ * peak RSS is its own and caches do not carry over from one scene to the
+ * next.
+ */
+
+// === Allocation counting =====================================================
+
+static std::atomic<quint64> allocations(0);
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if(void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+static qint64 peakRssKb()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return qint64(pmc.PeakWorkingSetSize / 1024);
+    return -1;
+#elif defined(Q_OS_UNIX)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+#if defined(Q_OS_DARWIN)
+    return qint64(usage.ru_maxrss / 1024);
+#else
+    return qint64(usage.ru_maxrss);
+#endif
+#else
+    return -1;
+#endif
+}
+
+// === Measurements ============================================================
+
+class Scenario
+{
+public:
+    explicit Scenario(const QString& name) : name(name) {}
+
+    void beginSetup()
+    {
+        timer.start();
+        mark = allocations.load(std::memory_order_relaxed);
+    }
+
+    void endSetup()
+    {
+        setupMs = timer.nsecsElapsed() / 1e6;
+        setupAllocations = allocations.load(std::memory_order_relaxed) - mark;
+    }
+
+    template<class F>
+    void frame(F f)
+    {
+        quint64 before = allocations.load(std::memory_order_relaxed);
+        timer.start();
+        f();
+        frames.append(timer.nsecsElapsed() / 1e6);
+        frameAllocations += allocations.load(std::memory_order_relaxed) - before;
+    }
+
+    QJsonObject report() const
+    {
+        auto sorted = frames;
+        std::sort(sorted.begin(), sorted.end());
+
+        auto percentile = [&sorted](qreal p)
+        {
+            if(sorted.isEmpty())
+                return 0.0;
+            int last = int(sorted.size()) - 1;
+            int i = qBound(0, int(p * last + 0.5), last);
+            return sorted.at(i);
+        };
+
+        qreal total = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+
+        QJsonObject frameMs {
+            { "min",    percentile(0)    },
+            { "median", percentile(0.5)  },
+            { "p95",    percentile(0.95) },
+            { "max",    percentile(1)    },
+            { "mean",   sorted.isEmpty() ? 0.0 : total / sorted.size() }
+        };
+
+        return {
+            { "name",                 name },
+            { "setupMs",              setupMs },
+            { "setupAllocations",     double(setupAllocations) },
+            { "frames",               sorted.size() },
+            { "frameMs",              frameMs },
+            { "allocationsPerFrame",  sorted.isEmpty() ? 0.0 : double(frameAllocations) / sorted.size() },
+            { "peakRssKb",            double(peakRssKb()) }
+        };
+    }
+
+private:
+    QString name;
+    QElapsedTimer timer;
+    quint64 mark = 0;
+    qreal setupMs = 0;
+    quint64 setupAllocations = 0;
+    quint64 frameAllocations = 0;
+    QVector<qreal> frames;
+};
+
+static void render(QWidget* w, QImage& target)
+{
+    QPainter p(&target);
+    w->render(&p);
+}
+
+// Code points of every Font Awesome 5 icon the bundled solid font covers.
+static QVector<int> availableIcons()
+{
+    QRawFont font(QStringLiteral(":/fonts/fa-solid-900.ttf"), 16);
+
+    QVector<int> icons;
+    for(int i = 0; i < fa::v5::icon_codes_count; ++i)
+    {
+        int code = fa::v5::icon_codes[i].code;
+        if(font.supportsCharacter(uint(code)))
+            icons.append(code);
+    }
+
+    return icons;
+}
+
+// === Scenes ==================================================================
+
+static QJsonObject toolButtons(bool shared, int frames)
+{
+    Scenario s(shared ? QStringLiteral("toolButtons/shared") : QStringLiteral("toolButtons/distinct"));
+
+    const int count   = 10000;
+    const int columns = 100;
+    const auto icons  = availableIcons();
+
+    s.beginSetup();
+
+    QScrollArea window;
+    auto content = new QWidget;
+    auto layout  = new QGridLayout(content);
+    layout->setSpacing(0);
+
+    QIcon sharedIcon = QFontIconEngine::icon(fa::v5::beer);
+
+    for(int i = 0; i < count; ++i)
+    {
+        auto b = new QToolButton;
+        b->setIconSize(QSize(24, 24));
+        b->setIcon(shared ? sharedIcon : QFontIconEngine::icon(icons.at(i % icons.size())));
+        layout->addWidget(b, i / columns, i % columns);
+    }
+
+    window.setWidget(content);
+    window.resize(1280, 800);
+    window.show();
+    QApplication::processEvents();
+
+    s.endSetup();
+
+    QImage target(window.size(), QImage::Format_ARGB32_Premultiplied);
+    auto bar = window.verticalScrollBar();
+
+    for(int f = 0; f < frames; ++f)
+    {
+        s.frame([&]()
+        {
+            bar->setValue(bar->maximum() * f / qMax(1, frames - 1));
+            QApplication::processEvents();
+            render(&window, target);
+        });
+    }
+
+    return s.report();
+}
+
+class IconTableModel : public QAbstractTableModel
+{
+public:
+    IconTableModel(const QVector<int>& icons, QWidget* viewport) :
+        icons(icons)
+    {
+        for(int i = 0; i < icons.size(); ++i)
+            shared.append(QFontIconEngine::icon(icons.at(i)));
+
+        // 50 spinners, spread over the whole table
+        for(int i = 0; i < 50; ++i)
+        {
+            auto engine = new QFontIconEngine(fa::v5::spinner);
+            engine->setWidget(viewport);
+            engine->setSpeed(360);
+            spinners.insert(i * (rows / 50), QIcon(engine));
+        }
+    }
+
+    int rowCount(const QModelIndex& parent = {}) const override { return parent.isValid() ? 0 : rows; }
+    int columnCount(const QModelIndex& parent = {}) const override { return parent.isValid() ? 0 : 3; }
+
+    QVariant data(const QModelIndex& index, int role) const override
+    {
+        if(role == Qt::DecorationRole && index.column() == 0)
+        {
+            auto it = spinners.find(index.row());
+            if(it != spinners.end())
+                return it.value();
+
+            return shared.at(index.row() % shared.size());
+        }
+
+        // Code points for QFontIconDelegate
+        if(role == Qt::UserRole && index.column() == 0)
+            return icons.at(index.row() % icons.size());
+
+        if(role == Qt::DisplayRole)
+            return QStringLiteral("Row %1, column %2").arg(index.row()).arg(index.column());
+
+        return {};
+    }
+
+private:
+    static const int rows = 100000;
+
+    QVector<int> icons;
+    QVector<QIcon> shared;
+    QHash<int, QIcon> spinners;
+};
+
+static QJsonObject iconTable(bool delegate, int frames)
+{
+    Scenario s(delegate ? QStringLiteral("iconTableDelegate") : QStringLiteral("iconTable"));
+
+    s.beginSetup();
+
+    QTableView view;
+    IconTableModel model(availableIcons(), view.viewport());
+    view.setModel(&model);
+    if(delegate)
+        view.setItemDelegateForColumn(0, new QFontIconDelegate(&view));
+    view.verticalHeader()->setDefaultSectionSize(24);
+    view.setIconSize(QSize(20, 20));
+    view.resize(1024, 768);
+    view.show();
+    QApplication::processEvents();
+
+    s.endSetup();
+
+    QImage target(view.size(), QImage::Format_ARGB32_Premultiplied);
+    auto bar = view.verticalScrollBar();
+
+    for(int f = 0; f < frames; ++f)
+    {
+        s.frame([&]()
+        {
+            // Scroll by about a page per frame, letting animation ticks in.
+            bar->setValue((f * 30) % qMax(1, bar->maximum()));
+            QApplication::processEvents();
+            render(&view, target);
+        });
+    }
+
+    return s.report();
+}
+
+static const char* const scenarioNames[] = {
+    "toolButtons/distinct", "toolButtons/shared", "iconTable", "iconTableDelegate"
+};
+
+static QJsonObject runScenario(const QString& name, int frames)
+{
+    fa::register_awesome_metrics();
+    QFontIconEngine::loadFont(QStringLiteral(":/fonts/fa-solid-900.ttf"), fa::solid);
+    QFontIconEngine::setDefaultFont(fa::solid);
+
+    if(name == QLatin1String("toolButtons/distinct"))
+        return toolButtons(false, frames);
+    if(name == QLatin1String("toolButtons/shared"))
+        return toolButtons(true, frames);
+    if(name == QLatin1String("iconTable"))
+        return iconTable(false, frames);
+    if(name == QLatin1String("iconTableDelegate"))
+        return iconTable(true, frames);
+    return {};
+}
+
+// Runs @a name in a child process and returns its report.
+static QJsonObject spawnScenario(const QString& name, int frames)
+{
+    QProcess child;
+    child.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    child.start(QCoreApplication::applicationFilePath(),
+                { QStringLiteral("--scenario"), name, QStringLiteral("--frames"), QString::number(frames) });
+
+    if(!child.waitForFinished(-1) || child.exitStatus() != QProcess::NormalExit || child.exitCode() != 0)
+    {
+        qWarning() << "Scenario" << name << "failed";
+        return {};
+    }
+
+    auto scenarios = QJsonDocument::fromJson(child.readAllStandardOutput()).object().value(QLatin1String("scenarios")).toArray();
+    return scenarios.first().toObject();
+}
+
+int main(int argc, char* argv[])
+{
+    if(!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("QFontIcon scenario benchmarks"));
+    parser.addHelpOption();
+    parser.addOption({ { "o", "output" }, QStringLiteral("Write the JSON report to <file>."), QStringLiteral("file") });
+    parser.addOption({ { "f", "frames" }, QStringLiteral("Frames rendered per scene."), QStringLiteral("count"), QStringLiteral("120") });
+    parser.addOption({ { "s", "scenario" }, QStringLiteral("Only run <name>, in this process."), QStringLiteral("name") });
+    parser.process(app);
+
+    int frames = qMax(1, parser.value(QStringLiteral("frames")).toInt());
+
+    QJsonArray scenarios;
+    if(parser.isSet(QStringLiteral("scenario")))
+    {
+        auto name = parser.value(QStringLiteral("scenario"));
+        auto result = runScenario(name, frames);
+        if(result.isEmpty())
+        {
+            qWarning() << "Unknown scenario" << name;
+            return 1;
+        }
+        scenarios.append(result);
+    }
+    else
+    {
+        for(auto name : scenarioNames)
+        {
+            auto result = spawnScenario(QLatin1String(name), frames);
+            if(result.isEmpty())
+                return 1;
+            scenarios.append(result);
+        }
+    }
+
+    QJsonObject report {
+        { "qt",        QLatin1String(qVersion()) },
+        { "platform",  QGuiApplication::platformName() },
+        { "scenarios", scenarios }
+    };
+
+    auto json = QJsonDocument(report).toJson();
+
+    if(parser.isSet(QStringLiteral("output")))
+    {
+        QFile file(parser.value(QStringLiteral("output")));
+        if(!file.open(QIODevice::WriteOnly))
+        {
+            qWarning() << "Could not write" << file.fileName();
+            return 1;
+        }
+        file.write(json);
+    }
+    else
+    {
+        QFile out;
+        out.open(stdout, QIODevice::WriteOnly);
+        out.write(json);
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+# qfonticon_subset_fonts(<target> QRC <file.qrc> [SOURCES <file>...] [KEEP <icon>...])
+#
+# Adds <file.qrc> to <target> with its TrueType fonts replaced by subsets
+# holding only the icons the sources use, see scripts/subset_fa.py. Resource
+# paths are unchanged. SOURCES defaults to the C++ sources of <target> known
+# when the function is called. KEEP adds icons only chosen at run time, by
+# name or 0x code point.
+
+set(QFONTICON_SCRIPTS_DIR "${CMAKE_CURRENT_LIST_DIR}/../scripts" CACHE INTERNAL "")
+set(QFONTICON_INCLUDE_DIR "${CMAKE_CURRENT_LIST_DIR}/../include" CACHE INTERNAL "")
+
+function(qfonticon_subset_fonts target)
+    cmake_parse_arguments(ARG "" "QRC" "SOURCES;KEEP" ${ARGN})
+    if(NOT ARG_QRC)
+        message(FATAL_ERROR "qfonticon_subset_fonts: no QRC given")
+    endif()
+
+    find_package(Python3 COMPONENTS Interpreter REQUIRED)
+
+    get_filename_component(qrc "${ARG_QRC}" ABSOLUTE)
+    get_filename_component(qrc_dir "${qrc}" DIRECTORY)
+    get_filename_component(qrc_name "${qrc}" NAME)
+    set(output_dir "${CMAKE_CURRENT_BINARY_DIR}/${target}_subset")
+
+    if(NOT ARG_SOURCES)
+        get_target_property(ARG_SOURCES ${target} SOURCES)
+    endif()
+
+    get_target_property(source_dir ${target} SOURCE_DIR)
+    set(sources)
+    foreach(source IN LISTS ARG_SOURCES)
+        if(source MATCHES "\\.(c|cc|cpp|cxx|h|hh|hpp|hxx)$")
+            get_filename_component(source "${source}" ABSOLUTE BASE_DIR "${source_dir}")
+            list(APPEND sources "${source}")
+        endif()
+    endforeach()
+
+    # Same resources, fonts from the output directory and every other file
+    # from the original location.
+    file(READ "${qrc}" content)
+    string(REGEX MATCHALL "<file[^>]*>[^<]*</file>" entries "${content}")
+
+    set(fonts)
+    set(originals)
+    set(subsets)
+    foreach(entry IN LISTS entries)
+        string(REGEX REPLACE "<file([^>]*)>([^<]*)</file>" "\\1" attributes "${entry}")
+        string(REGEX REPLACE "<file([^>]*)>([^<]*)</file>" "\\2" path "${entry}")
+        string(STRIP "${path}" path)
+
+        if(NOT attributes MATCHES "alias=")
+            set(attributes "${attributes} alias=\"${path}\"")
+        endif()
+
+        get_filename_component(file "${path}" ABSOLUTE BASE_DIR "${qrc_dir}")
+        if(path MATCHES "\\.ttf$")
+            list(APPEND fonts --font "${file}" "${output_dir}/${path}")
+            list(APPEND originals "${file}")
+            list(APPEND subsets "${output_dir}/${path}")
+            set(file "${output_dir}/${path}")
+        endif()
+
+        string(REPLACE "${entry}" "<file${attributes}>${file}</file>" content "${content}")
+    endforeach()
+
+    # Only touched when the resources change, so rcc does not run again
+    file(WRITE "${output_dir}/${qrc_name}.in" "${content}")
+    configure_file("${output_dir}/${qrc_name}.in" "${output_dir}/${qrc_name}" COPYONLY)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${qrc}")
+
+    # Sources are passed in a file, there may be too many for a command line
+    string(REPLACE ";" "\n" source_list "${sources}")
+    file(WRITE "${output_dir}/sources.txt.in" "${source_list}\n")
+    configure_file("${output_dir}/sources.txt.in" "${output_dir}/sources.txt" COPYONLY)
+
+    set(keep)
+    if(ARG_KEEP)
+        set(keep --keep ${ARG_KEEP})
+    endif()
+
+    add_custom_command(
+        OUTPUT ${subsets}
+        COMMAND ${Python3_EXECUTABLE} "${QFONTICON_SCRIPTS_DIR}/subset_fa.py" ${fonts} ${keep}
+                --sources "@${output_dir}/sources.txt"
+        DEPENDS ${originals} ${sources} "${output_dir}/sources.txt"
+                "${QFONTICON_SCRIPTS_DIR}/subset_fa.py" "${QFONTICON_SCRIPTS_DIR}/generate_fa.py"
+                "${QFONTICON_INCLUDE_DIR}/awesome.h" "${QFONTICON_INCLUDE_DIR}/awesome_names.h"
+        COMMENT "Subsetting the fonts of ${qrc_name} for ${target}"
+        VERBATIM)
+
+    set_source_files_properties("${output_dir}/${qrc_name}" PROPERTIES SKIP_AUTORCC ON)
+    if(COMMAND qt6_add_resources)
+        qt6_add_resources(resources "${output_dir}/${qrc_name}")
+    else()
+        qt5_add_resources(resources "${output_dir}/${qrc_name}")
+    endif()
+
+    target_sources(${target} PRIVATE ${resources})
+endfunction()
@@ -34,6 +34,7 @@ int main(int argc, char *argv[])
     QObject::connect(&app, &QApplication::paletteChanged, updatePalette);
     // === end of the trick
 
+    fa::register_awesome_metrics();
     QFontIconEngine::loadFont(":/fonts/fa-solid-900.ttf");
 
     QMainWindow w;
@@ -73,6 +74,22 @@ int main(int argc, char *argv[])
         layout->addWidget(toggleButton);
     }
 
+    // an icon picker over the whole font
+    //==============================
+    {
+        QPushButton* pickedButton = new QPushButton("Pick an icon below");
+        QFontIconPicker* picker = new QFontIconPicker();
+        picker->setIconFont(fa::solid);
+
+        QObject::connect(picker, &QFontIconPicker::iconActivated, [pickedButton, picker](int icon)
+        {
+            pickedButton->setIcon(QFontIconEngine::icon(icon, picker->iconFont()));
+        });
+
+        layout->addWidget(pickedButton);
+        layout->addWidget(picker);
+    }
+
 
     // add the samples
     QWidget* samples = new QWidget();
@@ -2323,8 +2323,11 @@ enum icons {
     youtube_square                      = 0xf431,
     zhihu                               = 0xf63f,
 };
-  
-bool register_awesome_names();
+
+// When lazy, no name is copied: a resolver querying the static tables of
+// awesome_names.h is installed instead.
+bool register_awesome_names(bool lazy = false);
+
 }
 
 namespace v6 {
@@ -4178,12 +4181,16 @@ enum icons {
     zhihu                                  = 0xf63f,
 };
 
-bool register_awesome_names();
-
-}
+// When lazy, no name is copied: a resolver querying the static tables of
+// awesome_names.h is installed instead.
+bool register_awesome_names(bool lazy = false);
 
 }
 
+// Registers the glyph metrics of the fonts this file was generated
+// against, see QFontIconEngine::registerGlyphMetrics().
+bool register_awesome_metrics();
 
+}
 
 #endif // AWESOME_H
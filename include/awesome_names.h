@@ -0,0 +1,8446 @@
+#ifndef AWESOME_NAMES_H
+#define AWESOME_NAMES_H
+
+#include <awesome.h>
+
+/**
+ * This file has been automatically generated.
+ */
+
+namespace fa {
+
+namespace detail {
+
+struct name_entry
+{
+    const char* name;
+    int         code;
+};
+
+// Deliberately not constexpr: reaching it while evaluating a constant
+// expression is what turns an unknown icon name into a compile error.
+// At runtime it yields QFontIconEngine::InvalidIcon.
+inline int unknown_icon_name() { return -1; }
+
+constexpr int compare(const char* a, const char* b)
+{
+    return *a != *b ? (*a < *b ? -1 : 1)
+         : *a == 0  ? 0
+                    : compare(a + 1, b + 1);
+}
+
+constexpr int find(const name_entry* table, int first, int last, const char* name);
+
+constexpr int find_step(const name_entry* table, int first, int last, int mid, int cmp, const char* name)
+{
+    return cmp == 0 ? table[mid].code
+         : cmp < 0  ? find(table, first, mid, name)
+                    : find(table, mid + 1, last, name);
+}
+
+constexpr int find(const name_entry* table, int first, int last, const char* name)
+{
+    return first >= last ? unknown_icon_name()
+         : find_step(table, first, last, first + (last - first) / 2,
+                     compare(name, table[first + (last - first) / 2].name), name);
+}
+
+constexpr const char* find_name(const name_entry* table, int first, int last, int mid, int code)
+{
+    return first >= last          ? nullptr
+         : table[mid].code == code ? table[mid].name
+         : table[mid].code > code  ? find_name(table, first, mid, first + (mid - first) / 2, code)
+                                   : find_name(table, mid + 1, last, mid + 1 + (last - mid - 1) / 2, code);
+}
+
+}
+
+namespace v5 {
+
+constexpr detail::name_entry icon_names[] = {
+    { "500px"                              , _500px                              },
+    { "abacus"                             , abacus                              },
+    { "accessible-icon"                    , accessible_icon                     },
+    { "accusoft"                           , accusoft                            },
+    { "acorn"                              , acorn                               },
+    { "acquisitions-incorporated"          , acquisitions_incorporated           },
+    { "ad"                                 , ad                                  },
+    { "address-book"                       , address_book                        },
+    { "address-card"                       , address_card                        },
+    { "adjust"                             , adjust                              },
+    { "adn"                                , adn                                 },
+    { "adversal"                           , adversal                            },
+    { "affiliatetheme"                     , affiliatetheme                      },
+    { "air-conditioner"                    , air_conditioner                     },
+    { "air-freshener"                      , air_freshener                       },
+    { "airbnb"                             , airbnb                              },
+    { "alarm-clock"                        , alarm_clock                         },
+    { "alarm-exclamation"                  , alarm_exclamation                   },
+    { "alarm-plus"                         , alarm_plus                          },
+    { "alarm-snooze"                       , alarm_snooze                        },
+    { "album"                              , album                               },
+    { "album-collection"                   , album_collection                    },
+    { "algolia"                            , algolia                             },
+    { "alicorn"                            , alicorn                             },
+    { "alien"                              , alien                               },
+    { "alien-monster"                      , alien_monster                       },
+    { "align-center"                       , align_center                        },
+    { "align-justify"                      , align_justify                       },
+    { "align-left"                         , align_left                          },
+    { "align-right"                        , align_right                         },
+    { "align-slash"                        , align_slash                         },
+    { "alipay"                             , alipay                              },
+    { "allergies"                          , allergies                           },
+    { "amazon"                             , amazon                              },
+    { "amazon-pay"                         , amazon_pay                          },
+    { "ambulance"                          , ambulance                           },
+    { "american-sign-language-interpreting", american_sign_language_interpreting },
+    { "amilia"                             , amilia                              },
+    { "amp-guitar"                         , amp_guitar                          },
+    { "analytics"                          , analytics                           },
+    { "anchor"                             , anchor                              },
+    { "android"                            , android                             },
+    { "angel"                              , angel                               },
+    { "angellist"                          , angellist                           },
+    { "angle-double-down"                  , angle_double_down                   },
+    { "angle-double-left"                  , angle_double_left                   },
+    { "angle-double-right"                 , angle_double_right                  },
+    { "angle-double-up"                    , angle_double_up                     },
+    { "angle-down"                         , angle_down                          },
+    { "angle-left"                         , angle_left                          },
+    { "angle-right"                        , angle_right                         },
+    { "angle-up"                           , angle_up                            },
+    { "angry"                              , angry                               },
+    { "angrycreative"                      , angrycreative                       },
+    { "angular"                            , angular                             },
+    { "ankh"                               , ankh                                },
+    { "app-store"                          , app_store                           },
+    { "app-store-ios"                      , app_store_ios                       },
+    { "apper"                              , apper                               },
+    { "apple"                              , apple                               },
+    { "apple-alt"                          , apple_alt                           },
+    { "apple-crate"                        , apple_crate                         },
+    { "apple-pay"                          , apple_pay                           },
+    { "archive"                            , archive                             },
+    { "archway"                            , archway                             },
+    { "arrow-alt-circle-down"              , arrow_alt_circle_down               },
+    { "arrow-alt-circle-left"              , arrow_alt_circle_left               },
+    { "arrow-alt-circle-right"             , arrow_alt_circle_right              },
+    { "arrow-alt-circle-up"                , arrow_alt_circle_up                 },
+    { "arrow-alt-down"                     , arrow_alt_down                      },
+    { "arrow-alt-from-bottom"              , arrow_alt_from_bottom               },
+    { "arrow-alt-from-left"                , arrow_alt_from_left                 },
+    { "arrow-alt-from-right"               , arrow_alt_from_right                },
+    { "arrow-alt-from-top"                 , arrow_alt_from_top                  },
+    { "arrow-alt-left"                     , arrow_alt_left                      },
+    { "arrow-alt-right"                    , arrow_alt_right                     },
+    { "arrow-alt-square-down"              , arrow_alt_square_down               },
+    { "arrow-alt-square-left"              , arrow_alt_square_left               },
+    { "arrow-alt-square-right"             , arrow_alt_square_right              },
+    { "arrow-alt-square-up"                , arrow_alt_square_up                 },
+    { "arrow-alt-to-bottom"                , arrow_alt_to_bottom                 },
+    { "arrow-alt-to-left"                  , arrow_alt_to_left                   },
+    { "arrow-alt-to-right"                 , arrow_alt_to_right                  },
+    { "arrow-alt-to-top"                   , arrow_alt_to_top                    },
+    { "arrow-alt-up"                       , arrow_alt_up                        },
+    { "arrow-circle-down"                  , arrow_circle_down                   },
+    { "arrow-circle-left"                  , arrow_circle_left                   },
+    { "arrow-circle-right"                 , arrow_circle_right                  },
+    { "arrow-circle-up"                    , arrow_circle_up                     },
+    { "arrow-down"                         , arrow_down                          },
+    { "arrow-from-bottom"                  , arrow_from_bottom                   },
+    { "arrow-from-left"                    , arrow_from_left                     },
+    { "arrow-from-right"                   , arrow_from_right                    },
+    { "arrow-from-top"                     , arrow_from_top                      },
+    { "arrow-left"                         , arrow_left                          },
+    { "arrow-right"                        , arrow_right                         },
+    { "arrow-square-down"                  , arrow_square_down                   },
+    { "arrow-square-left"                  , arrow_square_left                   },
+    { "arrow-square-right"                 , arrow_square_right                  },
+    { "arrow-square-up"                    , arrow_square_up                     },
+    { "arrow-to-bottom"                    , arrow_to_bottom                     },
+    { "arrow-to-left"                      , arrow_to_left                       },
+    { "arrow-to-right"                     , arrow_to_right                      },
+    { "arrow-to-top"                       , arrow_to_top                        },
+    { "arrow-up"                           , arrow_up                            },
+    { "arrows"                             , arrows                              },
+    { "arrows-alt"                         , arrows_alt                          },
+    { "arrows-alt-h"                       , arrows_alt_h                        },
+    { "arrows-alt-v"                       , arrows_alt_v                        },
+    { "arrows-h"                           , arrows_h                            },
+    { "arrows-v"                           , arrows_v                            },
+    { "artstation"                         , artstation                          },
+    { "assistive-listening-systems"        , assistive_listening_systems         },
+    { "asterisk"                           , asterisk                            },
+    { "asymmetrik"                         , asymmetrik                          },
+    { "at"                                 , at                                  },
+    { "atlas"                              , atlas                               },
+    { "atlassian"                          , atlassian                           },
+    { "atom"                               , atom                                },
+    { "atom-alt"                           , atom_alt                            },
+    { "audible"                            , audible                             },
+    { "audio-description"                  , audio_description                   },
+    { "autoprefixer"                       , autoprefixer                        },
+    { "avianex"                            , avianex                             },
+    { "aviato"                             , aviato                              },
+    { "award"                              , award                               },
+    { "aws"                                , aws                                 },
+    { "axe"                                , axe                                 },
+    { "axe-battle"                         , axe_battle                          },
+    { "baby"                               , baby                                },
+    { "baby-carriage"                      , baby_carriage                       },
+    { "backpack"                           , backpack                            },
+    { "backspace"                          , backspace                           },
+    { "backward"                           , backward                            },
+    { "bacon"                              , bacon                               },
+    { "bacteria"                           , bacteria                            },
+    { "bacterium"                          , bacterium                           },
+    { "badge"                              , badge                               },
+    { "badge-check"                        , badge_check                         },
+    { "badge-dollar"                       , badge_dollar                        },
+    { "badge-percent"                      , badge_percent                       },
+    { "badge-sheriff"                      , badge_sheriff                       },
+    { "badger-honey"                       , badger_honey                        },
+    { "bags-shopping"                      , bags_shopping                       },
+    { "bahai"                              , bahai                               },
+    { "balance-scale"                      , balance_scale                       },
+    { "balance-scale-left"                 , balance_scale_left                  },
+    { "balance-scale-right"                , balance_scale_right                 },
+    { "ball-pile"                          , ball_pile                           },
+    { "ballot"                             , ballot                              },
+    { "ballot-check"                       , ballot_check                        },
+    { "ban"                                , ban                                 },
+    { "band-aid"                           , band_aid                            },
+    { "bandcamp"                           , bandcamp                            },
+    { "banjo"                              , banjo                               },
+    { "barcode"                            , barcode                             },
+    { "barcode-alt"                        , barcode_alt                         },
+    { "barcode-read"                       , barcode_read                        },
+    { "barcode-scan"                       , barcode_scan                        },
+    { "bars"                               , bars                                },
+    { "baseball"                           , baseball                            },
+    { "baseball-ball"                      , baseball_ball                       },
+    { "basketball-ball"                    , basketball_ball                     },
+    { "basketball-hoop"                    , basketball_hoop                     },
+    { "bat"                                , bat                                 },
+    { "bath"                               , bath                                },
+    { "battery-bolt"                       , battery_bolt                        },
+    { "battery-empty"                      , battery_empty                       },
+    { "battery-full"                       , battery_full                        },
+    { "battery-half"                       , battery_half                        },
+    { "battery-quarter"                    , battery_quarter                     },
+    { "battery-slash"                      , battery_slash                       },
+    { "battery-three-quarters"             , battery_three_quarters              },
+    { "battle-net"                         , battle_net                          },
+    { "bed"                                , bed                                 },
+    { "bed-alt"                            , bed_alt                             },
+    { "bed-bunk"                           , bed_bunk                            },
+    { "bed-empty"                          , bed_empty                           },
+    { "beer"                               , beer                                },
+    { "behance"                            , behance                             },
+    { "behance-square"                     , behance_square                      },
+    { "bell"                               , bell                                },
+    { "bell-exclamation"                   , bell_exclamation                    },
+    { "bell-on"                            , bell_on                             },
+    { "bell-plus"                          , bell_plus                           },
+    { "bell-school"                        , bell_school                         },
+    { "bell-school-slash"                  , bell_school_slash                   },
+    { "bell-slash"                         , bell_slash                          },
+    { "bells"                              , bells                               },
+    { "betamax"                            , betamax                             },
+    { "bezier-curve"                       , bezier_curve                        },
+    { "bible"                              , bible                               },
+    { "bicycle"                            , bicycle                             },
+    { "biking"                             , biking                              },
+    { "biking-mountain"                    , biking_mountain                     },
+    { "bimobject"                          , bimobject                           },
+    { "binoculars"                         , binoculars                          },
+    { "biohazard"                          , biohazard                           },
+    { "birthday-cake"                      , birthday_cake                       },
+    { "bitbucket"                          , bitbucket                           },
+    { "bitcoin"                            , bitcoin                             },
+    { "bity"                               , bity                                },
+    { "black-tie"                          , black_tie                           },
+    { "blackberry"                         , blackberry                          },
+    { "blanket"                            , blanket                             },
+    { "blender"                            , blender                             },
+    { "blender-phone"                      , blender_phone                       },
+    { "blind"                              , blind                               },
+    { "blinds"                             , blinds                              },
+    { "blinds-open"                        , blinds_open                         },
+    { "blinds-raised"                      , blinds_raised                       },
+    { "blog"                               , blog                                },
+    { "blogger"                            , blogger                             },
+    { "blogger-b"                          , blogger_b                           },
+    { "bluetooth"                          , bluetooth                           },
+    { "bluetooth-b"                        , bluetooth_b                         },
+    { "bold"                               , bold                                },
+    { "bolt"                               , bolt                                },
+    { "bomb"                               , bomb                                },
+    { "bone"                               , bone                                },
+    { "bone-break"                         , bone_break                          },
+    { "bong"                               , bong                                },
+    { "book"                               , book                                },
+    { "book-alt"                           , book_alt                            },
+    { "book-dead"                          , book_dead                           },
+    { "book-heart"                         , book_heart                          },
+    { "book-medical"                       , book_medical                        },
+    { "book-open"                          , book_open                           },
+    { "book-reader"                        , book_reader                         },
+    { "book-spells"                        , book_spells                         },
+    { "book-user"                          , book_user                           },
+    { "bookmark"                           , bookmark                            },
+    { "books"                              , books                               },
+    { "books-medical"                      , books_medical                       },
+    { "boombox"                            , boombox                             },
+    { "boot"                               , boot                                },
+    { "booth-curtain"                      , booth_curtain                       },
+    { "bootstrap"                          , bootstrap                           },
+    { "border-all"                         , border_all                          },
+    { "border-bottom"                      , border_bottom                       },
+    { "border-center-h"                    , border_center_h                     },
+    { "border-center-v"                    , border_center_v                     },
+    { "border-inner"                       , border_inner                        },
+    { "border-left"                        , border_left                         },
+    { "border-none"                        , border_none                         },
+    { "border-outer"                       , border_outer                        },
+    { "border-right"                       , border_right                        },
+    { "border-style"                       , border_style                        },
+    { "border-style-alt"                   , border_style_alt                    },
+    { "border-top"                         , border_top                          },
+    { "bow-arrow"                          , bow_arrow                           },
+    { "bowling-ball"                       , bowling_ball                        },
+    { "bowling-pins"                       , bowling_pins                        },
+    { "box"                                , box                                 },
+    { "box-alt"                            , box_alt                             },
+    { "box-ballot"                         , box_ballot                          },
+    { "box-check"                          , box_check                           },
+    { "box-fragile"                        , box_fragile                         },
+    { "box-full"                           , box_full                            },
+    { "box-heart"                          , box_heart                           },
+    { "box-open"                           , box_open                            },
+    { "box-tissue"                         , box_tissue                          },
+    { "box-up"                             , box_up                              },
+    { "box-usd"                            , box_usd                             },
+    { "boxes"                              , boxes                               },
+    { "boxes-alt"                          , boxes_alt                           },
+    { "boxing-glove"                       , boxing_glove                        },
+    { "brackets"                           , brackets                            },
+    { "brackets-curly"                     , brackets_curly                      },
+    { "braille"                            , braille                             },
+    { "brain"                              , brain                               },
+    { "bread-loaf"                         , bread_loaf                          },
+    { "bread-slice"                        , bread_slice                         },
+    { "briefcase"                          , briefcase                           },
+    { "briefcase-medical"                  , briefcase_medical                   },
+    { "bring-forward"                      , bring_forward                       },
+    { "bring-front"                        , bring_front                         },
+    { "broadcast-tower"                    , broadcast_tower                     },
+    { "broom"                              , broom                               },
+    { "browser"                            , browser                             },
+    { "brush"                              , brush                               },
+    { "btc"                                , btc                                 },
+    { "buffer"                             , buffer                              },
+    { "bug"                                , bug                                 },
+    { "building"                           , building                            },
+    { "bullhorn"                           , bullhorn                            },
+    { "bullseye"                           , bullseye                            },
+    { "bullseye-arrow"                     , bullseye_arrow                      },
+    { "bullseye-pointer"                   , bullseye_pointer                    },
+    { "burger-soda"                        , burger_soda                         },
+    { "burn"                               , burn                                },
+    { "buromobelexperte"                   , buromobelexperte                    },
+    { "burrito"                            , burrito                             },
+    { "bus"                                , bus                                 },
+    { "bus-alt"                            , bus_alt                             },
+    { "bus-school"                         , bus_school                          },
+    { "business-time"                      , business_time                       },
+    { "buy-n-large"                        , buy_n_large                         },
+    { "buysellads"                         , buysellads                          },
+    { "cabinet-filing"                     , cabinet_filing                      },
+    { "cactus"                             , cactus                              },
+    { "calculator"                         , calculator                          },
+    { "calculator-alt"                     , calculator_alt                      },
+    { "calendar"                           , calendar                            },
+    { "calendar-alt"                       , calendar_alt                        },
+    { "calendar-check"                     , calendar_check                      },
+    { "calendar-day"                       , calendar_day                        },
+    { "calendar-edit"                      , calendar_edit                       },
+    { "calendar-exclamation"               , calendar_exclamation                },
+    { "calendar-minus"                     , calendar_minus                      },
+    { "calendar-plus"                      , calendar_plus                       },
+    { "calendar-star"                      , calendar_star                       },
+    { "calendar-times"                     , calendar_times                      },
+    { "calendar-week"                      , calendar_week                       },
+    { "camcorder"                          , camcorder                           },
+    { "camera"                             , camera                              },
+    { "camera-alt"                         , camera_alt                          },
+    { "camera-home"                        , camera_home                         },
+    { "camera-movie"                       , camera_movie                        },
+    { "camera-polaroid"                    , camera_polaroid                     },
+    { "camera-retro"                       , camera_retro                        },
+    { "campfire"                           , campfire                            },
+    { "campground"                         , campground                          },
+    { "canadian-maple-leaf"                , canadian_maple_leaf                 },
+    { "candle-holder"                      , candle_holder                       },
+    { "candy-cane"                         , candy_cane                          },
+    { "candy-corn"                         , candy_corn                          },
+    { "cannabis"                           , cannabis                            },
+    { "capsules"                           , capsules                            },
+    { "car"                                , car                                 },
+    { "car-alt"                            , car_alt                             },
+    { "car-battery"                        , car_battery                         },
+    { "car-building"                       , car_building                        },
+    { "car-bump"                           , car_bump                            },
+    { "car-bus"                            , car_bus                             },
+    { "car-crash"                          , car_crash                           },
+    { "car-garage"                         , car_garage                          },
+    { "car-mechanic"                       , car_mechanic                        },
+    { "car-side"                           , car_side                            },
+    { "car-tilt"                           , car_tilt                            },
+    { "car-wash"                           , car_wash                            },
+    { "caravan"                            , caravan                             },
+    { "caravan-alt"                        , caravan_alt                         },
+    { "caret-circle-down"                  , caret_circle_down                   },
+    { "caret-circle-left"                  , caret_circle_left                   },
+    { "caret-circle-right"                 , caret_circle_right                  },
+    { "caret-circle-up"                    , caret_circle_up                     },
+    { "caret-down"                         , caret_down                          },
+    { "caret-left"                         , caret_left                          },
+    { "caret-right"                        , caret_right                         },
+    { "caret-square-down"                  , caret_square_down                   },
+    { "caret-square-left"                  , caret_square_left                   },
+    { "caret-square-right"                 , caret_square_right                  },
+    { "caret-square-up"                    , caret_square_up                     },
+    { "caret-up"                           , caret_up                            },
+    { "carrot"                             , carrot                              },
+    { "cars"                               , cars                                },
+    { "cart-arrow-down"                    , cart_arrow_down                     },
+    { "cart-plus"                          , cart_plus                           },
+    { "cash-register"                      , cash_register                       },
+    { "cassette-tape"                      , cassette_tape                       },
+    { "cat"                                , cat                                 },
+    { "cat-space"                          , cat_space                           },
+    { "cauldron"                           , cauldron                            },
+    { "cc-amazon-pay"                      , cc_amazon_pay                       },
+    { "cc-amex"                            , cc_amex                             },
+    { "cc-apple-pay"                       , cc_apple_pay                        },
+    { "cc-diners-club"                     , cc_diners_club                      },
+    { "cc-discover"                        , cc_discover                         },
+    { "cc-jcb"                             , cc_jcb                              },
+    { "cc-mastercard"                      , cc_mastercard                       },
+    { "cc-paypal"                          , cc_paypal                           },
+    { "cc-stripe"                          , cc_stripe                           },
+    { "cc-visa"                            , cc_visa                             },
+    { "cctv"                               , cctv                                },
+    { "centercode"                         , centercode                          },
+    { "centos"                             , centos                              },
+    { "certificate"                        , certificate                         },
+    { "chair"                              , chair                               },
+    { "chair-office"                       , chair_office                        },
+    { "chalkboard"                         , chalkboard                          },
+    { "chalkboard-teacher"                 , chalkboard_teacher                  },
+    { "charging-station"                   , charging_station                    },
+    { "chart-area"                         , chart_area                          },
+    { "chart-bar"                          , chart_bar                           },
+    { "chart-line"                         , chart_line                          },
+    { "chart-line-down"                    , chart_line_down                     },
+    { "chart-network"                      , chart_network                       },
+    { "chart-pie"                          , chart_pie                           },
+    { "chart-pie-alt"                      , chart_pie_alt                       },
+    { "chart-scatter"                      , chart_scatter                       },
+    { "check"                              , check                               },
+    { "check-circle"                       , check_circle                        },
+    { "check-double"                       , check_double                        },
+    { "check-square"                       , check_square                        },
+    { "cheese"                             , cheese                              },
+    { "cheese-swiss"                       , cheese_swiss                        },
+    { "cheeseburger"                       , cheeseburger                        },
+    { "chess"                              , chess                               },
+    { "chess-bishop"                       , chess_bishop                        },
+    { "chess-bishop-alt"                   , chess_bishop_alt                    },
+    { "chess-board"                        , chess_board                         },
+    { "chess-clock"                        , chess_clock                         },
+    { "chess-clock-alt"                    , chess_clock_alt                     },
+    { "chess-king"                         , chess_king                          },
+    { "chess-king-alt"                     , chess_king_alt                      },
+    { "chess-knight"                       , chess_knight                        },
+    { "chess-knight-alt"                   , chess_knight_alt                    },
+    { "chess-pawn"                         , chess_pawn                          },
+    { "chess-pawn-alt"                     , chess_pawn_alt                      },
+    { "chess-queen"                        , chess_queen                         },
+    { "chess-queen-alt"                    , chess_queen_alt                     },
+    { "chess-rook"                         , chess_rook                          },
+    { "chess-rook-alt"                     , chess_rook_alt                      },
+    { "chevron-circle-down"                , chevron_circle_down                 },
+    { "chevron-circle-left"                , chevron_circle_left                 },
+    { "chevron-circle-right"               , chevron_circle_right                },
+    { "chevron-circle-up"                  , chevron_circle_up                   },
+    { "chevron-double-down"                , chevron_double_down                 },
+    { "chevron-double-left"                , chevron_double_left                 },
+    { "chevron-double-right"               , chevron_double_right                },
+    { "chevron-double-up"                  , chevron_double_up                   },
+    { "chevron-down"                       , chevron_down                        },
+    { "chevron-left"                       , chevron_left                        },
+    { "chevron-right"                      , chevron_right                       },
+    { "chevron-square-down"                , chevron_square_down                 },
+    { "chevron-square-left"                , chevron_square_left                 },
+    { "chevron-square-right"               , chevron_square_right                },
+    { "chevron-square-up"                  , chevron_square_up                   },
+    { "chevron-up"                         , chevron_up                          },
+    { "child"                              , child                               },
+    { "chimney"                            , chimney                             },
+    { "chrome"                             , chrome                              },
+    { "chromecast"                         , chromecast                          },
+    { "church"                             , church                              },
+    { "circle"                             , circle                              },
+    { "circle-notch"                       , circle_notch                        },
+    { "city"                               , city                                },
+    { "clarinet"                           , clarinet                            },
+    { "claw-marks"                         , claw_marks                          },
+    { "clinic-medical"                     , clinic_medical                      },
+    { "clipboard"                          , clipboard                           },
+    { "clipboard-check"                    , clipboard_check                     },
+    { "clipboard-list"                     , clipboard_list                      },
+    { "clipboard-list-check"               , clipboard_list_check                },
+    { "clipboard-prescription"             , clipboard_prescription              },
+    { "clipboard-user"                     , clipboard_user                      },
+    { "clock"                              , clock                               },
+    { "clone"                              , clone                               },
+    { "closed-captioning"                  , closed_captioning                   },
+    { "cloud"                              , cloud                               },
+    { "cloud-download"                     , cloud_download                      },
+    { "cloud-download-alt"                 , cloud_download_alt                  },
+    { "cloud-drizzle"                      , cloud_drizzle                       },
+    { "cloud-hail"                         , cloud_hail                          },
+    { "cloud-hail-mixed"                   , cloud_hail_mixed                    },
+    { "cloud-meatball"                     , cloud_meatball                      },
+    { "cloud-moon"                         , cloud_moon                          },
+    { "cloud-moon-rain"                    , cloud_moon_rain                     },
+    { "cloud-music"                        , cloud_music                         },
+    { "cloud-rain"                         , cloud_rain                          },
+    { "cloud-rainbow"                      , cloud_rainbow                       },
+    { "cloud-showers"                      , cloud_showers                       },
+    { "cloud-showers-heavy"                , cloud_showers_heavy                 },
+    { "cloud-sleet"                        , cloud_sleet                         },
+    { "cloud-snow"                         , cloud_snow                          },
+    { "cloud-sun"                          , cloud_sun                           },
+    { "cloud-sun-rain"                     , cloud_sun_rain                      },
+    { "cloud-upload"                       , cloud_upload                        },
+    { "cloud-upload-alt"                   , cloud_upload_alt                    },
+    { "cloudflare"                         , cloudflare                          },
+    { "clouds"                             , clouds                              },
+    { "clouds-moon"                        , clouds_moon                         },
+    { "clouds-sun"                         , clouds_sun                          },
+    { "cloudscale"                         , cloudscale                          },
+    { "cloudsmith"                         , cloudsmith                          },
+    { "cloudversify"                       , cloudversify                        },
+    { "club"                               , club                                },
+    { "cocktail"                           , cocktail                            },
+    { "code"                               , code                                },
+    { "code-branch"                        , code_branch                         },
+    { "code-commit"                        , code_commit                         },
+    { "code-merge"                         , code_merge                          },
+    { "codepen"                            , codepen                             },
+    { "codiepie"                           , codiepie                            },
+    { "coffee"                             , coffee                              },
+    { "coffee-pot"                         , coffee_pot                          },
+    { "coffee-togo"                        , coffee_togo                         },
+    { "coffin"                             , coffin                              },
+    { "coffin-cross"                       , coffin_cross                        },
+    { "cog"                                , cog                                 },
+    { "cogs"                               , cogs                                },
+    { "coin"                               , coin                                },
+    { "coins"                              , coins                               },
+    { "columns"                            , columns                             },
+    { "comet"                              , comet                               },
+    { "comment"                            , comment                             },
+    { "comment-alt"                        , comment_alt                         },
+    { "comment-alt-check"                  , comment_alt_check                   },
+    { "comment-alt-dollar"                 , comment_alt_dollar                  },
+    { "comment-alt-dots"                   , comment_alt_dots                    },
+    { "comment-alt-edit"                   , comment_alt_edit                    },
+    { "comment-alt-exclamation"            , comment_alt_exclamation             },
+    { "comment-alt-lines"                  , comment_alt_lines                   },
+    { "comment-alt-medical"                , comment_alt_medical                 },
+    { "comment-alt-minus"                  , comment_alt_minus                   },
+    { "comment-alt-music"                  , comment_alt_music                   },
+    { "comment-alt-plus"                   , comment_alt_plus                    },
+    { "comment-alt-slash"                  , comment_alt_slash                   },
+    { "comment-alt-smile"                  , comment_alt_smile                   },
+    { "comment-alt-times"                  , comment_alt_times                   },
+    { "comment-check"                      , comment_check                       },
+    { "comment-dollar"                     , comment_dollar                      },
+    { "comment-dots"                       , comment_dots                        },
+    { "comment-edit"                       , comment_edit                        },
+    { "comment-exclamation"                , comment_exclamation                 },
+    { "comment-lines"                      , comment_lines                       },
+    { "comment-medical"                    , comment_medical                     },
+    { "comment-minus"                      , comment_minus                       },
+    { "comment-music"                      , comment_music                       },
+    { "comment-plus"                       , comment_plus                        },
+    { "comment-slash"                      , comment_slash                       },
+    { "comment-smile"                      , comment_smile                       },
+    { "comment-times"                      , comment_times                       },
+    { "comments"                           , comments                            },
+    { "comments-alt"                       , comments_alt                        },
+    { "comments-alt-dollar"                , comments_alt_dollar                 },
+    { "comments-dollar"                    , comments_dollar                     },
+    { "compact-disc"                       , compact_disc                        },
+    { "compass"                            , compass                             },
+    { "compass-slash"                      , compass_slash                       },
+    { "compress"                           , compress                            },
+    { "compress-alt"                       , compress_alt                        },
+    { "compress-arrows-alt"                , compress_arrows_alt                 },
+    { "compress-wide"                      , compress_wide                       },
+    { "computer-classic"                   , computer_classic                    },
+    { "computer-speaker"                   , computer_speaker                    },
+    { "concierge-bell"                     , concierge_bell                      },
+    { "confluence"                         , confluence                          },
+    { "connectdevelop"                     , connectdevelop                      },
+    { "construction"                       , construction                        },
+    { "container-storage"                  , container_storage                   },
+    { "contao"                             , contao                              },
+    { "conveyor-belt"                      , conveyor_belt                       },
+    { "conveyor-belt-alt"                  , conveyor_belt_alt                   },
+    { "cookie"                             , cookie                              },
+    { "cookie-bite"                        , cookie_bite                         },
+    { "copy"                               , copy                                },
+    { "copyright"                          , copyright                           },
+    { "corn"                               , corn                                },
+    { "cotton-bureau"                      , cotton_bureau                       },
+    { "couch"                              , couch                               },
+    { "cow"                                , cow                                 },
+    { "cowbell"                            , cowbell                             },
+    { "cowbell-more"                       , cowbell_more                        },
+    { "cpanel"                             , cpanel                              },
+    { "creative-commons"                   , creative_commons                    },
+    { "creative-commons-by"                , creative_commons_by                 },
+    { "creative-commons-nc"                , creative_commons_nc                 },
+    { "creative-commons-nc-eu"             , creative_commons_nc_eu              },
+    { "creative-commons-nc-jp"             , creative_commons_nc_jp              },
+    { "creative-commons-nd"                , creative_commons_nd                 },
+    { "creative-commons-pd"                , creative_commons_pd                 },
+    { "creative-commons-pd-alt"            , creative_commons_pd_alt             },
+    { "creative-commons-remix"             , creative_commons_remix              },
+    { "creative-commons-sa"                , creative_commons_sa                 },
+    { "creative-commons-sampling"          , creative_commons_sampling           },
+    { "creative-commons-sampling-plus"     , creative_commons_sampling_plus      },
+    { "creative-commons-share"             , creative_commons_share              },
+    { "creative-commons-zero"              , creative_commons_zero               },
+    { "credit-card"                        , credit_card                         },
+    { "credit-card-blank"                  , credit_card_blank                   },
+    { "credit-card-front"                  , credit_card_front                   },
+    { "cricket"                            , cricket                             },
+    { "critical-role"                      , critical_role                       },
+    { "croissant"                          , croissant                           },
+    { "crop"                               , crop                                },
+    { "crop-alt"                           , crop_alt                            },
+    { "cross"                              , cross                               },
+    { "crosshairs"                         , crosshairs                          },
+    { "crow"                               , crow                                },
+    { "crown"                              , crown                               },
+    { "crutch"                             , crutch                              },
+    { "crutches"                           , crutches                            },
+    { "css3"                               , css3                                },
+    { "css3-alt"                           , css3_alt                            },
+    { "cube"                               , cube                                },
+    { "cubes"                              , cubes                               },
+    { "curling"                            , curling                             },
+    { "cut"                                , cut                                 },
+    { "cuttlefish"                         , cuttlefish                          },
+    { "d-and-d"                            , d_and_d                             },
+    { "d-and-d-beyond"                     , d_and_d_beyond                      },
+    { "dagger"                             , dagger                              },
+    { "dailymotion"                        , dailymotion                         },
+    { "dashcube"                           , dashcube                            },
+    { "database"                           , database                            },
+    { "deaf"                               , deaf                                },
+    { "debug"                              , debug                               },
+    { "deer"                               , deer                                },
+    { "deer-rudolph"                       , deer_rudolph                        },
+    { "deezer"                             , deezer                              },
+    { "delicious"                          , delicious                           },
+    { "democrat"                           , democrat                            },
+    { "deploydog"                          , deploydog                           },
+    { "deskpro"                            , deskpro                             },
+    { "desktop"                            , desktop                             },
+    { "desktop-alt"                        , desktop_alt                         },
+    { "dev"                                , dev                                 },
+    { "deviantart"                         , deviantart                          },
+    { "dewpoint"                           , dewpoint                            },
+    { "dharmachakra"                       , dharmachakra                        },
+    { "dhl"                                , dhl                                 },
+    { "diagnoses"                          , diagnoses                           },
+    { "diamond"                            , diamond                             },
+    { "diaspora"                           , diaspora                            },
+    { "dice"                               , dice                                },
+    { "dice-d10"                           , dice_d10                            },
+    { "dice-d12"                           , dice_d12                            },
+    { "dice-d20"                           , dice_d20                            },
+    { "dice-d4"                            , dice_d4                             },
+    { "dice-d6"                            , dice_d6                             },
+    { "dice-d8"                            , dice_d8                             },
+    { "dice-five"                          , dice_five                           },
+    { "dice-four"                          , dice_four                           },
+    { "dice-one"                           , dice_one                            },
+    { "dice-six"                           , dice_six                            },
+    { "dice-three"                         , dice_three                          },
+    { "dice-two"                           , dice_two                            },
+    { "digg"                               , digg                                },
+    { "digging"                            , digging                             },
+    { "digital-ocean"                      , digital_ocean                       },
+    { "digital-tachograph"                 , digital_tachograph                  },
+    { "diploma"                            , diploma                             },
+    { "directions"                         , directions                          },
+    { "disc-drive"                         , disc_drive                          },
+    { "discord"                            , discord                             },
+    { "discourse"                          , discourse                           },
+    { "disease"                            , disease                             },
+    { "divide"                             , divide                              },
+    { "dizzy"                              , dizzy                               },
+    { "dna"                                , dna                                 },
+    { "do-not-enter"                       , do_not_enter                        },
+    { "dochub"                             , dochub                              },
+    { "docker"                             , docker                              },
+    { "dog"                                , dog                                 },
+    { "dog-leashed"                        , dog_leashed                         },
+    { "dollar-sign"                        , dollar_sign                         },
+    { "dolly"                              , dolly                               },
+    { "dolly-empty"                        , dolly_empty                         },
+    { "dolly-flatbed"                      , dolly_flatbed                       },
+    { "dolly-flatbed-alt"                  , dolly_flatbed_alt                   },
+    { "dolly-flatbed-empty"                , dolly_flatbed_empty                 },
+    { "donate"                             , donate                              },
+    { "door-closed"                        , door_closed                         },
+    { "door-open"                          , door_open                           },
+    { "dot-circle"                         , dot_circle                          },
+    { "dove"                               , dove                                },
+    { "download"                           , download                            },
+    { "draft2digital"                      , draft2digital                       },
+    { "drafting-compass"                   , drafting_compass                    },
+    { "dragon"                             , dragon                              },
+    { "draw-circle"                        , draw_circle                         },
+    { "draw-polygon"                       , draw_polygon                        },
+    { "draw-square"                        , draw_square                         },
+    { "dreidel"                            , dreidel                             },
+    { "dribbble"                           , dribbble                            },
+    { "dribbble-square"                    , dribbble_square                     },
+    { "drone"                              , drone                               },
+    { "drone-alt"                          , drone_alt                           },
+    { "dropbox"                            , dropbox                             },
+    { "drum"                               , drum                                },
+    { "drum-steelpan"                      , drum_steelpan                       },
+    { "drumstick"                          , drumstick                           },
+    { "drumstick-bite"                     , drumstick_bite                      },
+    { "drupal"                             , drupal                              },
+    { "dryer"                              , dryer                               },
+    { "dryer-alt"                          , dryer_alt                           },
+    { "duck"                               , duck                                },
+    { "dumbbell"                           , dumbbell                            },
+    { "dumpster"                           , dumpster                            },
+    { "dumpster-fire"                      , dumpster_fire                       },
+    { "dungeon"                            , dungeon                             },
+    { "dyalog"                             , dyalog                              },
+    { "ear"                                , ear                                 },
+    { "ear-muffs"                          , ear_muffs                           },
+    { "earlybirds"                         , earlybirds                          },
+    { "ebay"                               , ebay                                },
+    { "eclipse"                            , eclipse                             },
+    { "eclipse-alt"                        , eclipse_alt                         },
+    { "edge"                               , edge                                },
+    { "edge-legacy"                        , edge_legacy                         },
+    { "edit"                               , edit                                },
+    { "egg"                                , egg                                 },
+    { "egg-fried"                          , egg_fried                           },
+    { "eject"                              , eject                               },
+    { "elementor"                          , elementor                           },
+    { "elephant"                           , elephant                            },
+    { "ellipsis-h"                         , ellipsis_h                          },
+    { "ellipsis-h-alt"                     , ellipsis_h_alt                      },
+    { "ellipsis-v"                         , ellipsis_v                          },
+    { "ellipsis-v-alt"                     , ellipsis_v_alt                      },
+    { "ello"                               , ello                                },
+    { "ember"                              , ember                               },
+    { "empire"                             , empire                              },
+    { "empty-set"                          , empty_set                           },
+    { "engine-warning"                     , engine_warning                      },
+    { "envelope"                           , envelope                            },
+    { "envelope-open"                      , envelope_open                       },
+    { "envelope-open-dollar"               , envelope_open_dollar                },
+    { "envelope-open-text"                 , envelope_open_text                  },
+    { "envelope-square"                    , envelope_square                     },
+    { "envira"                             , envira                              },
+    { "equals"                             , equals                              },
+    { "eraser"                             , eraser                              },
+    { "erlang"                             , erlang                              },
+    { "ethereum"                           , ethereum                            },
+    { "ethernet"                           , ethernet                            },
+    { "etsy"                               , etsy                                },
+    { "euro-sign"                          , euro_sign                           },
+    { "evernote"                           , evernote                            },
+    { "exchange"                           , exchange                            },
+    { "exchange-alt"                       , exchange_alt                        },
+    { "exclamation"                        , exclamation                         },
+    { "exclamation-circle"                 , exclamation_circle                  },
+    { "exclamation-square"                 , exclamation_square                  },
+    { "exclamation-triangle"               , exclamation_triangle                },
+    { "expand"                             , expand                              },
+    { "expand-alt"                         , expand_alt                          },
+    { "expand-arrows"                      , expand_arrows                       },
+    { "expand-arrows-alt"                  , expand_arrows_alt                   },
+    { "expand-wide"                        , expand_wide                         },
+    { "expeditedssl"                       , expeditedssl                        },
+    { "external-link"                      , external_link                       },
+    { "external-link-alt"                  , external_link_alt                   },
+    { "external-link-square"               , external_link_square                },
+    { "external-link-square-alt"           , external_link_square_alt            },
+    { "eye"                                , eye                                 },
+    { "eye-dropper"                        , eye_dropper                         },
+    { "eye-evil"                           , eye_evil                            },
+    { "eye-slash"                          , eye_slash                           },
+    { "facebook"                           , facebook                            },
+    { "facebook-f"                         , facebook_f                          },
+    { "facebook-messenger"                 , facebook_messenger                  },
+    { "facebook-square"                    , facebook_square                     },
+    { "fan"                                , fan                                 },
+    { "fan-table"                          , fan_table                           },
+    { "fantasy-flight-games"               , fantasy_flight_games                },
+    { "farm"                               , farm                                },
+    { "fast-backward"                      , fast_backward                       },
+    { "fast-forward"                       , fast_forward                        },
+    { "faucet"                             , faucet                              },
+    { "faucet-drip"                        , faucet_drip                         },
+    { "fax"                                , fax                                 },
+    { "feather"                            , feather                             },
+    { "feather-alt"                        , feather_alt                         },
+    { "fedex"                              , fedex                               },
+    { "fedora"                             , fedora                              },
+    { "female"                             , female                              },
+    { "field-hockey"                       , field_hockey                        },
+    { "fighter-jet"                        , fighter_jet                         },
+    { "figma"                              , figma                               },
+    { "file"                               , file                                },
+    { "file-alt"                           , file_alt                            },
+    { "file-archive"                       , file_archive                        },
+    { "file-audio"                         , file_audio                          },
+    { "file-certificate"                   , file_certificate                    },
+    { "file-chart-line"                    , file_chart_line                     },
+    { "file-chart-pie"                     , file_chart_pie                      },
+    { "file-check"                         , file_check                          },
+    { "file-code"                          , file_code                           },
+    { "file-contract"                      , file_contract                       },
+    { "file-csv"                           , file_csv                            },
+    { "file-download"                      , file_download                       },
+    { "file-edit"                          , file_edit                           },
+    { "file-excel"                         , file_excel                          },
+    { "file-exclamation"                   , file_exclamation                    },
+    { "file-export"                        , file_export                         },
+    { "file-image"                         , file_image                          },
+    { "file-import"                        , file_import                         },
+    { "file-invoice"                       , file_invoice                        },
+    { "file-invoice-dollar"                , file_invoice_dollar                 },
+    { "file-medical"                       , file_medical                        },
+    { "file-medical-alt"                   , file_medical_alt                    },
+    { "file-minus"                         , file_minus                          },
+    { "file-music"                         , file_music                          },
+    { "file-pdf"                           , file_pdf                            },
+    { "file-plus"                          , file_plus                           },
+    { "file-powerpoint"                    , file_powerpoint                     },
+    { "file-prescription"                  , file_prescription                   },
+    { "file-search"                        , file_search                         },
+    { "file-signature"                     , file_signature                      },
+    { "file-spreadsheet"                   , file_spreadsheet                    },
+    { "file-times"                         , file_times                          },
+    { "file-upload"                        , file_upload                         },
+    { "file-user"                          , file_user                           },
+    { "file-video"                         , file_video                          },
+    { "file-word"                          , file_word                           },
+    { "files-medical"                      , files_medical                       },
+    { "fill"                               , fill                                },
+    { "fill-drip"                          , fill_drip                           },
+    { "film"                               , film                                },
+    { "film-alt"                           , film_alt                            },
+    { "film-canister"                      , film_canister                       },
+    { "filter"                             , filter                              },
+    { "fingerprint"                        , fingerprint                         },
+    { "fire"                               , fire                                },
+    { "fire-alt"                           , fire_alt                            },
+    { "fire-extinguisher"                  , fire_extinguisher                   },
+    { "fire-smoke"                         , fire_smoke                          },
+    { "firefox"                            , firefox                             },
+    { "firefox-browser"                    , firefox_browser                     },
+    { "fireplace"                          , fireplace                           },
+    { "first-aid"                          , first_aid                           },
+    { "first-order"                        , first_order                         },
+    { "first-order-alt"                    , first_order_alt                     },
+    { "firstdraft"                         , firstdraft                          },
+    { "fish"                               , fish                                },
+    { "fish-cooked"                        , fish_cooked                         },
+    { "fist-raised"                        , fist_raised                         },
+    { "flag"                               , flag                                },
+    { "flag-alt"                           , flag_alt                            },
+    { "flag-checkered"                     , flag_checkered                      },
+    { "flag-usa"                           , flag_usa                            },
+    { "flame"                              , flame                               },
+    { "flashlight"                         , flashlight                          },
+    { "flask"                              , flask                               },
+    { "flask-poison"                       , flask_poison                        },
+    { "flask-potion"                       , flask_potion                        },
+    { "flickr"                             , flickr                              },
+    { "flipboard"                          , flipboard                           },
+    { "flower"                             , flower                              },
+    { "flower-daffodil"                    , flower_daffodil                     },
+    { "flower-tulip"                       , flower_tulip                        },
+    { "flushed"                            , flushed                             },
+    { "flute"                              , flute                               },
+    { "flux-capacitor"                     , flux_capacitor                      },
+    { "fly"                                , fly                                 },
+    { "fog"                                , fog                                 },
+    { "folder"                             , folder                              },
+    { "folder-download"                    , folder_download                     },
+    { "folder-minus"                       , folder_minus                        },
+    { "folder-open"                        , folder_open                         },
+    { "folder-plus"                        , folder_plus                         },
+    { "folder-times"                       , folder_times                        },
+    { "folder-tree"                        , folder_tree                         },
+    { "folder-upload"                      , folder_upload                       },
+    { "folders"                            , folders                             },
+    { "font"                               , font                                },
+    { "font-awesome"                       , font_awesome                        },
+    { "font-awesome-alt"                   , font_awesome_alt                    },
+    { "font-awesome-flag"                  , font_awesome_flag                   },
+    { "font-awesome-logo-full"             , font_awesome_logo_full              },
+    { "font-case"                          , font_case                           },
+    { "fonticons"                          , fonticons                           },
+    { "fonticons-fi"                       , fonticons_fi                        },
+    { "football-ball"                      , football_ball                       },
+    { "football-helmet"                    , football_helmet                     },
+    { "forklift"                           , forklift                            },
+    { "fort-awesome"                       , fort_awesome                        },
+    { "fort-awesome-alt"                   , fort_awesome_alt                    },
+    { "forumbee"                           , forumbee                            },
+    { "forward"                            , forward                             },
+    { "foursquare"                         , foursquare                          },
+    { "fragile"                            , fragile                             },
+    { "free-code-camp"                     , free_code_camp                      },
+    { "freebsd"                            , freebsd                             },
+    { "french-fries"                       , french_fries                        },
+    { "frog"                               , frog                                },
+    { "frosty-head"                        , frosty_head                         },
+    { "frown"                              , frown                               },
+    { "frown-open"                         , frown_open                          },
+    { "fulcrum"                            , fulcrum                             },
+    { "function"                           , function                            },
+    { "funnel-dollar"                      , funnel_dollar                       },
+    { "futbol"                             , futbol                              },
+    { "galactic-republic"                  , galactic_republic                   },
+    { "galactic-senate"                    , galactic_senate                     },
+    { "galaxy"                             , galaxy                              },
+    { "game-board"                         , game_board                          },
+    { "game-board-alt"                     , game_board_alt                      },
+    { "game-console-handheld"              , game_console_handheld               },
+    { "gamepad"                            , gamepad                             },
+    { "gamepad-alt"                        , gamepad_alt                         },
+    { "garage"                             , garage                              },
+    { "garage-car"                         , garage_car                          },
+    { "garage-open"                        , garage_open                         },
+    { "gas-pump"                           , gas_pump                            },
+    { "gas-pump-slash"                     , gas_pump_slash                      },
+    { "gavel"                              , gavel                               },
+    { "gem"                                , gem                                 },
+    { "genderless"                         , genderless                          },
+    { "get-pocket"                         , get_pocket                          },
+    { "gg"                                 , gg                                  },
+    { "gg-circle"                          , gg_circle                           },
+    { "ghost"                              , ghost                               },
+    { "gift"                               , gift                                },
+    { "gift-card"                          , gift_card                           },
+    { "gifts"                              , gifts                               },
+    { "gingerbread-man"                    , gingerbread_man                     },
+    { "git"                                , git                                 },
+    { "git-alt"                            , git_alt                             },
+    { "git-square"                         , git_square                          },
+    { "github"                             , github                              },
+    { "github-alt"                         , github_alt                          },
+    { "github-square"                      , github_square                       },
+    { "gitkraken"                          , gitkraken                           },
+    { "gitlab"                             , gitlab                              },
+    { "gitter"                             , gitter                              },
+    { "glass"                              , glass                               },
+    { "glass-champagne"                    , glass_champagne                     },
+    { "glass-cheers"                       , glass_cheers                        },
+    { "glass-citrus"                       , glass_citrus                        },
+    { "glass-martini"                      , glass_martini                       },
+    { "glass-martini-alt"                  , glass_martini_alt                   },
+    { "glass-whiskey"                      , glass_whiskey                       },
+    { "glass-whiskey-rocks"                , glass_whiskey_rocks                 },
+    { "glasses"                            , glasses                             },
+    { "glasses-alt"                        , glasses_alt                         },
+    { "glide"                              , glide                               },
+    { "glide-g"                            , glide_g                             },
+    { "globe"                              , globe                               },
+    { "globe-africa"                       , globe_africa                        },
+    { "globe-americas"                     , globe_americas                      },
+    { "globe-asia"                         , globe_asia                          },
+    { "globe-europe"                       , globe_europe                        },
+    { "globe-snow"                         , globe_snow                          },
+    { "globe-stand"                        , globe_stand                         },
+    { "gofore"                             , gofore                              },
+    { "golf-ball"                          , golf_ball                           },
+    { "golf-club"                          , golf_club                           },
+    { "goodreads"                          , goodreads                           },
+    { "goodreads-g"                        , goodreads_g                         },
+    { "google"                             , google                              },
+    { "google-drive"                       , google_drive                        },
+    { "google-pay"                         , google_pay                          },
+    { "google-play"                        , google_play                         },
+    { "google-plus"                        , google_plus                         },
+    { "google-plus-g"                      , google_plus_g                       },
+    { "google-plus-square"                 , google_plus_square                  },
+    { "google-wallet"                      , google_wallet                       },
+    { "gopuram"                            , gopuram                             },
+    { "graduation-cap"                     , graduation_cap                      },
+    { "gramophone"                         , gramophone                          },
+    { "gratipay"                           , gratipay                            },
+    { "grav"                               , grav                                },
+    { "greater-than"                       , greater_than                        },
+    { "greater-than-equal"                 , greater_than_equal                  },
+    { "grimace"                            , grimace                             },
+    { "grin"                               , grin                                },
+    { "grin-alt"                           , grin_alt                            },
+    { "grin-beam"                          , grin_beam                           },
+    { "grin-beam-sweat"                    , grin_beam_sweat                     },
+    { "grin-hearts"                        , grin_hearts                         },
+    { "grin-squint"                        , grin_squint                         },
+    { "grin-squint-tears"                  , grin_squint_tears                   },
+    { "grin-stars"                         , grin_stars                          },
+    { "grin-tears"                         , grin_tears                          },
+    { "grin-tongue"                        , grin_tongue                         },
+    { "grin-tongue-squint"                 , grin_tongue_squint                  },
+    { "grin-tongue-wink"                   , grin_tongue_wink                    },
+    { "grin-wink"                          , grin_wink                           },
+    { "grip-horizontal"                    , grip_horizontal                     },
+    { "grip-lines"                         , grip_lines                          },
+    { "grip-lines-vertical"                , grip_lines_vertical                 },
+    { "grip-vertical"                      , grip_vertical                       },
+    { "gripfire"                           , gripfire                            },
+    { "grunt"                              , grunt                               },
+    { "guilded"                            , guilded                             },
+    { "guitar"                             , guitar                              },
+    { "guitar-electric"                    , guitar_electric                     },
+    { "guitars"                            , guitars                             },
+    { "gulp"                               , gulp                                },
+    { "h-square"                           , h_square                            },
+    { "h1"                                 , h1                                  },
+    { "h2"                                 , h2                                  },
+    { "h3"                                 , h3                                  },
+    { "h4"                                 , h4                                  },
+    { "hacker-news"                        , hacker_news                         },
+    { "hacker-news-square"                 , hacker_news_square                  },
+    { "hackerrank"                         , hackerrank                          },
+    { "hamburger"                          , hamburger                           },
+    { "hammer"                             , hammer                              },
+    { "hammer-war"                         , hammer_war                          },
+    { "hamsa"                              , hamsa                               },
+    { "hand-heart"                         , hand_heart                          },
+    { "hand-holding"                       , hand_holding                        },
+    { "hand-holding-box"                   , hand_holding_box                    },
+    { "hand-holding-heart"                 , hand_holding_heart                  },
+    { "hand-holding-magic"                 , hand_holding_magic                  },
+    { "hand-holding-medical"               , hand_holding_medical                },
+    { "hand-holding-seedling"              , hand_holding_seedling               },
+    { "hand-holding-usd"                   , hand_holding_usd                    },
+    { "hand-holding-water"                 , hand_holding_water                  },
+    { "hand-lizard"                        , hand_lizard                         },
+    { "hand-middle-finger"                 , hand_middle_finger                  },
+    { "hand-paper"                         , hand_paper                          },
+    { "hand-peace"                         , hand_peace                          },
+    { "hand-point-down"                    , hand_point_down                     },
+    { "hand-point-left"                    , hand_point_left                     },
+    { "hand-point-right"                   , hand_point_right                    },
+    { "hand-point-up"                      , hand_point_up                       },
+    { "hand-pointer"                       , hand_pointer                        },
+    { "hand-receiving"                     , hand_receiving                      },
+    { "hand-rock"                          , hand_rock                           },
+    { "hand-scissors"                      , hand_scissors                       },
+    { "hand-sparkles"                      , hand_sparkles                       },
+    { "hand-spock"                         , hand_spock                          },
+    { "hands"                              , hands                               },
+    { "hands-heart"                        , hands_heart                         },
+    { "hands-helping"                      , hands_helping                       },
+    { "hands-usd"                          , hands_usd                           },
+    { "hands-wash"                         , hands_wash                          },
+    { "handshake"                          , handshake                           },
+    { "handshake-alt"                      , handshake_alt                       },
+    { "handshake-alt-slash"                , handshake_alt_slash                 },
+    { "handshake-slash"                    , handshake_slash                     },
+    { "hanukiah"                           , hanukiah                            },
+    { "hard-hat"                           , hard_hat                            },
+    { "hashtag"                            , hashtag                             },
+    { "hat-chef"                           , hat_chef                            },
+    { "hat-cowboy"                         , hat_cowboy                          },
+    { "hat-cowboy-side"                    , hat_cowboy_side                     },
+    { "hat-santa"                          , hat_santa                           },
+    { "hat-winter"                         , hat_winter                          },
+    { "hat-witch"                          , hat_witch                           },
+    { "hat-wizard"                         , hat_wizard                          },
+    { "hdd"                                , hdd                                 },
+    { "head-side"                          , head_side                           },
+    { "head-side-brain"                    , head_side_brain                     },
+    { "head-side-cough"                    , head_side_cough                     },
+    { "head-side-cough-slash"              , head_side_cough_slash               },
+    { "head-side-headphones"               , head_side_headphones                },
+    { "head-side-mask"                     , head_side_mask                      },
+    { "head-side-medical"                  , head_side_medical                   },
+    { "head-side-virus"                    , head_side_virus                     },
+    { "head-vr"                            , head_vr                             },
+    { "heading"                            , heading                             },
+    { "headphones"                         , headphones                          },
+    { "headphones-alt"                     , headphones_alt                      },
+    { "headset"                            , headset                             },
+    { "heart"                              , heart                               },
+    { "heart-broken"                       , heart_broken                        },
+    { "heart-circle"                       , heart_circle                        },
+    { "heart-rate"                         , heart_rate                          },
+    { "heart-square"                       , heart_square                        },
+    { "heartbeat"                          , heartbeat                           },
+    { "heat"                               , heat                                },
+    { "helicopter"                         , helicopter                          },
+    { "helmet-battle"                      , helmet_battle                       },
+    { "hexagon"                            , hexagon                             },
+    { "highlighter"                        , highlighter                         },
+    { "hiking"                             , hiking                              },
+    { "hippo"                              , hippo                               },
+    { "hips"                               , hips                                },
+    { "hire-a-helper"                      , hire_a_helper                       },
+    { "history"                            , history                             },
+    { "hive"                               , hive                                },
+    { "hockey-mask"                        , hockey_mask                         },
+    { "hockey-puck"                        , hockey_puck                         },
+    { "hockey-sticks"                      , hockey_sticks                       },
+    { "holly-berry"                        , holly_berry                         },
+    { "home"                               , home                                },
+    { "home-alt"                           , home_alt                            },
+    { "home-heart"                         , home_heart                          },
+    { "home-lg"                            , home_lg                             },
+    { "home-lg-alt"                        , home_lg_alt                         },
+    { "hood-cloak"                         , hood_cloak                          },
+    { "hooli"                              , hooli                               },
+    { "horizontal-rule"                    , horizontal_rule                     },
+    { "hornbill"                           , hornbill                            },
+    { "horse"                              , horse                               },
+    { "horse-head"                         , horse_head                          },
+    { "horse-saddle"                       , horse_saddle                        },
+    { "hospital"                           , hospital                            },
+    { "hospital-alt"                       , hospital_alt                        },
+    { "hospital-symbol"                    , hospital_symbol                     },
+    { "hospital-user"                      , hospital_user                       },
+    { "hospitals"                          , hospitals                           },
+    { "hot-tub"                            , hot_tub                             },
+    { "hotdog"                             , hotdog                              },
+    { "hotel"                              , hotel                               },
+    { "hotjar"                             , hotjar                              },
+    { "hourglass"                          , hourglass                           },
+    { "hourglass-end"                      , hourglass_end                       },
+    { "hourglass-half"                     , hourglass_half                      },
+    { "hourglass-start"                    , hourglass_start                     },
+    { "house"                              , house                               },
+    { "house-damage"                       , house_damage                        },
+    { "house-day"                          , house_day                           },
+    { "house-flood"                        , house_flood                         },
+    { "house-leave"                        , house_leave                         },
+    { "house-night"                        , house_night                         },
+    { "house-return"                       , house_return                        },
+    { "house-signal"                       , house_signal                        },
+    { "house-user"                         , house_user                          },
+    { "houzz"                              , houzz                               },
+    { "hryvnia"                            , hryvnia                             },
+    { "html5"                              , html5                               },
+    { "hubspot"                            , hubspot                             },
+    { "humidity"                           , humidity                            },
+    { "hurricane"                          , hurricane                           },
+    { "i-cursor"                           , i_cursor                            },
+    { "ice-cream"                          , ice_cream                           },
+    { "ice-skate"                          , ice_skate                           },
+    { "icicles"                            , icicles                             },
+    { "icons"                              , icons                               },
+    { "icons-alt"                          , icons_alt                           },
+    { "id-badge"                           , id_badge                            },
+    { "id-card"                            , id_card                             },
+    { "id-card-alt"                        , id_card_alt                         },
+    { "ideal"                              , ideal                               },
+    { "igloo"                              , igloo                               },
+    { "image"                              , image                               },
+    { "image-polaroid"                     , image_polaroid                      },
+    { "images"                             , images                              },
+    { "imdb"                               , imdb                                },
+    { "inbox"                              , inbox                               },
+    { "inbox-in"                           , inbox_in                            },
+    { "inbox-out"                          , inbox_out                           },
+    { "indent"                             , indent                              },
+    { "industry"                           , industry                            },
+    { "industry-alt"                       , industry_alt                        },
+    { "infinity"                           , infinity                            },
+    { "info"                               , info                                },
+    { "info-circle"                        , info_circle                         },
+    { "info-square"                        , info_square                         },
+    { "inhaler"                            , inhaler                             },
+    { "innosoft"                           , innosoft                            },
+    { "instagram"                          , instagram                           },
+    { "instagram-square"                   , instagram_square                    },
+    { "instalod"                           , instalod                            },
+    { "integral"                           , integral                            },
+    { "intercom"                           , intercom                            },
+    { "internet-explorer"                  , internet_explorer                   },
+    { "intersection"                       , intersection                        },
+    { "inventory"                          , inventory                           },
+    { "invision"                           , invision                            },
+    { "ioxhost"                            , ioxhost                             },
+    { "island-tropical"                    , island_tropical                     },
+    { "italic"                             , italic                              },
+    { "itch-io"                            , itch_io                             },
+    { "itunes"                             , itunes                              },
+    { "itunes-note"                        , itunes_note                         },
+    { "jack-o-lantern"                     , jack_o_lantern                      },
+    { "java"                               , java                                },
+    { "jedi"                               , jedi                                },
+    { "jedi-order"                         , jedi_order                          },
+    { "jenkins"                            , jenkins                             },
+    { "jira"                               , jira                                },
+    { "joget"                              , joget                               },
+    { "joint"                              , joint                               },
+    { "joomla"                             , joomla                              },
+    { "journal-whills"                     , journal_whills                      },
+    { "joystick"                           , joystick                            },
+    { "js"                                 , js                                  },
+    { "js-square"                          , js_square                           },
+    { "jsfiddle"                           , jsfiddle                            },
+    { "jug"                                , jug                                 },
+    { "kaaba"                              , kaaba                               },
+    { "kaggle"                             , kaggle                              },
+    { "kazoo"                              , kazoo                               },
+    { "kerning"                            , kerning                             },
+    { "key"                                , key                                 },
+    { "key-skeleton"                       , key_skeleton                        },
+    { "keybase"                            , keybase                             },
+    { "keyboard"                           , keyboard                            },
+    { "keycdn"                             , keycdn                              },
+    { "keynote"                            , keynote                             },
+    { "khanda"                             , khanda                              },
+    { "kickstarter"                        , kickstarter                         },
+    { "kickstarter-k"                      , kickstarter_k                       },
+    { "kidneys"                            , kidneys                             },
+    { "kiss"                               , kiss                                },
+    { "kiss-beam"                          , kiss_beam                           },
+    { "kiss-wink-heart"                    , kiss_wink_heart                     },
+    { "kite"                               , kite                                },
+    { "kiwi-bird"                          , kiwi_bird                           },
+    { "knife-kitchen"                      , knife_kitchen                       },
+    { "korvue"                             , korvue                              },
+    { "lambda"                             , lambda                              },
+    { "lamp"                               , lamp                                },
+    { "lamp-desk"                          , lamp_desk                           },
+    { "lamp-floor"                         , lamp_floor                          },
+    { "landmark"                           , landmark                            },
+    { "landmark-alt"                       , landmark_alt                        },
+    { "language"                           , language                            },
+    { "laptop"                             , laptop                              },
+    { "laptop-code"                        , laptop_code                         },
+    { "laptop-house"                       , laptop_house                        },
+    { "laptop-medical"                     , laptop_medical                      },
+    { "laravel"                            , laravel                             },
+    { "lasso"                              , lasso                               },
+    { "lastfm"                             , lastfm                              },
+    { "lastfm-square"                      , lastfm_square                       },
+    { "laugh"                              , laugh                               },
+    { "laugh-beam"                         , laugh_beam                          },
+    { "laugh-squint"                       , laugh_squint                        },
+    { "laugh-wink"                         , laugh_wink                          },
+    { "layer-group"                        , layer_group                         },
+    { "layer-minus"                        , layer_minus                         },
+    { "layer-plus"                         , layer_plus                          },
+    { "leaf"                               , leaf                                },
+    { "leaf-heart"                         , leaf_heart                          },
+    { "leaf-maple"                         , leaf_maple                          },
+    { "leaf-oak"                           , leaf_oak                            },
+    { "leanpub"                            , leanpub                             },
+    { "lemon"                              , lemon                               },
+    { "less"                               , less                                },
+    { "less-than"                          , less_than                           },
+    { "less-than-equal"                    , less_than_equal                     },
+    { "level-down"                         , level_down                          },
+    { "level-down-alt"                     , level_down_alt                      },
+    { "level-up"                           , level_up                            },
+    { "level-up-alt"                       , level_up_alt                        },
+    { "life-ring"                          , life_ring                           },
+    { "light-ceiling"                      , light_ceiling                       },
+    { "light-switch"                       , light_switch                        },
+    { "light-switch-off"                   , light_switch_off                    },
+    { "light-switch-on"                    , light_switch_on                     },
+    { "lightbulb"                          , lightbulb                           },
+    { "lightbulb-dollar"                   , lightbulb_dollar                    },
+    { "lightbulb-exclamation"              , lightbulb_exclamation               },
+    { "lightbulb-on"                       , lightbulb_on                        },
+    { "lightbulb-slash"                    , lightbulb_slash                     },
+    { "lights-holiday"                     , lights_holiday                      },
+    { "line"                               , _line                               },
+    { "line-columns"                       , line_columns                        },
+    { "line-height"                        , line_height                         },
+    { "link"                               , link                                },
+    { "linkedin"                           , linkedin                            },
+    { "linkedin-in"                        , linkedin_in                         },
+    { "linode"                             , linode                              },
+    { "linux"                              , _linux                              },
+    { "lips"                               , lips                                },
+    { "lira-sign"                          , lira_sign                           },
+    { "list"                               , list                                },
+    { "list-alt"                           , list_alt                            },
+    { "list-music"                         , list_music                          },
+    { "list-ol"                            , list_ol                             },
+    { "list-ul"                            , list_ul                             },
+    { "location"                           , location                            },
+    { "location-arrow"                     , location_arrow                      },
+    { "location-circle"                    , location_circle                     },
+    { "location-slash"                     , location_slash                      },
+    { "lock"                               , lock                                },
+    { "lock-alt"                           , lock_alt                            },
+    { "lock-open"                          , lock_open                           },
+    { "lock-open-alt"                      , lock_open_alt                       },
+    { "long-arrow-alt-down"                , long_arrow_alt_down                 },
+    { "long-arrow-alt-left"                , long_arrow_alt_left                 },
+    { "long-arrow-alt-right"               , long_arrow_alt_right                },
+    { "long-arrow-alt-up"                  , long_arrow_alt_up                   },
+    { "long-arrow-down"                    , long_arrow_down                     },
+    { "long-arrow-left"                    , long_arrow_left                     },
+    { "long-arrow-right"                   , long_arrow_right                    },
+    { "long-arrow-up"                      , long_arrow_up                       },
+    { "loveseat"                           , loveseat                            },
+    { "low-vision"                         , low_vision                          },
+    { "luchador"                           , luchador                            },
+    { "luggage-cart"                       , luggage_cart                        },
+    { "lungs"                              , lungs                               },
+    { "lungs-virus"                        , lungs_virus                         },
+    { "lyft"                               , lyft                                },
+    { "mace"                               , mace                                },
+    { "magento"                            , magento                             },
+    { "magic"                              , magic                               },
+    { "magnet"                             , magnet                              },
+    { "mail-bulk"                          , mail_bulk                           },
+    { "mailbox"                            , mailbox                             },
+    { "mailchimp"                          , mailchimp                           },
+    { "male"                               , male                                },
+    { "mandalorian"                        , mandalorian                         },
+    { "mandolin"                           , mandolin                            },
+    { "map"                                , map                                 },
+    { "map-marked"                         , map_marked                          },
+    { "map-marked-alt"                     , map_marked_alt                      },
+    { "map-marker"                         , map_marker                          },
+    { "map-marker-alt"                     , map_marker_alt                      },
+    { "map-marker-alt-slash"               , map_marker_alt_slash                },
+    { "map-marker-check"                   , map_marker_check                    },
+    { "map-marker-edit"                    , map_marker_edit                     },
+    { "map-marker-exclamation"             , map_marker_exclamation              },
+    { "map-marker-minus"                   , map_marker_minus                    },
+    { "map-marker-plus"                    , map_marker_plus                     },
+    { "map-marker-question"                , map_marker_question                 },
+    { "map-marker-slash"                   , map_marker_slash                    },
+    { "map-marker-smile"                   , map_marker_smile                    },
+    { "map-marker-times"                   , map_marker_times                    },
+    { "map-pin"                            , map_pin                             },
+    { "map-signs"                          , map_signs                           },
+    { "markdown"                           , markdown                            },
+    { "marker"                             , marker                              },
+    { "mars"                               , mars                                },
+    { "mars-double"                        , mars_double                         },
+    { "mars-stroke"                        , mars_stroke                         },
+    { "mars-stroke-h"                      , mars_stroke_h                       },
+    { "mars-stroke-v"                      , mars_stroke_v                       },
+    { "mask"                               , mask                                },
+    { "mastodon"                           , mastodon                            },
+    { "maxcdn"                             , maxcdn                              },
+    { "mdb"                                , mdb                                 },
+    { "meat"                               , meat                                },
+    { "medal"                              , medal                               },
+    { "medapps"                            , medapps                             },
+    { "medium"                             , medium                              },
+    { "medium-m"                           , medium_m                            },
+    { "medkit"                             , medkit                              },
+    { "medrt"                              , medrt                               },
+    { "meetup"                             , meetup                              },
+    { "megaphone"                          , megaphone                           },
+    { "megaport"                           , megaport                            },
+    { "meh"                                , meh                                 },
+    { "meh-blank"                          , meh_blank                           },
+    { "meh-rolling-eyes"                   , meh_rolling_eyes                    },
+    { "memory"                             , memory                              },
+    { "mendeley"                           , mendeley                            },
+    { "menorah"                            , menorah                             },
+    { "mercury"                            , mercury                             },
+    { "meteor"                             , meteor                              },
+    { "microblog"                          , microblog                           },
+    { "microchip"                          , microchip                           },
+    { "microphone"                         , microphone                          },
+    { "microphone-alt"                     , microphone_alt                      },
+    { "microphone-alt-slash"               , microphone_alt_slash                },
+    { "microphone-slash"                   , microphone_slash                    },
+    { "microphone-stand"                   , microphone_stand                    },
+    { "microscope"                         , microscope                          },
+    { "microsoft"                          , microsoft                           },
+    { "microwave"                          , microwave                           },
+    { "mind-share"                         , mind_share                          },
+    { "minus"                              , minus                               },
+    { "minus-circle"                       , minus_circle                        },
+    { "minus-hexagon"                      , minus_hexagon                       },
+    { "minus-octagon"                      , minus_octagon                       },
+    { "minus-square"                       , minus_square                        },
+    { "mistletoe"                          , mistletoe                           },
+    { "mitten"                             , mitten                              },
+    { "mix"                                , mix                                 },
+    { "mixcloud"                           , mixcloud                            },
+    { "mixer"                              , mixer                               },
+    { "mizuni"                             , mizuni                              },
+    { "mobile"                             , mobile                              },
+    { "mobile-alt"                         , mobile_alt                          },
+    { "mobile-android"                     , mobile_android                      },
+    { "mobile-android-alt"                 , mobile_android_alt                  },
+    { "modx"                               , modx                                },
+    { "monero"                             , monero                              },
+    { "money-bill"                         , money_bill                          },
+    { "money-bill-alt"                     , money_bill_alt                      },
+    { "money-bill-wave"                    , money_bill_wave                     },
+    { "money-bill-wave-alt"                , money_bill_wave_alt                 },
+    { "money-check"                        , money_check                         },
+    { "money-check-alt"                    , money_check_alt                     },
+    { "money-check-edit"                   , money_check_edit                    },
+    { "money-check-edit-alt"               , money_check_edit_alt                },
+    { "monitor-heart-rate"                 , monitor_heart_rate                  },
+    { "monkey"                             , monkey                              },
+    { "monument"                           , monument                            },
+    { "moon"                               , moon                                },
+    { "moon-cloud"                         , moon_cloud                          },
+    { "moon-stars"                         , moon_stars                          },
+    { "mortar-pestle"                      , mortar_pestle                       },
+    { "mosque"                             , mosque                              },
+    { "motorcycle"                         , motorcycle                          },
+    { "mountain"                           , mountain                            },
+    { "mountains"                          , mountains                           },
+    { "mouse"                              , mouse                               },
+    { "mouse-alt"                          , mouse_alt                           },
+    { "mouse-pointer"                      , mouse_pointer                       },
+    { "mp3-player"                         , mp3_player                          },
+    { "mug"                                , mug                                 },
+    { "mug-hot"                            , mug_hot                             },
+    { "mug-marshmallows"                   , mug_marshmallows                    },
+    { "mug-tea"                            , mug_tea                             },
+    { "music"                              , music                               },
+    { "music-alt"                          , music_alt                           },
+    { "music-alt-slash"                    , music_alt_slash                     },
+    { "music-slash"                        , music_slash                         },
+    { "napster"                            , napster                             },
+    { "narwhal"                            , narwhal                             },
+    { "neos"                               , neos                                },
+    { "network-wired"                      , network_wired                       },
+    { "neuter"                             , neuter                              },
+    { "newspaper"                          , newspaper                           },
+    { "nimblr"                             , nimblr                              },
+    { "node"                               , node                                },
+    { "node-js"                            , node_js                             },
+    { "not-equal"                          , not_equal                           },
+    { "notes-medical"                      , notes_medical                       },
+    { "npm"                                , npm                                 },
+    { "ns8"                                , ns8                                 },
+    { "nutritionix"                        , nutritionix                         },
+    { "object-group"                       , object_group                        },
+    { "object-ungroup"                     , object_ungroup                      },
+    { "octagon"                            , octagon                             },
+    { "octopus-deploy"                     , octopus_deploy                      },
+    { "odnoklassniki"                      , odnoklassniki                       },
+    { "odnoklassniki-square"               , odnoklassniki_square                },
+    { "oil-can"                            , oil_can                             },
+    { "oil-temp"                           , oil_temp                            },
+    { "old-republic"                       , old_republic                        },
+    { "om"                                 , om                                  },
+    { "omega"                              , omega                               },
+    { "opencart"                           , opencart                            },
+    { "openid"                             , openid                              },
+    { "opera"                              , opera                               },
+    { "optin-monster"                      , optin_monster                       },
+    { "orcid"                              , orcid                               },
+    { "ornament"                           , ornament                            },
+    { "osi"                                , osi                                 },
+    { "otter"                              , otter                               },
+    { "outdent"                            , outdent                             },
+    { "outlet"                             , outlet                              },
+    { "oven"                               , oven                                },
+    { "overline"                           , overline                            },
+    { "page-break"                         , page_break                          },
+    { "page4"                              , page4                               },
+    { "pagelines"                          , pagelines                           },
+    { "pager"                              , pager                               },
+    { "paint-brush"                        , paint_brush                         },
+    { "paint-brush-alt"                    , paint_brush_alt                     },
+    { "paint-roller"                       , paint_roller                        },
+    { "palette"                            , palette                             },
+    { "palfed"                             , palfed                              },
+    { "pallet"                             , pallet                              },
+    { "pallet-alt"                         , pallet_alt                          },
+    { "paper-plane"                        , paper_plane                         },
+    { "paperclip"                          , paperclip                           },
+    { "parachute-box"                      , parachute_box                       },
+    { "paragraph"                          , paragraph                           },
+    { "paragraph-rtl"                      , paragraph_rtl                       },
+    { "parking"                            , parking                             },
+    { "parking-circle"                     , parking_circle                      },
+    { "parking-circle-slash"               , parking_circle_slash                },
+    { "parking-slash"                      , parking_slash                       },
+    { "passport"                           , passport                            },
+    { "pastafarianism"                     , pastafarianism                      },
+    { "paste"                              , paste                               },
+    { "patreon"                            , patreon                             },
+    { "pause"                              , pause                               },
+    { "pause-circle"                       , pause_circle                        },
+    { "paw"                                , paw                                 },
+    { "paw-alt"                            , paw_alt                             },
+    { "paw-claws"                          , paw_claws                           },
+    { "paypal"                             , paypal                              },
+    { "peace"                              , peace                               },
+    { "pegasus"                            , pegasus                             },
+    { "pen"                                , pen                                 },
+    { "pen-alt"                            , pen_alt                             },
+    { "pen-fancy"                          , pen_fancy                           },
+    { "pen-nib"                            , pen_nib                             },
+    { "pen-square"                         , pen_square                          },
+    { "pencil"                             , pencil                              },
+    { "pencil-alt"                         , pencil_alt                          },
+    { "pencil-paintbrush"                  , pencil_paintbrush                   },
+    { "pencil-ruler"                       , pencil_ruler                        },
+    { "pennant"                            , pennant                             },
+    { "penny-arcade"                       , penny_arcade                        },
+    { "people-arrows"                      , people_arrows                       },
+    { "people-carry"                       , people_carry                        },
+    { "pepper-hot"                         , pepper_hot                          },
+    { "perbyte"                            , perbyte                             },
+    { "percent"                            , percent                             },
+    { "percentage"                         , percentage                          },
+    { "periscope"                          , periscope                           },
+    { "person-booth"                       , person_booth                        },
+    { "person-carry"                       , person_carry                        },
+    { "person-dolly"                       , person_dolly                        },
+    { "person-dolly-empty"                 , person_dolly_empty                  },
+    { "person-sign"                        , person_sign                         },
+    { "phabricator"                        , phabricator                         },
+    { "phoenix-framework"                  , phoenix_framework                   },
+    { "phoenix-squadron"                   , phoenix_squadron                    },
+    { "phone"                              , phone                               },
+    { "phone-alt"                          , phone_alt                           },
+    { "phone-laptop"                       , phone_laptop                        },
+    { "phone-office"                       , phone_office                        },
+    { "phone-plus"                         , phone_plus                          },
+    { "phone-rotary"                       , phone_rotary                        },
+    { "phone-slash"                        , phone_slash                         },
+    { "phone-square"                       , phone_square                        },
+    { "phone-square-alt"                   , phone_square_alt                    },
+    { "phone-volume"                       , phone_volume                        },
+    { "photo-video"                        , photo_video                         },
+    { "php"                                , php                                 },
+    { "pi"                                 , pi                                  },
+    { "piano"                              , piano                               },
+    { "piano-keyboard"                     , piano_keyboard                      },
+    { "pie"                                , pie                                 },
+    { "pied-piper"                         , pied_piper                          },
+    { "pied-piper-alt"                     , pied_piper_alt                      },
+    { "pied-piper-hat"                     , pied_piper_hat                      },
+    { "pied-piper-pp"                      , pied_piper_pp                       },
+    { "pied-piper-square"                  , pied_piper_square                   },
+    { "pig"                                , pig                                 },
+    { "piggy-bank"                         , piggy_bank                          },
+    { "pills"                              , pills                               },
+    { "pinterest"                          , pinterest                           },
+    { "pinterest-p"                        , pinterest_p                         },
+    { "pinterest-square"                   , pinterest_square                    },
+    { "pizza"                              , pizza                               },
+    { "pizza-slice"                        , pizza_slice                         },
+    { "place-of-worship"                   , place_of_worship                    },
+    { "plane"                              , plane                               },
+    { "plane-alt"                          , plane_alt                           },
+    { "plane-arrival"                      , plane_arrival                       },
+    { "plane-departure"                    , plane_departure                     },
+    { "plane-slash"                        , plane_slash                         },
+    { "planet-moon"                        , planet_moon                         },
+    { "planet-ringed"                      , planet_ringed                       },
+    { "play"                               , play                                },
+    { "play-circle"                        , play_circle                         },
+    { "playstation"                        , playstation                         },
+    { "plug"                               , plug                                },
+    { "plus"                               , plus                                },
+    { "plus-circle"                        , plus_circle                         },
+    { "plus-hexagon"                       , plus_hexagon                        },
+    { "plus-octagon"                       , plus_octagon                        },
+    { "plus-square"                        , plus_square                         },
+    { "podcast"                            , podcast                             },
+    { "podium"                             , podium                              },
+    { "podium-star"                        , podium_star                         },
+    { "police-box"                         , police_box                          },
+    { "poll"                               , poll                                },
+    { "poll-h"                             , poll_h                              },
+    { "poll-people"                        , poll_people                         },
+    { "poo"                                , poo                                 },
+    { "poo-storm"                          , poo_storm                           },
+    { "poop"                               , poop                                },
+    { "popcorn"                            , popcorn                             },
+    { "portal-enter"                       , portal_enter                        },
+    { "portal-exit"                        , portal_exit                         },
+    { "portrait"                           , portrait                            },
+    { "pound-sign"                         , pound_sign                          },
+    { "power-off"                          , power_off                           },
+    { "pray"                               , pray                                },
+    { "praying-hands"                      , praying_hands                       },
+    { "prescription"                       , prescription                        },
+    { "prescription-bottle"                , prescription_bottle                 },
+    { "prescription-bottle-alt"            , prescription_bottle_alt             },
+    { "presentation"                       , presentation                        },
+    { "print"                              , print                               },
+    { "print-search"                       , print_search                        },
+    { "print-slash"                        , print_slash                         },
+    { "procedures"                         , procedures                          },
+    { "product-hunt"                       , product_hunt                        },
+    { "project-diagram"                    , project_diagram                     },
+    { "projector"                          , projector                           },
+    { "pump-medical"                       , pump_medical                        },
+    { "pump-soap"                          , pump_soap                           },
+    { "pumpkin"                            , pumpkin                             },
+    { "pushed"                             , pushed                              },
+    { "puzzle-piece"                       , puzzle_piece                        },
+    { "python"                             , python                              },
+    { "qq"                                 , qq                                  },
+    { "qrcode"                             , qrcode                              },
+    { "question"                           , question                            },
+    { "question-circle"                    , question_circle                     },
+    { "question-square"                    , question_square                     },
+    { "quidditch"                          , quidditch                           },
+    { "quinscape"                          , quinscape                           },
+    { "quora"                              , quora                               },
+    { "quote-left"                         , quote_left                          },
+    { "quote-right"                        , quote_right                         },
+    { "quran"                              , quran                               },
+    { "r-project"                          , r_project                           },
+    { "rabbit"                             , rabbit                              },
+    { "rabbit-fast"                        , rabbit_fast                         },
+    { "racquet"                            , racquet                             },
+    { "radar"                              , radar                               },
+    { "radiation"                          , radiation                           },
+    { "radiation-alt"                      , radiation_alt                       },
+    { "radio"                              , radio                               },
+    { "radio-alt"                          , radio_alt                           },
+    { "rainbow"                            , rainbow                             },
+    { "raindrops"                          , raindrops                           },
+    { "ram"                                , ram                                 },
+    { "ramp-loading"                       , ramp_loading                        },
+    { "random"                             , random                              },
+    { "raspberry-pi"                       , raspberry_pi                        },
+    { "ravelry"                            , ravelry                             },
+    { "raygun"                             , raygun                              },
+    { "react"                              , react                               },
+    { "reacteurope"                        , reacteurope                         },
+    { "readme"                             , readme                              },
+    { "rebel"                              , rebel                               },
+    { "receipt"                            , receipt                             },
+    { "record-vinyl"                       , record_vinyl                        },
+    { "rectangle-landscape"                , rectangle_landscape                 },
+    { "rectangle-portrait"                 , rectangle_portrait                  },
+    { "rectangle-wide"                     , rectangle_wide                      },
+    { "recycle"                            , recycle                             },
+    { "red-river"                          , red_river                           },
+    { "reddit"                             , reddit                              },
+    { "reddit-alien"                       , reddit_alien                        },
+    { "reddit-square"                      , reddit_square                       },
+    { "redhat"                             , redhat                              },
+    { "redo"                               , redo                                },
+    { "redo-alt"                           , redo_alt                            },
+    { "refrigerator"                       , refrigerator                        },
+    { "registered"                         , registered                          },
+    { "remove-format"                      , remove_format                       },
+    { "renren"                             , renren                              },
+    { "repeat"                             , repeat                              },
+    { "repeat-1"                           , repeat_1                            },
+    { "repeat-1-alt"                       , repeat_1_alt                        },
+    { "repeat-alt"                         , repeat_alt                          },
+    { "reply"                              , reply                               },
+    { "reply-all"                          , reply_all                           },
+    { "replyd"                             , replyd                              },
+    { "republican"                         , republican                          },
+    { "researchgate"                       , researchgate                        },
+    { "resolving"                          , resolving                           },
+    { "restroom"                           , restroom                            },
+    { "retweet"                            , retweet                             },
+    { "retweet-alt"                        , retweet_alt                         },
+    { "rev"                                , rev                                 },
+    { "ribbon"                             , ribbon                              },
+    { "ring"                               , ring                                },
+    { "rings-wedding"                      , rings_wedding                       },
+    { "road"                               , road                                },
+    { "robot"                              , robot                               },
+    { "rocket"                             , rocket                              },
+    { "rocket-launch"                      , rocket_launch                       },
+    { "rocketchat"                         , rocketchat                          },
+    { "rockrms"                            , rockrms                             },
+    { "route"                              , route                               },
+    { "route-highway"                      , route_highway                       },
+    { "route-interstate"                   , route_interstate                    },
+    { "router"                             , router                              },
+    { "rss"                                , rss                                 },
+    { "rss-square"                         , rss_square                          },
+    { "ruble-sign"                         , ruble_sign                          },
+    { "ruler"                              , ruler                               },
+    { "ruler-combined"                     , ruler_combined                      },
+    { "ruler-horizontal"                   , ruler_horizontal                    },
+    { "ruler-triangle"                     , ruler_triangle                      },
+    { "ruler-vertical"                     , ruler_vertical                      },
+    { "running"                            , running                             },
+    { "rupee-sign"                         , rupee_sign                          },
+    { "rust"                               , rust                                },
+    { "rv"                                 , rv                                  },
+    { "sack"                               , sack                                },
+    { "sack-dollar"                        , sack_dollar                         },
+    { "sad-cry"                            , sad_cry                             },
+    { "sad-tear"                           , sad_tear                            },
+    { "safari"                             , safari                              },
+    { "salad"                              , salad                               },
+    { "salesforce"                         , salesforce                          },
+    { "sandwich"                           , sandwich                            },
+    { "sass"                               , sass                                },
+    { "satellite"                          , satellite                           },
+    { "satellite-dish"                     , satellite_dish                      },
+    { "sausage"                            , sausage                             },
+    { "save"                               , save                                },
+    { "sax-hot"                            , sax_hot                             },
+    { "saxophone"                          , saxophone                           },
+    { "scalpel"                            , scalpel                             },
+    { "scalpel-path"                       , scalpel_path                        },
+    { "scanner"                            , scanner                             },
+    { "scanner-image"                      , scanner_image                       },
+    { "scanner-keyboard"                   , scanner_keyboard                    },
+    { "scanner-touchscreen"                , scanner_touchscreen                 },
+    { "scarecrow"                          , scarecrow                           },
+    { "scarf"                              , scarf                               },
+    { "schlix"                             , schlix                              },
+    { "school"                             , school                              },
+    { "screwdriver"                        , screwdriver                         },
+    { "scribd"                             , scribd                              },
+    { "scroll"                             , scroll                              },
+    { "scroll-old"                         , scroll_old                          },
+    { "scrubber"                           , scrubber                            },
+    { "scythe"                             , scythe                              },
+    { "sd-card"                            , sd_card                             },
+    { "search"                             , search                              },
+    { "search-dollar"                      , search_dollar                       },
+    { "search-location"                    , search_location                     },
+    { "search-minus"                       , search_minus                        },
+    { "search-plus"                        , search_plus                         },
+    { "searchengin"                        , searchengin                         },
+    { "seedling"                           , seedling                            },
+    { "sellcast"                           , sellcast                            },
+    { "sellsy"                             , sellsy                              },
+    { "send-back"                          , send_back                           },
+    { "send-backward"                      , send_backward                       },
+    { "sensor"                             , sensor                              },
+    { "sensor-alert"                       , sensor_alert                        },
+    { "sensor-fire"                        , sensor_fire                         },
+    { "sensor-on"                          , sensor_on                           },
+    { "sensor-smoke"                       , sensor_smoke                        },
+    { "server"                             , server                              },
+    { "servicestack"                       , servicestack                        },
+    { "shapes"                             , shapes                              },
+    { "share"                              , share                               },
+    { "share-all"                          , share_all                           },
+    { "share-alt"                          , share_alt                           },
+    { "share-alt-square"                   , share_alt_square                    },
+    { "share-square"                       , share_square                        },
+    { "sheep"                              , sheep                               },
+    { "shekel-sign"                        , shekel_sign                         },
+    { "shield"                             , shield                              },
+    { "shield-alt"                         , shield_alt                          },
+    { "shield-check"                       , shield_check                        },
+    { "shield-cross"                       , shield_cross                        },
+    { "shield-virus"                       , shield_virus                        },
+    { "ship"                               , ship                                },
+    { "shipping-fast"                      , shipping_fast                       },
+    { "shipping-timed"                     , shipping_timed                      },
+    { "shirtsinbulk"                       , shirtsinbulk                        },
+    { "shish-kebab"                        , shish_kebab                         },
+    { "shoe-prints"                        , shoe_prints                         },
+    { "shopify"                            , shopify                             },
+    { "shopping-bag"                       , shopping_bag                        },
+    { "shopping-basket"                    , shopping_basket                     },
+    { "shopping-cart"                      , shopping_cart                       },
+    { "shopware"                           , shopware                            },
+    { "shovel"                             , shovel                              },
+    { "shovel-snow"                        , shovel_snow                         },
+    { "shower"                             , shower                              },
+    { "shredder"                           , shredder                            },
+    { "shuttle-van"                        , shuttle_van                         },
+    { "shuttlecock"                        , shuttlecock                         },
+    { "sickle"                             , sickle                              },
+    { "sigma"                              , sigma                               },
+    { "sign"                               , sign                                },
+    { "sign-in"                            , sign_in                             },
+    { "sign-in-alt"                        , sign_in_alt                         },
+    { "sign-language"                      , sign_language                       },
+    { "sign-out"                           , sign_out                            },
+    { "sign-out-alt"                       , sign_out_alt                        },
+    { "signal"                             , signal                              },
+    { "signal-1"                           , signal_1                            },
+    { "signal-2"                           , signal_2                            },
+    { "signal-3"                           , signal_3                            },
+    { "signal-4"                           , signal_4                            },
+    { "signal-alt"                         , signal_alt                          },
+    { "signal-alt-1"                       , signal_alt_1                        },
+    { "signal-alt-2"                       , signal_alt_2                        },
+    { "signal-alt-3"                       , signal_alt_3                        },
+    { "signal-alt-slash"                   , signal_alt_slash                    },
+    { "signal-slash"                       , signal_slash                        },
+    { "signal-stream"                      , signal_stream                       },
+    { "signature"                          , signature                           },
+    { "sim-card"                           , sim_card                            },
+    { "simplybuilt"                        , simplybuilt                         },
+    { "sink"                               , sink                                },
+    { "siren"                              , siren                               },
+    { "siren-on"                           , siren_on                            },
+    { "sistrix"                            , sistrix                             },
+    { "sitemap"                            , sitemap                             },
+    { "sith"                               , sith                                },
+    { "skating"                            , skating                             },
+    { "skeleton"                           , skeleton                            },
+    { "sketch"                             , sketch                              },
+    { "ski-jump"                           , ski_jump                            },
+    { "ski-lift"                           , ski_lift                            },
+    { "skiing"                             , skiing                              },
+    { "skiing-nordic"                      , skiing_nordic                       },
+    { "skull"                              , skull                               },
+    { "skull-cow"                          , skull_cow                           },
+    { "skull-crossbones"                   , skull_crossbones                    },
+    { "skyatlas"                           , skyatlas                            },
+    { "skype"                              , skype                               },
+    { "slack"                              , slack                               },
+    { "slack-hash"                         , slack_hash                          },
+    { "slash"                              , slash                               },
+    { "sledding"                           , sledding                            },
+    { "sleigh"                             , sleigh                              },
+    { "sliders-h"                          , sliders_h                           },
+    { "sliders-h-square"                   , sliders_h_square                    },
+    { "sliders-v"                          , sliders_v                           },
+    { "sliders-v-square"                   , sliders_v_square                    },
+    { "slideshare"                         , slideshare                          },
+    { "smile"                              , smile                               },
+    { "smile-beam"                         , smile_beam                          },
+    { "smile-plus"                         , smile_plus                          },
+    { "smile-wink"                         , smile_wink                          },
+    { "smog"                               , smog                                },
+    { "smoke"                              , smoke                               },
+    { "smoking"                            , smoking                             },
+    { "smoking-ban"                        , smoking_ban                         },
+    { "sms"                                , sms                                 },
+    { "snake"                              , snake                               },
+    { "snapchat"                           , snapchat                            },
+    { "snapchat-ghost"                     , snapchat_ghost                      },
+    { "snapchat-square"                    , snapchat_square                     },
+    { "snooze"                             , snooze                              },
+    { "snow-blowing"                       , snow_blowing                        },
+    { "snowboarding"                       , snowboarding                        },
+    { "snowflake"                          , snowflake                           },
+    { "snowflakes"                         , snowflakes                          },
+    { "snowman"                            , snowman                             },
+    { "snowmobile"                         , snowmobile                          },
+    { "snowplow"                           , snowplow                            },
+    { "soap"                               , soap                                },
+    { "socks"                              , socks                               },
+    { "solar-panel"                        , solar_panel                         },
+    { "solar-system"                       , solar_system                        },
+    { "sort"                               , sort                                },
+    { "sort-alpha-down"                    , sort_alpha_down                     },
+    { "sort-alpha-down-alt"                , sort_alpha_down_alt                 },
+    { "sort-alpha-up"                      , sort_alpha_up                       },
+    { "sort-alpha-up-alt"                  , sort_alpha_up_alt                   },
+    { "sort-alt"                           , sort_alt                            },
+    { "sort-amount-down"                   , sort_amount_down                    },
+    { "sort-amount-down-alt"               , sort_amount_down_alt                },
+    { "sort-amount-up"                     , sort_amount_up                      },
+    { "sort-amount-up-alt"                 , sort_amount_up_alt                  },
+    { "sort-circle"                        , sort_circle                         },
+    { "sort-circle-down"                   , sort_circle_down                    },
+    { "sort-circle-up"                     , sort_circle_up                      },
+    { "sort-down"                          , sort_down                           },
+    { "sort-numeric-down"                  , sort_numeric_down                   },
+    { "sort-numeric-down-alt"              , sort_numeric_down_alt               },
+    { "sort-numeric-up"                    , sort_numeric_up                     },
+    { "sort-numeric-up-alt"                , sort_numeric_up_alt                 },
+    { "sort-shapes-down"                   , sort_shapes_down                    },
+    { "sort-shapes-down-alt"               , sort_shapes_down_alt                },
+    { "sort-shapes-up"                     , sort_shapes_up                      },
+    { "sort-shapes-up-alt"                 , sort_shapes_up_alt                  },
+    { "sort-size-down"                     , sort_size_down                      },
+    { "sort-size-down-alt"                 , sort_size_down_alt                  },
+    { "sort-size-up"                       , sort_size_up                        },
+    { "sort-size-up-alt"                   , sort_size_up_alt                    },
+    { "sort-up"                            , sort_up                             },
+    { "soundcloud"                         , soundcloud                          },
+    { "soup"                               , soup                                },
+    { "sourcetree"                         , sourcetree                          },
+    { "spa"                                , spa                                 },
+    { "space-shuttle"                      , space_shuttle                       },
+    { "space-station-moon"                 , space_station_moon                  },
+    { "space-station-moon-alt"             , space_station_moon_alt              },
+    { "spade"                              , spade                               },
+    { "sparkles"                           , sparkles                            },
+    { "speakap"                            , speakap                             },
+    { "speaker"                            , speaker                             },
+    { "speaker-deck"                       , speaker_deck                        },
+    { "speakers"                           , speakers                            },
+    { "spell-check"                        , spell_check                         },
+    { "spider"                             , spider                              },
+    { "spider-black-widow"                 , spider_black_widow                  },
+    { "spider-web"                         , spider_web                          },
+    { "spinner"                            , spinner                             },
+    { "spinner-third"                      , spinner_third                       },
+    { "splotch"                            , splotch                             },
+    { "spotify"                            , spotify                             },
+    { "spray-can"                          , spray_can                           },
+    { "sprinkler"                          , sprinkler                           },
+    { "square"                             , square                              },
+    { "square-full"                        , square_full                         },
+    { "square-root"                        , square_root                         },
+    { "square-root-alt"                    , square_root_alt                     },
+    { "squarespace"                        , squarespace                         },
+    { "squirrel"                           , squirrel                            },
+    { "stack-exchange"                     , stack_exchange                      },
+    { "stack-overflow"                     , stack_overflow                      },
+    { "stackpath"                          , stackpath                           },
+    { "staff"                              , staff                               },
+    { "stamp"                              , stamp                               },
+    { "star"                               , star                                },
+    { "star-and-crescent"                  , star_and_crescent                   },
+    { "star-christmas"                     , star_christmas                      },
+    { "star-exclamation"                   , star_exclamation                    },
+    { "star-half"                          , star_half                           },
+    { "star-half-alt"                      , star_half_alt                       },
+    { "star-of-david"                      , star_of_david                       },
+    { "star-of-life"                       , star_of_life                        },
+    { "star-shooting"                      , star_shooting                       },
+    { "starfighter"                        , starfighter                         },
+    { "starfighter-alt"                    , starfighter_alt                     },
+    { "stars"                              , stars                               },
+    { "starship"                           , starship                            },
+    { "starship-freighter"                 , starship_freighter                  },
+    { "staylinked"                         , staylinked                          },
+    { "steak"                              , steak                               },
+    { "steam"                              , steam                               },
+    { "steam-square"                       , steam_square                        },
+    { "steam-symbol"                       , steam_symbol                        },
+    { "steering-wheel"                     , steering_wheel                      },
+    { "step-backward"                      , step_backward                       },
+    { "step-forward"                       , step_forward                        },
+    { "stethoscope"                        , stethoscope                         },
+    { "sticker-mule"                       , sticker_mule                        },
+    { "sticky-note"                        , sticky_note                         },
+    { "stocking"                           , stocking                            },
+    { "stomach"                            , stomach                             },
+    { "stop"                               , stop                                },
+    { "stop-circle"                        , stop_circle                         },
+    { "stopwatch"                          , stopwatch                           },
+    { "stopwatch-20"                       , stopwatch_20                        },
+    { "store"                              , store                               },
+    { "store-alt"                          , store_alt                           },
+    { "store-alt-slash"                    , store_alt_slash                     },
+    { "store-slash"                        , store_slash                         },
+    { "strava"                             , strava                              },
+    { "stream"                             , stream                              },
+    { "street-view"                        , street_view                         },
+    { "stretcher"                          , stretcher                           },
+    { "strikethrough"                      , strikethrough                       },
+    { "stripe"                             , stripe                              },
+    { "stripe-s"                           , stripe_s                            },
+    { "stroopwafel"                        , stroopwafel                         },
+    { "studiovinari"                       , studiovinari                        },
+    { "stumbleupon"                        , stumbleupon                         },
+    { "stumbleupon-circle"                 , stumbleupon_circle                  },
+    { "subscript"                          , subscript                           },
+    { "subway"                             , subway                              },
+    { "suitcase"                           , suitcase                            },
+    { "suitcase-rolling"                   , suitcase_rolling                    },
+    { "sun"                                , sun                                 },
+    { "sun-cloud"                          , sun_cloud                           },
+    { "sun-dust"                           , sun_dust                            },
+    { "sun-haze"                           , sun_haze                            },
+    { "sunglasses"                         , sunglasses                          },
+    { "sunrise"                            , sunrise                             },
+    { "sunset"                             , sunset                              },
+    { "superpowers"                        , superpowers                         },
+    { "superscript"                        , superscript                         },
+    { "supple"                             , supple                              },
+    { "surprise"                           , surprise                            },
+    { "suse"                               , suse                                },
+    { "swatchbook"                         , swatchbook                          },
+    { "swift"                              , swift                               },
+    { "swimmer"                            , swimmer                             },
+    { "swimming-pool"                      , swimming_pool                       },
+    { "sword"                              , sword                               },
+    { "sword-laser"                        , sword_laser                         },
+    { "sword-laser-alt"                    , sword_laser_alt                     },
+    { "swords"                             , swords                              },
+    { "swords-laser"                       , swords_laser                        },
+    { "symfony"                            , symfony                             },
+    { "synagogue"                          , synagogue                           },
+    { "sync"                               , sync                                },
+    { "sync-alt"                           , sync_alt                            },
+    { "syringe"                            , syringe                             },
+    { "table"                              , table                               },
+    { "table-tennis"                       , table_tennis                        },
+    { "tablet"                             , tablet                              },
+    { "tablet-alt"                         , tablet_alt                          },
+    { "tablet-android"                     , tablet_android                      },
+    { "tablet-android-alt"                 , tablet_android_alt                  },
+    { "tablet-rugged"                      , tablet_rugged                       },
+    { "tablets"                            , tablets                             },
+    { "tachometer"                         , tachometer                          },
+    { "tachometer-alt"                     , tachometer_alt                      },
+    { "tachometer-alt-average"             , tachometer_alt_average              },
+    { "tachometer-alt-fast"                , tachometer_alt_fast                 },
+    { "tachometer-alt-fastest"             , tachometer_alt_fastest              },
+    { "tachometer-alt-slow"                , tachometer_alt_slow                 },
+    { "tachometer-alt-slowest"             , tachometer_alt_slowest              },
+    { "tachometer-average"                 , tachometer_average                  },
+    { "tachometer-fast"                    , tachometer_fast                     },
+    { "tachometer-fastest"                 , tachometer_fastest                  },
+    { "tachometer-slow"                    , tachometer_slow                     },
+    { "tachometer-slowest"                 , tachometer_slowest                  },
+    { "taco"                               , taco                                },
+    { "tag"                                , tag                                 },
+    { "tags"                               , tags                                },
+    { "tally"                              , tally                               },
+    { "tanakh"                             , tanakh                              },
+    { "tape"                               , tape                                },
+    { "tasks"                              , tasks                               },
+    { "tasks-alt"                          , tasks_alt                           },
+    { "taxi"                               , taxi                                },
+    { "teamspeak"                          , teamspeak                           },
+    { "teeth"                              , teeth                               },
+    { "teeth-open"                         , teeth_open                          },
+    { "telegram"                           , telegram                            },
+    { "telegram-plane"                     , telegram_plane                      },
+    { "telescope"                          , telescope                           },
+    { "temperature-down"                   , temperature_down                    },
+    { "temperature-frigid"                 , temperature_frigid                  },
+    { "temperature-high"                   , temperature_high                    },
+    { "temperature-hot"                    , temperature_hot                     },
+    { "temperature-low"                    , temperature_low                     },
+    { "temperature-up"                     , temperature_up                      },
+    { "tencent-weibo"                      , tencent_weibo                       },
+    { "tenge"                              , tenge                               },
+    { "tennis-ball"                        , tennis_ball                         },
+    { "terminal"                           , terminal                            },
+    { "text"                               , text                                },
+    { "text-height"                        , text_height                         },
+    { "text-size"                          , text_size                           },
+    { "text-width"                         , text_width                          },
+    { "th"                                 , th                                  },
+    { "th-large"                           , th_large                            },
+    { "th-list"                            , th_list                             },
+    { "the-red-yeti"                       , the_red_yeti                        },
+    { "theater-masks"                      , theater_masks                       },
+    { "themeco"                            , themeco                             },
+    { "themeisle"                          , themeisle                           },
+    { "thermometer"                        , thermometer                         },
+    { "thermometer-empty"                  , thermometer_empty                   },
+    { "thermometer-full"                   , thermometer_full                    },
+    { "thermometer-half"                   , thermometer_half                    },
+    { "thermometer-quarter"                , thermometer_quarter                 },
+    { "thermometer-three-quarters"         , thermometer_three_quarters          },
+    { "theta"                              , theta                               },
+    { "think-peaks"                        , think_peaks                         },
+    { "thumbs-down"                        , thumbs_down                         },
+    { "thumbs-up"                          , thumbs_up                           },
+    { "thumbtack"                          , thumbtack                           },
+    { "thunderstorm"                       , thunderstorm                        },
+    { "thunderstorm-moon"                  , thunderstorm_moon                   },
+    { "thunderstorm-sun"                   , thunderstorm_sun                    },
+    { "ticket"                             , ticket                              },
+    { "ticket-alt"                         , ticket_alt                          },
+    { "tiktok"                             , tiktok                              },
+    { "tilde"                              , tilde                               },
+    { "times"                              , times                               },
+    { "times-circle"                       , times_circle                        },
+    { "times-hexagon"                      , times_hexagon                       },
+    { "times-octagon"                      , times_octagon                       },
+    { "times-square"                       , times_square                        },
+    { "tint"                               , tint                                },
+    { "tint-slash"                         , tint_slash                          },
+    { "tire"                               , tire                                },
+    { "tire-flat"                          , tire_flat                           },
+    { "tire-pressure-warning"              , tire_pressure_warning               },
+    { "tire-rugged"                        , tire_rugged                         },
+    { "tired"                              , tired                               },
+    { "toggle-off"                         , toggle_off                          },
+    { "toggle-on"                          , toggle_on                           },
+    { "toilet"                             , toilet                              },
+    { "toilet-paper"                       , toilet_paper                        },
+    { "toilet-paper-alt"                   , toilet_paper_alt                    },
+    { "toilet-paper-slash"                 , toilet_paper_slash                  },
+    { "tombstone"                          , tombstone                           },
+    { "tombstone-alt"                      , tombstone_alt                       },
+    { "toolbox"                            , toolbox                             },
+    { "tools"                              , tools                               },
+    { "tooth"                              , tooth                               },
+    { "toothbrush"                         , toothbrush                          },
+    { "torah"                              , torah                               },
+    { "torii-gate"                         , torii_gate                          },
+    { "tornado"                            , tornado                             },
+    { "tractor"                            , tractor                             },
+    { "trade-federation"                   , trade_federation                    },
+    { "trademark"                          , trademark                           },
+    { "traffic-cone"                       , traffic_cone                        },
+    { "traffic-light"                      , traffic_light                       },
+    { "traffic-light-go"                   , traffic_light_go                    },
+    { "traffic-light-slow"                 , traffic_light_slow                  },
+    { "traffic-light-stop"                 , traffic_light_stop                  },
+    { "trailer"                            , trailer                             },
+    { "train"                              , train                               },
+    { "tram"                               , tram                                },
+    { "transgender"                        , transgender                         },
+    { "transgender-alt"                    , transgender_alt                     },
+    { "transporter"                        , transporter                         },
+    { "transporter-1"                      , transporter_1                       },
+    { "transporter-2"                      , transporter_2                       },
+    { "transporter-3"                      , transporter_3                       },
+    { "transporter-empty"                  , transporter_empty                   },
+    { "trash"                              , trash                               },
+    { "trash-alt"                          , trash_alt                           },
+    { "trash-restore"                      , trash_restore                       },
+    { "trash-restore-alt"                  , trash_restore_alt                   },
+    { "trash-undo"                         , trash_undo                          },
+    { "trash-undo-alt"                     , trash_undo_alt                      },
+    { "treasure-chest"                     , treasure_chest                      },
+    { "tree"                               , tree                                },
+    { "tree-alt"                           , tree_alt                            },
+    { "tree-christmas"                     , tree_christmas                      },
+    { "tree-decorated"                     , tree_decorated                      },
+    { "tree-large"                         , tree_large                          },
+    { "tree-palm"                          , tree_palm                           },
+    { "trees"                              , trees                               },
+    { "trello"                             , trello                              },
+    { "triangle"                           , triangle                            },
+    { "triangle-music"                     , triangle_music                      },
+    { "tripadvisor"                        , tripadvisor                         },
+    { "trophy"                             , trophy                              },
+    { "trophy-alt"                         , trophy_alt                          },
+    { "truck"                              , truck                               },
+    { "truck-container"                    , truck_container                     },
+    { "truck-couch"                        , truck_couch                         },
+    { "truck-loading"                      , truck_loading                       },
+    { "truck-monster"                      , truck_monster                       },
+    { "truck-moving"                       , truck_moving                        },
+    { "truck-pickup"                       , truck_pickup                        },
+    { "truck-plow"                         , truck_plow                          },
+    { "truck-ramp"                         , truck_ramp                          },
+    { "trumpet"                            , trumpet                             },
+    { "tshirt"                             , tshirt                              },
+    { "tty"                                , tty                                 },
+    { "tumblr"                             , tumblr                              },
+    { "tumblr-square"                      , tumblr_square                       },
+    { "turkey"                             , turkey                              },
+    { "turntable"                          , turntable                           },
+    { "turtle"                             , turtle                              },
+    { "tv"                                 , tv                                  },
+    { "tv-alt"                             , tv_alt                              },
+    { "tv-music"                           , tv_music                            },
+    { "tv-retro"                           , tv_retro                            },
+    { "twitch"                             , twitch                              },
+    { "twitter"                            , twitter                             },
+    { "twitter-square"                     , twitter_square                      },
+    { "typewriter"                         , typewriter                          },
+    { "typo3"                              , typo3                               },
+    { "uber"                               , uber                                },
+    { "ubuntu"                             , ubuntu                              },
+    { "ufo"                                , ufo                                 },
+    { "ufo-beam"                           , ufo_beam                            },
+    { "uikit"                              , uikit                               },
+    { "umbraco"                            , umbraco                             },
+    { "umbrella"                           , umbrella                            },
+    { "umbrella-beach"                     , umbrella_beach                      },
+    { "uncharted"                          , uncharted                           },
+    { "underline"                          , underline                           },
+    { "undo"                               , undo                                },
+    { "undo-alt"                           , undo_alt                            },
+    { "unicorn"                            , unicorn                             },
+    { "union"                              , _union                              },
+    { "uniregistry"                        , uniregistry                         },
+    { "unity"                              , unity                               },
+    { "universal-access"                   , universal_access                    },
+    { "university"                         , university                          },
+    { "unlink"                             , unlink                              },
+    { "unlock"                             , unlock                              },
+    { "unlock-alt"                         , unlock_alt                          },
+    { "unsplash"                           , unsplash                            },
+    { "untappd"                            , untappd                             },
+    { "upload"                             , upload                              },
+    { "ups"                                , ups                                 },
+    { "usb"                                , usb                                 },
+    { "usb-drive"                          , usb_drive                           },
+    { "usd-circle"                         , usd_circle                          },
+    { "usd-square"                         , usd_square                          },
+    { "user"                               , user                                },
+    { "user-alien"                         , user_alien                          },
+    { "user-alt"                           , user_alt                            },
+    { "user-alt-slash"                     , user_alt_slash                      },
+    { "user-astronaut"                     , user_astronaut                      },
+    { "user-chart"                         , user_chart                          },
+    { "user-check"                         , user_check                          },
+    { "user-circle"                        , user_circle                         },
+    { "user-clock"                         , user_clock                          },
+    { "user-cog"                           , user_cog                            },
+    { "user-cowboy"                        , user_cowboy                         },
+    { "user-crown"                         , user_crown                          },
+    { "user-edit"                          , user_edit                           },
+    { "user-friends"                       , user_friends                        },
+    { "user-graduate"                      , user_graduate                       },
+    { "user-hard-hat"                      , user_hard_hat                       },
+    { "user-headset"                       , user_headset                        },
+    { "user-injured"                       , user_injured                        },
+    { "user-lock"                          , user_lock                           },
+    { "user-md"                            , user_md                             },
+    { "user-md-chat"                       , user_md_chat                        },
+    { "user-minus"                         , user_minus                          },
+    { "user-music"                         , user_music                          },
+    { "user-ninja"                         , user_ninja                          },
+    { "user-nurse"                         , user_nurse                          },
+    { "user-plus"                          , user_plus                           },
+    { "user-robot"                         , user_robot                          },
+    { "user-secret"                        , user_secret                         },
+    { "user-shield"                        , user_shield                         },
+    { "user-slash"                         , user_slash                          },
+    { "user-tag"                           , user_tag                            },
+    { "user-tie"                           , user_tie                            },
+    { "user-times"                         , user_times                          },
+    { "user-unlock"                        , user_unlock                         },
+    { "user-visor"                         , user_visor                          },
+    { "users"                              , users                               },
+    { "users-class"                        , users_class                         },
+    { "users-cog"                          , users_cog                           },
+    { "users-crown"                        , users_crown                         },
+    { "users-medical"                      , users_medical                       },
+    { "users-slash"                        , users_slash                         },
+    { "usps"                               , usps                                },
+    { "ussunnah"                           , ussunnah                            },
+    { "utensil-fork"                       , utensil_fork                        },
+    { "utensil-knife"                      , utensil_knife                       },
+    { "utensil-spoon"                      , utensil_spoon                       },
+    { "utensils"                           , utensils                            },
+    { "utensils-alt"                       , utensils_alt                        },
+    { "vaadin"                             , vaadin                              },
+    { "vacuum"                             , vacuum                              },
+    { "vacuum-robot"                       , vacuum_robot                        },
+    { "value-absolute"                     , value_absolute                      },
+    { "vector-square"                      , vector_square                       },
+    { "venus"                              , venus                               },
+    { "venus-double"                       , venus_double                        },
+    { "venus-mars"                         , venus_mars                          },
+    { "vest"                               , vest                                },
+    { "vest-patches"                       , vest_patches                        },
+    { "vhs"                                , vhs                                 },
+    { "viacoin"                            , viacoin                             },
+    { "viadeo"                             , viadeo                              },
+    { "viadeo-square"                      , viadeo_square                       },
+    { "vial"                               , vial                                },
+    { "vials"                              , vials                               },
+    { "viber"                              , viber                               },
+    { "video"                              , video                               },
+    { "video-plus"                         , video_plus                          },
+    { "video-slash"                        , video_slash                         },
+    { "vihara"                             , vihara                              },
+    { "vimeo"                              , vimeo                               },
+    { "vimeo-square"                       , vimeo_square                        },
+    { "vimeo-v"                            , vimeo_v                             },
+    { "vine"                               , vine                                },
+    { "violin"                             , violin                              },
+    { "virus"                              , virus                               },
+    { "virus-slash"                        , virus_slash                         },
+    { "viruses"                            , viruses                             },
+    { "vk"                                 , vk                                  },
+    { "vnv"                                , vnv                                 },
+    { "voicemail"                          , voicemail                           },
+    { "volcano"                            , volcano                             },
+    { "volleyball-ball"                    , volleyball_ball                     },
+    { "volume"                             , volume                              },
+    { "volume-down"                        , volume_down                         },
+    { "volume-mute"                        , volume_mute                         },
+    { "volume-off"                         , volume_off                          },
+    { "volume-slash"                       , volume_slash                        },
+    { "volume-up"                          , volume_up                           },
+    { "vote-nay"                           , vote_nay                            },
+    { "vote-yea"                           , vote_yea                            },
+    { "vr-cardboard"                       , vr_cardboard                        },
+    { "vuejs"                              , vuejs                               },
+    { "wagon-covered"                      , wagon_covered                       },
+    { "walker"                             , walker                              },
+    { "walkie-talkie"                      , walkie_talkie                       },
+    { "walking"                            , walking                             },
+    { "wallet"                             , wallet                              },
+    { "wand"                               , wand                                },
+    { "wand-magic"                         , wand_magic                          },
+    { "warehouse"                          , warehouse                           },
+    { "warehouse-alt"                      , warehouse_alt                       },
+    { "washer"                             , washer                              },
+    { "watch"                              , watch                               },
+    { "watch-calculator"                   , watch_calculator                    },
+    { "watch-fitness"                      , watch_fitness                       },
+    { "watchman-monitoring"                , watchman_monitoring                 },
+    { "water"                              , water                               },
+    { "water-lower"                        , water_lower                         },
+    { "water-rise"                         , water_rise                          },
+    { "wave-sine"                          , wave_sine                           },
+    { "wave-square"                        , wave_square                         },
+    { "wave-triangle"                      , wave_triangle                       },
+    { "waveform"                           , waveform                            },
+    { "waveform-path"                      , waveform_path                       },
+    { "waze"                               , waze                                },
+    { "webcam"                             , webcam                              },
+    { "webcam-slash"                       , webcam_slash                        },
+    { "weebly"                             , weebly                              },
+    { "weibo"                              , weibo                               },
+    { "weight"                             , weight                              },
+    { "weight-hanging"                     , weight_hanging                      },
+    { "weixin"                             , weixin                              },
+    { "whale"                              , whale                               },
+    { "whatsapp"                           , whatsapp                            },
+    { "whatsapp-square"                    , whatsapp_square                     },
+    { "wheat"                              , wheat                               },
+    { "wheelchair"                         , wheelchair                          },
+    { "whistle"                            , whistle                             },
+    { "whmcs"                              , whmcs                               },
+    { "wifi"                               , wifi                                },
+    { "wifi-1"                             , wifi_1                              },
+    { "wifi-2"                             , wifi_2                              },
+    { "wifi-slash"                         , wifi_slash                          },
+    { "wikipedia-w"                        , wikipedia_w                         },
+    { "wind"                               , wind                                },
+    { "wind-turbine"                       , wind_turbine                        },
+    { "wind-warning"                       , wind_warning                        },
+    { "window"                             , window                              },
+    { "window-alt"                         , window_alt                          },
+    { "window-close"                       , window_close                        },
+    { "window-frame"                       , window_frame                        },
+    { "window-frame-open"                  , window_frame_open                   },
+    { "window-maximize"                    , window_maximize                     },
+    { "window-minimize"                    , window_minimize                     },
+    { "window-restore"                     , window_restore                      },
+    { "windows"                            , windows                             },
+    { "windsock"                           , windsock                            },
+    { "wine-bottle"                        , wine_bottle                         },
+    { "wine-glass"                         , wine_glass                          },
+    { "wine-glass-alt"                     , wine_glass_alt                      },
+    { "wix"                                , wix                                 },
+    { "wizards-of-the-coast"               , wizards_of_the_coast                },
+    { "wodu"                               , wodu                                },
+    { "wolf-pack-battalion"                , wolf_pack_battalion                 },
+    { "won-sign"                           , won_sign                            },
+    { "wordpress"                          , wordpress                           },
+    { "wordpress-simple"                   , wordpress_simple                    },
+    { "wpbeginner"                         , wpbeginner                          },
+    { "wpexplorer"                         , wpexplorer                          },
+    { "wpforms"                            , wpforms                             },
+    { "wpressr"                            , wpressr                             },
+    { "wreath"                             , wreath                              },
+    { "wrench"                             , wrench                              },
+    { "x-ray"                              , x_ray                               },
+    { "xbox"                               , xbox                                },
+    { "xing"                               , xing                                },
+    { "xing-square"                        , xing_square                         },
+    { "y-combinator"                       , y_combinator                        },
+    { "yahoo"                              , yahoo                               },
+    { "yammer"                             , yammer                              },
+    { "yandex"                             , yandex                              },
+    { "yandex-international"               , yandex_international                },
+    { "yarn"                               , yarn                                },
+    { "yelp"                               , yelp                                },
+    { "yen-sign"                           , yen_sign                            },
+    { "yin-yang"                           , yin_yang                            },
+    { "yoast"                              , yoast                               },
+    { "youtube"                            , youtube                             },
+    { "youtube-square"                     , youtube_square                      },
+    { "zhihu"                              , zhihu                               },
+};
+
+constexpr int icon_names_count = sizeof(icon_names) / sizeof(icon_names[0]);
+
+/**
+ * Returns the code point of the icon called @a name.
+ *
+ * Used in a constant expression, the lookup happens at compile time and an
+ * unknown name fails to compile:
+ * @code
+ * constexpr int beer = fa::v5::icon_code("beer");
+ * @endcode
+ */
+constexpr int icon_code(const char* name)
+{
+    return detail::find(icon_names, 0, icon_names_count, name);
+}
+
+constexpr detail::name_entry icon_codes[] = {
+    { "caravan-alt"                        , caravan_alt                         },
+    { "cat-space"                          , cat_space                           },
+    { "coffee-pot"                         , coffee_pot                          },
+    { "comet"                              , comet                               },
+    { "fan-table"                          , fan_table                           },
+    { "faucet"                             , faucet                              },
+    { "faucet-drip"                        , faucet_drip                         },
+    { "firefox-browser"                    , firefox_browser                     },
+    { "galaxy"                             , galaxy                              },
+    { "garage"                             , garage                              },
+    { "garage-car"                         , garage_car                          },
+    { "garage-open"                        , garage_open                         },
+    { "heat"                               , heat                                },
+    { "house"                              , house                               },
+    { "house-day"                          , house_day                           },
+    { "house-leave"                        , house_leave                         },
+    { "house-night"                        , house_night                         },
+    { "house-return"                       , house_return                        },
+    { "house-signal"                       , house_signal                        },
+    { "ideal"                              , ideal                               },
+    { "lamp-desk"                          , lamp_desk                           },
+    { "lamp-floor"                         , lamp_floor                          },
+    { "light-ceiling"                      , light_ceiling                       },
+    { "light-switch"                       , light_switch                        },
+    { "light-switch-off"                   , light_switch_off                    },
+    { "light-switch-on"                    , light_switch_on                     },
+    { "microblog"                          , microblog                           },
+    { "microwave"                          , microwave                           },
+    { "outlet"                             , outlet                              },
+    { "oven"                               , oven                                },
+    { "pied-piper-square"                  , pied_piper_square                   },
+    { "planet-moon"                        , planet_moon                         },
+    { "planet-ringed"                      , planet_ringed                       },
+    { "police-box"                         , police_box                          },
+    { "portal-enter"                       , portal_enter                        },
+    { "portal-exit"                        , portal_exit                         },
+    { "radar"                              , radar                               },
+    { "raygun"                             , raygun                              },
+    { "refrigerator"                       , refrigerator                        },
+    { "rocket-launch"                      , rocket_launch                       },
+    { "sensor"                             , sensor                              },
+    { "sensor-alert"                       , sensor_alert                        },
+    { "sensor-fire"                        , sensor_fire                         },
+    { "sensor-on"                          , sensor_on                           },
+    { "sensor-smoke"                       , sensor_smoke                        },
+    { "siren"                              , siren                               },
+    { "siren-on"                           , siren_on                            },
+    { "solar-system"                       , solar_system                        },
+    { "sort-circle"                        , sort_circle                         },
+    { "sort-circle-down"                   , sort_circle_down                    },
+    { "sort-circle-up"                     , sort_circle_up                      },
+    { "space-station-moon"                 , space_station_moon                  },
+    { "space-station-moon-alt"             , space_station_moon_alt              },
+    { "sprinkler"                          , sprinkler                           },
+    { "star-shooting"                      , star_shooting                       },
+    { "starfighter"                        , starfighter                         },
+    { "starfighter-alt"                    , starfighter_alt                     },
+    { "starship"                           , starship                            },
+    { "starship-freighter"                 , starship_freighter                  },
+    { "sword-laser"                        , sword_laser                         },
+    { "sword-laser-alt"                    , sword_laser_alt                     },
+    { "swords-laser"                       , swords_laser                        },
+    { "telescope"                          , telescope                           },
+    { "temperature-down"                   , temperature_down                    },
+    { "temperature-up"                     , temperature_up                      },
+    { "trailer"                            , trailer                             },
+    { "transporter"                        , transporter                         },
+    { "transporter-1"                      , transporter_1                       },
+    { "transporter-2"                      , transporter_2                       },
+    { "transporter-3"                      , transporter_3                       },
+    { "transporter-empty"                  , transporter_empty                   },
+    { "ufo"                                , ufo                                 },
+    { "ufo-beam"                           , ufo_beam                            },
+    { "unity"                              , unity                               },
+    { "user-alien"                         , user_alien                          },
+    { "user-robot"                         , user_robot                          },
+    { "user-visor"                         , user_visor                          },
+    { "vacuum"                             , vacuum                              },
+    { "vacuum-robot"                       , vacuum_robot                        },
+    { "window-frame"                       , window_frame                        },
+    { "window-frame-open"                  , window_frame_open                   },
+    { "coffin-cross"                       , coffin_cross                        },
+    { "dailymotion"                        , dailymotion                         },
+    { "folder-download"                    , folder_download                     },
+    { "folder-upload"                      , folder_upload                       },
+    { "instagram-square"                   , instagram_square                    },
+    { "mixer"                              , mixer                               },
+    { "shopify"                            , shopify                             },
+    { "user-unlock"                        , user_unlock                         },
+    { "bacteria"                           , bacteria                            },
+    { "bacterium"                          , bacterium                           },
+    { "box-tissue"                         , box_tissue                          },
+    { "hand-holding-medical"               , hand_holding_medical                },
+    { "hand-sparkles"                      , hand_sparkles                       },
+    { "hands-wash"                         , hands_wash                          },
+    { "handshake-alt-slash"                , handshake_alt_slash                 },
+    { "handshake-slash"                    , handshake_slash                     },
+    { "head-side-cough"                    , head_side_cough                     },
+    { "head-side-cough-slash"              , head_side_cough_slash               },
+    { "head-side-mask"                     , head_side_mask                      },
+    { "head-side-virus"                    , head_side_virus                     },
+    { "house-user"                         , house_user                          },
+    { "laptop-house"                       , laptop_house                        },
+    { "lungs-virus"                        , lungs_virus                         },
+    { "people-arrows"                      , people_arrows                       },
+    { "plane-slash"                        , plane_slash                         },
+    { "pump-medical"                       , pump_medical                        },
+    { "pump-soap"                          , pump_soap                           },
+    { "shield-virus"                       , shield_virus                        },
+    { "sink"                               , sink                                },
+    { "soap"                               , soap                                },
+    { "stopwatch-20"                       , stopwatch_20                        },
+    { "store-alt-slash"                    , store_alt_slash                     },
+    { "store-slash"                        , store_slash                         },
+    { "toilet-paper-slash"                 , toilet_paper_slash                  },
+    { "users-slash"                        , users_slash                         },
+    { "virus"                              , virus                               },
+    { "virus-slash"                        , virus_slash                         },
+    { "viruses"                            , viruses                             },
+    { "deezer"                             , deezer                              },
+    { "edge-legacy"                        , edge_legacy                         },
+    { "google-pay"                         , google_pay                          },
+    { "rust"                               , rust                                },
+    { "tiktok"                             , tiktok                              },
+    { "unsplash"                           , unsplash                            },
+    { "cloudflare"                         , cloudflare                          },
+    { "guilded"                            , guilded                             },
+    { "hive"                               , hive                                },
+    { "innosoft"                           , innosoft                            },
+    { "instalod"                           , instalod                            },
+    { "octopus-deploy"                     , octopus_deploy                      },
+    { "perbyte"                            , perbyte                             },
+    { "uncharted"                          , uncharted                           },
+    { "vest"                               , vest                                },
+    { "vest-patches"                       , vest_patches                        },
+    { "watchman-monitoring"                , watchman_monitoring                 },
+    { "wodu"                               , wodu                                },
+    { "glass-martini"                      , glass_martini                       },
+    { "music"                              , music                               },
+    { "search"                             , search                              },
+    { "heart"                              , heart                               },
+    { "star"                               , star                                },
+    { "user"                               , user                                },
+    { "film"                               , film                                },
+    { "th-large"                           , th_large                            },
+    { "th"                                 , th                                  },
+    { "th-list"                            , th_list                             },
+    { "check"                              , check                               },
+    { "times"                              , times                               },
+    { "search-plus"                        , search_plus                         },
+    { "search-minus"                       , search_minus                        },
+    { "power-off"                          , power_off                           },
+    { "signal"                             , signal                              },
+    { "cog"                                , cog                                 },
+    { "home"                               , home                                },
+    { "clock"                              , clock                               },
+    { "road"                               , road                                },
+    { "download"                           , download                            },
+    { "inbox"                              , inbox                               },
+    { "redo"                               , redo                                },
+    { "sync"                               , sync                                },
+    { "list-alt"                           , list_alt                            },
+    { "lock"                               , lock                                },
+    { "flag"                               , flag                                },
+    { "headphones"                         , headphones                          },
+    { "volume-off"                         , volume_off                          },
+    { "volume-down"                        , volume_down                         },
+    { "volume-up"                          , volume_up                           },
+    { "qrcode"                             , qrcode                              },
+    { "barcode"                            , barcode                             },
+    { "tag"                                , tag                                 },
+    { "tags"                               , tags                                },
+    { "book"                               , book                                },
+    { "bookmark"                           , bookmark                            },
+    { "print"                              , print                               },
+    { "camera"                             , camera                              },
+    { "font"                               , font                                },
+    { "bold"                               , bold                                },
+    { "italic"                             , italic                              },
+    { "text-height"                        , text_height                         },
+    { "text-width"                         , text_width                          },
+    { "align-left"                         , align_left                          },
+    { "align-center"                       , align_center                        },
+    { "align-right"                        , align_right                         },
+    { "align-justify"                      , align_justify                       },
+    { "list"                               , list                                },
+    { "outdent"                            , outdent                             },
+    { "indent"                             , indent                              },
+    { "video"                              , video                               },
+    { "image"                              , image                               },
+    { "pencil"                             , pencil                              },
+    { "map-marker"                         , map_marker                          },
+    { "adjust"                             , adjust                              },
+    { "tint"                               , tint                                },
+    { "edit"                               , edit                                },
+    { "arrows"                             , arrows                              },
+    { "step-backward"                      , step_backward                       },
+    { "fast-backward"                      , fast_backward                       },
+    { "backward"                           , backward                            },
+    { "play"                               , play                                },
+    { "pause"                              , pause                               },
+    { "stop"                               , stop                                },
+    { "forward"                            , forward                             },
+    { "fast-forward"                       , fast_forward                        },
+    { "step-forward"                       , step_forward                        },
+    { "eject"                              , eject                               },
+    { "chevron-left"                       , chevron_left                        },
+    { "chevron-right"                      , chevron_right                       },
+    { "plus-circle"                        , plus_circle                         },
+    { "minus-circle"                       , minus_circle                        },
+    { "times-circle"                       , times_circle                        },
+    { "check-circle"                       , check_circle                        },
+    { "question-circle"                    , question_circle                     },
+    { "info-circle"                        , info_circle                         },
+    { "crosshairs"                         , crosshairs                          },
+    { "ban"                                , ban                                 },
+    { "arrow-left"                         , arrow_left                          },
+    { "arrow-right"                        , arrow_right                         },
+    { "arrow-up"                           , arrow_up                            },
+    { "arrow-down"                         , arrow_down                          },
+    { "share"                              , share                               },
+    { "expand"                             , expand                              },
+    { "compress"                           , compress                            },
+    { "plus"                               , plus                                },
+    { "minus"                              , minus                               },
+    { "asterisk"                           , asterisk                            },
+    { "exclamation-circle"                 , exclamation_circle                  },
+    { "gift"                               , gift                                },
+    { "leaf"                               , leaf                                },
+    { "fire"                               , fire                                },
+    { "eye"                                , eye                                 },
+    { "eye-slash"                          , eye_slash                           },
+    { "exclamation-triangle"               , exclamation_triangle                },
+    { "plane"                              , plane                               },
+    { "calendar-alt"                       , calendar_alt                        },
+    { "random"                             , random                              },
+    { "comment"                            , comment                             },
+    { "magnet"                             , magnet                              },
+    { "chevron-up"                         , chevron_up                          },
+    { "chevron-down"                       , chevron_down                        },
+    { "retweet"                            , retweet                             },
+    { "shopping-cart"                      , shopping_cart                       },
+    { "folder"                             , folder                              },
+    { "folder-open"                        , folder_open                         },
+    { "arrows-v"                           , arrows_v                            },
+    { "arrows-h"                           , arrows_h                            },
+    { "chart-bar"                          , chart_bar                           },
+    { "twitter-square"                     , twitter_square                      },
+    { "facebook-square"                    , facebook_square                     },
+    { "camera-retro"                       , camera_retro                        },
+    { "key"                                , key                                 },
+    { "cogs"                               , cogs                                },
+    { "comments"                           , comments                            },
+    { "star-half"                          , star_half                           },
+    { "sign-out"                           , sign_out                            },
+    { "linkedin"                           , linkedin                            },
+    { "thumbtack"                          , thumbtack                           },
+    { "external-link"                      , external_link                       },
+    { "sign-in"                            , sign_in                             },
+    { "trophy"                             , trophy                              },
+    { "github-square"                      , github_square                       },
+    { "upload"                             , upload                              },
+    { "lemon"                              , lemon                               },
+    { "phone"                              , phone                               },
+    { "phone-square"                       , phone_square                        },
+    { "twitter"                            , twitter                             },
+    { "facebook"                           , facebook                            },
+    { "github"                             , github                              },
+    { "unlock"                             , unlock                              },
+    { "credit-card"                        , credit_card                         },
+    { "rss"                                , rss                                 },
+    { "hdd"                                , hdd                                 },
+    { "bullhorn"                           , bullhorn                            },
+    { "certificate"                        , certificate                         },
+    { "hand-point-right"                   , hand_point_right                    },
+    { "hand-point-left"                    , hand_point_left                     },
+    { "hand-point-up"                      , hand_point_up                       },
+    { "hand-point-down"                    , hand_point_down                     },
+    { "arrow-circle-left"                  , arrow_circle_left                   },
+    { "arrow-circle-right"                 , arrow_circle_right                  },
+    { "arrow-circle-up"                    , arrow_circle_up                     },
+    { "arrow-circle-down"                  , arrow_circle_down                   },
+    { "globe"                              , globe                               },
+    { "wrench"                             , wrench                              },
+    { "tasks"                              , tasks                               },
+    { "filter"                             , filter                              },
+    { "briefcase"                          , briefcase                           },
+    { "arrows-alt"                         , arrows_alt                          },
+    { "users"                              , users                               },
+    { "link"                               , link                                },
+    { "cloud"                              , cloud                               },
+    { "flask"                              , flask                               },
+    { "cut"                                , cut                                 },
+    { "copy"                               , copy                                },
+    { "paperclip"                          , paperclip                           },
+    { "save"                               , save                                },
+    { "square"                             , square                              },
+    { "bars"                               , bars                                },
+    { "list-ul"                            , list_ul                             },
+    { "list-ol"                            , list_ol                             },
+    { "strikethrough"                      , strikethrough                       },
+    { "underline"                          , underline                           },
+    { "table"                              , table                               },
+    { "magic"                              , magic                               },
+    { "truck"                              , truck                               },
+    { "pinterest"                          , pinterest                           },
+    { "pinterest-square"                   , pinterest_square                    },
+    { "google-plus-square"                 , google_plus_square                  },
+    { "google-plus-g"                      , google_plus_g                       },
+    { "money-bill"                         , money_bill                          },
+    { "caret-down"                         , caret_down                          },
+    { "caret-up"                           , caret_up                            },
+    { "caret-left"                         , caret_left                          },
+    { "caret-right"                        , caret_right                         },
+    { "columns"                            , columns                             },
+    { "sort"                               , sort                                },
+    { "sort-down"                          , sort_down                           },
+    { "sort-up"                            , sort_up                             },
+    { "envelope"                           , envelope                            },
+    { "linkedin-in"                        , linkedin_in                         },
+    { "undo"                               , undo                                },
+    { "gavel"                              , gavel                               },
+    { "tachometer"                         , tachometer                          },
+    { "bolt"                               , bolt                                },
+    { "sitemap"                            , sitemap                             },
+    { "umbrella"                           , umbrella                            },
+    { "paste"                              , paste                               },
+    { "lightbulb"                          , lightbulb                           },
+    { "exchange"                           , exchange                            },
+    { "cloud-download"                     , cloud_download                      },
+    { "cloud-upload"                       , cloud_upload                        },
+    { "user-md"                            , user_md                             },
+    { "stethoscope"                        , stethoscope                         },
+    { "suitcase"                           , suitcase                            },
+    { "bell"                               , bell                                },
+    { "coffee"                             , coffee                              },
+    { "hospital"                           , hospital                            },
+    { "ambulance"                          , ambulance                           },
+    { "medkit"                             , medkit                              },
+    { "fighter-jet"                        , fighter_jet                         },
+    { "beer"                               , beer                                },
+    { "h-square"                           , h_square                            },
+    { "plus-square"                        , plus_square                         },
+    { "angle-double-left"                  , angle_double_left                   },
+    { "angle-double-right"                 , angle_double_right                  },
+    { "angle-double-up"                    , angle_double_up                     },
+    { "angle-double-down"                  , angle_double_down                   },
+    { "angle-left"                         , angle_left                          },
+    { "angle-right"                        , angle_right                         },
+    { "angle-up"                           , angle_up                            },
+    { "angle-down"                         , angle_down                          },
+    { "desktop"                            , desktop                             },
+    { "laptop"                             , laptop                              },
+    { "tablet"                             , tablet                              },
+    { "mobile"                             , mobile                              },
+    { "quote-left"                         , quote_left                          },
+    { "quote-right"                        , quote_right                         },
+    { "spinner"                            , spinner                             },
+    { "circle"                             , circle                              },
+    { "github-alt"                         , github_alt                          },
+    { "smile"                              , smile                               },
+    { "frown"                              , frown                               },
+    { "meh"                                , meh                                 },
+    { "gamepad"                            , gamepad                             },
+    { "keyboard"                           , keyboard                            },
+    { "flag-checkered"                     , flag_checkered                      },
+    { "terminal"                           , terminal                            },
+    { "code"                               , code                                },
+    { "reply-all"                          , reply_all                           },
+    { "location-arrow"                     , location_arrow                      },
+    { "crop"                               , crop                                },
+    { "code-branch"                        , code_branch                         },
+    { "unlink"                             , unlink                              },
+    { "question"                           , question                            },
+    { "info"                               , info                                },
+    { "exclamation"                        , exclamation                         },
+    { "superscript"                        , superscript                         },
+    { "subscript"                          , subscript                           },
+    { "eraser"                             , eraser                              },
+    { "puzzle-piece"                       , puzzle_piece                        },
+    { "microphone"                         , microphone                          },
+    { "microphone-slash"                   , microphone_slash                    },
+    { "shield"                             , shield                              },
+    { "calendar"                           , calendar                            },
+    { "fire-extinguisher"                  , fire_extinguisher                   },
+    { "rocket"                             , rocket                              },
+    { "maxcdn"                             , maxcdn                              },
+    { "chevron-circle-left"                , chevron_circle_left                 },
+    { "chevron-circle-right"               , chevron_circle_right                },
+    { "chevron-circle-up"                  , chevron_circle_up                   },
+    { "chevron-circle-down"                , chevron_circle_down                 },
+    { "html5"                              , html5                               },
+    { "css3"                               , css3                                },
+    { "anchor"                             , anchor                              },
+    { "unlock-alt"                         , unlock_alt                          },
+    { "bullseye"                           , bullseye                            },
+    { "ellipsis-h"                         , ellipsis_h                          },
+    { "ellipsis-v"                         , ellipsis_v                          },
+    { "rss-square"                         , rss_square                          },
+    { "play-circle"                        , play_circle                         },
+    { "ticket"                             , ticket                              },
+    { "minus-square"                       , minus_square                        },
+    { "level-up"                           , level_up                            },
+    { "level-down"                         , level_down                          },
+    { "check-square"                       , check_square                        },
+    { "pen-square"                         , pen_square                          },
+    { "external-link-square"               , external_link_square                },
+    { "share-square"                       , share_square                        },
+    { "compass"                            , compass                             },
+    { "caret-square-down"                  , caret_square_down                   },
+    { "caret-square-up"                    , caret_square_up                     },
+    { "caret-square-right"                 , caret_square_right                  },
+    { "euro-sign"                          , euro_sign                           },
+    { "pound-sign"                         , pound_sign                          },
+    { "dollar-sign"                        , dollar_sign                         },
+    { "rupee-sign"                         , rupee_sign                          },
+    { "yen-sign"                           , yen_sign                            },
+    { "ruble-sign"                         , ruble_sign                          },
+    { "won-sign"                           , won_sign                            },
+    { "btc"                                , btc                                 },
+    { "file"                               , file                                },
+    { "file-alt"                           , file_alt                            },
+    { "sort-alpha-down"                    , sort_alpha_down                     },
+    { "sort-alpha-up"                      , sort_alpha_up                       },
+    { "sort-amount-down"                   , sort_amount_down                    },
+    { "sort-amount-up"                     , sort_amount_up                      },
+    { "sort-numeric-down"                  , sort_numeric_down                   },
+    { "sort-numeric-up"                    , sort_numeric_up                     },
+    { "thumbs-up"                          , thumbs_up                           },
+    { "thumbs-down"                        , thumbs_down                         },
+    { "youtube"                            , youtube                             },
+    { "xing"                               , xing                                },
+    { "xing-square"                        , xing_square                         },
+    { "dropbox"                            , dropbox                             },
+    { "stack-overflow"                     , stack_overflow                      },
+    { "instagram"                          , instagram                           },
+    { "flickr"                             , flickr                              },
+    { "adn"                                , adn                                 },
+    { "bitbucket"                          , bitbucket                           },
+    { "tumblr"                             , tumblr                              },
+    { "tumblr-square"                      , tumblr_square                       },
+    { "long-arrow-down"                    , long_arrow_down                     },
+    { "long-arrow-up"                      , long_arrow_up                       },
+    { "long-arrow-left"                    , long_arrow_left                     },
+    { "long-arrow-right"                   , long_arrow_right                    },
+    { "apple"                              , apple                               },
+    { "windows"                            , windows                             },
+    { "android"                            , android                             },
+    { "linux"                              , _linux                              },
+    { "dribbble"                           , dribbble                            },
+    { "skype"                              , skype                               },
+    { "foursquare"                         , foursquare                          },
+    { "trello"                             , trello                              },
+    { "female"                             , female                              },
+    { "male"                               , male                                },
+    { "gratipay"                           , gratipay                            },
+    { "sun"                                , sun                                 },
+    { "moon"                               , moon                                },
+    { "archive"                            , archive                             },
+    { "bug"                                , bug                                 },
+    { "vk"                                 , vk                                  },
+    { "weibo"                              , weibo                               },
+    { "renren"                             , renren                              },
+    { "pagelines"                          , pagelines                           },
+    { "stack-exchange"                     , stack_exchange                      },
+    { "caret-square-left"                  , caret_square_left                   },
+    { "dot-circle"                         , dot_circle                          },
+    { "wheelchair"                         , wheelchair                          },
+    { "vimeo-square"                       , vimeo_square                        },
+    { "lira-sign"                          , lira_sign                           },
+    { "space-shuttle"                      , space_shuttle                       },
+    { "slack"                              , slack                               },
+    { "envelope-square"                    , envelope_square                     },
+    { "wordpress"                          , wordpress                           },
+    { "openid"                             , openid                              },
+    { "university"                         , university                          },
+    { "graduation-cap"                     , graduation_cap                      },
+    { "yahoo"                              , yahoo                               },
+    { "google"                             , google                              },
+    { "reddit"                             , reddit                              },
+    { "reddit-square"                      , reddit_square                       },
+    { "stumbleupon-circle"                 , stumbleupon_circle                  },
+    { "stumbleupon"                        , stumbleupon                         },
+    { "delicious"                          , delicious                           },
+    { "digg"                               , digg                                },
+    { "pied-piper-pp"                      , pied_piper_pp                       },
+    { "pied-piper-alt"                     , pied_piper_alt                      },
+    { "drupal"                             , drupal                              },
+    { "joomla"                             , joomla                              },
+    { "language"                           , language                            },
+    { "fax"                                , fax                                 },
+    { "building"                           , building                            },
+    { "child"                              , child                               },
+    { "paw"                                , paw                                 },
+    { "cube"                               , cube                                },
+    { "cubes"                              , cubes                               },
+    { "behance"                            , behance                             },
+    { "behance-square"                     , behance_square                      },
+    { "steam"                              , steam                               },
+    { "steam-square"                       , steam_square                        },
+    { "recycle"                            , recycle                             },
+    { "car"                                , car                                 },
+    { "taxi"                               , taxi                                },
+    { "tree"                               , tree                                },
+    { "spotify"                            , spotify                             },
+    { "deviantart"                         , deviantart                          },
+    { "soundcloud"                         , soundcloud                          },
+    { "database"                           , database                            },
+    { "file-pdf"                           , file_pdf                            },
+    { "file-word"                          , file_word                           },
+    { "file-excel"                         , file_excel                          },
+    { "file-powerpoint"                    , file_powerpoint                     },
+    { "file-image"                         , file_image                          },
+    { "file-archive"                       , file_archive                        },
+    { "file-audio"                         , file_audio                          },
+    { "file-video"                         , file_video                          },
+    { "file-code"                          , file_code                           },
+    { "vine"                               , vine                                },
+    { "codepen"                            , codepen                             },
+    { "jsfiddle"                           , jsfiddle                            },
+    { "life-ring"                          , life_ring                           },
+    { "circle-notch"                       , circle_notch                        },
+    { "rebel"                              , rebel                               },
+    { "empire"                             , empire                              },
+    { "git-square"                         , git_square                          },
+    { "git"                                , git                                 },
+    { "hacker-news"                        , hacker_news                         },
+    { "tencent-weibo"                      , tencent_weibo                       },
+    { "qq"                                 , qq                                  },
+    { "weixin"                             , weixin                              },
+    { "paper-plane"                        , paper_plane                         },
+    { "history"                            , history                             },
+    { "heading"                            , heading                             },
+    { "paragraph"                          , paragraph                           },
+    { "sliders-h"                          , sliders_h                           },
+    { "share-alt"                          , share_alt                           },
+    { "share-alt-square"                   , share_alt_square                    },
+    { "bomb"                               , bomb                                },
+    { "futbol"                             , futbol                              },
+    { "tty"                                , tty                                 },
+    { "binoculars"                         , binoculars                          },
+    { "plug"                               , plug                                },
+    { "slideshare"                         , slideshare                          },
+    { "twitch"                             , twitch                              },
+    { "yelp"                               , yelp                                },
+    { "newspaper"                          , newspaper                           },
+    { "wifi"                               , wifi                                },
+    { "calculator"                         , calculator                          },
+    { "paypal"                             , paypal                              },
+    { "google-wallet"                      , google_wallet                       },
+    { "cc-visa"                            , cc_visa                             },
+    { "cc-mastercard"                      , cc_mastercard                       },
+    { "cc-discover"                        , cc_discover                         },
+    { "cc-amex"                            , cc_amex                             },
+    { "cc-paypal"                          , cc_paypal                           },
+    { "cc-stripe"                          , cc_stripe                           },
+    { "bell-slash"                         , bell_slash                          },
+    { "trash"                              , trash                               },
+    { "copyright"                          , copyright                           },
+    { "at"                                 , at                                  },
+    { "eye-dropper"                        , eye_dropper                         },
+    { "paint-brush"                        , paint_brush                         },
+    { "birthday-cake"                      , birthday_cake                       },
+    { "chart-area"                         , chart_area                          },
+    { "chart-pie"                          , chart_pie                           },
+    { "chart-line"                         , chart_line                          },
+    { "lastfm"                             , lastfm                              },
+    { "lastfm-square"                      , lastfm_square                       },
+    { "toggle-off"                         , toggle_off                          },
+    { "toggle-on"                          , toggle_on                           },
+    { "bicycle"                            , bicycle                             },
+    { "bus"                                , bus                                 },
+    { "ioxhost"                            , ioxhost                             },
+    { "angellist"                          , angellist                           },
+    { "closed-captioning"                  , closed_captioning                   },
+    { "shekel-sign"                        , shekel_sign                         },
+    { "buysellads"                         , buysellads                          },
+    { "connectdevelop"                     , connectdevelop                      },
+    { "dashcube"                           , dashcube                            },
+    { "forumbee"                           , forumbee                            },
+    { "leanpub"                            , leanpub                             },
+    { "sellsy"                             , sellsy                              },
+    { "shirtsinbulk"                       , shirtsinbulk                        },
+    { "simplybuilt"                        , simplybuilt                         },
+    { "skyatlas"                           , skyatlas                            },
+    { "cart-plus"                          , cart_plus                           },
+    { "cart-arrow-down"                    , cart_arrow_down                     },
+    { "diamond"                            , diamond                             },
+    { "ship"                               , ship                                },
+    { "user-secret"                        , user_secret                         },
+    { "motorcycle"                         , motorcycle                          },
+    { "street-view"                        , street_view                         },
+    { "heartbeat"                          , heartbeat                           },
+    { "venus"                              , venus                               },
+    { "mars"                               , mars                                },
+    { "mercury"                            , mercury                             },
+    { "transgender"                        , transgender                         },
+    { "transgender-alt"                    , transgender_alt                     },
+    { "venus-double"                       , venus_double                        },
+    { "mars-double"                        , mars_double                         },
+    { "venus-mars"                         , venus_mars                          },
+    { "mars-stroke"                        , mars_stroke                         },
+    { "mars-stroke-v"                      , mars_stroke_v                       },
+    { "mars-stroke-h"                      , mars_stroke_h                       },
+    { "neuter"                             , neuter                              },
+    { "genderless"                         , genderless                          },
+    { "pinterest-p"                        , pinterest_p                         },
+    { "whatsapp"                           , whatsapp                            },
+    { "server"                             , server                              },
+    { "user-plus"                          , user_plus                           },
+    { "user-times"                         , user_times                          },
+    { "bed"                                , bed                                 },
+    { "viacoin"                            , viacoin                             },
+    { "train"                              , train                               },
+    { "subway"                             , subway                              },
+    { "medium"                             , medium                              },
+    { "y-combinator"                       , y_combinator                        },
+    { "optin-monster"                      , optin_monster                       },
+    { "opencart"                           , opencart                            },
+    { "expeditedssl"                       , expeditedssl                        },
+    { "battery-full"                       , battery_full                        },
+    { "battery-three-quarters"             , battery_three_quarters              },
+    { "battery-half"                       , battery_half                        },
+    { "battery-quarter"                    , battery_quarter                     },
+    { "battery-empty"                      , battery_empty                       },
+    { "mouse-pointer"                      , mouse_pointer                       },
+    { "i-cursor"                           , i_cursor                            },
+    { "object-group"                       , object_group                        },
+    { "object-ungroup"                     , object_ungroup                      },
+    { "sticky-note"                        , sticky_note                         },
+    { "cc-jcb"                             , cc_jcb                              },
+    { "cc-diners-club"                     , cc_diners_club                      },
+    { "clone"                              , clone                               },
+    { "balance-scale"                      , balance_scale                       },
+    { "hourglass-start"                    , hourglass_start                     },
+    { "hourglass-half"                     , hourglass_half                      },
+    { "hourglass-end"                      , hourglass_end                       },
+    { "hourglass"                          , hourglass                           },
+    { "hand-rock"                          , hand_rock                           },
+    { "hand-paper"                         , hand_paper                          },
+    { "hand-scissors"                      , hand_scissors                       },
+    { "hand-lizard"                        , hand_lizard                         },
+    { "hand-spock"                         , hand_spock                          },
+    { "hand-pointer"                       , hand_pointer                        },
+    { "hand-peace"                         , hand_peace                          },
+    { "trademark"                          , trademark                           },
+    { "registered"                         , registered                          },
+    { "creative-commons"                   , creative_commons                    },
+    { "gg"                                 , gg                                  },
+    { "gg-circle"                          , gg_circle                           },
+    { "tripadvisor"                        , tripadvisor                         },
+    { "odnoklassniki"                      , odnoklassniki                       },
+    { "odnoklassniki-square"               , odnoklassniki_square                },
+    { "get-pocket"                         , get_pocket                          },
+    { "wikipedia-w"                        , wikipedia_w                         },
+    { "safari"                             , safari                              },
+    { "chrome"                             , chrome                              },
+    { "firefox"                            , firefox                             },
+    { "opera"                              , opera                               },
+    { "internet-explorer"                  , internet_explorer                   },
+    { "tv"                                 , tv                                  },
+    { "contao"                             , contao                              },
+    { "500px"                              , _500px                              },
+    { "amazon"                             , amazon                              },
+    { "calendar-plus"                      , calendar_plus                       },
+    { "calendar-minus"                     , calendar_minus                      },
+    { "calendar-times"                     , calendar_times                      },
+    { "calendar-check"                     , calendar_check                      },
+    { "industry"                           , industry                            },
+    { "map-pin"                            , map_pin                             },
+    { "map-signs"                          , map_signs                           },
+    { "map"                                , map                                 },
+    { "comment-alt"                        , comment_alt                         },
+    { "houzz"                              , houzz                               },
+    { "vimeo-v"                            , vimeo_v                             },
+    { "black-tie"                          , black_tie                           },
+    { "fonticons"                          , fonticons                           },
+    { "reddit-alien"                       , reddit_alien                        },
+    { "edge"                               , edge                                },
+    { "codiepie"                           , codiepie                            },
+    { "modx"                               , modx                                },
+    { "fort-awesome"                       , fort_awesome                        },
+    { "usb"                                , usb                                 },
+    { "product-hunt"                       , product_hunt                        },
+    { "mixcloud"                           , mixcloud                            },
+    { "scribd"                             , scribd                              },
+    { "pause-circle"                       , pause_circle                        },
+    { "stop-circle"                        , stop_circle                         },
+    { "shopping-bag"                       , shopping_bag                        },
+    { "shopping-basket"                    , shopping_basket                     },
+    { "hashtag"                            , hashtag                             },
+    { "bluetooth"                          , bluetooth                           },
+    { "bluetooth-b"                        , bluetooth_b                         },
+    { "percent"                            , percent                             },
+    { "gitlab"                             , gitlab                              },
+    { "wpbeginner"                         , wpbeginner                          },
+    { "wpforms"                            , wpforms                             },
+    { "envira"                             , envira                              },
+    { "universal-access"                   , universal_access                    },
+    { "blind"                              , blind                               },
+    { "audio-description"                  , audio_description                   },
+    { "phone-volume"                       , phone_volume                        },
+    { "braille"                            , braille                             },
+    { "assistive-listening-systems"        , assistive_listening_systems         },
+    { "american-sign-language-interpreting", american_sign_language_interpreting },
+    { "deaf"                               , deaf                                },
+    { "glide"                              , glide                               },
+    { "glide-g"                            , glide_g                             },
+    { "sign-language"                      , sign_language                       },
+    { "low-vision"                         , low_vision                          },
+    { "viadeo"                             , viadeo                              },
+    { "viadeo-square"                      , viadeo_square                       },
+    { "snapchat"                           , snapchat                            },
+    { "snapchat-ghost"                     , snapchat_ghost                      },
+    { "snapchat-square"                    , snapchat_square                     },
+    { "pied-piper"                         , pied_piper                          },
+    { "first-order"                        , first_order                         },
+    { "yoast"                              , yoast                               },
+    { "themeisle"                          , themeisle                           },
+    { "google-plus"                        , google_plus                         },
+    { "font-awesome"                       , font_awesome                        },
+    { "handshake"                          , handshake                           },
+    { "envelope-open"                      , envelope_open                       },
+    { "linode"                             , linode                              },
+    { "address-book"                       , address_book                        },
+    { "address-card"                       , address_card                        },
+    { "user-circle"                        , user_circle                         },
+    { "id-badge"                           , id_badge                            },
+    { "id-card"                            , id_card                             },
+    { "quora"                              , quora                               },
+    { "free-code-camp"                     , free_code_camp                      },
+    { "telegram"                           , telegram                            },
+    { "thermometer-full"                   , thermometer_full                    },
+    { "thermometer-three-quarters"         , thermometer_three_quarters          },
+    { "thermometer-half"                   , thermometer_half                    },
+    { "thermometer-quarter"                , thermometer_quarter                 },
+    { "thermometer-empty"                  , thermometer_empty                   },
+    { "shower"                             , shower                              },
+    { "bath"                               , bath                                },
+    { "podcast"                            , podcast                             },
+    { "window-maximize"                    , window_maximize                     },
+    { "window-minimize"                    , window_minimize                     },
+    { "window-restore"                     , window_restore                      },
+    { "times-square"                       , times_square                        },
+    { "bandcamp"                           , bandcamp                            },
+    { "grav"                               , grav                                },
+    { "etsy"                               , etsy                                },
+    { "imdb"                               , imdb                                },
+    { "ravelry"                            , ravelry                             },
+    { "sellcast"                           , sellcast                            },
+    { "microchip"                          , microchip                           },
+    { "snowflake"                          , snowflake                           },
+    { "superpowers"                        , superpowers                         },
+    { "wpexplorer"                         , wpexplorer                          },
+    { "meetup"                             , meetup                              },
+    { "watch"                              , watch                               },
+    { "volume-slash"                       , volume_slash                        },
+    { "utensil-fork"                       , utensil_fork                        },
+    { "utensil-knife"                      , utensil_knife                       },
+    { "utensil-spoon"                      , utensil_spoon                       },
+    { "utensils-alt"                       , utensils_alt                        },
+    { "utensils"                           , utensils                            },
+    { "usd-circle"                         , usd_circle                          },
+    { "usd-square"                         , usd_square                          },
+    { "undo-alt"                           , undo_alt                            },
+    { "trophy-alt"                         , trophy_alt                          },
+    { "triangle"                           , triangle                            },
+    { "trash-alt"                          , trash_alt                           },
+    { "times-hexagon"                      , times_hexagon                       },
+    { "times-octagon"                      , times_octagon                       },
+    { "sync-alt"                           , sync_alt                            },
+    { "stopwatch"                          , stopwatch                           },
+    { "star-exclamation"                   , star_exclamation                    },
+    { "spade"                              , spade                               },
+    { "sign-out-alt"                       , sign_out_alt                        },
+    { "sign-in-alt"                        , sign_in_alt                         },
+    { "shield-check"                       , shield_check                        },
+    { "scrubber"                           , scrubber                            },
+    { "redo-alt"                           , redo_alt                            },
+    { "rectangle-landscape"                , rectangle_landscape                 },
+    { "rectangle-portrait"                 , rectangle_portrait                  },
+    { "rectangle-wide"                     , rectangle_wide                      },
+    { "question-square"                    , question_square                     },
+    { "poo"                                , poo                                 },
+    { "plus-hexagon"                       , plus_hexagon                        },
+    { "plus-octagon"                       , plus_octagon                        },
+    { "images"                             , images                              },
+    { "pencil-alt"                         , pencil_alt                          },
+    { "pen"                                , pen                                 },
+    { "pen-alt"                            , pen_alt                             },
+    { "octagon"                            , octagon                             },
+    { "minus-hexagon"                      , minus_hexagon                       },
+    { "minus-octagon"                      , minus_octagon                       },
+    { "long-arrow-alt-down"                , long_arrow_alt_down                 },
+    { "long-arrow-alt-left"                , long_arrow_alt_left                 },
+    { "long-arrow-alt-right"               , long_arrow_alt_right                },
+    { "long-arrow-alt-up"                  , long_arrow_alt_up                   },
+    { "lock-alt"                           , lock_alt                            },
+    { "jack-o-lantern"                     , jack_o_lantern                      },
+    { "info-square"                        , info_square                         },
+    { "inbox-in"                           , inbox_in                            },
+    { "inbox-out"                          , inbox_out                           },
+    { "hexagon"                            , hexagon                             },
+    { "h1"                                 , h1                                  },
+    { "h2"                                 , h2                                  },
+    { "h3"                                 , h3                                  },
+    { "file-check"                         , file_check                          },
+    { "file-times"                         , file_times                          },
+    { "file-minus"                         , file_minus                          },
+    { "file-plus"                          , file_plus                           },
+    { "file-exclamation"                   , file_exclamation                    },
+    { "file-edit"                          , file_edit                           },
+    { "expand-arrows"                      , expand_arrows                       },
+    { "expand-arrows-alt"                  , expand_arrows_alt                   },
+    { "expand-wide"                        , expand_wide                         },
+    { "exclamation-square"                 , exclamation_square                  },
+    { "chevron-double-down"                , chevron_double_down                 },
+    { "chevron-double-left"                , chevron_double_left                 },
+    { "chevron-double-right"               , chevron_double_right                },
+    { "chevron-double-up"                  , chevron_double_up                   },
+    { "compress-wide"                      , compress_wide                       },
+    { "club"                               , club                                },
+    { "clipboard"                          , clipboard                           },
+    { "chevron-square-down"                , chevron_square_down                 },
+    { "chevron-square-left"                , chevron_square_left                 },
+    { "chevron-square-right"               , chevron_square_right                },
+    { "chevron-square-up"                  , chevron_square_up                   },
+    { "caret-circle-down"                  , caret_circle_down                   },
+    { "caret-circle-left"                  , caret_circle_left                   },
+    { "caret-circle-right"                 , caret_circle_right                  },
+    { "caret-circle-up"                    , caret_circle_up                     },
+    { "camera-alt"                         , camera_alt                          },
+    { "calendar-edit"                      , calendar_edit                       },
+    { "calendar-exclamation"               , calendar_exclamation                },
+    { "badge"                              , badge                               },
+    { "badge-check"                        , badge_check                         },
+    { "arrows-alt-h"                       , arrows_alt_h                        },
+    { "arrows-alt-v"                       , arrows_alt_v                        },
+    { "arrow-square-down"                  , arrow_square_down                   },
+    { "arrow-square-left"                  , arrow_square_left                   },
+    { "arrow-square-right"                 , arrow_square_right                  },
+    { "arrow-square-up"                    , arrow_square_up                     },
+    { "arrow-to-bottom"                    , arrow_to_bottom                     },
+    { "arrow-to-left"                      , arrow_to_left                       },
+    { "arrow-to-right"                     , arrow_to_right                      },
+    { "arrow-to-top"                       , arrow_to_top                        },
+    { "arrow-from-bottom"                  , arrow_from_bottom                   },
+    { "arrow-from-left"                    , arrow_from_left                     },
+    { "arrow-from-right"                   , arrow_from_right                    },
+    { "arrow-from-top"                     , arrow_from_top                      },
+    { "arrow-alt-from-bottom"              , arrow_alt_from_bottom               },
+    { "arrow-alt-from-left"                , arrow_alt_from_left                 },
+    { "arrow-alt-from-right"               , arrow_alt_from_right                },
+    { "arrow-alt-from-top"                 , arrow_alt_from_top                  },
+    { "arrow-alt-to-bottom"                , arrow_alt_to_bottom                 },
+    { "arrow-alt-to-left"                  , arrow_alt_to_left                   },
+    { "arrow-alt-to-right"                 , arrow_alt_to_right                  },
+    { "arrow-alt-to-top"                   , arrow_alt_to_top                    },
+    { "alarm-clock"                        , alarm_clock                         },
+    { "arrow-alt-square-down"              , arrow_alt_square_down               },
+    { "arrow-alt-square-left"              , arrow_alt_square_left               },
+    { "arrow-alt-square-right"             , arrow_alt_square_right              },
+    { "arrow-alt-square-up"                , arrow_alt_square_up                 },
+    { "arrow-alt-down"                     , arrow_alt_down                      },
+    { "arrow-alt-left"                     , arrow_alt_left                      },
+    { "arrow-alt-right"                    , arrow_alt_right                     },
+    { "arrow-alt-up"                       , arrow_alt_up                        },
+    { "arrow-alt-circle-down"              , arrow_alt_circle_down               },
+    { "arrow-alt-circle-left"              , arrow_alt_circle_left               },
+    { "arrow-alt-circle-right"             , arrow_alt_circle_right              },
+    { "arrow-alt-circle-up"                , arrow_alt_circle_up                 },
+    { "font-awesome-alt"                   , font_awesome_alt                    },
+    { "external-link-alt"                  , external_link_alt                   },
+    { "external-link-square-alt"           , external_link_square_alt            },
+    { "retweet-alt"                        , retweet_alt                         },
+    { "exchange-alt"                       , exchange_alt                        },
+    { "repeat"                             , repeat                              },
+    { "repeat-alt"                         , repeat_alt                          },
+    { "repeat-1"                           , repeat_1                            },
+    { "repeat-1-alt"                       , repeat_1_alt                        },
+    { "share-all"                          , share_all                           },
+    { "accessible-icon"                    , accessible_icon                     },
+    { "accusoft"                           , accusoft                            },
+    { "adversal"                           , adversal                            },
+    { "affiliatetheme"                     , affiliatetheme                      },
+    { "algolia"                            , algolia                             },
+    { "amilia"                             , amilia                              },
+    { "angrycreative"                      , angrycreative                       },
+    { "app-store"                          , app_store                           },
+    { "app-store-ios"                      , app_store_ios                       },
+    { "apper"                              , apper                               },
+    { "asymmetrik"                         , asymmetrik                          },
+    { "audible"                            , audible                             },
+    { "avianex"                            , avianex                             },
+    { "aws"                                , aws                                 },
+    { "battery-bolt"                       , battery_bolt                        },
+    { "battery-slash"                      , battery_slash                       },
+    { "bimobject"                          , bimobject                           },
+    { "bitcoin"                            , bitcoin                             },
+    { "bity"                               , bity                                },
+    { "blackberry"                         , blackberry                          },
+    { "blogger"                            , blogger                             },
+    { "blogger-b"                          , blogger_b                           },
+    { "browser"                            , browser                             },
+    { "buromobelexperte"                   , buromobelexperte                    },
+    { "centercode"                         , centercode                          },
+    { "cloud-download-alt"                 , cloud_download_alt                  },
+    { "cloud-upload-alt"                   , cloud_upload_alt                    },
+    { "cloudscale"                         , cloudscale                          },
+    { "cloudsmith"                         , cloudsmith                          },
+    { "cloudversify"                       , cloudversify                        },
+    { "code-commit"                        , code_commit                         },
+    { "code-merge"                         , code_merge                          },
+    { "cpanel"                             , cpanel                              },
+    { "credit-card-blank"                  , credit_card_blank                   },
+    { "credit-card-front"                  , credit_card_front                   },
+    { "css3-alt"                           , css3_alt                            },
+    { "cuttlefish"                         , cuttlefish                          },
+    { "d-and-d"                            , d_and_d                             },
+    { "deploydog"                          , deploydog                           },
+    { "deskpro"                            , deskpro                             },
+    { "desktop-alt"                        , desktop_alt                         },
+    { "digital-ocean"                      , digital_ocean                       },
+    { "discord"                            , discord                             },
+    { "discourse"                          , discourse                           },
+    { "dochub"                             , dochub                              },
+    { "docker"                             , docker                              },
+    { "draft2digital"                      , draft2digital                       },
+    { "dribbble-square"                    , dribbble_square                     },
+    { "dyalog"                             , dyalog                              },
+    { "earlybirds"                         , earlybirds                          },
+    { "ellipsis-h-alt"                     , ellipsis_h_alt                      },
+    { "ellipsis-v-alt"                     , ellipsis_v_alt                      },
+    { "erlang"                             , erlang                              },
+    { "facebook-f"                         , facebook_f                          },
+    { "facebook-messenger"                 , facebook_messenger                  },
+    { "film-alt"                           , film_alt                            },
+    { "firstdraft"                         , firstdraft                          },
+    { "fonticons-fi"                       , fonticons_fi                        },
+    { "fort-awesome-alt"                   , fort_awesome_alt                    },
+    { "freebsd"                            , freebsd                             },
+    { "gem"                                , gem                                 },
+    { "gitkraken"                          , gitkraken                           },
+    { "gofore"                             , gofore                              },
+    { "goodreads"                          , goodreads                           },
+    { "goodreads-g"                        , goodreads_g                         },
+    { "google-drive"                       , google_drive                        },
+    { "google-play"                        , google_play                         },
+    { "gripfire"                           , gripfire                            },
+    { "grunt"                              , grunt                               },
+    { "gulp"                               , gulp                                },
+    { "hacker-news-square"                 , hacker_news_square                  },
+    { "hire-a-helper"                      , hire_a_helper                       },
+    { "hotjar"                             , hotjar                              },
+    { "hubspot"                            , hubspot                             },
+    { "industry-alt"                       , industry_alt                        },
+    { "itunes"                             , itunes                              },
+    { "itunes-note"                        , itunes_note                         },
+    { "jenkins"                            , jenkins                             },
+    { "joget"                              , joget                               },
+    { "js"                                 , js                                  },
+    { "js-square"                          , js_square                           },
+    { "keycdn"                             , keycdn                              },
+    { "kickstarter"                        , kickstarter                         },
+    { "kickstarter-k"                      , kickstarter_k                       },
+    { "laravel"                            , laravel                             },
+    { "level-down-alt"                     , level_down_alt                      },
+    { "level-up-alt"                       , level_up_alt                        },
+    { "line"                               , _line                               },
+    { "lock-open"                          , lock_open                           },
+    { "lock-open-alt"                      , lock_open_alt                       },
+    { "lyft"                               , lyft                                },
+    { "magento"                            , magento                             },
+    { "map-marker-alt"                     , map_marker_alt                      },
+    { "medapps"                            , medapps                             },
+    { "medium-m"                           , medium_m                            },
+    { "medrt"                              , medrt                               },
+    { "microphone-alt"                     , microphone_alt                      },
+    { "microsoft"                          , microsoft                           },
+    { "mix"                                , mix                                 },
+    { "mizuni"                             , mizuni                              },
+    { "mobile-alt"                         , mobile_alt                          },
+    { "mobile-android"                     , mobile_android                      },
+    { "mobile-android-alt"                 , mobile_android_alt                  },
+    { "monero"                             , monero                              },
+    { "money-bill-alt"                     , money_bill_alt                      },
+    { "napster"                            , napster                             },
+    { "node-js"                            , node_js                             },
+    { "npm"                                , npm                                 },
+    { "ns8"                                , ns8                                 },
+    { "nutritionix"                        , nutritionix                         },
+    { "page4"                              , page4                               },
+    { "palfed"                             , palfed                              },
+    { "patreon"                            , patreon                             },
+    { "periscope"                          , periscope                           },
+    { "phabricator"                        , phabricator                         },
+    { "phoenix-framework"                  , phoenix_framework                   },
+    { "phone-slash"                        , phone_slash                         },
+    { "plane-alt"                          , plane_alt                           },
+    { "playstation"                        , playstation                         },
+    { "portrait"                           , portrait                            },
+    { "pushed"                             , pushed                              },
+    { "python"                             , python                              },
+    { "red-river"                          , red_river                           },
+    { "wpressr"                            , wpressr                             },
+    { "reply"                              , reply                               },
+    { "replyd"                             , replyd                              },
+    { "resolving"                          , resolving                           },
+    { "rocketchat"                         , rocketchat                          },
+    { "rockrms"                            , rockrms                             },
+    { "schlix"                             , schlix                              },
+    { "searchengin"                        , searchengin                         },
+    { "servicestack"                       , servicestack                        },
+    { "shield-alt"                         , shield_alt                          },
+    { "sistrix"                            , sistrix                             },
+    { "slack-hash"                         , slack_hash                          },
+    { "sliders-h-square"                   , sliders_h_square                    },
+    { "sliders-v"                          , sliders_v                           },
+    { "sliders-v-square"                   , sliders_v_square                    },
+    { "speakap"                            , speakap                             },
+    { "spinner-third"                      , spinner_third                       },
+    { "staylinked"                         , staylinked                          },
+    { "steam-symbol"                       , steam_symbol                        },
+    { "sticker-mule"                       , sticker_mule                        },
+    { "studiovinari"                       , studiovinari                        },
+    { "supple"                             , supple                              },
+    { "tablet-alt"                         , tablet_alt                          },
+    { "tablet-android"                     , tablet_android                      },
+    { "tablet-android-alt"                 , tablet_android_alt                  },
+    { "tachometer-alt"                     , tachometer_alt                      },
+    { "telegram-plane"                     , telegram_plane                      },
+    { "ticket-alt"                         , ticket_alt                          },
+    { "tree-alt"                           , tree_alt                            },
+    { "tv-retro"                           , tv_retro                            },
+    { "uber"                               , uber                                },
+    { "uikit"                              , uikit                               },
+    { "uniregistry"                        , uniregistry                         },
+    { "untappd"                            , untappd                             },
+    { "user-alt"                           , user_alt                            },
+    { "ussunnah"                           , ussunnah                            },
+    { "vaadin"                             , vaadin                              },
+    { "viber"                              , viber                               },
+    { "vimeo"                              , vimeo                               },
+    { "vnv"                                , vnv                                 },
+    { "whatsapp-square"                    , whatsapp_square                     },
+    { "whmcs"                              , whmcs                               },
+    { "window"                             , window                              },
+    { "window-alt"                         , window_alt                          },
+    { "window-close"                       , window_close                        },
+    { "wordpress-simple"                   , wordpress_simple                    },
+    { "xbox"                               , xbox                                },
+    { "yandex"                             , yandex                              },
+    { "yandex-international"               , yandex_international                },
+    { "apple-pay"                          , apple_pay                           },
+    { "cc-apple-pay"                       , cc_apple_pay                        },
+    { "fly"                                , fly                                 },
+    { "node"                               , node                                },
+    { "osi"                                , osi                                 },
+    { "react"                              , react                               },
+    { "autoprefixer"                       , autoprefixer                        },
+    { "less"                               , less                                },
+    { "sass"                               , sass                                },
+    { "vuejs"                              , vuejs                               },
+    { "angular"                            , angular                             },
+    { "aviato"                             , aviato                              },
+    { "compress-alt"                       , compress_alt                        },
+    { "ember"                              , ember                               },
+    { "expand-alt"                         , expand_alt                          },
+    { "font-awesome-flag"                  , font_awesome_flag                   },
+    { "gitter"                             , gitter                              },
+    { "hooli"                              , hooli                               },
+    { "strava"                             , strava                              },
+    { "stripe"                             , stripe                              },
+    { "stripe-s"                           , stripe_s                            },
+    { "typo3"                              , typo3                               },
+    { "amazon-pay"                         , amazon_pay                          },
+    { "cc-amazon-pay"                      , cc_amazon_pay                       },
+    { "ethereum"                           , ethereum                            },
+    { "korvue"                             , korvue                              },
+    { "elementor"                          , elementor                           },
+    { "youtube-square"                     , youtube_square                      },
+    { "baseball"                           , baseball                            },
+    { "baseball-ball"                      , baseball_ball                       },
+    { "basketball-ball"                    , basketball_ball                     },
+    { "basketball-hoop"                    , basketball_hoop                     },
+    { "bowling-ball"                       , bowling_ball                        },
+    { "bowling-pins"                       , bowling_pins                        },
+    { "boxing-glove"                       , boxing_glove                        },
+    { "chess"                              , chess                               },
+    { "chess-bishop"                       , chess_bishop                        },
+    { "chess-bishop-alt"                   , chess_bishop_alt                    },
+    { "chess-board"                        , chess_board                         },
+    { "chess-clock"                        , chess_clock                         },
+    { "chess-clock-alt"                    , chess_clock_alt                     },
+    { "chess-king"                         , chess_king                          },
+    { "chess-king-alt"                     , chess_king_alt                      },
+    { "chess-knight"                       , chess_knight                        },
+    { "chess-knight-alt"                   , chess_knight_alt                    },
+    { "chess-pawn"                         , chess_pawn                          },
+    { "chess-pawn-alt"                     , chess_pawn_alt                      },
+    { "chess-queen"                        , chess_queen                         },
+    { "chess-queen-alt"                    , chess_queen_alt                     },
+    { "chess-rook"                         , chess_rook                          },
+    { "chess-rook-alt"                     , chess_rook_alt                      },
+    { "cricket"                            , cricket                             },
+    { "curling"                            , curling                             },
+    { "dumbbell"                           , dumbbell                            },
+    { "field-hockey"                       , field_hockey                        },
+    { "flipboard"                          , flipboard                           },
+    { "football-ball"                      , football_ball                       },
+    { "football-helmet"                    , football_helmet                     },
+    { "golf-ball"                          , golf_ball                           },
+    { "golf-club"                          , golf_club                           },
+    { "hips"                               , hips                                },
+    { "hockey-puck"                        , hockey_puck                         },
+    { "hockey-sticks"                      , hockey_sticks                       },
+    { "luchador"                           , luchador                            },
+    { "pennant"                            , pennant                             },
+    { "php"                                , php                                 },
+    { "quidditch"                          , quidditch                           },
+    { "quinscape"                          , quinscape                           },
+    { "racquet"                            , racquet                             },
+    { "shuttlecock"                        , shuttlecock                         },
+    { "square-full"                        , square_full                         },
+    { "table-tennis"                       , table_tennis                        },
+    { "tennis-ball"                        , tennis_ball                         },
+    { "volleyball-ball"                    , volleyball_ball                     },
+    { "whistle"                            , whistle                             },
+    { "allergies"                          , allergies                           },
+    { "band-aid"                           , band_aid                            },
+    { "barcode-alt"                        , barcode_alt                         },
+    { "barcode-read"                       , barcode_read                        },
+    { "barcode-scan"                       , barcode_scan                        },
+    { "box"                                , box                                 },
+    { "box-check"                          , box_check                           },
+    { "boxes"                              , boxes                               },
+    { "briefcase-medical"                  , briefcase_medical                   },
+    { "burn"                               , burn                                },
+    { "capsules"                           , capsules                            },
+    { "clipboard-check"                    , clipboard_check                     },
+    { "clipboard-list"                     , clipboard_list                      },
+    { "conveyor-belt"                      , conveyor_belt                       },
+    { "conveyor-belt-alt"                  , conveyor_belt_alt                   },
+    { "diagnoses"                          , diagnoses                           },
+    { "dna"                                , dna                                 },
+    { "dolly"                              , dolly                               },
+    { "dolly-empty"                        , dolly_empty                         },
+    { "dolly-flatbed"                      , dolly_flatbed                       },
+    { "dolly-flatbed-alt"                  , dolly_flatbed_alt                   },
+    { "dolly-flatbed-empty"                , dolly_flatbed_empty                 },
+    { "file-medical"                       , file_medical                        },
+    { "file-medical-alt"                   , file_medical_alt                    },
+    { "first-aid"                          , first_aid                           },
+    { "forklift"                           , forklift                            },
+    { "hand-holding-box"                   , hand_holding_box                    },
+    { "hand-receiving"                     , hand_receiving                      },
+    { "hospital-alt"                       , hospital_alt                        },
+    { "hospital-symbol"                    , hospital_symbol                     },
+    { "id-card-alt"                        , id_card_alt                         },
+    { "inventory"                          , inventory                           },
+    { "notes-medical"                      , notes_medical                       },
+    { "pallet"                             , pallet                              },
+    { "pallet-alt"                         , pallet_alt                          },
+    { "pills"                              , pills                               },
+    { "prescription-bottle"                , prescription_bottle                 },
+    { "prescription-bottle-alt"            , prescription_bottle_alt             },
+    { "procedures"                         , procedures                          },
+    { "scanner"                            , scanner                             },
+    { "scanner-keyboard"                   , scanner_keyboard                    },
+    { "scanner-touchscreen"                , scanner_touchscreen                 },
+    { "shipping-fast"                      , shipping_fast                       },
+    { "shipping-timed"                     , shipping_timed                      },
+    { "smoking"                            , smoking                             },
+    { "syringe"                            , syringe                             },
+    { "tablet-rugged"                      , tablet_rugged                       },
+    { "tablets"                            , tablets                             },
+    { "thermometer"                        , thermometer                         },
+    { "vial"                               , vial                                },
+    { "vials"                              , vials                               },
+    { "warehouse"                          , warehouse                           },
+    { "warehouse-alt"                      , warehouse_alt                       },
+    { "weight"                             , weight                              },
+    { "x-ray"                              , x_ray                               },
+    { "blanket"                            , blanket                             },
+    { "book-heart"                         , book_heart                          },
+    { "box-alt"                            , box_alt                             },
+    { "box-fragile"                        , box_fragile                         },
+    { "box-full"                           , box_full                            },
+    { "box-heart"                          , box_heart                           },
+    { "box-open"                           , box_open                            },
+    { "box-up"                             , box_up                              },
+    { "box-usd"                            , box_usd                             },
+    { "boxes-alt"                          , boxes_alt                           },
+    { "comment-alt-check"                  , comment_alt_check                   },
+    { "comment-alt-dots"                   , comment_alt_dots                    },
+    { "comment-alt-edit"                   , comment_alt_edit                    },
+    { "comment-alt-exclamation"            , comment_alt_exclamation             },
+    { "comment-alt-lines"                  , comment_alt_lines                   },
+    { "comment-alt-minus"                  , comment_alt_minus                   },
+    { "comment-alt-plus"                   , comment_alt_plus                    },
+    { "comment-alt-slash"                  , comment_alt_slash                   },
+    { "comment-alt-smile"                  , comment_alt_smile                   },
+    { "comment-alt-times"                  , comment_alt_times                   },
+    { "comment-check"                      , comment_check                       },
+    { "comment-dots"                       , comment_dots                        },
+    { "comment-edit"                       , comment_edit                        },
+    { "comment-exclamation"                , comment_exclamation                 },
+    { "comment-lines"                      , comment_lines                       },
+    { "comment-minus"                      , comment_minus                       },
+    { "comment-plus"                       , comment_plus                        },
+    { "comment-slash"                      , comment_slash                       },
+    { "comment-smile"                      , comment_smile                       },
+    { "comment-times"                      , comment_times                       },
+    { "comments-alt"                       , comments_alt                        },
+    { "container-storage"                  , container_storage                   },
+    { "couch"                              , couch                               },
+    { "donate"                             , donate                              },
+    { "dove"                               , dove                                },
+    { "fragile"                            , fragile                             },
+    { "hand-heart"                         , hand_heart                          },
+    { "hand-holding"                       , hand_holding                        },
+    { "hand-holding-heart"                 , hand_holding_heart                  },
+    { "hand-holding-seedling"              , hand_holding_seedling               },
+    { "hand-holding-usd"                   , hand_holding_usd                    },
+    { "hand-holding-water"                 , hand_holding_water                  },
+    { "hands"                              , hands                               },
+    { "hands-heart"                        , hands_heart                         },
+    { "hands-helping"                      , hands_helping                       },
+    { "hands-usd"                          , hands_usd                           },
+    { "handshake-alt"                      , handshake_alt                       },
+    { "heart-circle"                       , heart_circle                        },
+    { "heart-square"                       , heart_square                        },
+    { "home-heart"                         , home_heart                          },
+    { "lamp"                               , lamp                                },
+    { "leaf-heart"                         , leaf_heart                          },
+    { "loveseat"                           , loveseat                            },
+    { "parachute-box"                      , parachute_box                       },
+    { "people-carry"                       , people_carry                        },
+    { "person-carry"                       , person_carry                        },
+    { "person-dolly"                       , person_dolly                        },
+    { "person-dolly-empty"                 , person_dolly_empty                  },
+    { "phone-plus"                         , phone_plus                          },
+    { "piggy-bank"                         , piggy_bank                          },
+    { "ramp-loading"                       , ramp_loading                        },
+    { "readme"                             , readme                              },
+    { "ribbon"                             , ribbon                              },
+    { "route"                              , route                               },
+    { "seedling"                           , seedling                            },
+    { "sign"                               , sign                                },
+    { "smile-wink"                         , smile_wink                          },
+    { "tape"                               , tape                                },
+    { "truck-container"                    , truck_container                     },
+    { "truck-couch"                        , truck_couch                         },
+    { "truck-loading"                      , truck_loading                       },
+    { "truck-moving"                       , truck_moving                        },
+    { "truck-ramp"                         , truck_ramp                          },
+    { "video-plus"                         , video_plus                          },
+    { "video-slash"                        , video_slash                         },
+    { "wine-glass"                         , wine_glass                          },
+    { "java"                               , java                                },
+    { "pied-piper-hat"                     , pied_piper_hat                      },
+    { "font-awesome-logo-full"             , font_awesome_logo_full              },
+    { "creative-commons-by"                , creative_commons_by                 },
+    { "creative-commons-nc"                , creative_commons_nc                 },
+    { "creative-commons-nc-eu"             , creative_commons_nc_eu              },
+    { "creative-commons-nc-jp"             , creative_commons_nc_jp              },
+    { "creative-commons-nd"                , creative_commons_nd                 },
+    { "creative-commons-pd"                , creative_commons_pd                 },
+    { "creative-commons-pd-alt"            , creative_commons_pd_alt             },
+    { "creative-commons-remix"             , creative_commons_remix              },
+    { "creative-commons-sa"                , creative_commons_sa                 },
+    { "creative-commons-sampling"          , creative_commons_sampling           },
+    { "creative-commons-sampling-plus"     , creative_commons_sampling_plus      },
+    { "creative-commons-share"             , creative_commons_share              },
+    { "creative-commons-zero"              , creative_commons_zero               },
+    { "ebay"                               , ebay                                },
+    { "keybase"                            , keybase                             },
+    { "mastodon"                           , mastodon                            },
+    { "r-project"                          , r_project                           },
+    { "researchgate"                       , researchgate                        },
+    { "teamspeak"                          , teamspeak                           },
+    { "user-alt-slash"                     , user_alt_slash                      },
+    { "user-astronaut"                     , user_astronaut                      },
+    { "user-check"                         , user_check                          },
+    { "user-clock"                         , user_clock                          },
+    { "user-cog"                           , user_cog                            },
+    { "user-edit"                          , user_edit                           },
+    { "user-friends"                       , user_friends                        },
+    { "user-graduate"                      , user_graduate                       },
+    { "user-lock"                          , user_lock                           },
+    { "user-minus"                         , user_minus                          },
+    { "user-ninja"                         , user_ninja                          },
+    { "user-shield"                        , user_shield                         },
+    { "user-slash"                         , user_slash                          },
+    { "user-tag"                           , user_tag                            },
+    { "user-tie"                           , user_tie                            },
+    { "users-cog"                          , users_cog                           },
+    { "first-order-alt"                    , first_order_alt                     },
+    { "fulcrum"                            , fulcrum                             },
+    { "galactic-republic"                  , galactic_republic                   },
+    { "galactic-senate"                    , galactic_senate                     },
+    { "jedi-order"                         , jedi_order                          },
+    { "mandalorian"                        , mandalorian                         },
+    { "old-republic"                       , old_republic                        },
+    { "phoenix-squadron"                   , phoenix_squadron                    },
+    { "sith"                               , sith                                },
+    { "trade-federation"                   , trade_federation                    },
+    { "wolf-pack-battalion"                , wolf_pack_battalion                 },
+    { "balance-scale-left"                 , balance_scale_left                  },
+    { "balance-scale-right"                , balance_scale_right                 },
+    { "blender"                            , blender                             },
+    { "book-open"                          , book_open                           },
+    { "broadcast-tower"                    , broadcast_tower                     },
+    { "broom"                              , broom                               },
+    { "chalkboard"                         , chalkboard                          },
+    { "chalkboard-teacher"                 , chalkboard_teacher                  },
+    { "church"                             , church                              },
+    { "coins"                              , coins                               },
+    { "compact-disc"                       , compact_disc                        },
+    { "crow"                               , crow                                },
+    { "crown"                              , crown                               },
+    { "dice"                               , dice                                },
+    { "dice-five"                          , dice_five                           },
+    { "dice-four"                          , dice_four                           },
+    { "dice-one"                           , dice_one                            },
+    { "dice-six"                           , dice_six                            },
+    { "dice-three"                         , dice_three                          },
+    { "dice-two"                           , dice_two                            },
+    { "divide"                             , divide                              },
+    { "door-closed"                        , door_closed                         },
+    { "door-open"                          , door_open                           },
+    { "equals"                             , equals                              },
+    { "feather"                            , feather                             },
+    { "frog"                               , frog                                },
+    { "gas-pump"                           , gas_pump                            },
+    { "glasses"                            , glasses                             },
+    { "greater-than"                       , greater_than                        },
+    { "greater-than-equal"                 , greater_than_equal                  },
+    { "helicopter"                         , helicopter                          },
+    { "infinity"                           , infinity                            },
+    { "kiwi-bird"                          , kiwi_bird                           },
+    { "less-than"                          , less_than                           },
+    { "less-than-equal"                    , less_than_equal                     },
+    { "memory"                             , memory                              },
+    { "microphone-alt-slash"               , microphone_alt_slash                },
+    { "money-bill-wave"                    , money_bill_wave                     },
+    { "money-bill-wave-alt"                , money_bill_wave_alt                 },
+    { "money-check"                        , money_check                         },
+    { "money-check-alt"                    , money_check_alt                     },
+    { "not-equal"                          , not_equal                           },
+    { "palette"                            , palette                             },
+    { "parking"                            , parking                             },
+    { "percentage"                         , percentage                          },
+    { "project-diagram"                    , project_diagram                     },
+    { "receipt"                            , receipt                             },
+    { "robot"                              , robot                               },
+    { "ruler"                              , ruler                               },
+    { "ruler-combined"                     , ruler_combined                      },
+    { "ruler-horizontal"                   , ruler_horizontal                    },
+    { "ruler-vertical"                     , ruler_vertical                      },
+    { "school"                             , school                              },
+    { "screwdriver"                        , screwdriver                         },
+    { "shoe-prints"                        , shoe_prints                         },
+    { "skull"                              , skull                               },
+    { "smoking-ban"                        , smoking_ban                         },
+    { "store"                              , store                               },
+    { "store-alt"                          , store_alt                           },
+    { "stream"                             , stream                              },
+    { "stroopwafel"                        , stroopwafel                         },
+    { "toolbox"                            , toolbox                             },
+    { "tshirt"                             , tshirt                              },
+    { "walking"                            , walking                             },
+    { "wallet"                             , wallet                              },
+    { "angry"                              , angry                               },
+    { "archway"                            , archway                             },
+    { "atlas"                              , atlas                               },
+    { "award"                              , award                               },
+    { "backspace"                          , backspace                           },
+    { "bezier-curve"                       , bezier_curve                        },
+    { "bong"                               , bong                                },
+    { "brush"                              , brush                               },
+    { "bus-alt"                            , bus_alt                             },
+    { "cannabis"                           , cannabis                            },
+    { "check-double"                       , check_double                        },
+    { "cocktail"                           , cocktail                            },
+    { "concierge-bell"                     , concierge_bell                      },
+    { "cookie"                             , cookie                              },
+    { "cookie-bite"                        , cookie_bite                         },
+    { "crop-alt"                           , crop_alt                            },
+    { "digital-tachograph"                 , digital_tachograph                  },
+    { "dizzy"                              , dizzy                               },
+    { "drafting-compass"                   , drafting_compass                    },
+    { "drum"                               , drum                                },
+    { "drum-steelpan"                      , drum_steelpan                       },
+    { "feather-alt"                        , feather_alt                         },
+    { "file-contract"                      , file_contract                       },
+    { "file-download"                      , file_download                       },
+    { "file-export"                        , file_export                         },
+    { "file-import"                        , file_import                         },
+    { "file-invoice"                       , file_invoice                        },
+    { "file-invoice-dollar"                , file_invoice_dollar                 },
+    { "file-prescription"                  , file_prescription                   },
+    { "file-signature"                     , file_signature                      },
+    { "file-upload"                        , file_upload                         },
+    { "fill"                               , fill                                },
+    { "fill-drip"                          , fill_drip                           },
+    { "fingerprint"                        , fingerprint                         },
+    { "fish"                               , fish                                },
+    { "flushed"                            , flushed                             },
+    { "frown-open"                         , frown_open                          },
+    { "glass-martini-alt"                  , glass_martini_alt                   },
+    { "globe-africa"                       , globe_africa                        },
+    { "globe-americas"                     , globe_americas                      },
+    { "globe-asia"                         , globe_asia                          },
+    { "grimace"                            , grimace                             },
+    { "grin"                               , grin                                },
+    { "grin-alt"                           , grin_alt                            },
+    { "grin-beam"                          , grin_beam                           },
+    { "grin-beam-sweat"                    , grin_beam_sweat                     },
+    { "grin-hearts"                        , grin_hearts                         },
+    { "grin-squint"                        , grin_squint                         },
+    { "grin-squint-tears"                  , grin_squint_tears                   },
+    { "grin-stars"                         , grin_stars                          },
+    { "grin-tears"                         , grin_tears                          },
+    { "grin-tongue"                        , grin_tongue                         },
+    { "grin-tongue-squint"                 , grin_tongue_squint                  },
+    { "grin-tongue-wink"                   , grin_tongue_wink                    },
+    { "grin-wink"                          , grin_wink                           },
+    { "grip-horizontal"                    , grip_horizontal                     },
+    { "grip-vertical"                      , grip_vertical                       },
+    { "headphones-alt"                     , headphones_alt                      },
+    { "headset"                            , headset                             },
+    { "highlighter"                        , highlighter                         },
+    { "hornbill"                           , hornbill                            },
+    { "hot-tub"                            , hot_tub                             },
+    { "hotel"                              , hotel                               },
+    { "joint"                              , joint                               },
+    { "kiss"                               , kiss                                },
+    { "kiss-beam"                          , kiss_beam                           },
+    { "kiss-wink-heart"                    , kiss_wink_heart                     },
+    { "laugh"                              , laugh                               },
+    { "laugh-beam"                         , laugh_beam                          },
+    { "laugh-squint"                       , laugh_squint                        },
+    { "laugh-wink"                         , laugh_wink                          },
+    { "luggage-cart"                       , luggage_cart                        },
+    { "mailchimp"                          , mailchimp                           },
+    { "map-marked"                         , map_marked                          },
+    { "map-marked-alt"                     , map_marked_alt                      },
+    { "marker"                             , marker                              },
+    { "medal"                              , medal                               },
+    { "megaport"                           , megaport                            },
+    { "meh-blank"                          , meh_blank                           },
+    { "meh-rolling-eyes"                   , meh_rolling_eyes                    },
+    { "monument"                           , monument                            },
+    { "mortar-pestle"                      , mortar_pestle                       },
+    { "nimblr"                             , nimblr                              },
+    { "paint-brush-alt"                    , paint_brush_alt                     },
+    { "paint-roller"                       , paint_roller                        },
+    { "passport"                           , passport                            },
+    { "pen-fancy"                          , pen_fancy                           },
+    { "pen-nib"                            , pen_nib                             },
+    { "pencil-ruler"                       , pencil_ruler                        },
+    { "plane-arrival"                      , plane_arrival                       },
+    { "plane-departure"                    , plane_departure                     },
+    { "prescription"                       , prescription                        },
+    { "rev"                                , rev                                 },
+    { "sad-cry"                            , sad_cry                             },
+    { "sad-tear"                           , sad_tear                            },
+    { "shopware"                           , shopware                            },
+    { "shuttle-van"                        , shuttle_van                         },
+    { "signature"                          , signature                           },
+    { "smile-beam"                         , smile_beam                          },
+    { "smile-plus"                         , smile_plus                          },
+    { "solar-panel"                        , solar_panel                         },
+    { "spa"                                , spa                                 },
+    { "splotch"                            , splotch                             },
+    { "spray-can"                          , spray_can                           },
+    { "squarespace"                        , squarespace                         },
+    { "stamp"                              , stamp                               },
+    { "star-half-alt"                      , star_half_alt                       },
+    { "suitcase-rolling"                   , suitcase_rolling                    },
+    { "surprise"                           , surprise                            },
+    { "swatchbook"                         , swatchbook                          },
+    { "swimmer"                            , swimmer                             },
+    { "swimming-pool"                      , swimming_pool                       },
+    { "themeco"                            , themeco                             },
+    { "tint-slash"                         , tint_slash                          },
+    { "tired"                              , tired                               },
+    { "tooth"                              , tooth                               },
+    { "umbrella-beach"                     , umbrella_beach                      },
+    { "vector-square"                      , vector_square                       },
+    { "weebly"                             , weebly                              },
+    { "weight-hanging"                     , weight_hanging                      },
+    { "wine-glass-alt"                     , wine_glass_alt                      },
+    { "wix"                                , wix                                 },
+    { "air-freshener"                      , air_freshener                       },
+    { "apple-alt"                          , apple_alt                           },
+    { "atom"                               , atom                                },
+    { "atom-alt"                           , atom_alt                            },
+    { "backpack"                           , backpack                            },
+    { "bell-school"                        , bell_school                         },
+    { "bell-school-slash"                  , bell_school_slash                   },
+    { "bone"                               , bone                                },
+    { "bone-break"                         , bone_break                          },
+    { "book-alt"                           , book_alt                            },
+    { "book-reader"                        , book_reader                         },
+    { "books"                              , books                               },
+    { "brain"                              , brain                               },
+    { "bus-school"                         , bus_school                          },
+    { "car-alt"                            , car_alt                             },
+    { "car-battery"                        , car_battery                         },
+    { "car-bump"                           , car_bump                            },
+    { "car-crash"                          , car_crash                           },
+    { "car-garage"                         , car_garage                          },
+    { "car-mechanic"                       , car_mechanic                        },
+    { "car-side"                           , car_side                            },
+    { "car-tilt"                           , car_tilt                            },
+    { "car-wash"                           , car_wash                            },
+    { "charging-station"                   , charging_station                    },
+    { "clipboard-prescription"             , clipboard_prescription              },
+    { "compass-slash"                      , compass_slash                       },
+    { "diploma"                            , diploma                             },
+    { "directions"                         , directions                          },
+    { "do-not-enter"                       , do_not_enter                        },
+    { "draw-circle"                        , draw_circle                         },
+    { "draw-polygon"                       , draw_polygon                        },
+    { "draw-square"                        , draw_square                         },
+    { "ear"                                , ear                                 },
+    { "ello"                               , ello                                },
+    { "engine-warning"                     , engine_warning                      },
+    { "file-certificate"                   , file_certificate                    },
+    { "gas-pump-slash"                     , gas_pump_slash                      },
+    { "glasses-alt"                        , glasses_alt                         },
+    { "globe-stand"                        , globe_stand                         },
+    { "hackerrank"                         , hackerrank                          },
+    { "heart-rate"                         , heart_rate                          },
+    { "inhaler"                            , inhaler                             },
+    { "kaggle"                             , kaggle                              },
+    { "kidneys"                            , kidneys                             },
+    { "laptop-code"                        , laptop_code                         },
+    { "layer-group"                        , layer_group                         },
+    { "layer-minus"                        , layer_minus                         },
+    { "layer-plus"                         , layer_plus                          },
+    { "lips"                               , lips                                },
+    { "location"                           , location                            },
+    { "location-circle"                    , location_circle                     },
+    { "location-slash"                     , location_slash                      },
+    { "lungs"                              , lungs                               },
+    { "map-marker-alt-slash"               , map_marker_alt_slash                },
+    { "map-marker-check"                   , map_marker_check                    },
+    { "map-marker-edit"                    , map_marker_edit                     },
+    { "map-marker-exclamation"             , map_marker_exclamation              },
+    { "map-marker-minus"                   , map_marker_minus                    },
+    { "map-marker-plus"                    , map_marker_plus                     },
+    { "map-marker-question"                , map_marker_question                 },
+    { "map-marker-slash"                   , map_marker_slash                    },
+    { "map-marker-smile"                   , map_marker_smile                    },
+    { "map-marker-times"                   , map_marker_times                    },
+    { "markdown"                           , markdown                            },
+    { "microscope"                         , microscope                          },
+    { "monitor-heart-rate"                 , monitor_heart_rate                  },
+    { "neos"                               , neos                                },
+    { "oil-can"                            , oil_can                             },
+    { "oil-temp"                           , oil_temp                            },
+    { "parking-circle"                     , parking_circle                      },
+    { "parking-circle-slash"               , parking_circle_slash                },
+    { "parking-slash"                      , parking_slash                       },
+    { "pencil-paintbrush"                  , pencil_paintbrush                   },
+    { "poop"                               , poop                                },
+    { "route-highway"                      , route_highway                       },
+    { "route-interstate"                   , route_interstate                    },
+    { "ruler-triangle"                     , ruler_triangle                      },
+    { "scalpel"                            , scalpel                             },
+    { "scalpel-path"                       , scalpel_path                        },
+    { "shapes"                             , shapes                              },
+    { "skeleton"                           , skeleton                            },
+    { "star-of-life"                       , star_of_life                        },
+    { "steering-wheel"                     , steering_wheel                      },
+    { "stomach"                            , stomach                             },
+    { "tachometer-alt-average"             , tachometer_alt_average              },
+    { "tachometer-alt-fast"                , tachometer_alt_fast                 },
+    { "tachometer-alt-fastest"             , tachometer_alt_fastest              },
+    { "tachometer-alt-slow"                , tachometer_alt_slow                 },
+    { "tachometer-alt-slowest"             , tachometer_alt_slowest              },
+    { "tachometer-average"                 , tachometer_average                  },
+    { "tachometer-fast"                    , tachometer_fast                     },
+    { "tachometer-fastest"                 , tachometer_fastest                  },
+    { "tachometer-slow"                    , tachometer_slow                     },
+    { "tachometer-slowest"                 , tachometer_slowest                  },
+    { "teeth"                              , teeth                               },
+    { "teeth-open"                         , teeth_open                          },
+    { "theater-masks"                      , theater_masks                       },
+    { "tire"                               , tire                                },
+    { "tire-flat"                          , tire_flat                           },
+    { "tire-pressure-warning"              , tire_pressure_warning               },
+    { "tire-rugged"                        , tire_rugged                         },
+    { "toothbrush"                         , toothbrush                          },
+    { "traffic-cone"                       , traffic_cone                        },
+    { "traffic-light"                      , traffic_light                       },
+    { "traffic-light-go"                   , traffic_light_go                    },
+    { "traffic-light-slow"                 , traffic_light_slow                  },
+    { "traffic-light-stop"                 , traffic_light_stop                  },
+    { "truck-monster"                      , truck_monster                       },
+    { "truck-pickup"                       , truck_pickup                        },
+    { "users-class"                        , users_class                         },
+    { "watch-fitness"                      , watch_fitness                       },
+    { "zhihu"                              , zhihu                               },
+    { "abacus"                             , abacus                              },
+    { "ad"                                 , ad                                  },
+    { "alipay"                             , alipay                              },
+    { "analytics"                          , analytics                           },
+    { "ankh"                               , ankh                                },
+    { "badge-dollar"                       , badge_dollar                        },
+    { "badge-percent"                      , badge_percent                       },
+    { "bible"                              , bible                               },
+    { "bullseye-arrow"                     , bullseye_arrow                      },
+    { "bullseye-pointer"                   , bullseye_pointer                    },
+    { "business-time"                      , business_time                       },
+    { "cabinet-filing"                     , cabinet_filing                      },
+    { "calculator-alt"                     , calculator_alt                      },
+    { "chart-line-down"                    , chart_line_down                     },
+    { "chart-pie-alt"                      , chart_pie_alt                       },
+    { "city"                               , city                                },
+    { "comment-alt-dollar"                 , comment_alt_dollar                  },
+    { "comment-dollar"                     , comment_dollar                      },
+    { "comments-alt-dollar"                , comments_alt_dollar                 },
+    { "comments-dollar"                    , comments_dollar                     },
+    { "cross"                              , cross                               },
+    { "dharmachakra"                       , dharmachakra                        },
+    { "empty-set"                          , empty_set                           },
+    { "envelope-open-dollar"               , envelope_open_dollar                },
+    { "envelope-open-text"                 , envelope_open_text                  },
+    { "file-chart-line"                    , file_chart_line                     },
+    { "file-chart-pie"                     , file_chart_pie                      },
+    { "file-spreadsheet"                   , file_spreadsheet                    },
+    { "file-user"                          , file_user                           },
+    { "folder-minus"                       , folder_minus                        },
+    { "folder-plus"                        , folder_plus                         },
+    { "folder-times"                       , folder_times                        },
+    { "folders"                            , folders                             },
+    { "function"                           , function                            },
+    { "funnel-dollar"                      , funnel_dollar                       },
+    { "gift-card"                          , gift_card                           },
+    { "gopuram"                            , gopuram                             },
+    { "hamsa"                              , hamsa                               },
+    { "bahai"                              , bahai                               },
+    { "integral"                           , integral                            },
+    { "intersection"                       , intersection                        },
+    { "jedi"                               , jedi                                },
+    { "journal-whills"                     , journal_whills                      },
+    { "kaaba"                              , kaaba                               },
+    { "keynote"                            , keynote                             },
+    { "khanda"                             , khanda                              },
+    { "lambda"                             , lambda                              },
+    { "landmark"                           , landmark                            },
+    { "lightbulb-dollar"                   , lightbulb_dollar                    },
+    { "lightbulb-exclamation"              , lightbulb_exclamation               },
+    { "lightbulb-on"                       , lightbulb_on                        },
+    { "lightbulb-slash"                    , lightbulb_slash                     },
+    { "mail-bulk"                          , mail_bulk                           },
+    { "megaphone"                          , megaphone                           },
+    { "menorah"                            , menorah                             },
+    { "mind-share"                         , mind_share                          },
+    { "mosque"                             , mosque                              },
+    { "om"                                 , om                                  },
+    { "omega"                              , omega                               },
+    { "pastafarianism"                     , pastafarianism                      },
+    { "peace"                              , peace                               },
+    { "phone-office"                       , phone_office                        },
+    { "pi"                                 , pi                                  },
+    { "place-of-worship"                   , place_of_worship                    },
+    { "podium"                             , podium                              },
+    { "poll"                               , poll                                },
+    { "poll-h"                             , poll_h                              },
+    { "pray"                               , pray                                },
+    { "praying-hands"                      , praying_hands                       },
+    { "presentation"                       , presentation                        },
+    { "print-slash"                        , print_slash                         },
+    { "quran"                              , quran                               },
+    { "search-dollar"                      , search_dollar                       },
+    { "search-location"                    , search_location                     },
+    { "shredder"                           , shredder                            },
+    { "sigma"                              , sigma                               },
+    { "signal-1"                           , signal_1                            },
+    { "signal-2"                           , signal_2                            },
+    { "signal-3"                           , signal_3                            },
+    { "signal-4"                           , signal_4                            },
+    { "signal-alt"                         , signal_alt                          },
+    { "signal-alt-1"                       , signal_alt_1                        },
+    { "signal-alt-2"                       , signal_alt_2                        },
+    { "signal-alt-3"                       , signal_alt_3                        },
+    { "signal-alt-slash"                   , signal_alt_slash                    },
+    { "signal-slash"                       , signal_slash                        },
+    { "socks"                              , socks                               },
+    { "square-root"                        , square_root                         },
+    { "square-root-alt"                    , square_root_alt                     },
+    { "star-and-crescent"                  , star_and_crescent                   },
+    { "star-of-david"                      , star_of_david                       },
+    { "synagogue"                          , synagogue                           },
+    { "tally"                              , tally                               },
+    { "the-red-yeti"                       , the_red_yeti                        },
+    { "theta"                              , theta                               },
+    { "tilde"                              , tilde                               },
+    { "torah"                              , torah                               },
+    { "torii-gate"                         , torii_gate                          },
+    { "union"                              , _union                              },
+    { "user-chart"                         , user_chart                          },
+    { "user-crown"                         , user_crown                          },
+    { "users-crown"                        , users_crown                         },
+    { "value-absolute"                     , value_absolute                      },
+    { "vihara"                             , vihara                              },
+    { "volume"                             , volume                              },
+    { "volume-mute"                        , volume_mute                         },
+    { "wifi-1"                             , wifi_1                              },
+    { "wifi-2"                             , wifi_2                              },
+    { "wifi-slash"                         , wifi_slash                          },
+    { "yin-yang"                           , yin_yang                            },
+    { "acorn"                              , acorn                               },
+    { "acquisitions-incorporated"          , acquisitions_incorporated           },
+    { "alicorn"                            , alicorn                             },
+    { "apple-crate"                        , apple_crate                         },
+    { "axe"                                , axe                                 },
+    { "axe-battle"                         , axe_battle                          },
+    { "badger-honey"                       , badger_honey                        },
+    { "bat"                                , bat                                 },
+    { "blender-phone"                      , blender_phone                       },
+    { "book-dead"                          , book_dead                           },
+    { "book-spells"                        , book_spells                         },
+    { "bow-arrow"                          , bow_arrow                           },
+    { "campfire"                           , campfire                            },
+    { "campground"                         , campground                          },
+    { "candle-holder"                      , candle_holder                       },
+    { "candy-corn"                         , candy_corn                          },
+    { "cat"                                , cat                                 },
+    { "cauldron"                           , cauldron                            },
+    { "chair"                              , chair                               },
+    { "chair-office"                       , chair_office                        },
+    { "claw-marks"                         , claw_marks                          },
+    { "cloud-moon"                         , cloud_moon                          },
+    { "cloud-sun"                          , cloud_sun                           },
+    { "coffee-togo"                        , coffee_togo                         },
+    { "coffin"                             , coffin                              },
+    { "corn"                               , corn                                },
+    { "cow"                                , cow                                 },
+    { "critical-role"                      , critical_role                       },
+    { "d-and-d-beyond"                     , d_and_d_beyond                      },
+    { "dagger"                             , dagger                              },
+    { "dev"                                , dev                                 },
+    { "dice-d10"                           , dice_d10                            },
+    { "dice-d12"                           , dice_d12                            },
+    { "dice-d20"                           , dice_d20                            },
+    { "dice-d4"                            , dice_d4                             },
+    { "dice-d6"                            , dice_d6                             },
+    { "dice-d8"                            , dice_d8                             },
+    { "dog"                                , dog                                 },
+    { "dog-leashed"                        , dog_leashed                         },
+    { "dragon"                             , dragon                              },
+    { "drumstick"                          , drumstick                           },
+    { "drumstick-bite"                     , drumstick_bite                      },
+    { "duck"                               , duck                                },
+    { "dungeon"                            , dungeon                             },
+    { "elephant"                           , elephant                            },
+    { "eye-evil"                           , eye_evil                            },
+    { "fantasy-flight-games"               , fantasy_flight_games                },
+    { "file-csv"                           , file_csv                            },
+    { "fist-raised"                        , fist_raised                         },
+    { "flame"                              , flame                               },
+    { "flask-poison"                       , flask_poison                        },
+    { "flask-potion"                       , flask_potion                        },
+    { "ghost"                              , ghost                               },
+    { "hammer"                             , hammer                              },
+    { "hammer-war"                         , hammer_war                          },
+    { "hand-holding-magic"                 , hand_holding_magic                  },
+    { "hanukiah"                           , hanukiah                            },
+    { "hat-witch"                          , hat_witch                           },
+    { "hat-wizard"                         , hat_wizard                          },
+    { "head-side"                          , head_side                           },
+    { "head-vr"                            , head_vr                             },
+    { "helmet-battle"                      , helmet_battle                       },
+    { "hiking"                             , hiking                              },
+    { "hippo"                              , hippo                               },
+    { "hockey-mask"                        , hockey_mask                         },
+    { "hood-cloak"                         , hood_cloak                          },
+    { "horse"                              , horse                               },
+    { "house-damage"                       , house_damage                        },
+    { "hryvnia"                            , hryvnia                             },
+    { "key-skeleton"                       , key_skeleton                        },
+    { "kite"                               , kite                                },
+    { "knife-kitchen"                      , knife_kitchen                       },
+    { "leaf-maple"                         , leaf_maple                          },
+    { "leaf-oak"                           , leaf_oak                            },
+    { "mace"                               , mace                                },
+    { "mandolin"                           , mandolin                            },
+    { "mask"                               , mask                                },
+    { "monkey"                             , monkey                              },
+    { "mountain"                           , mountain                            },
+    { "mountains"                          , mountains                           },
+    { "narwhal"                            , narwhal                             },
+    { "network-wired"                      , network_wired                       },
+    { "otter"                              , otter                               },
+    { "paw-alt"                            , paw_alt                             },
+    { "paw-claws"                          , paw_claws                           },
+    { "pegasus"                            , pegasus                             },
+    { "penny-arcade"                       , penny_arcade                        },
+    { "pie"                                , pie                                 },
+    { "pig"                                , pig                                 },
+    { "pumpkin"                            , pumpkin                             },
+    { "rabbit"                             , rabbit                              },
+    { "rabbit-fast"                        , rabbit_fast                         },
+    { "ram"                                , ram                                 },
+    { "ring"                               , ring                                },
+    { "running"                            , running                             },
+    { "scarecrow"                          , scarecrow                           },
+    { "scroll"                             , scroll                              },
+    { "scroll-old"                         , scroll_old                          },
+    { "scythe"                             , scythe                              },
+    { "sheep"                              , sheep                               },
+    { "shield-cross"                       , shield_cross                        },
+    { "shovel"                             , shovel                              },
+    { "skull-crossbones"                   , skull_crossbones                    },
+    { "slash"                              , slash                               },
+    { "snake"                              , snake                               },
+    { "spider"                             , spider                              },
+    { "spider-black-widow"                 , spider_black_widow                  },
+    { "spider-web"                         , spider_web                          },
+    { "squirrel"                           , squirrel                            },
+    { "staff"                              , staff                               },
+    { "sword"                              , sword                               },
+    { "swords"                             , swords                              },
+    { "toilet-paper"                       , toilet_paper                        },
+    { "toilet-paper-alt"                   , toilet_paper_alt                    },
+    { "tombstone"                          , tombstone                           },
+    { "tombstone-alt"                      , tombstone_alt                       },
+    { "tractor"                            , tractor                             },
+    { "treasure-chest"                     , treasure_chest                      },
+    { "trees"                              , trees                               },
+    { "turkey"                             , turkey                              },
+    { "turtle"                             , turtle                              },
+    { "unicorn"                            , unicorn                             },
+    { "user-injured"                       , user_injured                        },
+    { "vr-cardboard"                       , vr_cardboard                        },
+    { "wand"                               , wand                                },
+    { "wand-magic"                         , wand_magic                          },
+    { "whale"                              , whale                               },
+    { "wheat"                              , wheat                               },
+    { "wind"                               , wind                                },
+    { "wine-bottle"                        , wine_bottle                         },
+    { "wizards-of-the-coast"               , wizards_of_the_coast                },
+    { "think-peaks"                        , think_peaks                         },
+    { "ballot"                             , ballot                              },
+    { "ballot-check"                       , ballot_check                        },
+    { "booth-curtain"                      , booth_curtain                       },
+    { "box-ballot"                         , box_ballot                          },
+    { "calendar-star"                      , calendar_star                       },
+    { "clipboard-list-check"               , clipboard_list_check                },
+    { "cloud-drizzle"                      , cloud_drizzle                       },
+    { "cloud-hail"                         , cloud_hail                          },
+    { "cloud-hail-mixed"                   , cloud_hail_mixed                    },
+    { "cloud-meatball"                     , cloud_meatball                      },
+    { "cloud-moon-rain"                    , cloud_moon_rain                     },
+    { "cloud-rain"                         , cloud_rain                          },
+    { "cloud-rainbow"                      , cloud_rainbow                       },
+    { "cloud-showers"                      , cloud_showers                       },
+    { "cloud-showers-heavy"                , cloud_showers_heavy                 },
+    { "cloud-sleet"                        , cloud_sleet                         },
+    { "cloud-snow"                         , cloud_snow                          },
+    { "cloud-sun-rain"                     , cloud_sun_rain                      },
+    { "clouds"                             , clouds                              },
+    { "clouds-moon"                        , clouds_moon                         },
+    { "clouds-sun"                         , clouds_sun                          },
+    { "democrat"                           , democrat                            },
+    { "dewpoint"                           , dewpoint                            },
+    { "eclipse"                            , eclipse                             },
+    { "eclipse-alt"                        , eclipse_alt                         },
+    { "fire-smoke"                         , fire_smoke                          },
+    { "flag-alt"                           , flag_alt                            },
+    { "flag-usa"                           , flag_usa                            },
+    { "fog"                                , fog                                 },
+    { "house-flood"                        , house_flood                         },
+    { "humidity"                           , humidity                            },
+    { "hurricane"                          , hurricane                           },
+    { "landmark-alt"                       , landmark_alt                        },
+    { "meteor"                             , meteor                              },
+    { "moon-cloud"                         , moon_cloud                          },
+    { "moon-stars"                         , moon_stars                          },
+    { "person-booth"                       , person_booth                        },
+    { "person-sign"                        , person_sign                         },
+    { "podium-star"                        , podium_star                         },
+    { "poll-people"                        , poll_people                         },
+    { "poo-storm"                          , poo_storm                           },
+    { "rainbow"                            , rainbow                             },
+    { "raindrops"                          , raindrops                           },
+    { "reacteurope"                        , reacteurope                         },
+    { "republican"                         , republican                          },
+    { "smog"                               , smog                                },
+    { "smoke"                              , smoke                               },
+    { "snow-blowing"                       , snow_blowing                        },
+    { "stars"                              , stars                               },
+    { "sun-cloud"                          , sun_cloud                           },
+    { "sun-dust"                           , sun_dust                            },
+    { "sun-haze"                           , sun_haze                            },
+    { "sunrise"                            , sunrise                             },
+    { "sunset"                             , sunset                              },
+    { "temperature-frigid"                 , temperature_frigid                  },
+    { "temperature-high"                   , temperature_high                    },
+    { "temperature-hot"                    , temperature_hot                     },
+    { "temperature-low"                    , temperature_low                     },
+    { "thunderstorm"                       , thunderstorm                        },
+    { "thunderstorm-moon"                  , thunderstorm_moon                   },
+    { "thunderstorm-sun"                   , thunderstorm_sun                    },
+    { "tornado"                            , tornado                             },
+    { "volcano"                            , volcano                             },
+    { "vote-nay"                           , vote_nay                            },
+    { "vote-yea"                           , vote_yea                            },
+    { "water"                              , water                               },
+    { "water-lower"                        , water_lower                         },
+    { "water-rise"                         , water_rise                          },
+    { "wind-warning"                       , wind_warning                        },
+    { "windsock"                           , windsock                            },
+    { "angel"                              , angel                               },
+    { "artstation"                         , artstation                          },
+    { "atlassian"                          , atlassian                           },
+    { "baby"                               , baby                                },
+    { "baby-carriage"                      , baby_carriage                       },
+    { "ball-pile"                          , ball_pile                           },
+    { "bells"                              , bells                               },
+    { "biohazard"                          , biohazard                           },
+    { "blog"                               , blog                                },
+    { "boot"                               , boot                                },
+    { "calendar-day"                       , calendar_day                        },
+    { "calendar-week"                      , calendar_week                       },
+    { "canadian-maple-leaf"                , canadian_maple_leaf                 },
+    { "candy-cane"                         , candy_cane                          },
+    { "carrot"                             , carrot                              },
+    { "cash-register"                      , cash_register                       },
+    { "centos"                             , centos                              },
+    { "chart-network"                      , chart_network                       },
+    { "chimney"                            , chimney                             },
+    { "compress-arrows-alt"                , compress_arrows_alt                 },
+    { "confluence"                         , confluence                          },
+    { "deer"                               , deer                                },
+    { "deer-rudolph"                       , deer_rudolph                        },
+    { "dhl"                                , dhl                                 },
+    { "diaspora"                           , diaspora                            },
+    { "dreidel"                            , dreidel                             },
+    { "dumpster"                           , dumpster                            },
+    { "dumpster-fire"                      , dumpster_fire                       },
+    { "ear-muffs"                          , ear_muffs                           },
+    { "ethernet"                           , ethernet                            },
+    { "fedex"                              , fedex                               },
+    { "fedora"                             , fedora                              },
+    { "figma"                              , figma                               },
+    { "fireplace"                          , fireplace                           },
+    { "frosty-head"                        , frosty_head                         },
+    { "gifts"                              , gifts                               },
+    { "gingerbread-man"                    , gingerbread_man                     },
+    { "glass-champagne"                    , glass_champagne                     },
+    { "glass-cheers"                       , glass_cheers                        },
+    { "glass-whiskey"                      , glass_whiskey                       },
+    { "glass-whiskey-rocks"                , glass_whiskey_rocks                 },
+    { "globe-europe"                       , globe_europe                        },
+    { "globe-snow"                         , globe_snow                          },
+    { "grip-lines"                         , grip_lines                          },
+    { "grip-lines-vertical"                , grip_lines_vertical                 },
+    { "guitar"                             , guitar                              },
+    { "hat-santa"                          , hat_santa                           },
+    { "hat-winter"                         , hat_winter                          },
+    { "heart-broken"                       , heart_broken                        },
+    { "holly-berry"                        , holly_berry                         },
+    { "horse-head"                         , horse_head                          },
+    { "ice-skate"                          , ice_skate                           },
+    { "icicles"                            , icicles                             },
+    { "igloo"                              , igloo                               },
+    { "intercom"                           , intercom                            },
+    { "invision"                           , invision                            },
+    { "jira"                               , jira                                },
+    { "lights-holiday"                     , lights_holiday                      },
+    { "mendeley"                           , mendeley                            },
+    { "mistletoe"                          , mistletoe                           },
+    { "mitten"                             , mitten                              },
+    { "mug-hot"                            , mug_hot                             },
+    { "mug-marshmallows"                   , mug_marshmallows                    },
+    { "ornament"                           , ornament                            },
+    { "radiation"                          , radiation                           },
+    { "radiation-alt"                      , radiation_alt                       },
+    { "raspberry-pi"                       , raspberry_pi                        },
+    { "redhat"                             , redhat                              },
+    { "restroom"                           , restroom                            },
+    { "rv"                                 , rv                                  },
+    { "satellite"                          , satellite                           },
+    { "satellite-dish"                     , satellite_dish                      },
+    { "scarf"                              , scarf                               },
+    { "sd-card"                            , sd_card                             },
+    { "shovel-snow"                        , shovel_snow                         },
+    { "sim-card"                           , sim_card                            },
+    { "skating"                            , skating                             },
+    { "sketch"                             , sketch                              },
+    { "ski-jump"                           , ski_jump                            },
+    { "ski-lift"                           , ski_lift                            },
+    { "skiing"                             , skiing                              },
+    { "skiing-nordic"                      , skiing_nordic                       },
+    { "sledding"                           , sledding                            },
+    { "sleigh"                             , sleigh                              },
+    { "sms"                                , sms                                 },
+    { "snowboarding"                       , snowboarding                        },
+    { "snowflakes"                         , snowflakes                          },
+    { "snowman"                            , snowman                             },
+    { "snowmobile"                         , snowmobile                          },
+    { "snowplow"                           , snowplow                            },
+    { "sourcetree"                         , sourcetree                          },
+    { "star-christmas"                     , star_christmas                      },
+    { "stocking"                           , stocking                            },
+    { "suse"                               , suse                                },
+    { "tenge"                              , tenge                               },
+    { "toilet"                             , toilet                              },
+    { "tools"                              , tools                               },
+    { "tram"                               , tram                                },
+    { "tree-christmas"                     , tree_christmas                      },
+    { "tree-decorated"                     , tree_decorated                      },
+    { "tree-large"                         , tree_large                          },
+    { "truck-plow"                         , truck_plow                          },
+    { "ubuntu"                             , ubuntu                              },
+    { "ups"                                , ups                                 },
+    { "usps"                               , usps                                },
+    { "wreath"                             , wreath                              },
+    { "yarn"                               , yarn                                },
+    { "fire-alt"                           , fire_alt                            },
+    { "bacon"                              , bacon                               },
+    { "book-medical"                       , book_medical                        },
+    { "book-user"                          , book_user                           },
+    { "books-medical"                      , books_medical                       },
+    { "brackets"                           , brackets                            },
+    { "brackets-curly"                     , brackets_curly                      },
+    { "bread-loaf"                         , bread_loaf                          },
+    { "bread-slice"                        , bread_slice                         },
+    { "burrito"                            , burrito                             },
+    { "chart-scatter"                      , chart_scatter                       },
+    { "cheese"                             , cheese                              },
+    { "cheese-swiss"                       , cheese_swiss                        },
+    { "cheeseburger"                       , cheeseburger                        },
+    { "clinic-medical"                     , clinic_medical                      },
+    { "clipboard-user"                     , clipboard_user                      },
+    { "comment-alt-medical"                , comment_alt_medical                 },
+    { "comment-medical"                    , comment_medical                     },
+    { "croissant"                          , croissant                           },
+    { "crutch"                             , crutch                              },
+    { "crutches"                           , crutches                            },
+    { "debug"                              , debug                               },
+    { "disease"                            , disease                             },
+    { "egg"                                , egg                                 },
+    { "egg-fried"                          , egg_fried                           },
+    { "files-medical"                      , files_medical                       },
+    { "fish-cooked"                        , fish_cooked                         },
+    { "flower"                             , flower                              },
+    { "flower-daffodil"                    , flower_daffodil                     },
+    { "flower-tulip"                       , flower_tulip                        },
+    { "folder-tree"                        , folder_tree                         },
+    { "french-fries"                       , french_fries                        },
+    { "glass"                              , glass                               },
+    { "hamburger"                          , hamburger                           },
+    { "hand-middle-finger"                 , hand_middle_finger                  },
+    { "hard-hat"                           , hard_hat                            },
+    { "head-side-brain"                    , head_side_brain                     },
+    { "head-side-medical"                  , head_side_medical                   },
+    { "home-alt"                           , home_alt                            },
+    { "home-lg"                            , home_lg                             },
+    { "home-lg-alt"                        , home_lg_alt                         },
+    { "hospital-user"                      , hospital_user                       },
+    { "hospitals"                          , hospitals                           },
+    { "hotdog"                             , hotdog                              },
+    { "ice-cream"                          , ice_cream                           },
+    { "island-tropical"                    , island_tropical                     },
+    { "laptop-medical"                     , laptop_medical                      },
+    { "mailbox"                            , mailbox                             },
+    { "meat"                               , meat                                },
+    { "pager"                              , pager                               },
+    { "pepper-hot"                         , pepper_hot                          },
+    { "pizza"                              , pizza                               },
+    { "pizza-slice"                        , pizza_slice                         },
+    { "popcorn"                            , popcorn                             },
+    { "print-search"                       , print_search                        },
+    { "rings-wedding"                      , rings_wedding                       },
+    { "sack"                               , sack                                },
+    { "sack-dollar"                        , sack_dollar                         },
+    { "salad"                              , salad                               },
+    { "sandwich"                           , sandwich                            },
+    { "sausage"                            , sausage                             },
+    { "shish-kebab"                        , shish_kebab                         },
+    { "sickle"                             , sickle                              },
+    { "soup"                               , soup                                },
+    { "steak"                              , steak                               },
+    { "stretcher"                          , stretcher                           },
+    { "taco"                               , taco                                },
+    { "tanakh"                             , tanakh                              },
+    { "tasks-alt"                          , tasks_alt                           },
+    { "trash-restore"                      , trash_restore                       },
+    { "trash-restore-alt"                  , trash_restore_alt                   },
+    { "tree-palm"                          , tree_palm                           },
+    { "user-hard-hat"                      , user_hard_hat                       },
+    { "user-headset"                       , user_headset                        },
+    { "user-md-chat"                       , user_md_chat                        },
+    { "user-nurse"                         , user_nurse                          },
+    { "users-medical"                      , users_medical                       },
+    { "walker"                             , walker                              },
+    { "webcam"                             , webcam                              },
+    { "webcam-slash"                       , webcam_slash                        },
+    { "airbnb"                             , airbnb                              },
+    { "battle-net"                         , battle_net                          },
+    { "bootstrap"                          , bootstrap                           },
+    { "buffer"                             , buffer                              },
+    { "chromecast"                         , chromecast                          },
+    { "evernote"                           , evernote                            },
+    { "itch-io"                            , itch_io                             },
+    { "salesforce"                         , salesforce                          },
+    { "speaker-deck"                       , speaker_deck                        },
+    { "symfony"                            , symfony                             },
+    { "wave-square"                        , wave_square                         },
+    { "waze"                               , waze                                },
+    { "yammer"                             , yammer                              },
+    { "git-alt"                            , git_alt                             },
+    { "stackpath"                          , stackpath                           },
+    { "alarm-exclamation"                  , alarm_exclamation                   },
+    { "alarm-plus"                         , alarm_plus                          },
+    { "alarm-snooze"                       , alarm_snooze                        },
+    { "align-slash"                        , align_slash                         },
+    { "bags-shopping"                      , bags_shopping                       },
+    { "bell-exclamation"                   , bell_exclamation                    },
+    { "bell-plus"                          , bell_plus                           },
+    { "biking"                             , biking                              },
+    { "biking-mountain"                    , biking_mountain                     },
+    { "border-all"                         , border_all                          },
+    { "border-bottom"                      , border_bottom                       },
+    { "border-inner"                       , border_inner                        },
+    { "border-left"                        , border_left                         },
+    { "border-none"                        , border_none                         },
+    { "border-outer"                       , border_outer                        },
+    { "border-right"                       , border_right                        },
+    { "border-style"                       , border_style                        },
+    { "border-style-alt"                   , border_style_alt                    },
+    { "border-top"                         , border_top                          },
+    { "bring-forward"                      , bring_forward                       },
+    { "bring-front"                        , bring_front                         },
+    { "burger-soda"                        , burger_soda                         },
+    { "car-building"                       , car_building                        },
+    { "car-bus"                            , car_bus                             },
+    { "cars"                               , cars                                },
+    { "coin"                               , coin                                },
+    { "construction"                       , construction                        },
+    { "digging"                            , digging                             },
+    { "drone"                              , drone                               },
+    { "drone-alt"                          , drone_alt                           },
+    { "dryer"                              , dryer                               },
+    { "dryer-alt"                          , dryer_alt                           },
+    { "fan"                                , fan                                 },
+    { "farm"                               , farm                                },
+    { "file-search"                        , file_search                         },
+    { "font-case"                          , font_case                           },
+    { "game-board"                         , game_board                          },
+    { "game-board-alt"                     , game_board_alt                      },
+    { "glass-citrus"                       , glass_citrus                        },
+    { "h4"                                 , h4                                  },
+    { "hat-chef"                           , hat_chef                            },
+    { "horizontal-rule"                    , horizontal_rule                     },
+    { "icons"                              , icons                               },
+    { "icons-alt"                          , icons_alt                           },
+    { "kerning"                            , kerning                             },
+    { "line-columns"                       , line_columns                        },
+    { "line-height"                        , line_height                         },
+    { "money-check-edit"                   , money_check_edit                    },
+    { "money-check-edit-alt"               , money_check_edit_alt                },
+    { "mug"                                , mug                                 },
+    { "mug-tea"                            , mug_tea                             },
+    { "overline"                           , overline                            },
+    { "page-break"                         , page_break                          },
+    { "paragraph-rtl"                      , paragraph_rtl                       },
+    { "phone-alt"                          , phone_alt                           },
+    { "phone-laptop"                       , phone_laptop                        },
+    { "phone-square-alt"                   , phone_square_alt                    },
+    { "photo-video"                        , photo_video                         },
+    { "remove-format"                      , remove_format                       },
+    { "send-back"                          , send_back                           },
+    { "send-backward"                      , send_backward                       },
+    { "snooze"                             , snooze                              },
+    { "sort-alpha-down-alt"                , sort_alpha_down_alt                 },
+    { "sort-alpha-up-alt"                  , sort_alpha_up_alt                   },
+    { "sort-alt"                           , sort_alt                            },
+    { "sort-amount-down-alt"               , sort_amount_down_alt                },
+    { "sort-amount-up-alt"                 , sort_amount_up_alt                  },
+    { "sort-numeric-down-alt"              , sort_numeric_down_alt               },
+    { "sort-numeric-up-alt"                , sort_numeric_up_alt                 },
+    { "sort-shapes-down"                   , sort_shapes_down                    },
+    { "sort-shapes-down-alt"               , sort_shapes_down_alt                },
+    { "sort-shapes-up"                     , sort_shapes_up                      },
+    { "sort-shapes-up-alt"                 , sort_shapes_up_alt                  },
+    { "sort-size-down"                     , sort_size_down                      },
+    { "sort-size-down-alt"                 , sort_size_down_alt                  },
+    { "sort-size-up"                       , sort_size_up                        },
+    { "sort-size-up-alt"                   , sort_size_up_alt                    },
+    { "sparkles"                           , sparkles                            },
+    { "spell-check"                        , spell_check                         },
+    { "sunglasses"                         , sunglasses                          },
+    { "text"                               , text                                },
+    { "text-size"                          , text_size                           },
+    { "trash-undo"                         , trash_undo                          },
+    { "trash-undo-alt"                     , trash_undo_alt                      },
+    { "voicemail"                          , voicemail                           },
+    { "washer"                             , washer                              },
+    { "wave-sine"                          , wave_sine                           },
+    { "wave-triangle"                      , wave_triangle                       },
+    { "wind-turbine"                       , wind_turbine                        },
+    { "border-center-h"                    , border_center_h                     },
+    { "border-center-v"                    , border_center_v                     },
+    { "cotton-bureau"                      , cotton_bureau                       },
+    { "album"                              , album                               },
+    { "album-collection"                   , album_collection                    },
+    { "amp-guitar"                         , amp_guitar                          },
+    { "badge-sheriff"                      , badge_sheriff                       },
+    { "banjo"                              , banjo                               },
+    { "betamax"                            , betamax                             },
+    { "boombox"                            , boombox                             },
+    { "buy-n-large"                        , buy_n_large                         },
+    { "cactus"                             , cactus                              },
+    { "camcorder"                          , camcorder                           },
+    { "camera-movie"                       , camera_movie                        },
+    { "camera-polaroid"                    , camera_polaroid                     },
+    { "cassette-tape"                      , cassette_tape                       },
+    { "cctv"                               , cctv                                },
+    { "clarinet"                           , clarinet                            },
+    { "cloud-music"                        , cloud_music                         },
+    { "comment-alt-music"                  , comment_alt_music                   },
+    { "comment-music"                      , comment_music                       },
+    { "computer-classic"                   , computer_classic                    },
+    { "computer-speaker"                   , computer_speaker                    },
+    { "cowbell"                            , cowbell                             },
+    { "cowbell-more"                       , cowbell_more                        },
+    { "disc-drive"                         , disc_drive                          },
+    { "file-music"                         , file_music                          },
+    { "film-canister"                      , film_canister                       },
+    { "flashlight"                         , flashlight                          },
+    { "flute"                              , flute                               },
+    { "flux-capacitor"                     , flux_capacitor                      },
+    { "game-console-handheld"              , game_console_handheld               },
+    { "gamepad-alt"                        , gamepad_alt                         },
+    { "gramophone"                         , gramophone                          },
+    { "guitar-electric"                    , guitar_electric                     },
+    { "guitars"                            , guitars                             },
+    { "hat-cowboy"                         , hat_cowboy                          },
+    { "hat-cowboy-side"                    , hat_cowboy_side                     },
+    { "head-side-headphones"               , head_side_headphones                },
+    { "horse-saddle"                       , horse_saddle                        },
+    { "image-polaroid"                     , image_polaroid                      },
+    { "joystick"                           , joystick                            },
+    { "jug"                                , jug                                 },
+    { "kazoo"                              , kazoo                               },
+    { "lasso"                              , lasso                               },
+    { "list-music"                         , list_music                          },
+    { "mdb"                                , mdb                                 },
+    { "microphone-stand"                   , microphone_stand                    },
+    { "mouse"                              , mouse                               },
+    { "mouse-alt"                          , mouse_alt                           },
+    { "mp3-player"                         , mp3_player                          },
+    { "music-alt"                          , music_alt                           },
+    { "music-alt-slash"                    , music_alt_slash                     },
+    { "music-slash"                        , music_slash                         },
+    { "orcid"                              , orcid                               },
+    { "phone-rotary"                       , phone_rotary                        },
+    { "piano"                              , piano                               },
+    { "piano-keyboard"                     , piano_keyboard                      },
+    { "projector"                          , projector                           },
+    { "radio"                              , radio                               },
+    { "radio-alt"                          , radio_alt                           },
+    { "record-vinyl"                       , record_vinyl                        },
+    { "router"                             , router                              },
+    { "sax-hot"                            , sax_hot                             },
+    { "saxophone"                          , saxophone                           },
+    { "signal-stream"                      , signal_stream                       },
+    { "skull-cow"                          , skull_cow                           },
+    { "speaker"                            , speaker                             },
+    { "speakers"                           , speakers                            },
+    { "swift"                              , swift                               },
+    { "triangle-music"                     , triangle_music                      },
+    { "trumpet"                            , trumpet                             },
+    { "turntable"                          , turntable                           },
+    { "tv-alt"                             , tv_alt                              },
+    { "tv-music"                           , tv_music                            },
+    { "typewriter"                         , typewriter                          },
+    { "umbraco"                            , umbraco                             },
+    { "usb-drive"                          , usb_drive                           },
+    { "user-cowboy"                        , user_cowboy                         },
+    { "user-music"                         , user_music                          },
+    { "vhs"                                , vhs                                 },
+    { "violin"                             , violin                              },
+    { "wagon-covered"                      , wagon_covered                       },
+    { "walkie-talkie"                      , walkie_talkie                       },
+    { "watch-calculator"                   , watch_calculator                    },
+    { "waveform"                           , waveform                            },
+    { "waveform-path"                      , waveform_path                       },
+    { "scanner-image"                      , scanner_image                       },
+    { "air-conditioner"                    , air_conditioner                     },
+    { "alien"                              , alien                               },
+    { "alien-monster"                      , alien_monster                       },
+    { "bed-alt"                            , bed_alt                             },
+    { "bed-bunk"                           , bed_bunk                            },
+    { "bed-empty"                          , bed_empty                           },
+    { "bell-on"                            , bell_on                             },
+    { "blinds"                             , blinds                              },
+    { "blinds-open"                        , blinds_open                         },
+    { "blinds-raised"                      , blinds_raised                       },
+    { "camera-home"                        , camera_home                         },
+    { "caravan"                            , caravan                             },
+};
+
+constexpr int icon_codes_count = sizeof(icon_codes) / sizeof(icon_codes[0]);
+
+/**
+ * Returns the name of the icon with the code point @a code, or nullptr if
+ * there is none.
+ */
+constexpr const char* icon_name(int code)
+{
+    return detail::find_name(icon_codes, 0, icon_codes_count, icon_codes_count / 2, code);
+}
+
+}
+
+namespace v6 {
+
+constexpr detail::name_entry icon_names[] = {
+    { "0"                                     , _0                                     },
+    { "1"                                     , _1                                     },
+    { "2"                                     , _2                                     },
+    { "3"                                     , _3                                     },
+    { "4"                                     , _4                                     },
+    { "42-group"                              , _42_group                              },
+    { "5"                                     , _5                                     },
+    { "500px"                                 , _500px                                 },
+    { "6"                                     , _6                                     },
+    { "7"                                     , _7                                     },
+    { "8"                                     , _8                                     },
+    { "9"                                     , _9                                     },
+    { "a"                                     , a                                      },
+    { "accessible-icon"                       , accessible_icon                        },
+    { "accusoft"                              , accusoft                               },
+    { "address-book"                          , address_book                           },
+    { "address-card"                          , address_card                           },
+    { "adn"                                   , adn                                    },
+    { "adversal"                              , adversal                               },
+    { "affiliatetheme"                        , affiliatetheme                         },
+    { "airbnb"                                , airbnb                                 },
+    { "algolia"                               , algolia                                },
+    { "align-center"                          , align_center                           },
+    { "align-justify"                         , align_justify                          },
+    { "align-left"                            , align_left                             },
+    { "align-right"                           , align_right                            },
+    { "alipay"                                , alipay                                 },
+    { "amazon"                                , amazon                                 },
+    { "amazon-pay"                            , amazon_pay                             },
+    { "amilia"                                , amilia                                 },
+    { "anchor"                                , anchor                                 },
+    { "anchor-circle-check"                   , anchor_circle_check                    },
+    { "anchor-circle-exclamation"             , anchor_circle_exclamation              },
+    { "anchor-circle-xmark"                   , anchor_circle_xmark                    },
+    { "anchor-lock"                           , anchor_lock                            },
+    { "android"                               , android                                },
+    { "angellist"                             , angellist                              },
+    { "angle-down"                            , angle_down                             },
+    { "angle-left"                            , angle_left                             },
+    { "angle-right"                           , angle_right                            },
+    { "angle-up"                              , angle_up                               },
+    { "angles-down"                           , angles_down                            },
+    { "angles-left"                           , angles_left                            },
+    { "angles-right"                          , angles_right                           },
+    { "angles-up"                             , angles_up                              },
+    { "angrycreative"                         , angrycreative                          },
+    { "angular"                               , angular                                },
+    { "ankh"                                  , ankh                                   },
+    { "app-store"                             , app_store                              },
+    { "app-store-ios"                         , app_store_ios                          },
+    { "apper"                                 , apper                                  },
+    { "apple"                                 , apple                                  },
+    { "apple-pay"                             , apple_pay                              },
+    { "apple-whole"                           , apple_whole                            },
+    { "archway"                               , archway                                },
+    { "arrow-down"                            , arrow_down                             },
+    { "arrow-down-1-9"                        , arrow_down_1_9                         },
+    { "arrow-down-9-1"                        , arrow_down_9_1                         },
+    { "arrow-down-a-z"                        , arrow_down_a_z                         },
+    { "arrow-down-long"                       , arrow_down_long                        },
+    { "arrow-down-short-wide"                 , arrow_down_short_wide                  },
+    { "arrow-down-up-across-line"             , arrow_down_up_across_line              },
+    { "arrow-down-up-lock"                    , arrow_down_up_lock                     },
+    { "arrow-down-wide-short"                 , arrow_down_wide_short                  },
+    { "arrow-down-z-a"                        , arrow_down_z_a                         },
+    { "arrow-left"                            , arrow_left                             },
+    { "arrow-left-long"                       , arrow_left_long                        },
+    { "arrow-pointer"                         , arrow_pointer                          },
+    { "arrow-right"                           , arrow_right                            },
+    { "arrow-right-arrow-left"                , arrow_right_arrow_left                 },
+    { "arrow-right-from-bracket"              , arrow_right_from_bracket               },
+    { "arrow-right-long"                      , arrow_right_long                       },
+    { "arrow-right-to-bracket"                , arrow_right_to_bracket                 },
+    { "arrow-right-to-city"                   , arrow_right_to_city                    },
+    { "arrow-rotate-left"                     , arrow_rotate_left                      },
+    { "arrow-rotate-right"                    , arrow_rotate_right                     },
+    { "arrow-trend-down"                      , arrow_trend_down                       },
+    { "arrow-trend-up"                        , arrow_trend_up                         },
+    { "arrow-turn-down"                       , arrow_turn_down                        },
+    { "arrow-turn-up"                         , arrow_turn_up                          },
+    { "arrow-up"                              , arrow_up                               },
+    { "arrow-up-1-9"                          , arrow_up_1_9                           },
+    { "arrow-up-9-1"                          , arrow_up_9_1                           },
+    { "arrow-up-a-z"                          , arrow_up_a_z                           },
+    { "arrow-up-from-bracket"                 , arrow_up_from_bracket                  },
+    { "arrow-up-from-ground-water"            , arrow_up_from_ground_water             },
+    { "arrow-up-from-water-pump"              , arrow_up_from_water_pump               },
+    { "arrow-up-long"                         , arrow_up_long                          },
+    { "arrow-up-right-dots"                   , arrow_up_right_dots                    },
+    { "arrow-up-right-from-square"            , arrow_up_right_from_square             },
+    { "arrow-up-short-wide"                   , arrow_up_short_wide                    },
+    { "arrow-up-wide-short"                   , arrow_up_wide_short                    },
+    { "arrow-up-z-a"                          , arrow_up_z_a                           },
+    { "arrows-down-to-line"                   , arrows_down_to_line                    },
+    { "arrows-down-to-people"                 , arrows_down_to_people                  },
+    { "arrows-left-right"                     , arrows_left_right                      },
+    { "arrows-left-right-to-line"             , arrows_left_right_to_line              },
+    { "arrows-rotate"                         , arrows_rotate                          },
+    { "arrows-spin"                           , arrows_spin                            },
+    { "arrows-split-up-and-left"              , arrows_split_up_and_left               },
+    { "arrows-to-circle"                      , arrows_to_circle                       },
+    { "arrows-to-dot"                         , arrows_to_dot                          },
+    { "arrows-to-eye"                         , arrows_to_eye                          },
+    { "arrows-turn-right"                     , arrows_turn_right                      },
+    { "arrows-turn-to-dots"                   , arrows_turn_to_dots                    },
+    { "arrows-up-down"                        , arrows_up_down                         },
+    { "arrows-up-down-left-right"             , arrows_up_down_left_right              },
+    { "arrows-up-to-line"                     , arrows_up_to_line                      },
+    { "artstation"                            , artstation                             },
+    { "asterisk"                              , asterisk                               },
+    { "asymmetrik"                            , asymmetrik                             },
+    { "at"                                    , at                                     },
+    { "atlassian"                             , atlassian                              },
+    { "atom"                                  , atom                                   },
+    { "audible"                               , audible                                },
+    { "audio-description"                     , audio_description                      },
+    { "austral-sign"                          , austral_sign                           },
+    { "autoprefixer"                          , autoprefixer                           },
+    { "avianex"                               , avianex                                },
+    { "aviato"                                , aviato                                 },
+    { "award"                                 , award                                  },
+    { "aws"                                   , aws                                    },
+    { "b"                                     , b                                      },
+    { "baby"                                  , baby                                   },
+    { "baby-carriage"                         , baby_carriage                          },
+    { "backward"                              , backward                               },
+    { "backward-fast"                         , backward_fast                          },
+    { "backward-step"                         , backward_step                          },
+    { "bacon"                                 , bacon                                  },
+    { "bacteria"                              , bacteria                               },
+    { "bacterium"                             , bacterium                              },
+    { "bag-shopping"                          , bag_shopping                           },
+    { "bahai"                                 , bahai                                  },
+    { "baht-sign"                             , baht_sign                              },
+    { "ban"                                   , ban                                    },
+    { "ban-smoking"                           , ban_smoking                            },
+    { "bandage"                               , bandage                                },
+    { "bandcamp"                              , bandcamp                               },
+    { "barcode"                               , barcode                                },
+    { "bars"                                  , bars                                   },
+    { "bars-progress"                         , bars_progress                          },
+    { "bars-staggered"                        , bars_staggered                         },
+    { "baseball"                              , baseball                               },
+    { "baseball-bat-ball"                     , baseball_bat_ball                      },
+    { "basket-shopping"                       , basket_shopping                        },
+    { "basketball"                            , basketball                             },
+    { "bath"                                  , bath                                   },
+    { "battery-empty"                         , battery_empty                          },
+    { "battery-full"                          , battery_full                           },
+    { "battery-half"                          , battery_half                           },
+    { "battery-quarter"                       , battery_quarter                        },
+    { "battery-three-quarters"                , battery_three_quarters                 },
+    { "battle-net"                            , battle_net                             },
+    { "bed"                                   , bed                                    },
+    { "bed-pulse"                             , bed_pulse                              },
+    { "beer-mug-empty"                        , beer_mug_empty                         },
+    { "behance"                               , behance                                },
+    { "behance-square"                        , behance_square                         },
+    { "bell"                                  , bell                                   },
+    { "bell-concierge"                        , bell_concierge                         },
+    { "bell-slash"                            , bell_slash                             },
+    { "bezier-curve"                          , bezier_curve                           },
+    { "bicycle"                               , bicycle                                },
+    { "bilibili"                              , bilibili                               },
+    { "bimobject"                             , bimobject                              },
+    { "binoculars"                            , binoculars                             },
+    { "biohazard"                             , biohazard                              },
+    { "bitbucket"                             , bitbucket                              },
+    { "bitcoin"                               , bitcoin                                },
+    { "bitcoin-sign"                          , bitcoin_sign                           },
+    { "bity"                                  , bity                                   },
+    { "black-tie"                             , black_tie                              },
+    { "blackberry"                            , blackberry                             },
+    { "blender"                               , blender                                },
+    { "blender-phone"                         , blender_phone                          },
+    { "blog"                                  , blog                                   },
+    { "blogger"                               , blogger                                },
+    { "blogger-b"                             , blogger_b                              },
+    { "bluetooth"                             , bluetooth                              },
+    { "bluetooth-b"                           , bluetooth_b                            },
+    { "bold"                                  , bold                                   },
+    { "bolt"                                  , bolt                                   },
+    { "bolt-lightning"                        , bolt_lightning                         },
+    { "bomb"                                  , bomb                                   },
+    { "bone"                                  , bone                                   },
+    { "bong"                                  , bong                                   },
+    { "book"                                  , book                                   },
+    { "book-atlas"                            , book_atlas                             },
+    { "book-bible"                            , book_bible                             },
+    { "book-bookmark"                         , book_bookmark                          },
+    { "book-journal-whills"                   , book_journal_whills                    },
+    { "book-medical"                          , book_medical                           },
+    { "book-open"                             , book_open                              },
+    { "book-open-reader"                      , book_open_reader                       },
+    { "book-quran"                            , book_quran                             },
+    { "book-skull"                            , book_skull                             },
+    { "bookmark"                              , bookmark                               },
+    { "bootstrap"                             , bootstrap                              },
+    { "border-all"                            , border_all                             },
+    { "border-none"                           , border_none                            },
+    { "border-top-left"                       , border_top_left                        },
+    { "bore-hole"                             , bore_hole                              },
+    { "bots"                                  , bots                                   },
+    { "bottle-droplet"                        , bottle_droplet                         },
+    { "bottle-water"                          , bottle_water                           },
+    { "bowl-food"                             , bowl_food                              },
+    { "bowl-rice"                             , bowl_rice                              },
+    { "bowling-ball"                          , bowling_ball                           },
+    { "box"                                   , box                                    },
+    { "box-archive"                           , box_archive                            },
+    { "box-open"                              , box_open                               },
+    { "box-tissue"                            , box_tissue                             },
+    { "boxes-packing"                         , boxes_packing                          },
+    { "boxes-stacked"                         , boxes_stacked                          },
+    { "braille"                               , braille                                },
+    { "brain"                                 , brain                                  },
+    { "brazilian-real-sign"                   , brazilian_real_sign                    },
+    { "bread-slice"                           , bread_slice                            },
+    { "bridge"                                , bridge                                 },
+    { "bridge-circle-check"                   , bridge_circle_check                    },
+    { "bridge-circle-exclamation"             , bridge_circle_exclamation              },
+    { "bridge-circle-xmark"                   , bridge_circle_xmark                    },
+    { "bridge-lock"                           , bridge_lock                            },
+    { "bridge-water"                          , bridge_water                           },
+    { "briefcase"                             , briefcase                              },
+    { "briefcase-medical"                     , briefcase_medical                      },
+    { "broom"                                 , broom                                  },
+    { "broom-ball"                            , broom_ball                             },
+    { "brush"                                 , brush                                  },
+    { "btc"                                   , btc                                    },
+    { "bucket"                                , bucket                                 },
+    { "buffer"                                , buffer                                 },
+    { "bug"                                   , bug                                    },
+    { "bug-slash"                             , bug_slash                              },
+    { "bugs"                                  , bugs                                   },
+    { "building"                              , building                               },
+    { "building-circle-arrow-right"           , building_circle_arrow_right            },
+    { "building-circle-check"                 , building_circle_check                  },
+    { "building-circle-exclamation"           , building_circle_exclamation            },
+    { "building-circle-xmark"                 , building_circle_xmark                  },
+    { "building-columns"                      , building_columns                       },
+    { "building-flag"                         , building_flag                          },
+    { "building-lock"                         , building_lock                          },
+    { "building-ngo"                          , building_ngo                           },
+    { "building-shield"                       , building_shield                        },
+    { "building-un"                           , building_un                            },
+    { "building-user"                         , building_user                          },
+    { "building-wheat"                        , building_wheat                         },
+    { "bullhorn"                              , bullhorn                               },
+    { "bullseye"                              , bullseye                               },
+    { "burger"                                , burger                                 },
+    { "buromobelexperte"                      , buromobelexperte                       },
+    { "burst"                                 , burst                                  },
+    { "bus"                                   , bus                                    },
+    { "bus-simple"                            , bus_simple                             },
+    { "business-time"                         , business_time                          },
+    { "buy-n-large"                           , buy_n_large                            },
+    { "buysellads"                            , buysellads                             },
+    { "c"                                     , c                                      },
+    { "cake-candles"                          , cake_candles                           },
+    { "calculator"                            , calculator                             },
+    { "calendar"                              , calendar                               },
+    { "calendar-check"                        , calendar_check                         },
+    { "calendar-day"                          , calendar_day                           },
+    { "calendar-days"                         , calendar_days                          },
+    { "calendar-minus"                        , calendar_minus                         },
+    { "calendar-plus"                         , calendar_plus                          },
+    { "calendar-week"                         , calendar_week                          },
+    { "calendar-xmark"                        , calendar_xmark                         },
+    { "camera"                                , camera                                 },
+    { "camera-retro"                          , camera_retro                           },
+    { "camera-rotate"                         , camera_rotate                          },
+    { "campground"                            , campground                             },
+    { "canadian-maple-leaf"                   , canadian_maple_leaf                    },
+    { "candy-cane"                            , candy_cane                             },
+    { "cannabis"                              , cannabis                               },
+    { "capsules"                              , capsules                               },
+    { "car"                                   , car                                    },
+    { "car-battery"                           , car_battery                            },
+    { "car-burst"                             , car_burst                              },
+    { "car-on"                                , car_on                                 },
+    { "car-rear"                              , car_rear                               },
+    { "car-side"                              , car_side                               },
+    { "car-tunnel"                            , car_tunnel                             },
+    { "caravan"                               , caravan                                },
+    { "caret-down"                            , caret_down                             },
+    { "caret-left"                            , caret_left                             },
+    { "caret-right"                           , caret_right                            },
+    { "caret-up"                              , caret_up                               },
+    { "carrot"                                , carrot                                 },
+    { "cart-arrow-down"                       , cart_arrow_down                        },
+    { "cart-flatbed"                          , cart_flatbed                           },
+    { "cart-flatbed-suitcase"                 , cart_flatbed_suitcase                  },
+    { "cart-plus"                             , cart_plus                              },
+    { "cart-shopping"                         , cart_shopping                          },
+    { "cash-register"                         , cash_register                          },
+    { "cat"                                   , cat                                    },
+    { "cc-amazon-pay"                         , cc_amazon_pay                          },
+    { "cc-amex"                               , cc_amex                                },
+    { "cc-apple-pay"                          , cc_apple_pay                           },
+    { "cc-diners-club"                        , cc_diners_club                         },
+    { "cc-discover"                           , cc_discover                            },
+    { "cc-jcb"                                , cc_jcb                                 },
+    { "cc-mastercard"                         , cc_mastercard                          },
+    { "cc-paypal"                             , cc_paypal                              },
+    { "cc-stripe"                             , cc_stripe                              },
+    { "cc-visa"                               , cc_visa                                },
+    { "cedi-sign"                             , cedi_sign                              },
+    { "cent-sign"                             , cent_sign                              },
+    { "centercode"                            , centercode                             },
+    { "centos"                                , centos                                 },
+    { "certificate"                           , certificate                            },
+    { "chair"                                 , chair                                  },
+    { "chalkboard"                            , chalkboard                             },
+    { "chalkboard-user"                       , chalkboard_user                        },
+    { "champagne-glasses"                     , champagne_glasses                      },
+    { "charging-station"                      , charging_station                       },
+    { "chart-area"                            , chart_area                             },
+    { "chart-bar"                             , chart_bar                              },
+    { "chart-column"                          , chart_column                           },
+    { "chart-gantt"                           , chart_gantt                            },
+    { "chart-line"                            , chart_line                             },
+    { "chart-pie"                             , chart_pie                              },
+    { "chart-simple"                          , chart_simple                           },
+    { "check"                                 , check                                  },
+    { "check-double"                          , check_double                           },
+    { "check-to-slot"                         , check_to_slot                          },
+    { "cheese"                                , cheese                                 },
+    { "chess"                                 , chess                                  },
+    { "chess-bishop"                          , chess_bishop                           },
+    { "chess-board"                           , chess_board                            },
+    { "chess-king"                            , chess_king                             },
+    { "chess-knight"                          , chess_knight                           },
+    { "chess-pawn"                            , chess_pawn                             },
+    { "chess-queen"                           , chess_queen                            },
+    { "chess-rook"                            , chess_rook                             },
+    { "chevron-down"                          , chevron_down                           },
+    { "chevron-left"                          , chevron_left                           },
+    { "chevron-right"                         , chevron_right                          },
+    { "chevron-up"                            , chevron_up                             },
+    { "child"                                 , child                                  },
+    { "child-dress"                           , child_dress                            },
+    { "child-reaching"                        , child_reaching                         },
+    { "child-rifle"                           , child_rifle                            },
+    { "children"                              , children                               },
+    { "chrome"                                , chrome                                 },
+    { "chromecast"                            , chromecast                             },
+    { "church"                                , church                                 },
+    { "circle"                                , circle                                 },
+    { "circle-arrow-down"                     , circle_arrow_down                      },
+    { "circle-arrow-left"                     , circle_arrow_left                      },
+    { "circle-arrow-right"                    , circle_arrow_right                     },
+    { "circle-arrow-up"                       , circle_arrow_up                        },
+    { "circle-check"                          , circle_check                           },
+    { "circle-chevron-down"                   , circle_chevron_down                    },
+    { "circle-chevron-left"                   , circle_chevron_left                    },
+    { "circle-chevron-right"                  , circle_chevron_right                   },
+    { "circle-chevron-up"                     , circle_chevron_up                      },
+    { "circle-dollar-to-slot"                 , circle_dollar_to_slot                  },
+    { "circle-dot"                            , circle_dot                             },
+    { "circle-down"                           , circle_down                            },
+    { "circle-exclamation"                    , circle_exclamation                     },
+    { "circle-h"                              , circle_h                               },
+    { "circle-half-stroke"                    , circle_half_stroke                     },
+    { "circle-info"                           , circle_info                            },
+    { "circle-left"                           , circle_left                            },
+    { "circle-minus"                          , circle_minus                           },
+    { "circle-nodes"                          , circle_nodes                           },
+    { "circle-notch"                          , circle_notch                           },
+    { "circle-pause"                          , circle_pause                           },
+    { "circle-play"                           , circle_play                            },
+    { "circle-plus"                           , circle_plus                            },
+    { "circle-question"                       , circle_question                        },
+    { "circle-radiation"                      , circle_radiation                       },
+    { "circle-right"                          , circle_right                           },
+    { "circle-stop"                           , circle_stop                            },
+    { "circle-up"                             , circle_up                              },
+    { "circle-user"                           , circle_user                            },
+    { "circle-xmark"                          , circle_xmark                           },
+    { "city"                                  , city                                   },
+    { "clapperboard"                          , clapperboard                           },
+    { "clipboard"                             , clipboard                              },
+    { "clipboard-check"                       , clipboard_check                        },
+    { "clipboard-list"                        , clipboard_list                         },
+    { "clipboard-question"                    , clipboard_question                     },
+    { "clipboard-user"                        , clipboard_user                         },
+    { "clock"                                 , clock                                  },
+    { "clock-rotate-left"                     , clock_rotate_left                      },
+    { "clone"                                 , clone                                  },
+    { "closed-captioning"                     , closed_captioning                      },
+    { "cloud"                                 , cloud                                  },
+    { "cloud-arrow-down"                      , cloud_arrow_down                       },
+    { "cloud-arrow-up"                        , cloud_arrow_up                         },
+    { "cloud-bolt"                            , cloud_bolt                             },
+    { "cloud-meatball"                        , cloud_meatball                         },
+    { "cloud-moon"                            , cloud_moon                             },
+    { "cloud-moon-rain"                       , cloud_moon_rain                        },
+    { "cloud-rain"                            , cloud_rain                             },
+    { "cloud-showers-heavy"                   , cloud_showers_heavy                    },
+    { "cloud-showers-water"                   , cloud_showers_water                    },
+    { "cloud-sun"                             , cloud_sun                              },
+    { "cloud-sun-rain"                        , cloud_sun_rain                         },
+    { "cloudflare"                            , cloudflare                             },
+    { "cloudscale"                            , cloudscale                             },
+    { "cloudsmith"                            , cloudsmith                             },
+    { "cloudversify"                          , cloudversify                           },
+    { "clover"                                , clover                                 },
+    { "cmplid"                                , cmplid                                 },
+    { "code"                                  , code                                   },
+    { "code-branch"                           , code_branch                            },
+    { "code-commit"                           , code_commit                            },
+    { "code-compare"                          , code_compare                           },
+    { "code-fork"                             , code_fork                              },
+    { "code-merge"                            , code_merge                             },
+    { "code-pull-request"                     , code_pull_request                      },
+    { "codepen"                               , codepen                                },
+    { "codiepie"                              , codiepie                               },
+    { "coins"                                 , coins                                  },
+    { "colon-sign"                            , colon_sign                             },
+    { "comment"                               , comment                                },
+    { "comment-dollar"                        , comment_dollar                         },
+    { "comment-dots"                          , comment_dots                           },
+    { "comment-medical"                       , comment_medical                        },
+    { "comment-slash"                         , comment_slash                          },
+    { "comment-sms"                           , comment_sms                            },
+    { "comments"                              , comments                               },
+    { "comments-dollar"                       , comments_dollar                        },
+    { "compact-disc"                          , compact_disc                           },
+    { "compass"                               , compass                                },
+    { "compass-drafting"                      , compass_drafting                       },
+    { "compress"                              , compress                               },
+    { "computer"                              , computer                               },
+    { "computer-mouse"                        , computer_mouse                         },
+    { "confluence"                            , confluence                             },
+    { "connectdevelop"                        , connectdevelop                         },
+    { "contao"                                , contao                                 },
+    { "cookie"                                , cookie                                 },
+    { "cookie-bite"                           , cookie_bite                            },
+    { "copy"                                  , copy                                   },
+    { "copyright"                             , copyright                              },
+    { "cotton-bureau"                         , cotton_bureau                          },
+    { "couch"                                 , couch                                  },
+    { "cow"                                   , cow                                    },
+    { "cpanel"                                , cpanel                                 },
+    { "creative-commons"                      , creative_commons                       },
+    { "creative-commons-by"                   , creative_commons_by                    },
+    { "creative-commons-nc"                   , creative_commons_nc                    },
+    { "creative-commons-nc-eu"                , creative_commons_nc_eu                 },
+    { "creative-commons-nc-jp"                , creative_commons_nc_jp                 },
+    { "creative-commons-nd"                   , creative_commons_nd                    },
+    { "creative-commons-pd"                   , creative_commons_pd                    },
+    { "creative-commons-pd-alt"               , creative_commons_pd_alt                },
+    { "creative-commons-remix"                , creative_commons_remix                 },
+    { "creative-commons-sa"                   , creative_commons_sa                    },
+    { "creative-commons-sampling"             , creative_commons_sampling              },
+    { "creative-commons-sampling-plus"        , creative_commons_sampling_plus         },
+    { "creative-commons-share"                , creative_commons_share                 },
+    { "creative-commons-zero"                 , creative_commons_zero                  },
+    { "credit-card"                           , credit_card                            },
+    { "critical-role"                         , critical_role                          },
+    { "crop"                                  , crop                                   },
+    { "crop-simple"                           , crop_simple                            },
+    { "cross"                                 , cross                                  },
+    { "crosshairs"                            , crosshairs                             },
+    { "crow"                                  , crow                                   },
+    { "crown"                                 , crown                                  },
+    { "crutch"                                , crutch                                 },
+    { "cruzeiro-sign"                         , cruzeiro_sign                          },
+    { "css3"                                  , css3                                   },
+    { "css3-alt"                              , css3_alt                               },
+    { "cube"                                  , cube                                   },
+    { "cubes"                                 , cubes                                  },
+    { "cubes-stacked"                         , cubes_stacked                          },
+    { "cuttlefish"                            , cuttlefish                             },
+    { "d"                                     , d                                      },
+    { "d-and-d"                               , d_and_d                                },
+    { "d-and-d-beyond"                        , d_and_d_beyond                         },
+    { "dailymotion"                           , dailymotion                            },
+    { "dashcube"                              , dashcube                               },
+    { "database"                              , database                               },
+    { "deezer"                                , deezer                                 },
+    { "delete-left"                           , delete_left                            },
+    { "delicious"                             , delicious                              },
+    { "democrat"                              , democrat                               },
+    { "deploydog"                             , deploydog                              },
+    { "deskpro"                               , deskpro                                },
+    { "desktop"                               , desktop                                },
+    { "dev"                                   , dev                                    },
+    { "deviantart"                            , deviantart                             },
+    { "dharmachakra"                          , dharmachakra                           },
+    { "dhl"                                   , dhl                                    },
+    { "diagram-next"                          , diagram_next                           },
+    { "diagram-predecessor"                   , diagram_predecessor                    },
+    { "diagram-project"                       , diagram_project                        },
+    { "diagram-successor"                     , diagram_successor                      },
+    { "diamond"                               , diamond                                },
+    { "diamond-turn-right"                    , diamond_turn_right                     },
+    { "diaspora"                              , diaspora                               },
+    { "dice"                                  , dice                                   },
+    { "dice-d20"                              , dice_d20                               },
+    { "dice-d6"                               , dice_d6                                },
+    { "dice-five"                             , dice_five                              },
+    { "dice-four"                             , dice_four                              },
+    { "dice-one"                              , dice_one                               },
+    { "dice-six"                              , dice_six                               },
+    { "dice-three"                            , dice_three                             },
+    { "dice-two"                              , dice_two                               },
+    { "digg"                                  , digg                                   },
+    { "digital-ocean"                         , digital_ocean                          },
+    { "discord"                               , discord                                },
+    { "discourse"                             , discourse                              },
+    { "disease"                               , disease                                },
+    { "display"                               , display                                },
+    { "divide"                                , divide                                 },
+    { "dna"                                   , dna                                    },
+    { "dochub"                                , dochub                                 },
+    { "docker"                                , docker                                 },
+    { "dog"                                   , dog                                    },
+    { "dollar-sign"                           , dollar_sign                            },
+    { "dolly"                                 , dolly                                  },
+    { "dong-sign"                             , dong_sign                              },
+    { "door-closed"                           , door_closed                            },
+    { "door-open"                             , door_open                              },
+    { "dove"                                  , dove                                   },
+    { "down-left-and-up-right-to-center"      , down_left_and_up_right_to_center       },
+    { "down-long"                             , down_long                              },
+    { "download"                              , download                               },
+    { "draft2digital"                         , draft2digital                          },
+    { "dragon"                                , dragon                                 },
+    { "draw-polygon"                          , draw_polygon                           },
+    { "dribbble"                              , dribbble                               },
+    { "dribbble-square"                       , dribbble_square                        },
+    { "dropbox"                               , dropbox                                },
+    { "droplet"                               , droplet                                },
+    { "droplet-slash"                         , droplet_slash                          },
+    { "drum"                                  , drum                                   },
+    { "drum-steelpan"                         , drum_steelpan                          },
+    { "drumstick-bite"                        , drumstick_bite                         },
+    { "drupal"                                , drupal                                 },
+    { "dumbbell"                              , dumbbell                               },
+    { "dumpster"                              , dumpster                               },
+    { "dumpster-fire"                         , dumpster_fire                          },
+    { "dungeon"                               , dungeon                                },
+    { "dyalog"                                , dyalog                                 },
+    { "e"                                     , e                                      },
+    { "ear-deaf"                              , ear_deaf                               },
+    { "ear-listen"                            , ear_listen                             },
+    { "earlybirds"                            , earlybirds                             },
+    { "earth-africa"                          , earth_africa                           },
+    { "earth-americas"                        , earth_americas                         },
+    { "earth-asia"                            , earth_asia                             },
+    { "earth-europe"                          , earth_europe                           },
+    { "earth-oceania"                         , earth_oceania                          },
+    { "ebay"                                  , ebay                                   },
+    { "edge"                                  , edge                                   },
+    { "edge-legacy"                           , edge_legacy                            },
+    { "egg"                                   , egg                                    },
+    { "eject"                                 , eject                                  },
+    { "elementor"                             , elementor                              },
+    { "elevator"                              , elevator                               },
+    { "ellipsis"                              , ellipsis                               },
+    { "ellipsis-vertical"                     , ellipsis_vertical                      },
+    { "ello"                                  , ello                                   },
+    { "ember"                                 , ember                                  },
+    { "empire"                                , empire                                 },
+    { "envelope"                              , envelope                               },
+    { "envelope-circle-check"                 , envelope_circle_check                  },
+    { "envelope-open"                         , envelope_open                          },
+    { "envelope-open-text"                    , envelope_open_text                     },
+    { "envelopes-bulk"                        , envelopes_bulk                         },
+    { "envira"                                , envira                                 },
+    { "equals"                                , equals                                 },
+    { "eraser"                                , eraser                                 },
+    { "erlang"                                , erlang                                 },
+    { "ethereum"                              , ethereum                               },
+    { "ethernet"                              , ethernet                               },
+    { "etsy"                                  , etsy                                   },
+    { "euro-sign"                             , euro_sign                              },
+    { "evernote"                              , evernote                               },
+    { "exclamation"                           , exclamation                            },
+    { "expand"                                , expand                                 },
+    { "expeditedssl"                          , expeditedssl                           },
+    { "explosion"                             , explosion                              },
+    { "eye"                                   , eye                                    },
+    { "eye-dropper"                           , eye_dropper                            },
+    { "eye-low-vision"                        , eye_low_vision                         },
+    { "eye-slash"                             , eye_slash                              },
+    { "f"                                     , f                                      },
+    { "face-angry"                            , face_angry                             },
+    { "face-dizzy"                            , face_dizzy                             },
+    { "face-flushed"                          , face_flushed                           },
+    { "face-frown"                            , face_frown                             },
+    { "face-frown-open"                       , face_frown_open                        },
+    { "face-grimace"                          , face_grimace                           },
+    { "face-grin"                             , face_grin                              },
+    { "face-grin-beam"                        , face_grin_beam                         },
+    { "face-grin-beam-sweat"                  , face_grin_beam_sweat                   },
+    { "face-grin-hearts"                      , face_grin_hearts                       },
+    { "face-grin-squint"                      , face_grin_squint                       },
+    { "face-grin-squint-tears"                , face_grin_squint_tears                 },
+    { "face-grin-stars"                       , face_grin_stars                        },
+    { "face-grin-tears"                       , face_grin_tears                        },
+    { "face-grin-tongue"                      , face_grin_tongue                       },
+    { "face-grin-tongue-squint"               , face_grin_tongue_squint                },
+    { "face-grin-tongue-wink"                 , face_grin_tongue_wink                  },
+    { "face-grin-wide"                        , face_grin_wide                         },
+    { "face-grin-wink"                        , face_grin_wink                         },
+    { "face-kiss"                             , face_kiss                              },
+    { "face-kiss-beam"                        , face_kiss_beam                         },
+    { "face-kiss-wink-heart"                  , face_kiss_wink_heart                   },
+    { "face-laugh"                            , face_laugh                             },
+    { "face-laugh-beam"                       , face_laugh_beam                        },
+    { "face-laugh-squint"                     , face_laugh_squint                      },
+    { "face-laugh-wink"                       , face_laugh_wink                        },
+    { "face-meh"                              , face_meh                               },
+    { "face-meh-blank"                        , face_meh_blank                         },
+    { "face-rolling-eyes"                     , face_rolling_eyes                      },
+    { "face-sad-cry"                          , face_sad_cry                           },
+    { "face-sad-tear"                         , face_sad_tear                          },
+    { "face-smile"                            , face_smile                             },
+    { "face-smile-beam"                       , face_smile_beam                        },
+    { "face-smile-wink"                       , face_smile_wink                        },
+    { "face-surprise"                         , face_surprise                          },
+    { "face-tired"                            , face_tired                             },
+    { "facebook"                              , facebook                               },
+    { "facebook-f"                            , facebook_f                             },
+    { "facebook-messenger"                    , facebook_messenger                     },
+    { "facebook-square"                       , facebook_square                        },
+    { "fan"                                   , fan                                    },
+    { "fantasy-flight-games"                  , fantasy_flight_games                   },
+    { "faucet"                                , faucet                                 },
+    { "faucet-drip"                           , faucet_drip                            },
+    { "fax"                                   , fax                                    },
+    { "feather"                               , feather                                },
+    { "feather-pointed"                       , feather_pointed                        },
+    { "fedex"                                 , fedex                                  },
+    { "fedora"                                , fedora                                 },
+    { "ferry"                                 , ferry                                  },
+    { "figma"                                 , figma                                  },
+    { "file"                                  , file                                   },
+    { "file-arrow-down"                       , file_arrow_down                        },
+    { "file-arrow-up"                         , file_arrow_up                          },
+    { "file-audio"                            , file_audio                             },
+    { "file-circle-check"                     , file_circle_check                      },
+    { "file-circle-exclamation"               , file_circle_exclamation                },
+    { "file-circle-minus"                     , file_circle_minus                      },
+    { "file-circle-plus"                      , file_circle_plus                       },
+    { "file-circle-question"                  , file_circle_question                   },
+    { "file-circle-xmark"                     , file_circle_xmark                      },
+    { "file-code"                             , file_code                              },
+    { "file-contract"                         , file_contract                          },
+    { "file-csv"                              , file_csv                               },
+    { "file-excel"                            , file_excel                             },
+    { "file-export"                           , file_export                            },
+    { "file-image"                            , file_image                             },
+    { "file-import"                           , file_import                            },
+    { "file-invoice"                          , file_invoice                           },
+    { "file-invoice-dollar"                   , file_invoice_dollar                    },
+    { "file-lines"                            , file_lines                             },
+    { "file-medical"                          , file_medical                           },
+    { "file-pdf"                              , file_pdf                               },
+    { "file-pen"                              , file_pen                               },
+    { "file-powerpoint"                       , file_powerpoint                        },
+    { "file-prescription"                     , file_prescription                      },
+    { "file-shield"                           , file_shield                            },
+    { "file-signature"                        , file_signature                         },
+    { "file-video"                            , file_video                             },
+    { "file-waveform"                         , file_waveform                          },
+    { "file-word"                             , file_word                              },
+    { "file-zipper"                           , file_zipper                            },
+    { "fill"                                  , fill                                   },
+    { "fill-drip"                             , fill_drip                              },
+    { "film"                                  , film                                   },
+    { "filter"                                , filter                                 },
+    { "filter-circle-dollar"                  , filter_circle_dollar                   },
+    { "filter-circle-xmark"                   , filter_circle_xmark                    },
+    { "fingerprint"                           , fingerprint                            },
+    { "fire"                                  , fire                                   },
+    { "fire-burner"                           , fire_burner                            },
+    { "fire-extinguisher"                     , fire_extinguisher                      },
+    { "fire-flame-curved"                     , fire_flame_curved                      },
+    { "fire-flame-simple"                     , fire_flame_simple                      },
+    { "firefox"                               , firefox                                },
+    { "firefox-browser"                       , firefox_browser                        },
+    { "first-order"                           , first_order                            },
+    { "first-order-alt"                       , first_order_alt                        },
+    { "firstdraft"                            , firstdraft                             },
+    { "fish"                                  , fish                                   },
+    { "fish-fins"                             , fish_fins                              },
+    { "flag"                                  , flag                                   },
+    { "flag-checkered"                        , flag_checkered                         },
+    { "flag-usa"                              , flag_usa                               },
+    { "flask"                                 , flask                                  },
+    { "flask-vial"                            , flask_vial                             },
+    { "flickr"                                , flickr                                 },
+    { "flipboard"                             , flipboard                              },
+    { "floppy-disk"                           , floppy_disk                            },
+    { "florin-sign"                           , florin_sign                            },
+    { "fly"                                   , fly                                    },
+    { "folder"                                , folder                                 },
+    { "folder-closed"                         , folder_closed                          },
+    { "folder-minus"                          , folder_minus                           },
+    { "folder-open"                           , folder_open                            },
+    { "folder-plus"                           , folder_plus                            },
+    { "folder-tree"                           , folder_tree                            },
+    { "font"                                  , font                                   },
+    { "font-awesome"                          , font_awesome                           },
+    { "fonticons"                             , fonticons                              },
+    { "fonticons-fi"                          , fonticons_fi                           },
+    { "football"                              , football                               },
+    { "fort-awesome"                          , fort_awesome                           },
+    { "fort-awesome-alt"                      , fort_awesome_alt                       },
+    { "forumbee"                              , forumbee                               },
+    { "forward"                               , forward                                },
+    { "forward-fast"                          , forward_fast                           },
+    { "forward-step"                          , forward_step                           },
+    { "foursquare"                            , foursquare                             },
+    { "franc-sign"                            , franc_sign                             },
+    { "free-code-camp"                        , free_code_camp                         },
+    { "freebsd"                               , freebsd                                },
+    { "frog"                                  , frog                                   },
+    { "fulcrum"                               , fulcrum                                },
+    { "futbol"                                , futbol                                 },
+    { "g"                                     , g                                      },
+    { "galactic-republic"                     , galactic_republic                      },
+    { "galactic-senate"                       , galactic_senate                        },
+    { "gamepad"                               , gamepad                                },
+    { "gas-pump"                              , gas_pump                               },
+    { "gauge"                                 , gauge                                  },
+    { "gauge-high"                            , gauge_high                             },
+    { "gauge-simple"                          , gauge_simple                           },
+    { "gauge-simple-high"                     , gauge_simple_high                      },
+    { "gavel"                                 , gavel                                  },
+    { "gear"                                  , gear                                   },
+    { "gears"                                 , gears                                  },
+    { "gem"                                   , gem                                    },
+    { "genderless"                            , genderless                             },
+    { "get-pocket"                            , get_pocket                             },
+    { "gg"                                    , gg                                     },
+    { "gg-circle"                             , gg_circle                              },
+    { "ghost"                                 , ghost                                  },
+    { "gift"                                  , gift                                   },
+    { "gifts"                                 , gifts                                  },
+    { "git"                                   , git                                    },
+    { "git-alt"                               , git_alt                                },
+    { "git-square"                            , git_square                             },
+    { "github"                                , github                                 },
+    { "github-alt"                            , github_alt                             },
+    { "github-square"                         , github_square                          },
+    { "gitkraken"                             , gitkraken                              },
+    { "gitlab"                                , gitlab                                 },
+    { "gitter"                                , gitter                                 },
+    { "glass-water"                           , glass_water                            },
+    { "glass-water-droplet"                   , glass_water_droplet                    },
+    { "glasses"                               , glasses                                },
+    { "glide"                                 , glide                                  },
+    { "glide-g"                               , glide_g                                },
+    { "globe"                                 , globe                                  },
+    { "gofore"                                , gofore                                 },
+    { "golang"                                , golang                                 },
+    { "golf-ball-tee"                         , golf_ball_tee                          },
+    { "goodreads"                             , goodreads                              },
+    { "goodreads-g"                           , goodreads_g                            },
+    { "google"                                , google                                 },
+    { "google-drive"                          , google_drive                           },
+    { "google-pay"                            , google_pay                             },
+    { "google-play"                           , google_play                            },
+    { "google-plus"                           , google_plus                            },
+    { "google-plus-g"                         , google_plus_g                          },
+    { "google-plus-square"                    , google_plus_square                     },
+    { "google-wallet"                         , google_wallet                          },
+    { "gopuram"                               , gopuram                                },
+    { "graduation-cap"                        , graduation_cap                         },
+    { "gratipay"                              , gratipay                               },
+    { "grav"                                  , grav                                   },
+    { "greater-than"                          , greater_than                           },
+    { "greater-than-equal"                    , greater_than_equal                     },
+    { "grip"                                  , grip                                   },
+    { "grip-lines"                            , grip_lines                             },
+    { "grip-lines-vertical"                   , grip_lines_vertical                    },
+    { "grip-vertical"                         , grip_vertical                          },
+    { "gripfire"                              , gripfire                               },
+    { "group-arrows-rotate"                   , group_arrows_rotate                    },
+    { "grunt"                                 , grunt                                  },
+    { "guarani-sign"                          , guarani_sign                           },
+    { "guilded"                               , guilded                                },
+    { "guitar"                                , guitar                                 },
+    { "gulp"                                  , gulp                                   },
+    { "gun"                                   , gun                                    },
+    { "h"                                     , h                                      },
+    { "hacker-news"                           , hacker_news                            },
+    { "hacker-news-square"                    , hacker_news_square                     },
+    { "hackerrank"                            , hackerrank                             },
+    { "hammer"                                , hammer                                 },
+    { "hamsa"                                 , hamsa                                  },
+    { "hand"                                  , hand                                   },
+    { "hand-back-fist"                        , hand_back_fist                         },
+    { "hand-dots"                             , hand_dots                              },
+    { "hand-fist"                             , hand_fist                              },
+    { "hand-holding"                          , hand_holding                           },
+    { "hand-holding-dollar"                   , hand_holding_dollar                    },
+    { "hand-holding-droplet"                  , hand_holding_droplet                   },
+    { "hand-holding-hand"                     , hand_holding_hand                      },
+    { "hand-holding-heart"                    , hand_holding_heart                     },
+    { "hand-holding-medical"                  , hand_holding_medical                   },
+    { "hand-lizard"                           , hand_lizard                            },
+    { "hand-middle-finger"                    , hand_middle_finger                     },
+    { "hand-peace"                            , hand_peace                             },
+    { "hand-point-down"                       , hand_point_down                        },
+    { "hand-point-left"                       , hand_point_left                        },
+    { "hand-point-right"                      , hand_point_right                       },
+    { "hand-point-up"                         , hand_point_up                          },
+    { "hand-pointer"                          , hand_pointer                           },
+    { "hand-scissors"                         , hand_scissors                          },
+    { "hand-sparkles"                         , hand_sparkles                          },
+    { "hand-spock"                            , hand_spock                             },
+    { "handcuffs"                             , handcuffs                              },
+    { "hands"                                 , hands                                  },
+    { "hands-asl-interpreting"                , hands_asl_interpreting                 },
+    { "hands-bound"                           , hands_bound                            },
+    { "hands-bubbles"                         , hands_bubbles                          },
+    { "hands-clapping"                        , hands_clapping                         },
+    { "hands-holding"                         , hands_holding                          },
+    { "hands-holding-child"                   , hands_holding_child                    },
+    { "hands-holding-circle"                  , hands_holding_circle                   },
+    { "hands-praying"                         , hands_praying                          },
+    { "handshake"                             , handshake                              },
+    { "handshake-angle"                       , handshake_angle                        },
+    { "handshake-simple"                      , handshake_simple                       },
+    { "handshake-simple-slash"                , handshake_simple_slash                 },
+    { "handshake-slash"                       , handshake_slash                        },
+    { "hanukiah"                              , hanukiah                               },
+    { "hard-drive"                            , hard_drive                             },
+    { "hashnode"                              , hashnode                               },
+    { "hashtag"                               , hashtag                                },
+    { "hat-cowboy"                            , hat_cowboy                             },
+    { "hat-cowboy-side"                       , hat_cowboy_side                        },
+    { "hat-wizard"                            , hat_wizard                             },
+    { "head-side-cough"                       , head_side_cough                        },
+    { "head-side-cough-slash"                 , head_side_cough_slash                  },
+    { "head-side-mask"                        , head_side_mask                         },
+    { "head-side-virus"                       , head_side_virus                        },
+    { "heading"                               , heading                                },
+    { "headphones"                            , headphones                             },
+    { "headphones-simple"                     , headphones_simple                      },
+    { "headset"                               , headset                                },
+    { "heart"                                 , heart                                  },
+    { "heart-circle-bolt"                     , heart_circle_bolt                      },
+    { "heart-circle-check"                    , heart_circle_check                     },
+    { "heart-circle-exclamation"              , heart_circle_exclamation               },
+    { "heart-circle-minus"                    , heart_circle_minus                     },
+    { "heart-circle-plus"                     , heart_circle_plus                      },
+    { "heart-circle-xmark"                    , heart_circle_xmark                     },
+    { "heart-crack"                           , heart_crack                            },
+    { "heart-pulse"                           , heart_pulse                            },
+    { "helicopter"                            , helicopter                             },
+    { "helicopter-symbol"                     , helicopter_symbol                      },
+    { "helmet-safety"                         , helmet_safety                          },
+    { "helmet-un"                             , helmet_un                              },
+    { "highlighter"                           , highlighter                            },
+    { "hill-avalanche"                        , hill_avalanche                         },
+    { "hill-rockslide"                        , hill_rockslide                         },
+    { "hippo"                                 , hippo                                  },
+    { "hips"                                  , hips                                   },
+    { "hire-a-helper"                         , hire_a_helper                          },
+    { "hive"                                  , hive                                   },
+    { "hockey-puck"                           , hockey_puck                            },
+    { "holly-berry"                           , holly_berry                            },
+    { "hooli"                                 , hooli                                  },
+    { "hornbill"                              , hornbill                               },
+    { "horse"                                 , horse                                  },
+    { "horse-head"                            , horse_head                             },
+    { "hospital"                              , hospital                               },
+    { "hospital-user"                         , hospital_user                          },
+    { "hot-tub-person"                        , hot_tub_person                         },
+    { "hotdog"                                , hotdog                                 },
+    { "hotel"                                 , hotel                                  },
+    { "hotjar"                                , hotjar                                 },
+    { "hourglass"                             , hourglass                              },
+    { "hourglass-empty"                       , hourglass_empty                        },
+    { "hourglass-end"                         , hourglass_end                          },
+    { "hourglass-start"                       , hourglass_start                        },
+    { "house"                                 , house                                  },
+    { "house-chimney"                         , house_chimney                          },
+    { "house-chimney-crack"                   , house_chimney_crack                    },
+    { "house-chimney-medical"                 , house_chimney_medical                  },
+    { "house-chimney-user"                    , house_chimney_user                     },
+    { "house-chimney-window"                  , house_chimney_window                   },
+    { "house-circle-check"                    , house_circle_check                     },
+    { "house-circle-exclamation"              , house_circle_exclamation               },
+    { "house-circle-xmark"                    , house_circle_xmark                     },
+    { "house-crack"                           , house_crack                            },
+    { "house-fire"                            , house_fire                             },
+    { "house-flag"                            , house_flag                             },
+    { "house-flood-water"                     , house_flood_water                      },
+    { "house-flood-water-circle-arrow-right"  , house_flood_water_circle_arrow_right   },
+    { "house-laptop"                          , house_laptop                           },
+    { "house-lock"                            , house_lock                             },
+    { "house-medical"                         , house_medical                          },
+    { "house-medical-circle-check"            , house_medical_circle_check             },
+    { "house-medical-circle-exclamation"      , house_medical_circle_exclamation       },
+    { "house-medical-circle-xmark"            , house_medical_circle_xmark             },
+    { "house-medical-flag"                    , house_medical_flag                     },
+    { "house-signal"                          , house_signal                           },
+    { "house-tsunami"                         , house_tsunami                          },
+    { "house-user"                            , house_user                             },
+    { "houzz"                                 , houzz                                  },
+    { "hryvnia-sign"                          , hryvnia_sign                           },
+    { "html5"                                 , html5                                  },
+    { "hubspot"                               , hubspot                                },
+    { "hurricane"                             , hurricane                              },
+    { "i"                                     , i                                      },
+    { "i-cursor"                              , i_cursor                               },
+    { "ice-cream"                             , ice_cream                              },
+    { "icicles"                               , icicles                                },
+    { "icons"                                 , icons                                  },
+    { "id-badge"                              , id_badge                               },
+    { "id-card"                               , id_card                                },
+    { "id-card-clip"                          , id_card_clip                           },
+    { "ideal"                                 , ideal                                  },
+    { "igloo"                                 , igloo                                  },
+    { "image"                                 , image                                  },
+    { "image-portrait"                        , image_portrait                         },
+    { "images"                                , images                                 },
+    { "imdb"                                  , imdb                                   },
+    { "inbox"                                 , inbox                                  },
+    { "indent"                                , indent                                 },
+    { "indian-rupee-sign"                     , indian_rupee_sign                      },
+    { "industry"                              , industry                               },
+    { "infinity"                              , infinity                               },
+    { "info"                                  , info                                   },
+    { "instagram"                             , instagram                              },
+    { "instagram-square"                      , instagram_square                       },
+    { "instalod"                              , instalod                               },
+    { "intercom"                              , intercom                               },
+    { "internet-explorer"                     , internet_explorer                      },
+    { "invision"                              , invision                               },
+    { "ioxhost"                               , ioxhost                                },
+    { "italic"                                , italic                                 },
+    { "itch-io"                               , itch_io                                },
+    { "itunes"                                , itunes                                 },
+    { "itunes-note"                           , itunes_note                            },
+    { "j"                                     , j                                      },
+    { "jar"                                   , jar                                    },
+    { "jar-wheat"                             , jar_wheat                              },
+    { "java"                                  , java                                   },
+    { "jedi"                                  , jedi                                   },
+    { "jedi-order"                            , jedi_order                             },
+    { "jenkins"                               , jenkins                                },
+    { "jet-fighter"                           , jet_fighter                            },
+    { "jet-fighter-up"                        , jet_fighter_up                         },
+    { "jira"                                  , jira                                   },
+    { "joget"                                 , joget                                  },
+    { "joint"                                 , joint                                  },
+    { "joomla"                                , joomla                                 },
+    { "js"                                    , js                                     },
+    { "js-square"                             , js_square                              },
+    { "jsfiddle"                              , jsfiddle                               },
+    { "jug-detergent"                         , jug_detergent                          },
+    { "k"                                     , k                                      },
+    { "kaaba"                                 , kaaba                                  },
+    { "kaggle"                                , kaggle                                 },
+    { "key"                                   , key                                    },
+    { "keybase"                               , keybase                                },
+    { "keyboard"                              , keyboard                               },
+    { "keycdn"                                , keycdn                                 },
+    { "khanda"                                , khanda                                 },
+    { "kickstarter"                           , kickstarter                            },
+    { "kickstarter-k"                         , kickstarter_k                          },
+    { "kip-sign"                              , kip_sign                               },
+    { "kit-medical"                           , kit_medical                            },
+    { "kitchen-set"                           , kitchen_set                            },
+    { "kiwi-bird"                             , kiwi_bird                              },
+    { "korvue"                                , korvue                                 },
+    { "l"                                     , l                                      },
+    { "land-mine-on"                          , land_mine_on                           },
+    { "landmark"                              , landmark                               },
+    { "landmark-dome"                         , landmark_dome                          },
+    { "landmark-flag"                         , landmark_flag                          },
+    { "language"                              , language                               },
+    { "laptop"                                , laptop                                 },
+    { "laptop-code"                           , laptop_code                            },
+    { "laptop-file"                           , laptop_file                            },
+    { "laptop-medical"                        , laptop_medical                         },
+    { "laravel"                               , laravel                                },
+    { "lari-sign"                             , lari_sign                              },
+    { "lastfm"                                , lastfm                                 },
+    { "lastfm-square"                         , lastfm_square                          },
+    { "layer-group"                           , layer_group                            },
+    { "leaf"                                  , leaf                                   },
+    { "leanpub"                               , leanpub                                },
+    { "left-long"                             , left_long                              },
+    { "left-right"                            , left_right                             },
+    { "lemon"                                 , lemon                                  },
+    { "less"                                  , less                                   },
+    { "less-than"                             , less_than                              },
+    { "less-than-equal"                       , less_than_equal                        },
+    { "life-ring"                             , life_ring                              },
+    { "lightbulb"                             , lightbulb                              },
+    { "line"                                  , _line                                  },
+    { "lines-leaning"                         , lines_leaning                          },
+    { "link"                                  , link                                   },
+    { "link-slash"                            , link_slash                             },
+    { "linkedin"                              , linkedin                               },
+    { "linkedin-in"                           , linkedin_in                            },
+    { "linode"                                , linode                                 },
+    { "linux"                                 , _linux                                 },
+    { "lira-sign"                             , lira_sign                              },
+    { "list"                                  , list                                   },
+    { "list-check"                            , list_check                             },
+    { "list-ol"                               , list_ol                                },
+    { "list-ul"                               , list_ul                                },
+    { "litecoin-sign"                         , litecoin_sign                          },
+    { "location-arrow"                        , location_arrow                         },
+    { "location-crosshairs"                   , location_crosshairs                    },
+    { "location-dot"                          , location_dot                           },
+    { "location-pin"                          , location_pin                           },
+    { "location-pin-lock"                     , location_pin_lock                      },
+    { "lock"                                  , lock                                   },
+    { "lock-open"                             , lock_open                              },
+    { "locust"                                , locust                                 },
+    { "lungs"                                 , lungs                                  },
+    { "lungs-virus"                           , lungs_virus                            },
+    { "lyft"                                  , lyft                                   },
+    { "m"                                     , m                                      },
+    { "magento"                               , magento                                },
+    { "magnet"                                , magnet                                 },
+    { "magnifying-glass"                      , magnifying_glass                       },
+    { "magnifying-glass-arrow-right"          , magnifying_glass_arrow_right           },
+    { "magnifying-glass-chart"                , magnifying_glass_chart                 },
+    { "magnifying-glass-dollar"               , magnifying_glass_dollar                },
+    { "magnifying-glass-location"             , magnifying_glass_location              },
+    { "magnifying-glass-minus"                , magnifying_glass_minus                 },
+    { "magnifying-glass-plus"                 , magnifying_glass_plus                  },
+    { "mailchimp"                             , mailchimp                              },
+    { "manat-sign"                            , manat_sign                             },
+    { "mandalorian"                           , mandalorian                            },
+    { "map"                                   , map                                    },
+    { "map-location"                          , map_location                           },
+    { "map-location-dot"                      , map_location_dot                       },
+    { "map-pin"                               , map_pin                                },
+    { "markdown"                              , markdown                               },
+    { "marker"                                , marker                                 },
+    { "mars"                                  , mars                                   },
+    { "mars-and-venus"                        , mars_and_venus                         },
+    { "mars-and-venus-burst"                  , mars_and_venus_burst                   },
+    { "mars-double"                           , mars_double                            },
+    { "mars-stroke"                           , mars_stroke                            },
+    { "mars-stroke-right"                     , mars_stroke_right                      },
+    { "mars-stroke-up"                        , mars_stroke_up                         },
+    { "martini-glass"                         , martini_glass                          },
+    { "martini-glass-citrus"                  , martini_glass_citrus                   },
+    { "martini-glass-empty"                   , martini_glass_empty                    },
+    { "mask"                                  , mask                                   },
+    { "mask-face"                             , mask_face                              },
+    { "mask-ventilator"                       , mask_ventilator                        },
+    { "masks-theater"                         , masks_theater                          },
+    { "mastodon"                              , mastodon                               },
+    { "mattress-pillow"                       , mattress_pillow                        },
+    { "maxcdn"                                , maxcdn                                 },
+    { "maximize"                              , maximize                               },
+    { "mdb"                                   , mdb                                    },
+    { "medal"                                 , medal                                  },
+    { "medapps"                               , medapps                                },
+    { "medium"                                , medium                                 },
+    { "medrt"                                 , medrt                                  },
+    { "meetup"                                , meetup                                 },
+    { "megaport"                              , megaport                               },
+    { "memory"                                , memory                                 },
+    { "mendeley"                              , mendeley                               },
+    { "menorah"                               , menorah                                },
+    { "mercury"                               , mercury                                },
+    { "message"                               , message                                },
+    { "meteor"                                , meteor                                 },
+    { "microblog"                             , microblog                              },
+    { "microchip"                             , microchip                              },
+    { "microphone"                            , microphone                             },
+    { "microphone-lines"                      , microphone_lines                       },
+    { "microphone-lines-slash"                , microphone_lines_slash                 },
+    { "microphone-slash"                      , microphone_slash                       },
+    { "microscope"                            , microscope                             },
+    { "microsoft"                             , microsoft                              },
+    { "mill-sign"                             , mill_sign                              },
+    { "minimize"                              , minimize                               },
+    { "minus"                                 , minus                                  },
+    { "mitten"                                , mitten                                 },
+    { "mix"                                   , mix                                    },
+    { "mixcloud"                              , mixcloud                               },
+    { "mixer"                                 , mixer                                  },
+    { "mizuni"                                , mizuni                                 },
+    { "mobile"                                , mobile                                 },
+    { "mobile-button"                         , mobile_button                          },
+    { "mobile-retro"                          , mobile_retro                           },
+    { "mobile-screen"                         , mobile_screen                          },
+    { "mobile-screen-button"                  , mobile_screen_button                   },
+    { "modx"                                  , modx                                   },
+    { "monero"                                , monero                                 },
+    { "money-bill"                            , money_bill                             },
+    { "money-bill-1"                          , money_bill_1                           },
+    { "money-bill-1-wave"                     , money_bill_1_wave                      },
+    { "money-bill-transfer"                   , money_bill_transfer                    },
+    { "money-bill-trend-up"                   , money_bill_trend_up                    },
+    { "money-bill-wave"                       , money_bill_wave                        },
+    { "money-bill-wheat"                      , money_bill_wheat                       },
+    { "money-bills"                           , money_bills                            },
+    { "money-check"                           , money_check                            },
+    { "money-check-dollar"                    , money_check_dollar                     },
+    { "monument"                              , monument                               },
+    { "moon"                                  , moon                                   },
+    { "mortar-pestle"                         , mortar_pestle                          },
+    { "mosque"                                , mosque                                 },
+    { "mosquito"                              , mosquito                               },
+    { "mosquito-net"                          , mosquito_net                           },
+    { "motorcycle"                            , motorcycle                             },
+    { "mound"                                 , mound                                  },
+    { "mountain"                              , mountain                               },
+    { "mountain-city"                         , mountain_city                          },
+    { "mountain-sun"                          , mountain_sun                           },
+    { "mug-hot"                               , mug_hot                                },
+    { "mug-saucer"                            , mug_saucer                             },
+    { "music"                                 , music                                  },
+    { "n"                                     , n                                      },
+    { "naira-sign"                            , naira_sign                             },
+    { "napster"                               , napster                                },
+    { "neos"                                  , neos                                   },
+    { "network-wired"                         , network_wired                          },
+    { "neuter"                                , neuter                                 },
+    { "newspaper"                             , newspaper                              },
+    { "nfc-directional"                       , nfc_directional                        },
+    { "nfc-symbol"                            , nfc_symbol                             },
+    { "nimblr"                                , nimblr                                 },
+    { "node"                                  , node                                   },
+    { "node-js"                               , node_js                                },
+    { "not-equal"                             , not_equal                              },
+    { "note-sticky"                           , note_sticky                            },
+    { "notes-medical"                         , notes_medical                          },
+    { "npm"                                   , npm                                    },
+    { "ns8"                                   , ns8                                    },
+    { "nutritionix"                           , nutritionix                            },
+    { "o"                                     , o                                      },
+    { "object-group"                          , object_group                           },
+    { "object-ungroup"                        , object_ungroup                         },
+    { "octopus-deploy"                        , octopus_deploy                         },
+    { "odnoklassniki"                         , odnoklassniki                          },
+    { "odnoklassniki-square"                  , odnoklassniki_square                   },
+    { "oil-can"                               , oil_can                                },
+    { "oil-well"                              , oil_well                               },
+    { "old-republic"                          , old_republic                           },
+    { "om"                                    , om                                     },
+    { "opencart"                              , opencart                               },
+    { "openid"                                , openid                                 },
+    { "opera"                                 , opera                                  },
+    { "optin-monster"                         , optin_monster                          },
+    { "orcid"                                 , orcid                                  },
+    { "osi"                                   , osi                                    },
+    { "otter"                                 , otter                                  },
+    { "outdent"                               , outdent                                },
+    { "p"                                     , p                                      },
+    { "padlet"                                , padlet                                 },
+    { "page4"                                 , page4                                  },
+    { "pagelines"                             , pagelines                              },
+    { "pager"                                 , pager                                  },
+    { "paint-roller"                          , paint_roller                           },
+    { "paintbrush"                            , paintbrush                             },
+    { "palette"                               , palette                                },
+    { "palfed"                                , palfed                                 },
+    { "pallet"                                , pallet                                 },
+    { "panorama"                              , panorama                               },
+    { "paper-plane"                           , paper_plane                            },
+    { "paperclip"                             , paperclip                              },
+    { "parachute-box"                         , parachute_box                          },
+    { "paragraph"                             , paragraph                              },
+    { "passport"                              , passport                               },
+    { "paste"                                 , paste                                  },
+    { "patreon"                               , patreon                                },
+    { "pause"                                 , pause                                  },
+    { "paw"                                   , paw                                    },
+    { "paypal"                                , paypal                                 },
+    { "peace"                                 , peace                                  },
+    { "pen"                                   , pen                                    },
+    { "pen-clip"                              , pen_clip                               },
+    { "pen-fancy"                             , pen_fancy                              },
+    { "pen-nib"                               , pen_nib                                },
+    { "pen-ruler"                             , pen_ruler                              },
+    { "pen-to-square"                         , pen_to_square                          },
+    { "pencil"                                , pencil                                 },
+    { "people-arrows-left-right"              , people_arrows_left_right               },
+    { "people-carry-box"                      , people_carry_box                       },
+    { "people-group"                          , people_group                           },
+    { "people-line"                           , people_line                            },
+    { "people-pulling"                        , people_pulling                         },
+    { "people-robbery"                        , people_robbery                         },
+    { "people-roof"                           , people_roof                            },
+    { "pepper-hot"                            , pepper_hot                             },
+    { "perbyte"                               , perbyte                                },
+    { "percent"                               , percent                                },
+    { "periscope"                             , periscope                              },
+    { "person"                                , person                                 },
+    { "person-arrow-down-to-line"             , person_arrow_down_to_line              },
+    { "person-arrow-up-from-line"             , person_arrow_up_from_line              },
+    { "person-biking"                         , person_biking                          },
+    { "person-booth"                          , person_booth                           },
+    { "person-breastfeeding"                  , person_breastfeeding                   },
+    { "person-burst"                          , person_burst                           },
+    { "person-cane"                           , person_cane                            },
+    { "person-chalkboard"                     , person_chalkboard                      },
+    { "person-circle-check"                   , person_circle_check                    },
+    { "person-circle-exclamation"             , person_circle_exclamation              },
+    { "person-circle-minus"                   , person_circle_minus                    },
+    { "person-circle-plus"                    , person_circle_plus                     },
+    { "person-circle-question"                , person_circle_question                 },
+    { "person-circle-xmark"                   , person_circle_xmark                    },
+    { "person-digging"                        , person_digging                         },
+    { "person-dots-from-line"                 , person_dots_from_line                  },
+    { "person-dress"                          , person_dress                           },
+    { "person-dress-burst"                    , person_dress_burst                     },
+    { "person-drowning"                       , person_drowning                        },
+    { "person-falling"                        , person_falling                         },
+    { "person-falling-burst"                  , person_falling_burst                   },
+    { "person-half-dress"                     , person_half_dress                      },
+    { "person-harassing"                      , person_harassing                       },
+    { "person-hiking"                         , person_hiking                          },
+    { "person-military-pointing"              , person_military_pointing               },
+    { "person-military-rifle"                 , person_military_rifle                  },
+    { "person-military-to-person"             , person_military_to_person              },
+    { "person-praying"                        , person_praying                         },
+    { "person-pregnant"                       , person_pregnant                        },
+    { "person-rays"                           , person_rays                            },
+    { "person-rifle"                          , person_rifle                           },
+    { "person-running"                        , person_running                         },
+    { "person-shelter"                        , person_shelter                         },
+    { "person-skating"                        , person_skating                         },
+    { "person-skiing"                         , person_skiing                          },
+    { "person-skiing-nordic"                  , person_skiing_nordic                   },
+    { "person-snowboarding"                   , person_snowboarding                    },
+    { "person-swimming"                       , person_swimming                        },
+    { "person-through-window"                 , person_through_window                  },
+    { "person-walking"                        , person_walking                         },
+    { "person-walking-arrow-loop-left"        , person_walking_arrow_loop_left         },
+    { "person-walking-arrow-right"            , person_walking_arrow_right             },
+    { "person-walking-dashed-line-arrow-right", person_walking_dashed_line_arrow_right },
+    { "person-walking-luggage"                , person_walking_luggage                 },
+    { "person-walking-with-cane"              , person_walking_with_cane               },
+    { "peseta-sign"                           , peseta_sign                            },
+    { "peso-sign"                             , peso_sign                              },
+    { "phabricator"                           , phabricator                            },
+    { "phoenix-framework"                     , phoenix_framework                      },
+    { "phoenix-squadron"                      , phoenix_squadron                       },
+    { "phone"                                 , phone                                  },
+    { "phone-flip"                            , phone_flip                             },
+    { "phone-slash"                           , phone_slash                            },
+    { "phone-volume"                          , phone_volume                           },
+    { "photo-film"                            , photo_film                             },
+    { "php"                                   , php                                    },
+    { "pied-piper"                            , pied_piper                             },
+    { "pied-piper-alt"                        , pied_piper_alt                         },
+    { "pied-piper-hat"                        , pied_piper_hat                         },
+    { "pied-piper-pp"                         , pied_piper_pp                          },
+    { "pied-piper-square"                     , pied_piper_square                      },
+    { "piggy-bank"                            , piggy_bank                             },
+    { "pills"                                 , pills                                  },
+    { "pinterest"                             , pinterest                              },
+    { "pinterest-p"                           , pinterest_p                            },
+    { "pinterest-square"                      , pinterest_square                       },
+    { "pix"                                   , pix                                    },
+    { "pizza-slice"                           , pizza_slice                            },
+    { "place-of-worship"                      , place_of_worship                       },
+    { "plane"                                 , plane                                  },
+    { "plane-arrival"                         , plane_arrival                          },
+    { "plane-circle-check"                    , plane_circle_check                     },
+    { "plane-circle-exclamation"              , plane_circle_exclamation               },
+    { "plane-circle-xmark"                    , plane_circle_xmark                     },
+    { "plane-departure"                       , plane_departure                        },
+    { "plane-lock"                            , plane_lock                             },
+    { "plane-slash"                           , plane_slash                            },
+    { "plane-up"                              , plane_up                               },
+    { "plant-wilt"                            , plant_wilt                             },
+    { "plate-wheat"                           , plate_wheat                            },
+    { "play"                                  , play                                   },
+    { "playstation"                           , playstation                            },
+    { "plug"                                  , plug                                   },
+    { "plug-circle-bolt"                      , plug_circle_bolt                       },
+    { "plug-circle-check"                     , plug_circle_check                      },
+    { "plug-circle-exclamation"               , plug_circle_exclamation                },
+    { "plug-circle-minus"                     , plug_circle_minus                      },
+    { "plug-circle-plus"                      , plug_circle_plus                       },
+    { "plug-circle-xmark"                     , plug_circle_xmark                      },
+    { "plus"                                  , plus                                   },
+    { "plus-minus"                            , plus_minus                             },
+    { "podcast"                               , podcast                                },
+    { "poo"                                   , poo                                    },
+    { "poo-storm"                             , poo_storm                              },
+    { "poop"                                  , poop                                   },
+    { "power-off"                             , power_off                              },
+    { "prescription"                          , prescription                           },
+    { "prescription-bottle"                   , prescription_bottle                    },
+    { "prescription-bottle-medical"           , prescription_bottle_medical            },
+    { "print"                                 , print                                  },
+    { "product-hunt"                          , product_hunt                           },
+    { "pump-medical"                          , pump_medical                           },
+    { "pump-soap"                             , pump_soap                              },
+    { "pushed"                                , pushed                                 },
+    { "puzzle-piece"                          , puzzle_piece                           },
+    { "python"                                , python                                 },
+    { "q"                                     , q                                      },
+    { "qq"                                    , qq                                     },
+    { "qrcode"                                , qrcode                                 },
+    { "question"                              , question                               },
+    { "quinscape"                             , quinscape                              },
+    { "quora"                                 , quora                                  },
+    { "quote-left"                            , quote_left                             },
+    { "quote-right"                           , quote_right                            },
+    { "r"                                     , r                                      },
+    { "r-project"                             , r_project                              },
+    { "radiation"                             , radiation                              },
+    { "radio"                                 , radio                                  },
+    { "rainbow"                               , rainbow                                },
+    { "ranking-star"                          , ranking_star                           },
+    { "raspberry-pi"                          , raspberry_pi                           },
+    { "ravelry"                               , ravelry                                },
+    { "react"                                 , react                                  },
+    { "reacteurope"                           , reacteurope                            },
+    { "readme"                                , readme                                 },
+    { "rebel"                                 , rebel                                  },
+    { "receipt"                               , receipt                                },
+    { "record-vinyl"                          , record_vinyl                           },
+    { "rectangle-ad"                          , rectangle_ad                           },
+    { "rectangle-list"                        , rectangle_list                         },
+    { "rectangle-xmark"                       , rectangle_xmark                        },
+    { "recycle"                               , recycle                                },
+    { "red-river"                             , red_river                              },
+    { "reddit"                                , reddit                                 },
+    { "reddit-alien"                          , reddit_alien                           },
+    { "reddit-square"                         , reddit_square                          },
+    { "redhat"                                , redhat                                 },
+    { "registered"                            , registered                             },
+    { "renren"                                , renren                                 },
+    { "repeat"                                , repeat                                 },
+    { "reply"                                 , reply                                  },
+    { "reply-all"                             , reply_all                              },
+    { "replyd"                                , replyd                                 },
+    { "republican"                            , republican                             },
+    { "researchgate"                          , researchgate                           },
+    { "resolving"                             , resolving                              },
+    { "restroom"                              , restroom                               },
+    { "retweet"                               , retweet                                },
+    { "rev"                                   , rev                                    },
+    { "ribbon"                                , ribbon                                 },
+    { "right-from-bracket"                    , right_from_bracket                     },
+    { "right-left"                            , right_left                             },
+    { "right-long"                            , right_long                             },
+    { "right-to-bracket"                      , right_to_bracket                       },
+    { "ring"                                  , ring                                   },
+    { "road"                                  , road                                   },
+    { "road-barrier"                          , road_barrier                           },
+    { "road-bridge"                           , road_bridge                            },
+    { "road-circle-check"                     , road_circle_check                      },
+    { "road-circle-exclamation"               , road_circle_exclamation                },
+    { "road-circle-xmark"                     , road_circle_xmark                      },
+    { "road-lock"                             , road_lock                              },
+    { "road-spikes"                           , road_spikes                            },
+    { "robot"                                 , robot                                  },
+    { "rocket"                                , rocket                                 },
+    { "rocketchat"                            , rocketchat                             },
+    { "rockrms"                               , rockrms                                },
+    { "rotate"                                , rotate                                 },
+    { "rotate-left"                           , rotate_left                            },
+    { "rotate-right"                          , rotate_right                           },
+    { "route"                                 , route                                  },
+    { "rss"                                   , rss                                    },
+    { "ruble-sign"                            , ruble_sign                             },
+    { "rug"                                   , rug                                    },
+    { "ruler"                                 , ruler                                  },
+    { "ruler-combined"                        , ruler_combined                         },
+    { "ruler-horizontal"                      , ruler_horizontal                       },
+    { "ruler-vertical"                        , ruler_vertical                         },
+    { "rupee-sign"                            , rupee_sign                             },
+    { "rupiah-sign"                           , rupiah_sign                            },
+    { "rust"                                  , rust                                   },
+    { "s"                                     , s                                      },
+    { "sack-dollar"                           , sack_dollar                            },
+    { "sack-xmark"                            , sack_xmark                             },
+    { "safari"                                , safari                                 },
+    { "sailboat"                              , sailboat                               },
+    { "salesforce"                            , salesforce                             },
+    { "sass"                                  , sass                                   },
+    { "satellite"                             , satellite                              },
+    { "satellite-dish"                        , satellite_dish                         },
+    { "scale-balanced"                        , scale_balanced                         },
+    { "scale-unbalanced"                      , scale_unbalanced                       },
+    { "scale-unbalanced-flip"                 , scale_unbalanced_flip                  },
+    { "schlix"                                , schlix                                 },
+    { "school"                                , school                                 },
+    { "school-circle-check"                   , school_circle_check                    },
+    { "school-circle-exclamation"             , school_circle_exclamation              },
+    { "school-circle-xmark"                   , school_circle_xmark                    },
+    { "school-flag"                           , school_flag                            },
+    { "school-lock"                           , school_lock                            },
+    { "scissors"                              , scissors                               },
+    { "screenpal"                             , screenpal                              },
+    { "screwdriver"                           , screwdriver                            },
+    { "screwdriver-wrench"                    , screwdriver_wrench                     },
+    { "scribd"                                , scribd                                 },
+    { "scroll"                                , scroll                                 },
+    { "scroll-torah"                          , scroll_torah                           },
+    { "sd-card"                               , sd_card                                },
+    { "searchengin"                           , searchengin                            },
+    { "section"                               , section                                },
+    { "seedling"                              , seedling                               },
+    { "sellcast"                              , sellcast                               },
+    { "sellsy"                                , sellsy                                 },
+    { "server"                                , server                                 },
+    { "servicestack"                          , servicestack                           },
+    { "shapes"                                , shapes                                 },
+    { "share"                                 , share                                  },
+    { "share-from-square"                     , share_from_square                      },
+    { "share-nodes"                           , share_nodes                            },
+    { "sheet-plastic"                         , sheet_plastic                          },
+    { "shekel-sign"                           , shekel_sign                            },
+    { "shield"                                , shield                                 },
+    { "shield-cat"                            , shield_cat                             },
+    { "shield-dog"                            , shield_dog                             },
+    { "shield-halved"                         , shield_halved                          },
+    { "shield-heart"                          , shield_heart                           },
+    { "shield-virus"                          , shield_virus                           },
+    { "ship"                                  , ship                                   },
+    { "shirt"                                 , shirt                                  },
+    { "shirtsinbulk"                          , shirtsinbulk                           },
+    { "shoe-prints"                           , shoe_prints                            },
+    { "shop"                                  , shop                                   },
+    { "shop-lock"                             , shop_lock                              },
+    { "shop-slash"                            , shop_slash                             },
+    { "shopify"                               , shopify                                },
+    { "shopware"                              , shopware                               },
+    { "shower"                                , shower                                 },
+    { "shrimp"                                , shrimp                                 },
+    { "shuffle"                               , shuffle                                },
+    { "shuttle-space"                         , shuttle_space                          },
+    { "sign-hanging"                          , sign_hanging                           },
+    { "signal"                                , signal                                 },
+    { "signature"                             , signature                              },
+    { "signs-post"                            , signs_post                             },
+    { "sim-card"                              , sim_card                               },
+    { "simplybuilt"                           , simplybuilt                            },
+    { "sink"                                  , sink                                   },
+    { "sistrix"                               , sistrix                                },
+    { "sitemap"                               , sitemap                                },
+    { "sith"                                  , sith                                   },
+    { "sitrox"                                , sitrox                                 },
+    { "sketch"                                , sketch                                 },
+    { "skull"                                 , skull                                  },
+    { "skull-crossbones"                      , skull_crossbones                       },
+    { "skyatlas"                              , skyatlas                               },
+    { "skype"                                 , skype                                  },
+    { "slack"                                 , slack                                  },
+    { "slash"                                 , slash                                  },
+    { "sleigh"                                , sleigh                                 },
+    { "sliders"                               , sliders                                },
+    { "slideshare"                            , slideshare                             },
+    { "smog"                                  , smog                                   },
+    { "smoking"                               , smoking                                },
+    { "snapchat"                              , snapchat                               },
+    { "snapchat-square"                       , snapchat_square                        },
+    { "snowflake"                             , snowflake                              },
+    { "snowman"                               , snowman                                },
+    { "snowplow"                              , snowplow                               },
+    { "soap"                                  , soap                                   },
+    { "socks"                                 , socks                                  },
+    { "solar-panel"                           , solar_panel                            },
+    { "sort"                                  , sort                                   },
+    { "sort-down"                             , sort_down                              },
+    { "sort-up"                               , sort_up                                },
+    { "soundcloud"                            , soundcloud                             },
+    { "sourcetree"                            , sourcetree                             },
+    { "spa"                                   , spa                                    },
+    { "spaghetti-monster-flying"              , spaghetti_monster_flying               },
+    { "speakap"                               , speakap                                },
+    { "speaker-deck"                          , speaker_deck                           },
+    { "spell-check"                           , spell_check                            },
+    { "spider"                                , spider                                 },
+    { "spinner"                               , spinner                                },
+    { "splotch"                               , splotch                                },
+    { "spoon"                                 , spoon                                  },
+    { "spotify"                               , spotify                                },
+    { "spray-can"                             , spray_can                              },
+    { "spray-can-sparkles"                    , spray_can_sparkles                     },
+    { "square"                                , square                                 },
+    { "square-arrow-up-right"                 , square_arrow_up_right                  },
+    { "square-caret-down"                     , square_caret_down                      },
+    { "square-caret-left"                     , square_caret_left                      },
+    { "square-caret-right"                    , square_caret_right                     },
+    { "square-caret-up"                       , square_caret_up                        },
+    { "square-check"                          , square_check                           },
+    { "square-envelope"                       , square_envelope                        },
+    { "square-font-awesome"                   , square_font_awesome                    },
+    { "square-font-awesome-stroke"            , square_font_awesome_stroke             },
+    { "square-full"                           , square_full                            },
+    { "square-h"                              , square_h                               },
+    { "square-minus"                          , square_minus                           },
+    { "square-nfi"                            , square_nfi                             },
+    { "square-parking"                        , square_parking                         },
+    { "square-pen"                            , square_pen                             },
+    { "square-person-confined"                , square_person_confined                 },
+    { "square-phone"                          , square_phone                           },
+    { "square-phone-flip"                     , square_phone_flip                      },
+    { "square-plus"                           , square_plus                            },
+    { "square-poll-horizontal"                , square_poll_horizontal                 },
+    { "square-poll-vertical"                  , square_poll_vertical                   },
+    { "square-root-variable"                  , square_root_variable                   },
+    { "square-rss"                            , square_rss                             },
+    { "square-share-nodes"                    , square_share_nodes                     },
+    { "square-up-right"                       , square_up_right                        },
+    { "square-virus"                          , square_virus                           },
+    { "square-xmark"                          , square_xmark                           },
+    { "squarespace"                           , squarespace                            },
+    { "stack-exchange"                        , stack_exchange                         },
+    { "stack-overflow"                        , stack_overflow                         },
+    { "stackpath"                             , stackpath                              },
+    { "staff-aesculapius"                     , staff_aesculapius                      },
+    { "stairs"                                , stairs                                 },
+    { "stamp"                                 , stamp                                  },
+    { "star"                                  , star                                   },
+    { "star-and-crescent"                     , star_and_crescent                      },
+    { "star-half"                             , star_half                              },
+    { "star-half-stroke"                      , star_half_stroke                       },
+    { "star-of-david"                         , star_of_david                          },
+    { "star-of-life"                          , star_of_life                           },
+    { "staylinked"                            , staylinked                             },
+    { "steam"                                 , steam                                  },
+    { "steam-square"                          , steam_square                           },
+    { "steam-symbol"                          , steam_symbol                           },
+    { "sterling-sign"                         , sterling_sign                          },
+    { "stethoscope"                           , stethoscope                            },
+    { "sticker-mule"                          , sticker_mule                           },
+    { "stop"                                  , stop                                   },
+    { "stopwatch"                             , stopwatch                              },
+    { "stopwatch-20"                          , stopwatch_20                           },
+    { "store"                                 , store                                  },
+    { "store-slash"                           , store_slash                            },
+    { "strava"                                , strava                                 },
+    { "street-view"                           , street_view                            },
+    { "strikethrough"                         , strikethrough                          },
+    { "stripe"                                , stripe                                 },
+    { "stripe-s"                              , stripe_s                               },
+    { "stroopwafel"                           , stroopwafel                            },
+    { "studiovinari"                          , studiovinari                           },
+    { "stumbleupon"                           , stumbleupon                            },
+    { "stumbleupon-circle"                    , stumbleupon_circle                     },
+    { "subscript"                             , subscript                              },
+    { "suitcase"                              , suitcase                               },
+    { "suitcase-medical"                      , suitcase_medical                       },
+    { "suitcase-rolling"                      , suitcase_rolling                       },
+    { "sun"                                   , sun                                    },
+    { "sun-plant-wilt"                        , sun_plant_wilt                         },
+    { "superpowers"                           , superpowers                            },
+    { "superscript"                           , superscript                            },
+    { "supple"                                , supple                                 },
+    { "suse"                                  , suse                                   },
+    { "swatchbook"                            , swatchbook                             },
+    { "swift"                                 , swift                                  },
+    { "symfony"                               , symfony                                },
+    { "synagogue"                             , synagogue                              },
+    { "syringe"                               , syringe                                },
+    { "t"                                     , t                                      },
+    { "table"                                 , table                                  },
+    { "table-cells"                           , table_cells                            },
+    { "table-cells-large"                     , table_cells_large                      },
+    { "table-columns"                         , table_columns                          },
+    { "table-list"                            , table_list                             },
+    { "table-tennis-paddle-ball"              , table_tennis_paddle_ball               },
+    { "tablet"                                , tablet                                 },
+    { "tablet-button"                         , tablet_button                          },
+    { "tablet-screen-button"                  , tablet_screen_button                   },
+    { "tablets"                               , tablets                                },
+    { "tachograph-digital"                    , tachograph_digital                     },
+    { "tag"                                   , tag                                    },
+    { "tags"                                  , tags                                   },
+    { "tape"                                  , tape                                   },
+    { "tarp"                                  , tarp                                   },
+    { "tarp-droplet"                          , tarp_droplet                           },
+    { "taxi"                                  , taxi                                   },
+    { "teamspeak"                             , teamspeak                              },
+    { "teeth"                                 , teeth                                  },
+    { "teeth-open"                            , teeth_open                             },
+    { "telegram"                              , telegram                               },
+    { "temperature-arrow-down"                , temperature_arrow_down                 },
+    { "temperature-arrow-up"                  , temperature_arrow_up                   },
+    { "temperature-empty"                     , temperature_empty                      },
+    { "temperature-full"                      , temperature_full                       },
+    { "temperature-half"                      , temperature_half                       },
+    { "temperature-high"                      , temperature_high                       },
+    { "temperature-low"                       , temperature_low                        },
+    { "temperature-quarter"                   , temperature_quarter                    },
+    { "temperature-three-quarters"            , temperature_three_quarters             },
+    { "tencent-weibo"                         , tencent_weibo                          },
+    { "tenge-sign"                            , tenge_sign                             },
+    { "tent"                                  , tent                                   },
+    { "tent-arrow-down-to-line"               , tent_arrow_down_to_line                },
+    { "tent-arrow-left-right"                 , tent_arrow_left_right                  },
+    { "tent-arrow-turn-left"                  , tent_arrow_turn_left                   },
+    { "tent-arrows-down"                      , tent_arrows_down                       },
+    { "tents"                                 , tents                                  },
+    { "terminal"                              , terminal                               },
+    { "text-height"                           , text_height                            },
+    { "text-slash"                            , text_slash                             },
+    { "text-width"                            , text_width                             },
+    { "the-red-yeti"                          , the_red_yeti                           },
+    { "themeco"                               , themeco                                },
+    { "themeisle"                             , themeisle                              },
+    { "thermometer"                           , thermometer                            },
+    { "think-peaks"                           , think_peaks                            },
+    { "thumbs-down"                           , thumbs_down                            },
+    { "thumbs-up"                             , thumbs_up                              },
+    { "thumbtack"                             , thumbtack                              },
+    { "ticket"                                , ticket                                 },
+    { "ticket-simple"                         , ticket_simple                          },
+    { "tiktok"                                , tiktok                                 },
+    { "timeline"                              , timeline                               },
+    { "toggle-off"                            , toggle_off                             },
+    { "toggle-on"                             , toggle_on                              },
+    { "toilet"                                , toilet                                 },
+    { "toilet-paper"                          , toilet_paper                           },
+    { "toilet-paper-slash"                    , toilet_paper_slash                     },
+    { "toilet-portable"                       , toilet_portable                        },
+    { "toilets-portable"                      , toilets_portable                       },
+    { "toolbox"                               , toolbox                                },
+    { "tooth"                                 , tooth                                  },
+    { "torii-gate"                            , torii_gate                             },
+    { "tornado"                               , tornado                                },
+    { "tower-broadcast"                       , tower_broadcast                        },
+    { "tower-cell"                            , tower_cell                             },
+    { "tower-observation"                     , tower_observation                      },
+    { "tractor"                               , tractor                                },
+    { "trade-federation"                      , trade_federation                       },
+    { "trademark"                             , trademark                              },
+    { "traffic-light"                         , traffic_light                          },
+    { "trailer"                               , trailer                                },
+    { "train"                                 , train                                  },
+    { "train-subway"                          , train_subway                           },
+    { "train-tram"                            , train_tram                             },
+    { "transgender"                           , transgender                            },
+    { "trash"                                 , trash                                  },
+    { "trash-arrow-up"                        , trash_arrow_up                         },
+    { "trash-can"                             , trash_can                              },
+    { "trash-can-arrow-up"                    , trash_can_arrow_up                     },
+    { "tree"                                  , tree                                   },
+    { "tree-city"                             , tree_city                              },
+    { "trello"                                , trello                                 },
+    { "triangle-exclamation"                  , triangle_exclamation                   },
+    { "trophy"                                , trophy                                 },
+    { "trowel"                                , trowel                                 },
+    { "trowel-bricks"                         , trowel_bricks                          },
+    { "truck"                                 , truck                                  },
+    { "truck-arrow-right"                     , truck_arrow_right                      },
+    { "truck-droplet"                         , truck_droplet                          },
+    { "truck-fast"                            , truck_fast                             },
+    { "truck-field"                           , truck_field                            },
+    { "truck-field-un"                        , truck_field_un                         },
+    { "truck-front"                           , truck_front                            },
+    { "truck-medical"                         , truck_medical                          },
+    { "truck-monster"                         , truck_monster                          },
+    { "truck-moving"                          , truck_moving                           },
+    { "truck-pickup"                          , truck_pickup                           },
+    { "truck-plane"                           , truck_plane                            },
+    { "truck-ramp-box"                        , truck_ramp_box                         },
+    { "tty"                                   , tty                                    },
+    { "tumblr"                                , tumblr                                 },
+    { "tumblr-square"                         , tumblr_square                          },
+    { "turkish-lira-sign"                     , turkish_lira_sign                      },
+    { "turn-down"                             , turn_down                              },
+    { "turn-up"                               , turn_up                                },
+    { "tv"                                    , tv                                     },
+    { "twitch"                                , twitch                                 },
+    { "twitter"                               , twitter                                },
+    { "twitter-square"                        , twitter_square                         },
+    { "typo3"                                 , typo3                                  },
+    { "u"                                     , u                                      },
+    { "uber"                                  , uber                                   },
+    { "ubuntu"                                , ubuntu                                 },
+    { "uikit"                                 , uikit                                  },
+    { "umbraco"                               , umbraco                                },
+    { "umbrella"                              , umbrella                               },
+    { "umbrella-beach"                        , umbrella_beach                         },
+    { "uncharted"                             , uncharted                              },
+    { "underline"                             , underline                              },
+    { "uniregistry"                           , uniregistry                            },
+    { "unity"                                 , unity                                  },
+    { "universal-access"                      , universal_access                       },
+    { "unlock"                                , unlock                                 },
+    { "unlock-keyhole"                        , unlock_keyhole                         },
+    { "unsplash"                              , unsplash                               },
+    { "untappd"                               , untappd                                },
+    { "up-down"                               , up_down                                },
+    { "up-down-left-right"                    , up_down_left_right                     },
+    { "up-long"                               , up_long                                },
+    { "up-right-and-down-left-from-center"    , up_right_and_down_left_from_center     },
+    { "up-right-from-square"                  , up_right_from_square                   },
+    { "upload"                                , upload                                 },
+    { "ups"                                   , ups                                    },
+    { "usb"                                   , usb                                    },
+    { "user"                                  , user                                   },
+    { "user-astronaut"                        , user_astronaut                         },
+    { "user-check"                            , user_check                             },
+    { "user-clock"                            , user_clock                             },
+    { "user-doctor"                           , user_doctor                            },
+    { "user-gear"                             , user_gear                              },
+    { "user-graduate"                         , user_graduate                          },
+    { "user-group"                            , user_group                             },
+    { "user-injured"                          , user_injured                           },
+    { "user-large"                            , user_large                             },
+    { "user-large-slash"                      , user_large_slash                       },
+    { "user-lock"                             , user_lock                              },
+    { "user-minus"                            , user_minus                             },
+    { "user-ninja"                            , user_ninja                             },
+    { "user-nurse"                            , user_nurse                             },
+    { "user-pen"                              , user_pen                               },
+    { "user-plus"                             , user_plus                              },
+    { "user-secret"                           , user_secret                            },
+    { "user-shield"                           , user_shield                            },
+    { "user-slash"                            , user_slash                             },
+    { "user-tag"                              , user_tag                               },
+    { "user-tie"                              , user_tie                               },
+    { "user-xmark"                            , user_xmark                             },
+    { "users"                                 , users                                  },
+    { "users-between-lines"                   , users_between_lines                    },
+    { "users-gear"                            , users_gear                             },
+    { "users-line"                            , users_line                             },
+    { "users-rays"                            , users_rays                             },
+    { "users-rectangle"                       , users_rectangle                        },
+    { "users-slash"                           , users_slash                            },
+    { "users-viewfinder"                      , users_viewfinder                       },
+    { "usps"                                  , usps                                   },
+    { "ussunnah"                              , ussunnah                               },
+    { "utensils"                              , utensils                               },
+    { "v"                                     , v                                      },
+    { "vaadin"                                , vaadin                                 },
+    { "van-shuttle"                           , van_shuttle                            },
+    { "vault"                                 , vault                                  },
+    { "vector-square"                         , vector_square                          },
+    { "venus"                                 , venus                                  },
+    { "venus-double"                          , venus_double                           },
+    { "venus-mars"                            , venus_mars                             },
+    { "vest"                                  , vest                                   },
+    { "vest-patches"                          , vest_patches                           },
+    { "viacoin"                               , viacoin                                },
+    { "viadeo"                                , viadeo                                 },
+    { "viadeo-square"                         , viadeo_square                          },
+    { "vial"                                  , vial                                   },
+    { "vial-circle-check"                     , vial_circle_check                      },
+    { "vial-virus"                            , vial_virus                             },
+    { "vials"                                 , vials                                  },
+    { "viber"                                 , viber                                  },
+    { "video"                                 , video                                  },
+    { "video-slash"                           , video_slash                            },
+    { "vihara"                                , vihara                                 },
+    { "vimeo"                                 , vimeo                                  },
+    { "vimeo-square"                          , vimeo_square                           },
+    { "vimeo-v"                               , vimeo_v                                },
+    { "vine"                                  , vine                                   },
+    { "virus"                                 , virus                                  },
+    { "virus-covid"                           , virus_covid                            },
+    { "virus-covid-slash"                     , virus_covid_slash                      },
+    { "virus-slash"                           , virus_slash                            },
+    { "viruses"                               , viruses                                },
+    { "vk"                                    , vk                                     },
+    { "vnv"                                   , vnv                                    },
+    { "voicemail"                             , voicemail                              },
+    { "volcano"                               , volcano                                },
+    { "volleyball"                            , volleyball                             },
+    { "volume-high"                           , volume_high                            },
+    { "volume-low"                            , volume_low                             },
+    { "volume-off"                            , volume_off                             },
+    { "volume-xmark"                          , volume_xmark                           },
+    { "vr-cardboard"                          , vr_cardboard                           },
+    { "vuejs"                                 , vuejs                                  },
+    { "w"                                     , w                                      },
+    { "walkie-talkie"                         , walkie_talkie                          },
+    { "wallet"                                , wallet                                 },
+    { "wand-magic"                            , wand_magic                             },
+    { "wand-magic-sparkles"                   , wand_magic_sparkles                    },
+    { "wand-sparkles"                         , wand_sparkles                          },
+    { "warehouse"                             , warehouse                              },
+    { "watchman-monitoring"                   , watchman_monitoring                    },
+    { "water"                                 , water                                  },
+    { "water-ladder"                          , water_ladder                           },
+    { "wave-square"                           , wave_square                            },
+    { "waze"                                  , waze                                   },
+    { "weebly"                                , weebly                                 },
+    { "weibo"                                 , weibo                                  },
+    { "weight-hanging"                        , weight_hanging                         },
+    { "weight-scale"                          , weight_scale                           },
+    { "weixin"                                , weixin                                 },
+    { "whatsapp"                              , whatsapp                               },
+    { "whatsapp-square"                       , whatsapp_square                        },
+    { "wheat-awn"                             , wheat_awn                              },
+    { "wheat-awn-circle-exclamation"          , wheat_awn_circle_exclamation           },
+    { "wheelchair"                            , wheelchair                             },
+    { "wheelchair-move"                       , wheelchair_move                        },
+    { "whiskey-glass"                         , whiskey_glass                          },
+    { "whmcs"                                 , whmcs                                  },
+    { "wifi"                                  , wifi                                   },
+    { "wikipedia-w"                           , wikipedia_w                            },
+    { "wind"                                  , wind                                   },
+    { "window-maximize"                       , window_maximize                        },
+    { "window-minimize"                       , window_minimize                        },
+    { "window-restore"                        , window_restore                         },
+    { "windows"                               , windows                                },
+    { "wine-bottle"                           , wine_bottle                            },
+    { "wine-glass"                            , wine_glass                             },
+    { "wine-glass-empty"                      , wine_glass_empty                       },
+    { "wirsindhandwerk"                       , wirsindhandwerk                        },
+    { "wix"                                   , wix                                    },
+    { "wizards-of-the-coast"                  , wizards_of_the_coast                   },
+    { "wodu"                                  , wodu                                   },
+    { "wolf-pack-battalion"                   , wolf_pack_battalion                    },
+    { "won-sign"                              , won_sign                               },
+    { "wordpress"                             , wordpress                              },
+    { "wordpress-simple"                      , wordpress_simple                       },
+    { "worm"                                  , worm                                   },
+    { "wpbeginner"                            , wpbeginner                             },
+    { "wpexplorer"                            , wpexplorer                             },
+    { "wpforms"                               , wpforms                                },
+    { "wpressr"                               , wpressr                                },
+    { "wrench"                                , wrench                                 },
+    { "x"                                     , x                                      },
+    { "x-ray"                                 , x_ray                                  },
+    { "xbox"                                  , xbox                                   },
+    { "xing"                                  , xing                                   },
+    { "xing-square"                           , xing_square                            },
+    { "xmark"                                 , xmark                                  },
+    { "xmarks-lines"                          , xmarks_lines                           },
+    { "y"                                     , y                                      },
+    { "y-combinator"                          , y_combinator                           },
+    { "yahoo"                                 , yahoo                                  },
+    { "yammer"                                , yammer                                 },
+    { "yandex"                                , yandex                                 },
+    { "yandex-international"                  , yandex_international                   },
+    { "yarn"                                  , yarn                                   },
+    { "yelp"                                  , yelp                                   },
+    { "yen-sign"                              , yen_sign                               },
+    { "yin-yang"                              , yin_yang                               },
+    { "yoast"                                 , yoast                                  },
+    { "youtube"                               , youtube                                },
+    { "youtube-square"                        , youtube_square                         },
+    { "z"                                     , z                                      },
+    { "zhihu"                                 , zhihu                                  },
+};
+
+constexpr int icon_names_count = sizeof(icon_names) / sizeof(icon_names[0]);
+
+/**
+ * Returns the code point of the icon called @a name.
+ *
+ * Used in a constant expression, the lookup happens at compile time and an
+ * unknown name fails to compile:
+ * @code
+ * constexpr int beer_mug_empty = fa::v6::icon_code("beer-mug-empty");
+ * @endcode
+ */
+constexpr int icon_code(const char* name)
+{
+    return detail::find(icon_names, 0, icon_names_count, name);
+}
+
+constexpr detail::name_entry icon_codes[] = {
+    { "exclamation"                           , exclamation                            },
+    { "hashtag"                               , hashtag                                },
+    { "dollar-sign"                           , dollar_sign                            },
+    { "percent"                               , percent                                },
+    { "asterisk"                              , asterisk                               },
+    { "plus"                                  , plus                                   },
+    { "0"                                     , _0                                     },
+    { "1"                                     , _1                                     },
+    { "2"                                     , _2                                     },
+    { "3"                                     , _3                                     },
+    { "4"                                     , _4                                     },
+    { "5"                                     , _5                                     },
+    { "6"                                     , _6                                     },
+    { "7"                                     , _7                                     },
+    { "8"                                     , _8                                     },
+    { "9"                                     , _9                                     },
+    { "less-than"                             , less_than                              },
+    { "equals"                                , equals                                 },
+    { "greater-than"                          , greater_than                           },
+    { "question"                              , question                               },
+    { "at"                                    , at                                     },
+    { "a"                                     , a                                      },
+    { "b"                                     , b                                      },
+    { "c"                                     , c                                      },
+    { "d"                                     , d                                      },
+    { "e"                                     , e                                      },
+    { "f"                                     , f                                      },
+    { "g"                                     , g                                      },
+    { "h"                                     , h                                      },
+    { "i"                                     , i                                      },
+    { "j"                                     , j                                      },
+    { "k"                                     , k                                      },
+    { "l"                                     , l                                      },
+    { "m"                                     , m                                      },
+    { "n"                                     , n                                      },
+    { "o"                                     , o                                      },
+    { "p"                                     , p                                      },
+    { "q"                                     , q                                      },
+    { "r"                                     , r                                      },
+    { "s"                                     , s                                      },
+    { "t"                                     , t                                      },
+    { "u"                                     , u                                      },
+    { "v"                                     , v                                      },
+    { "w"                                     , w                                      },
+    { "x"                                     , x                                      },
+    { "y"                                     , y                                      },
+    { "z"                                     , z                                      },
+    { "faucet"                                , faucet                                 },
+    { "faucet-drip"                           , faucet_drip                            },
+    { "firefox-browser"                       , firefox_browser                        },
+    { "house-chimney-window"                  , house_chimney_window                   },
+    { "house-signal"                          , house_signal                           },
+    { "ideal"                                 , ideal                                  },
+    { "microblog"                             , microblog                              },
+    { "pied-piper-square"                     , pied_piper_square                      },
+    { "temperature-arrow-down"                , temperature_arrow_down                 },
+    { "temperature-arrow-up"                  , temperature_arrow_up                   },
+    { "trailer"                               , trailer                                },
+    { "unity"                                 , unity                                  },
+    { "dailymotion"                           , dailymotion                            },
+    { "instagram-square"                      , instagram_square                       },
+    { "mixer"                                 , mixer                                  },
+    { "shopify"                               , shopify                                },
+    { "bacteria"                              , bacteria                               },
+    { "bacterium"                             , bacterium                              },
+    { "box-tissue"                            , box_tissue                             },
+    { "hand-holding-medical"                  , hand_holding_medical                   },
+    { "hand-sparkles"                         , hand_sparkles                          },
+    { "hands-bubbles"                         , hands_bubbles                          },
+    { "handshake-simple-slash"                , handshake_simple_slash                 },
+    { "handshake-slash"                       , handshake_slash                        },
+    { "head-side-cough"                       , head_side_cough                        },
+    { "head-side-cough-slash"                 , head_side_cough_slash                  },
+    { "head-side-mask"                        , head_side_mask                         },
+    { "head-side-virus"                       , head_side_virus                        },
+    { "house-chimney-user"                    , house_chimney_user                     },
+    { "house-laptop"                          , house_laptop                           },
+    { "lungs-virus"                           , lungs_virus                            },
+    { "people-arrows-left-right"              , people_arrows_left_right               },
+    { "plane-slash"                           , plane_slash                            },
+    { "pump-medical"                          , pump_medical                           },
+    { "pump-soap"                             , pump_soap                              },
+    { "shield-virus"                          , shield_virus                           },
+    { "sink"                                  , sink                                   },
+    { "soap"                                  , soap                                   },
+    { "stopwatch-20"                          , stopwatch_20                           },
+    { "shop-slash"                            , shop_slash                             },
+    { "store-slash"                           , store_slash                            },
+    { "toilet-paper-slash"                    , toilet_paper_slash                     },
+    { "users-slash"                           , users_slash                            },
+    { "virus"                                 , virus                                  },
+    { "virus-slash"                           , virus_slash                            },
+    { "viruses"                               , viruses                                },
+    { "deezer"                                , deezer                                 },
+    { "edge-legacy"                           , edge_legacy                            },
+    { "google-pay"                            , google_pay                             },
+    { "rust"                                  , rust                                   },
+    { "tiktok"                                , tiktok                                 },
+    { "unsplash"                              , unsplash                               },
+    { "cloudflare"                            , cloudflare                             },
+    { "guilded"                               , guilded                                },
+    { "hive"                                  , hive                                   },
+    { "42-group"                              , _42_group                              },
+    { "instalod"                              , instalod                               },
+    { "octopus-deploy"                        , octopus_deploy                         },
+    { "perbyte"                               , perbyte                                },
+    { "uncharted"                             , uncharted                              },
+    { "vest"                                  , vest                                   },
+    { "vest-patches"                          , vest_patches                           },
+    { "watchman-monitoring"                   , watchman_monitoring                    },
+    { "wodu"                                  , wodu                                   },
+    { "arrow-trend-down"                      , arrow_trend_down                       },
+    { "arrow-trend-up"                        , arrow_trend_up                         },
+    { "arrow-up-from-bracket"                 , arrow_up_from_bracket                  },
+    { "austral-sign"                          , austral_sign                           },
+    { "baht-sign"                             , baht_sign                              },
+    { "bitcoin-sign"                          , bitcoin_sign                           },
+    { "bolt-lightning"                        , bolt_lightning                         },
+    { "book-bookmark"                         , book_bookmark                          },
+    { "camera-rotate"                         , camera_rotate                          },
+    { "cedi-sign"                             , cedi_sign                              },
+    { "chart-column"                          , chart_column                           },
+    { "chart-gantt"                           , chart_gantt                            },
+    { "clapperboard"                          , clapperboard                           },
+    { "clover"                                , clover                                 },
+    { "code-compare"                          , code_compare                           },
+    { "code-fork"                             , code_fork                              },
+    { "code-pull-request"                     , code_pull_request                      },
+    { "colon-sign"                            , colon_sign                             },
+    { "cruzeiro-sign"                         , cruzeiro_sign                          },
+    { "display"                               , display                                },
+    { "dong-sign"                             , dong_sign                              },
+    { "elevator"                              , elevator                               },
+    { "filter-circle-xmark"                   , filter_circle_xmark                    },
+    { "florin-sign"                           , florin_sign                            },
+    { "folder-closed"                         , folder_closed                          },
+    { "franc-sign"                            , franc_sign                             },
+    { "guarani-sign"                          , guarani_sign                           },
+    { "gun"                                   , gun                                    },
+    { "hands-clapping"                        , hands_clapping                         },
+    { "house-user"                            , house_user                             },
+    { "indian-rupee-sign"                     , indian_rupee_sign                      },
+    { "kip-sign"                              , kip_sign                               },
+    { "lari-sign"                             , lari_sign                              },
+    { "litecoin-sign"                         , litecoin_sign                          },
+    { "manat-sign"                            , manat_sign                             },
+    { "mask-face"                             , mask_face                              },
+    { "mill-sign"                             , mill_sign                              },
+    { "money-bills"                           , money_bills                            },
+    { "naira-sign"                            , naira_sign                             },
+    { "panorama"                              , panorama                               },
+    { "peseta-sign"                           , peseta_sign                            },
+    { "peso-sign"                             , peso_sign                              },
+    { "plane-up"                              , plane_up                               },
+    { "rupiah-sign"                           , rupiah_sign                            },
+    { "stairs"                                , stairs                                 },
+    { "timeline"                              , timeline                               },
+    { "truck-front"                           , truck_front                            },
+    { "turkish-lira-sign"                     , turkish_lira_sign                      },
+    { "vault"                                 , vault                                  },
+    { "wand-magic-sparkles"                   , wand_magic_sparkles                    },
+    { "wheat-awn"                             , wheat_awn                              },
+    { "wheelchair-move"                       , wheelchair_move                        },
+    { "wirsindhandwerk"                       , wirsindhandwerk                        },
+    { "bowl-rice"                             , bowl_rice                              },
+    { "person-pregnant"                       , person_pregnant                        },
+    { "bots"                                  , bots                                   },
+    { "cmplid"                                , cmplid                                 },
+    { "house-chimney"                         , house_chimney                          },
+    { "house-crack"                           , house_crack                            },
+    { "house-medical"                         , house_medical                          },
+    { "bilibili"                              , bilibili                               },
+    { "cent-sign"                             , cent_sign                              },
+    { "golang"                                , golang                                 },
+    { "person-through-window"                 , person_through_window                  },
+    { "pix"                                   , pix                                    },
+    { "plant-wilt"                            , plant_wilt                             },
+    { "plus-minus"                            , plus_minus                             },
+    { "sailboat"                              , sailboat                               },
+    { "section"                               , section                                },
+    { "shrimp"                                , shrimp                                 },
+    { "sitrox"                                , sitrox                                 },
+    { "brazilian-real-sign"                   , brazilian_real_sign                    },
+    { "chart-simple"                          , chart_simple                           },
+    { "diagram-next"                          , diagram_next                           },
+    { "diagram-predecessor"                   , diagram_predecessor                    },
+    { "diagram-successor"                     , diagram_successor                      },
+    { "earth-oceania"                         , earth_oceania                          },
+    { "bug-slash"                             , bug_slash                              },
+    { "file-circle-check"                     , file_circle_check                      },
+    { "file-circle-xmark"                     , file_circle_xmark                      },
+    { "hashnode"                              , hashnode                               },
+    { "padlet"                                , padlet                                 },
+    { "shop-lock"                             , shop_lock                              },
+    { "virus-covid"                           , virus_covid                            },
+    { "virus-covid-slash"                     , virus_covid_slash                      },
+    { "anchor-circle-check"                   , anchor_circle_check                    },
+    { "anchor-circle-exclamation"             , anchor_circle_exclamation              },
+    { "anchor-circle-xmark"                   , anchor_circle_xmark                    },
+    { "anchor-lock"                           , anchor_lock                            },
+    { "arrow-down-up-across-line"             , arrow_down_up_across_line              },
+    { "arrow-down-up-lock"                    , arrow_down_up_lock                     },
+    { "arrow-right-to-city"                   , arrow_right_to_city                    },
+    { "arrow-up-from-ground-water"            , arrow_up_from_ground_water             },
+    { "arrow-up-from-water-pump"              , arrow_up_from_water_pump               },
+    { "arrow-up-right-dots"                   , arrow_up_right_dots                    },
+    { "arrows-down-to-line"                   , arrows_down_to_line                    },
+    { "arrows-down-to-people"                 , arrows_down_to_people                  },
+    { "arrows-left-right-to-line"             , arrows_left_right_to_line              },
+    { "arrows-spin"                           , arrows_spin                            },
+    { "arrows-split-up-and-left"              , arrows_split_up_and_left               },
+    { "arrows-to-circle"                      , arrows_to_circle                       },
+    { "arrows-to-dot"                         , arrows_to_dot                          },
+    { "arrows-to-eye"                         , arrows_to_eye                          },
+    { "arrows-turn-right"                     , arrows_turn_right                      },
+    { "arrows-turn-to-dots"                   , arrows_turn_to_dots                    },
+    { "arrows-up-to-line"                     , arrows_up_to_line                      },
+    { "bore-hole"                             , bore_hole                              },
+    { "bottle-droplet"                        , bottle_droplet                         },
+    { "bottle-water"                          , bottle_water                           },
+    { "bowl-food"                             , bowl_food                              },
+    { "boxes-packing"                         , boxes_packing                          },
+    { "bridge"                                , bridge                                 },
+    { "bridge-circle-check"                   , bridge_circle_check                    },
+    { "bridge-circle-exclamation"             , bridge_circle_exclamation              },
+    { "bridge-circle-xmark"                   , bridge_circle_xmark                    },
+    { "bridge-lock"                           , bridge_lock                            },
+    { "bridge-water"                          , bridge_water                           },
+    { "bucket"                                , bucket                                 },
+    { "bugs"                                  , bugs                                   },
+    { "building-circle-arrow-right"           , building_circle_arrow_right            },
+    { "building-circle-check"                 , building_circle_check                  },
+    { "building-circle-exclamation"           , building_circle_exclamation            },
+    { "building-circle-xmark"                 , building_circle_xmark                  },
+    { "building-flag"                         , building_flag                          },
+    { "building-lock"                         , building_lock                          },
+    { "building-ngo"                          , building_ngo                           },
+    { "building-shield"                       , building_shield                        },
+    { "building-un"                           , building_un                            },
+    { "building-user"                         , building_user                          },
+    { "building-wheat"                        , building_wheat                         },
+    { "burst"                                 , burst                                  },
+    { "car-on"                                , car_on                                 },
+    { "car-tunnel"                            , car_tunnel                             },
+    { "child-rifle"                           , child_rifle                            },
+    { "children"                              , children                               },
+    { "circle-nodes"                          , circle_nodes                           },
+    { "clipboard-question"                    , clipboard_question                     },
+    { "cloud-showers-water"                   , cloud_showers_water                    },
+    { "computer"                              , computer                               },
+    { "cubes-stacked"                         , cubes_stacked                          },
+    { "envelope-circle-check"                 , envelope_circle_check                  },
+    { "explosion"                             , explosion                              },
+    { "ferry"                                 , ferry                                  },
+    { "file-circle-exclamation"               , file_circle_exclamation                },
+    { "file-circle-minus"                     , file_circle_minus                      },
+    { "file-circle-plus"                      , file_circle_plus                       },
+    { "file-circle-question"                  , file_circle_question                   },
+    { "file-shield"                           , file_shield                            },
+    { "fire-burner"                           , fire_burner                            },
+    { "fish-fins"                             , fish_fins                              },
+    { "flask-vial"                            , flask_vial                             },
+    { "glass-water"                           , glass_water                            },
+    { "glass-water-droplet"                   , glass_water_droplet                    },
+    { "group-arrows-rotate"                   , group_arrows_rotate                    },
+    { "hand-holding-hand"                     , hand_holding_hand                      },
+    { "handcuffs"                             , handcuffs                              },
+    { "hands-bound"                           , hands_bound                            },
+    { "hands-holding-child"                   , hands_holding_child                    },
+    { "hands-holding-circle"                  , hands_holding_circle                   },
+    { "heart-circle-bolt"                     , heart_circle_bolt                      },
+    { "heart-circle-check"                    , heart_circle_check                     },
+    { "heart-circle-exclamation"              , heart_circle_exclamation               },
+    { "heart-circle-minus"                    , heart_circle_minus                     },
+    { "heart-circle-plus"                     , heart_circle_plus                      },
+    { "heart-circle-xmark"                    , heart_circle_xmark                     },
+    { "helicopter-symbol"                     , helicopter_symbol                      },
+    { "helmet-un"                             , helmet_un                              },
+    { "hill-avalanche"                        , hill_avalanche                         },
+    { "hill-rockslide"                        , hill_rockslide                         },
+    { "house-circle-check"                    , house_circle_check                     },
+    { "house-circle-exclamation"              , house_circle_exclamation               },
+    { "house-circle-xmark"                    , house_circle_xmark                     },
+    { "house-fire"                            , house_fire                             },
+    { "house-flag"                            , house_flag                             },
+    { "house-flood-water"                     , house_flood_water                      },
+    { "house-flood-water-circle-arrow-right"  , house_flood_water_circle_arrow_right   },
+    { "house-lock"                            , house_lock                             },
+    { "house-medical-circle-check"            , house_medical_circle_check             },
+    { "house-medical-circle-exclamation"      , house_medical_circle_exclamation       },
+    { "house-medical-circle-xmark"            , house_medical_circle_xmark             },
+    { "house-medical-flag"                    , house_medical_flag                     },
+    { "house-tsunami"                         , house_tsunami                          },
+    { "jar"                                   , jar                                    },
+    { "jar-wheat"                             , jar_wheat                              },
+    { "jet-fighter-up"                        , jet_fighter_up                         },
+    { "jug-detergent"                         , jug_detergent                          },
+    { "kitchen-set"                           , kitchen_set                            },
+    { "land-mine-on"                          , land_mine_on                           },
+    { "landmark-flag"                         , landmark_flag                          },
+    { "laptop-file"                           , laptop_file                            },
+    { "lines-leaning"                         , lines_leaning                          },
+    { "location-pin-lock"                     , location_pin_lock                      },
+    { "locust"                                , locust                                 },
+    { "magnifying-glass-arrow-right"          , magnifying_glass_arrow_right           },
+    { "magnifying-glass-chart"                , magnifying_glass_chart                 },
+    { "mars-and-venus-burst"                  , mars_and_venus_burst                   },
+    { "mask-ventilator"                       , mask_ventilator                        },
+    { "mattress-pillow"                       , mattress_pillow                        },
+    { "mobile-retro"                          , mobile_retro                           },
+    { "money-bill-transfer"                   , money_bill_transfer                    },
+    { "money-bill-trend-up"                   , money_bill_trend_up                    },
+    { "money-bill-wheat"                      , money_bill_wheat                       },
+    { "mosquito"                              , mosquito                               },
+    { "mosquito-net"                          , mosquito_net                           },
+    { "mound"                                 , mound                                  },
+    { "mountain-city"                         , mountain_city                          },
+    { "mountain-sun"                          , mountain_sun                           },
+    { "nfc-directional"                       , nfc_directional                        },
+    { "nfc-symbol"                            , nfc_symbol                             },
+    { "oil-well"                              , oil_well                               },
+    { "people-group"                          , people_group                           },
+    { "people-line"                           , people_line                            },
+    { "people-pulling"                        , people_pulling                         },
+    { "people-robbery"                        , people_robbery                         },
+    { "people-roof"                           , people_roof                            },
+    { "person-arrow-down-to-line"             , person_arrow_down_to_line              },
+    { "person-arrow-up-from-line"             , person_arrow_up_from_line              },
+    { "person-breastfeeding"                  , person_breastfeeding                   },
+    { "person-burst"                          , person_burst                           },
+    { "person-cane"                           , person_cane                            },
+    { "person-chalkboard"                     , person_chalkboard                      },
+    { "person-circle-check"                   , person_circle_check                    },
+    { "person-circle-exclamation"             , person_circle_exclamation              },
+    { "person-circle-minus"                   , person_circle_minus                    },
+    { "person-circle-plus"                    , person_circle_plus                     },
+    { "person-circle-question"                , person_circle_question                 },
+    { "person-circle-xmark"                   , person_circle_xmark                    },
+    { "person-dress-burst"                    , person_dress_burst                     },
+    { "person-drowning"                       , person_drowning                        },
+    { "person-falling"                        , person_falling                         },
+    { "person-falling-burst"                  , person_falling_burst                   },
+    { "person-half-dress"                     , person_half_dress                      },
+    { "person-harassing"                      , person_harassing                       },
+    { "person-military-pointing"              , person_military_pointing               },
+    { "person-military-rifle"                 , person_military_rifle                  },
+    { "person-military-to-person"             , person_military_to_person              },
+    { "person-rays"                           , person_rays                            },
+    { "person-rifle"                          , person_rifle                           },
+    { "person-shelter"                        , person_shelter                         },
+    { "person-walking-arrow-loop-left"        , person_walking_arrow_loop_left         },
+    { "person-walking-arrow-right"            , person_walking_arrow_right             },
+    { "person-walking-dashed-line-arrow-right", person_walking_dashed_line_arrow_right },
+    { "person-walking-luggage"                , person_walking_luggage                 },
+    { "plane-circle-check"                    , plane_circle_check                     },
+    { "plane-circle-exclamation"              , plane_circle_exclamation               },
+    { "plane-circle-xmark"                    , plane_circle_xmark                     },
+    { "plane-lock"                            , plane_lock                             },
+    { "plate-wheat"                           , plate_wheat                            },
+    { "plug-circle-bolt"                      , plug_circle_bolt                       },
+    { "plug-circle-check"                     , plug_circle_check                      },
+    { "plug-circle-exclamation"               , plug_circle_exclamation                },
+    { "plug-circle-minus"                     , plug_circle_minus                      },
+    { "plug-circle-plus"                      , plug_circle_plus                       },
+    { "plug-circle-xmark"                     , plug_circle_xmark                      },
+    { "ranking-star"                          , ranking_star                           },
+    { "road-barrier"                          , road_barrier                           },
+    { "road-bridge"                           , road_bridge                            },
+    { "road-circle-check"                     , road_circle_check                      },
+    { "road-circle-exclamation"               , road_circle_exclamation                },
+    { "road-circle-xmark"                     , road_circle_xmark                      },
+    { "road-lock"                             , road_lock                              },
+    { "road-spikes"                           , road_spikes                            },
+    { "rug"                                   , rug                                    },
+    { "sack-xmark"                            , sack_xmark                             },
+    { "school-circle-check"                   , school_circle_check                    },
+    { "school-circle-exclamation"             , school_circle_exclamation              },
+    { "school-circle-xmark"                   , school_circle_xmark                    },
+    { "school-flag"                           , school_flag                            },
+    { "school-lock"                           , school_lock                            },
+    { "screenpal"                             , screenpal                              },
+    { "sheet-plastic"                         , sheet_plastic                          },
+    { "shield-cat"                            , shield_cat                             },
+    { "shield-dog"                            , shield_dog                             },
+    { "shield-heart"                          , shield_heart                           },
+    { "square-nfi"                            , square_nfi                             },
+    { "square-person-confined"                , square_person_confined                 },
+    { "square-virus"                          , square_virus                           },
+    { "staff-aesculapius"                     , staff_aesculapius                      },
+    { "sun-plant-wilt"                        , sun_plant_wilt                         },
+    { "tarp"                                  , tarp                                   },
+    { "tarp-droplet"                          , tarp_droplet                           },
+    { "tent"                                  , tent                                   },
+    { "tent-arrow-down-to-line"               , tent_arrow_down_to_line                },
+    { "tent-arrow-left-right"                 , tent_arrow_left_right                  },
+    { "tent-arrow-turn-left"                  , tent_arrow_turn_left                   },
+    { "tent-arrows-down"                      , tent_arrows_down                       },
+    { "tents"                                 , tents                                  },
+    { "toilet-portable"                       , toilet_portable                        },
+    { "toilets-portable"                      , toilets_portable                       },
+    { "tower-cell"                            , tower_cell                             },
+    { "tower-observation"                     , tower_observation                      },
+    { "tree-city"                             , tree_city                              },
+    { "trowel"                                , trowel                                 },
+    { "trowel-bricks"                         , trowel_bricks                          },
+    { "truck-arrow-right"                     , truck_arrow_right                      },
+    { "truck-droplet"                         , truck_droplet                          },
+    { "truck-field"                           , truck_field                            },
+    { "truck-field-un"                        , truck_field_un                         },
+    { "truck-plane"                           , truck_plane                            },
+    { "users-between-lines"                   , users_between_lines                    },
+    { "users-line"                            , users_line                             },
+    { "users-rays"                            , users_rays                             },
+    { "users-rectangle"                       , users_rectangle                        },
+    { "users-viewfinder"                      , users_viewfinder                       },
+    { "vial-circle-check"                     , vial_circle_check                      },
+    { "vial-virus"                            , vial_virus                             },
+    { "wheat-awn-circle-exclamation"          , wheat_awn_circle_exclamation           },
+    { "worm"                                  , worm                                   },
+    { "xmarks-lines"                          , xmarks_lines                           },
+    { "child-dress"                           , child_dress                            },
+    { "child-reaching"                        , child_reaching                         },
+    { "martini-glass-empty"                   , martini_glass_empty                    },
+    { "music"                                 , music                                  },
+    { "magnifying-glass"                      , magnifying_glass                       },
+    { "heart"                                 , heart                                  },
+    { "star"                                  , star                                   },
+    { "user"                                  , user                                   },
+    { "film"                                  , film                                   },
+    { "table-cells-large"                     , table_cells_large                      },
+    { "table-cells"                           , table_cells                            },
+    { "table-list"                            , table_list                             },
+    { "check"                                 , check                                  },
+    { "xmark"                                 , xmark                                  },
+    { "magnifying-glass-plus"                 , magnifying_glass_plus                  },
+    { "magnifying-glass-minus"                , magnifying_glass_minus                 },
+    { "power-off"                             , power_off                              },
+    { "signal"                                , signal                                 },
+    { "gear"                                  , gear                                   },
+    { "house"                                 , house                                  },
+    { "clock"                                 , clock                                  },
+    { "road"                                  , road                                   },
+    { "download"                              , download                               },
+    { "inbox"                                 , inbox                                  },
+    { "arrow-rotate-right"                    , arrow_rotate_right                     },
+    { "arrows-rotate"                         , arrows_rotate                          },
+    { "rectangle-list"                        , rectangle_list                         },
+    { "lock"                                  , lock                                   },
+    { "flag"                                  , flag                                   },
+    { "headphones"                            , headphones                             },
+    { "volume-off"                            , volume_off                             },
+    { "volume-low"                            , volume_low                             },
+    { "volume-high"                           , volume_high                            },
+    { "qrcode"                                , qrcode                                 },
+    { "barcode"                               , barcode                                },
+    { "tag"                                   , tag                                    },
+    { "tags"                                  , tags                                   },
+    { "book"                                  , book                                   },
+    { "bookmark"                              , bookmark                               },
+    { "print"                                 , print                                  },
+    { "camera"                                , camera                                 },
+    { "font"                                  , font                                   },
+    { "bold"                                  , bold                                   },
+    { "italic"                                , italic                                 },
+    { "text-height"                           , text_height                            },
+    { "text-width"                            , text_width                             },
+    { "align-left"                            , align_left                             },
+    { "align-center"                          , align_center                           },
+    { "align-right"                           , align_right                            },
+    { "align-justify"                         , align_justify                          },
+    { "list"                                  , list                                   },
+    { "outdent"                               , outdent                                },
+    { "indent"                                , indent                                 },
+    { "video"                                 , video                                  },
+    { "image"                                 , image                                  },
+    { "location-pin"                          , location_pin                           },
+    { "circle-half-stroke"                    , circle_half_stroke                     },
+    { "droplet"                               , droplet                                },
+    { "pen-to-square"                         , pen_to_square                          },
+    { "arrows-up-down-left-right"             , arrows_up_down_left_right              },
+    { "backward-step"                         , backward_step                          },
+    { "backward-fast"                         , backward_fast                          },
+    { "backward"                              , backward                               },
+    { "play"                                  , play                                   },
+    { "pause"                                 , pause                                  },
+    { "stop"                                  , stop                                   },
+    { "forward"                               , forward                                },
+    { "forward-fast"                          , forward_fast                           },
+    { "forward-step"                          , forward_step                           },
+    { "eject"                                 , eject                                  },
+    { "chevron-left"                          , chevron_left                           },
+    { "chevron-right"                         , chevron_right                          },
+    { "circle-plus"                           , circle_plus                            },
+    { "circle-minus"                          , circle_minus                           },
+    { "circle-xmark"                          , circle_xmark                           },
+    { "circle-check"                          , circle_check                           },
+    { "circle-question"                       , circle_question                        },
+    { "circle-info"                           , circle_info                            },
+    { "crosshairs"                            , crosshairs                             },
+    { "ban"                                   , ban                                    },
+    { "arrow-left"                            , arrow_left                             },
+    { "arrow-right"                           , arrow_right                            },
+    { "arrow-up"                              , arrow_up                               },
+    { "arrow-down"                            , arrow_down                             },
+    { "share"                                 , share                                  },
+    { "expand"                                , expand                                 },
+    { "compress"                              , compress                               },
+    { "minus"                                 , minus                                  },
+    { "circle-exclamation"                    , circle_exclamation                     },
+    { "gift"                                  , gift                                   },
+    { "leaf"                                  , leaf                                   },
+    { "fire"                                  , fire                                   },
+    { "eye"                                   , eye                                    },
+    { "eye-slash"                             , eye_slash                              },
+    { "triangle-exclamation"                  , triangle_exclamation                   },
+    { "plane"                                 , plane                                  },
+    { "calendar-days"                         , calendar_days                          },
+    { "shuffle"                               , shuffle                                },
+    { "comment"                               , comment                                },
+    { "magnet"                                , magnet                                 },
+    { "chevron-up"                            , chevron_up                             },
+    { "chevron-down"                          , chevron_down                           },
+    { "retweet"                               , retweet                                },
+    { "cart-shopping"                         , cart_shopping                          },
+    { "folder"                                , folder                                 },
+    { "folder-open"                           , folder_open                            },
+    { "arrows-up-down"                        , arrows_up_down                         },
+    { "arrows-left-right"                     , arrows_left_right                      },
+    { "chart-bar"                             , chart_bar                              },
+    { "twitter-square"                        , twitter_square                         },
+    { "facebook-square"                       , facebook_square                        },
+    { "camera-retro"                          , camera_retro                           },
+    { "key"                                   , key                                    },
+    { "gears"                                 , gears                                  },
+    { "comments"                              , comments                               },
+    { "star-half"                             , star_half                              },
+    { "arrow-right-from-bracket"              , arrow_right_from_bracket               },
+    { "linkedin"                              , linkedin                               },
+    { "thumbtack"                             , thumbtack                              },
+    { "arrow-up-right-from-square"            , arrow_up_right_from_square             },
+    { "arrow-right-to-bracket"                , arrow_right_to_bracket                 },
+    { "trophy"                                , trophy                                 },
+    { "github-square"                         , github_square                          },
+    { "upload"                                , upload                                 },
+    { "lemon"                                 , lemon                                  },
+    { "phone"                                 , phone                                  },
+    { "square-phone"                          , square_phone                           },
+    { "twitter"                               , twitter                                },
+    { "facebook"                              , facebook                               },
+    { "github"                                , github                                 },
+    { "unlock"                                , unlock                                 },
+    { "credit-card"                           , credit_card                            },
+    { "rss"                                   , rss                                    },
+    { "hard-drive"                            , hard_drive                             },
+    { "bullhorn"                              , bullhorn                               },
+    { "certificate"                           , certificate                            },
+    { "hand-point-right"                      , hand_point_right                       },
+    { "hand-point-left"                       , hand_point_left                        },
+    { "hand-point-up"                         , hand_point_up                          },
+    { "hand-point-down"                       , hand_point_down                        },
+    { "circle-arrow-left"                     , circle_arrow_left                      },
+    { "circle-arrow-right"                    , circle_arrow_right                     },
+    { "circle-arrow-up"                       , circle_arrow_up                        },
+    { "circle-arrow-down"                     , circle_arrow_down                      },
+    { "globe"                                 , globe                                  },
+    { "wrench"                                , wrench                                 },
+    { "list-check"                            , list_check                             },
+    { "filter"                                , filter                                 },
+    { "briefcase"                             , briefcase                              },
+    { "up-down-left-right"                    , up_down_left_right                     },
+    { "users"                                 , users                                  },
+    { "link"                                  , link                                   },
+    { "cloud"                                 , cloud                                  },
+    { "flask"                                 , flask                                  },
+    { "scissors"                              , scissors                               },
+    { "copy"                                  , copy                                   },
+    { "paperclip"                             , paperclip                              },
+    { "floppy-disk"                           , floppy_disk                            },
+    { "square"                                , square                                 },
+    { "bars"                                  , bars                                   },
+    { "list-ul"                               , list_ul                                },
+    { "list-ol"                               , list_ol                                },
+    { "strikethrough"                         , strikethrough                          },
+    { "underline"                             , underline                              },
+    { "table"                                 , table                                  },
+    { "wand-magic"                            , wand_magic                             },
+    { "truck"                                 , truck                                  },
+    { "pinterest"                             , pinterest                              },
+    { "pinterest-square"                      , pinterest_square                       },
+    { "google-plus-square"                    , google_plus_square                     },
+    { "google-plus-g"                         , google_plus_g                          },
+    { "money-bill"                            , money_bill                             },
+    { "caret-down"                            , caret_down                             },
+    { "caret-up"                              , caret_up                               },
+    { "caret-left"                            , caret_left                             },
+    { "caret-right"                           , caret_right                            },
+    { "table-columns"                         , table_columns                          },
+    { "sort"                                  , sort                                   },
+    { "sort-down"                             , sort_down                              },
+    { "sort-up"                               , sort_up                                },
+    { "envelope"                              , envelope                               },
+    { "linkedin-in"                           , linkedin_in                            },
+    { "arrow-rotate-left"                     , arrow_rotate_left                      },
+    { "gavel"                                 , gavel                                  },
+    { "bolt"                                  , bolt                                   },
+    { "sitemap"                               , sitemap                                },
+    { "umbrella"                              , umbrella                               },
+    { "paste"                                 , paste                                  },
+    { "lightbulb"                             , lightbulb                              },
+    { "arrow-right-arrow-left"                , arrow_right_arrow_left                 },
+    { "cloud-arrow-down"                      , cloud_arrow_down                       },
+    { "cloud-arrow-up"                        , cloud_arrow_up                         },
+    { "user-doctor"                           , user_doctor                            },
+    { "stethoscope"                           , stethoscope                            },
+    { "suitcase"                              , suitcase                               },
+    { "bell"                                  , bell                                   },
+    { "mug-saucer"                            , mug_saucer                             },
+    { "hospital"                              , hospital                               },
+    { "truck-medical"                         , truck_medical                          },
+    { "suitcase-medical"                      , suitcase_medical                       },
+    { "jet-fighter"                           , jet_fighter                            },
+    { "beer-mug-empty"                        , beer_mug_empty                         },
+    { "square-h"                              , square_h                               },
+    { "square-plus"                           , square_plus                            },
+    { "angles-left"                           , angles_left                            },
+    { "angles-right"                          , angles_right                           },
+    { "angles-up"                             , angles_up                              },
+    { "angles-down"                           , angles_down                            },
+    { "angle-left"                            , angle_left                             },
+    { "angle-right"                           , angle_right                            },
+    { "angle-up"                              , angle_up                               },
+    { "angle-down"                            , angle_down                             },
+    { "laptop"                                , laptop                                 },
+    { "tablet-button"                         , tablet_button                          },
+    { "mobile-button"                         , mobile_button                          },
+    { "quote-left"                            , quote_left                             },
+    { "quote-right"                           , quote_right                            },
+    { "spinner"                               , spinner                                },
+    { "circle"                                , circle                                 },
+    { "github-alt"                            , github_alt                             },
+    { "face-smile"                            , face_smile                             },
+    { "face-frown"                            , face_frown                             },
+    { "face-meh"                              , face_meh                               },
+    { "gamepad"                               , gamepad                                },
+    { "keyboard"                              , keyboard                               },
+    { "flag-checkered"                        , flag_checkered                         },
+    { "terminal"                              , terminal                               },
+    { "code"                                  , code                                   },
+    { "reply-all"                             , reply_all                              },
+    { "location-arrow"                        , location_arrow                         },
+    { "crop"                                  , crop                                   },
+    { "code-branch"                           , code_branch                            },
+    { "link-slash"                            , link_slash                             },
+    { "info"                                  , info                                   },
+    { "superscript"                           , superscript                            },
+    { "subscript"                             , subscript                              },
+    { "eraser"                                , eraser                                 },
+    { "puzzle-piece"                          , puzzle_piece                           },
+    { "microphone"                            , microphone                             },
+    { "microphone-slash"                      , microphone_slash                       },
+    { "shield"                                , shield                                 },
+    { "calendar"                              , calendar                               },
+    { "fire-extinguisher"                     , fire_extinguisher                      },
+    { "rocket"                                , rocket                                 },
+    { "maxcdn"                                , maxcdn                                 },
+    { "circle-chevron-left"                   , circle_chevron_left                    },
+    { "circle-chevron-right"                  , circle_chevron_right                   },
+    { "circle-chevron-up"                     , circle_chevron_up                      },
+    { "circle-chevron-down"                   , circle_chevron_down                    },
+    { "html5"                                 , html5                                  },
+    { "css3"                                  , css3                                   },
+    { "anchor"                                , anchor                                 },
+    { "unlock-keyhole"                        , unlock_keyhole                         },
+    { "bullseye"                              , bullseye                               },
+    { "ellipsis"                              , ellipsis                               },
+    { "ellipsis-vertical"                     , ellipsis_vertical                      },
+    { "square-rss"                            , square_rss                             },
+    { "circle-play"                           , circle_play                            },
+    { "ticket"                                , ticket                                 },
+    { "square-minus"                          , square_minus                           },
+    { "arrow-turn-up"                         , arrow_turn_up                          },
+    { "arrow-turn-down"                       , arrow_turn_down                        },
+    { "square-check"                          , square_check                           },
+    { "square-pen"                            , square_pen                             },
+    { "square-arrow-up-right"                 , square_arrow_up_right                  },
+    { "share-from-square"                     , share_from_square                      },
+    { "compass"                               , compass                                },
+    { "square-caret-down"                     , square_caret_down                      },
+    { "square-caret-up"                       , square_caret_up                        },
+    { "square-caret-right"                    , square_caret_right                     },
+    { "euro-sign"                             , euro_sign                              },
+    { "sterling-sign"                         , sterling_sign                          },
+    { "rupee-sign"                            , rupee_sign                             },
+    { "yen-sign"                              , yen_sign                               },
+    { "ruble-sign"                            , ruble_sign                             },
+    { "won-sign"                              , won_sign                               },
+    { "btc"                                   , btc                                    },
+    { "file"                                  , file                                   },
+    { "file-lines"                            , file_lines                             },
+    { "arrow-down-a-z"                        , arrow_down_a_z                         },
+    { "arrow-up-a-z"                          , arrow_up_a_z                           },
+    { "arrow-down-wide-short"                 , arrow_down_wide_short                  },
+    { "arrow-up-wide-short"                   , arrow_up_wide_short                    },
+    { "arrow-down-1-9"                        , arrow_down_1_9                         },
+    { "arrow-up-1-9"                          , arrow_up_1_9                           },
+    { "thumbs-up"                             , thumbs_up                              },
+    { "thumbs-down"                           , thumbs_down                            },
+    { "youtube"                               , youtube                                },
+    { "xing"                                  , xing                                   },
+    { "xing-square"                           , xing_square                            },
+    { "dropbox"                               , dropbox                                },
+    { "stack-overflow"                        , stack_overflow                         },
+    { "instagram"                             , instagram                              },
+    { "flickr"                                , flickr                                 },
+    { "adn"                                   , adn                                    },
+    { "bitbucket"                             , bitbucket                              },
+    { "tumblr"                                , tumblr                                 },
+    { "tumblr-square"                         , tumblr_square                          },
+    { "arrow-down-long"                       , arrow_down_long                        },
+    { "arrow-up-long"                         , arrow_up_long                          },
+    { "arrow-left-long"                       , arrow_left_long                        },
+    { "arrow-right-long"                      , arrow_right_long                       },
+    { "apple"                                 , apple                                  },
+    { "windows"                               , windows                                },
+    { "android"                               , android                                },
+    { "linux"                                 , _linux                                 },
+    { "dribbble"                              , dribbble                               },
+    { "skype"                                 , skype                                  },
+    { "foursquare"                            , foursquare                             },
+    { "trello"                                , trello                                 },
+    { "person-dress"                          , person_dress                           },
+    { "person"                                , person                                 },
+    { "gratipay"                              , gratipay                               },
+    { "sun"                                   , sun                                    },
+    { "moon"                                  , moon                                   },
+    { "box-archive"                           , box_archive                            },
+    { "bug"                                   , bug                                    },
+    { "vk"                                    , vk                                     },
+    { "weibo"                                 , weibo                                  },
+    { "renren"                                , renren                                 },
+    { "pagelines"                             , pagelines                              },
+    { "stack-exchange"                        , stack_exchange                         },
+    { "square-caret-left"                     , square_caret_left                      },
+    { "circle-dot"                            , circle_dot                             },
+    { "wheelchair"                            , wheelchair                             },
+    { "vimeo-square"                          , vimeo_square                           },
+    { "lira-sign"                             , lira_sign                              },
+    { "shuttle-space"                         , shuttle_space                          },
+    { "slack"                                 , slack                                  },
+    { "square-envelope"                       , square_envelope                        },
+    { "wordpress"                             , wordpress                              },
+    { "openid"                                , openid                                 },
+    { "building-columns"                      , building_columns                       },
+    { "graduation-cap"                        , graduation_cap                         },
+    { "yahoo"                                 , yahoo                                  },
+    { "google"                                , google                                 },
+    { "reddit"                                , reddit                                 },
+    { "reddit-square"                         , reddit_square                          },
+    { "stumbleupon-circle"                    , stumbleupon_circle                     },
+    { "stumbleupon"                           , stumbleupon                            },
+    { "delicious"                             , delicious                              },
+    { "digg"                                  , digg                                   },
+    { "pied-piper-pp"                         , pied_piper_pp                          },
+    { "pied-piper-alt"                        , pied_piper_alt                         },
+    { "drupal"                                , drupal                                 },
+    { "joomla"                                , joomla                                 },
+    { "language"                              , language                               },
+    { "fax"                                   , fax                                    },
+    { "building"                              , building                               },
+    { "child"                                 , child                                  },
+    { "paw"                                   , paw                                    },
+    { "cube"                                  , cube                                   },
+    { "cubes"                                 , cubes                                  },
+    { "behance"                               , behance                                },
+    { "behance-square"                        , behance_square                         },
+    { "steam"                                 , steam                                  },
+    { "steam-square"                          , steam_square                           },
+    { "recycle"                               , recycle                                },
+    { "car"                                   , car                                    },
+    { "taxi"                                  , taxi                                   },
+    { "tree"                                  , tree                                   },
+    { "spotify"                               , spotify                                },
+    { "deviantart"                            , deviantart                             },
+    { "soundcloud"                            , soundcloud                             },
+    { "database"                              , database                               },
+    { "file-pdf"                              , file_pdf                               },
+    { "file-word"                             , file_word                              },
+    { "file-excel"                            , file_excel                             },
+    { "file-powerpoint"                       , file_powerpoint                        },
+    { "file-image"                            , file_image                             },
+    { "file-zipper"                           , file_zipper                            },
+    { "file-audio"                            , file_audio                             },
+    { "file-video"                            , file_video                             },
+    { "file-code"                             , file_code                              },
+    { "vine"                                  , vine                                   },
+    { "codepen"                               , codepen                                },
+    { "jsfiddle"                              , jsfiddle                               },
+    { "life-ring"                             , life_ring                              },
+    { "circle-notch"                          , circle_notch                           },
+    { "rebel"                                 , rebel                                  },
+    { "empire"                                , empire                                 },
+    { "git-square"                            , git_square                             },
+    { "git"                                   , git                                    },
+    { "hacker-news"                           , hacker_news                            },
+    { "tencent-weibo"                         , tencent_weibo                          },
+    { "qq"                                    , qq                                     },
+    { "weixin"                                , weixin                                 },
+    { "paper-plane"                           , paper_plane                            },
+    { "clock-rotate-left"                     , clock_rotate_left                      },
+    { "heading"                               , heading                                },
+    { "paragraph"                             , paragraph                              },
+    { "sliders"                               , sliders                                },
+    { "share-nodes"                           , share_nodes                            },
+    { "square-share-nodes"                    , square_share_nodes                     },
+    { "bomb"                                  , bomb                                   },
+    { "futbol"                                , futbol                                 },
+    { "tty"                                   , tty                                    },
+    { "binoculars"                            , binoculars                             },
+    { "plug"                                  , plug                                   },
+    { "slideshare"                            , slideshare                             },
+    { "twitch"                                , twitch                                 },
+    { "yelp"                                  , yelp                                   },
+    { "newspaper"                             , newspaper                              },
+    { "wifi"                                  , wifi                                   },
+    { "calculator"                            , calculator                             },
+    { "paypal"                                , paypal                                 },
+    { "google-wallet"                         , google_wallet                          },
+    { "cc-visa"                               , cc_visa                                },
+    { "cc-mastercard"                         , cc_mastercard                          },
+    { "cc-discover"                           , cc_discover                            },
+    { "cc-amex"                               , cc_amex                                },
+    { "cc-paypal"                             , cc_paypal                              },
+    { "cc-stripe"                             , cc_stripe                              },
+    { "bell-slash"                            , bell_slash                             },
+    { "trash"                                 , trash                                  },
+    { "copyright"                             , copyright                              },
+    { "eye-dropper"                           , eye_dropper                            },
+    { "paintbrush"                            , paintbrush                             },
+    { "cake-candles"                          , cake_candles                           },
+    { "chart-area"                            , chart_area                             },
+    { "chart-pie"                             , chart_pie                              },
+    { "chart-line"                            , chart_line                             },
+    { "lastfm"                                , lastfm                                 },
+    { "lastfm-square"                         , lastfm_square                          },
+    { "toggle-off"                            , toggle_off                             },
+    { "toggle-on"                             , toggle_on                              },
+    { "bicycle"                               , bicycle                                },
+    { "bus"                                   , bus                                    },
+    { "ioxhost"                               , ioxhost                                },
+    { "angellist"                             , angellist                              },
+    { "closed-captioning"                     , closed_captioning                      },
+    { "shekel-sign"                           , shekel_sign                            },
+    { "buysellads"                            , buysellads                             },
+    { "connectdevelop"                        , connectdevelop                         },
+    { "dashcube"                              , dashcube                               },
+    { "forumbee"                              , forumbee                               },
+    { "leanpub"                               , leanpub                                },
+    { "sellsy"                                , sellsy                                 },
+    { "shirtsinbulk"                          , shirtsinbulk                           },
+    { "simplybuilt"                           , simplybuilt                            },
+    { "skyatlas"                              , skyatlas                               },
+    { "cart-plus"                             , cart_plus                              },
+    { "cart-arrow-down"                       , cart_arrow_down                        },
+    { "diamond"                               , diamond                                },
+    { "ship"                                  , ship                                   },
+    { "user-secret"                           , user_secret                            },
+    { "motorcycle"                            , motorcycle                             },
+    { "street-view"                           , street_view                            },
+    { "heart-pulse"                           , heart_pulse                            },
+    { "venus"                                 , venus                                  },
+    { "mars"                                  , mars                                   },
+    { "mercury"                               , mercury                                },
+    { "mars-and-venus"                        , mars_and_venus                         },
+    { "transgender"                           , transgender                            },
+    { "venus-double"                          , venus_double                           },
+    { "mars-double"                           , mars_double                            },
+    { "venus-mars"                            , venus_mars                             },
+    { "mars-stroke"                           , mars_stroke                            },
+    { "mars-stroke-up"                        , mars_stroke_up                         },
+    { "mars-stroke-right"                     , mars_stroke_right                      },
+    { "neuter"                                , neuter                                 },
+    { "genderless"                            , genderless                             },
+    { "pinterest-p"                           , pinterest_p                            },
+    { "whatsapp"                              , whatsapp                               },
+    { "server"                                , server                                 },
+    { "user-plus"                             , user_plus                              },
+    { "user-xmark"                            , user_xmark                             },
+    { "bed"                                   , bed                                    },
+    { "viacoin"                               , viacoin                                },
+    { "train"                                 , train                                  },
+    { "train-subway"                          , train_subway                           },
+    { "medium"                                , medium                                 },
+    { "y-combinator"                          , y_combinator                           },
+    { "optin-monster"                         , optin_monster                          },
+    { "opencart"                              , opencart                               },
+    { "expeditedssl"                          , expeditedssl                           },
+    { "battery-full"                          , battery_full                           },
+    { "battery-three-quarters"                , battery_three_quarters                 },
+    { "battery-half"                          , battery_half                           },
+    { "battery-quarter"                       , battery_quarter                        },
+    { "battery-empty"                         , battery_empty                          },
+    { "arrow-pointer"                         , arrow_pointer                          },
+    { "i-cursor"                              , i_cursor                               },
+    { "object-group"                          , object_group                           },
+    { "object-ungroup"                        , object_ungroup                         },
+    { "note-sticky"                           , note_sticky                            },
+    { "cc-jcb"                                , cc_jcb                                 },
+    { "cc-diners-club"                        , cc_diners_club                         },
+    { "clone"                                 , clone                                  },
+    { "scale-balanced"                        , scale_balanced                         },
+    { "hourglass-start"                       , hourglass_start                        },
+    { "hourglass-empty"                       , hourglass_empty                        },
+    { "hourglass-end"                         , hourglass_end                          },
+    { "hourglass"                             , hourglass                              },
+    { "hand-back-fist"                        , hand_back_fist                         },
+    { "hand"                                  , hand                                   },
+    { "hand-scissors"                         , hand_scissors                          },
+    { "hand-lizard"                           , hand_lizard                            },
+    { "hand-spock"                            , hand_spock                             },
+    { "hand-pointer"                          , hand_pointer                           },
+    { "hand-peace"                            , hand_peace                             },
+    { "trademark"                             , trademark                              },
+    { "registered"                            , registered                             },
+    { "creative-commons"                      , creative_commons                       },
+    { "gg"                                    , gg                                     },
+    { "gg-circle"                             , gg_circle                              },
+    { "odnoklassniki"                         , odnoklassniki                          },
+    { "odnoklassniki-square"                  , odnoklassniki_square                   },
+    { "get-pocket"                            , get_pocket                             },
+    { "wikipedia-w"                           , wikipedia_w                            },
+    { "safari"                                , safari                                 },
+    { "chrome"                                , chrome                                 },
+    { "firefox"                               , firefox                                },
+    { "opera"                                 , opera                                  },
+    { "internet-explorer"                     , internet_explorer                      },
+    { "tv"                                    , tv                                     },
+    { "contao"                                , contao                                 },
+    { "500px"                                 , _500px                                 },
+    { "amazon"                                , amazon                                 },
+    { "calendar-plus"                         , calendar_plus                          },
+    { "calendar-minus"                        , calendar_minus                         },
+    { "calendar-xmark"                        , calendar_xmark                         },
+    { "calendar-check"                        , calendar_check                         },
+    { "industry"                              , industry                               },
+    { "map-pin"                               , map_pin                                },
+    { "signs-post"                            , signs_post                             },
+    { "map"                                   , map                                    },
+    { "message"                               , message                                },
+    { "houzz"                                 , houzz                                  },
+    { "vimeo-v"                               , vimeo_v                                },
+    { "black-tie"                             , black_tie                              },
+    { "fonticons"                             , fonticons                              },
+    { "reddit-alien"                          , reddit_alien                           },
+    { "edge"                                  , edge                                   },
+    { "codiepie"                              , codiepie                               },
+    { "modx"                                  , modx                                   },
+    { "fort-awesome"                          , fort_awesome                           },
+    { "usb"                                   , usb                                    },
+    { "product-hunt"                          , product_hunt                           },
+    { "mixcloud"                              , mixcloud                               },
+    { "scribd"                                , scribd                                 },
+    { "circle-pause"                          , circle_pause                           },
+    { "circle-stop"                           , circle_stop                            },
+    { "bag-shopping"                          , bag_shopping                           },
+    { "basket-shopping"                       , basket_shopping                        },
+    { "bluetooth"                             , bluetooth                              },
+    { "bluetooth-b"                           , bluetooth_b                            },
+    { "gitlab"                                , gitlab                                 },
+    { "wpbeginner"                            , wpbeginner                             },
+    { "wpforms"                               , wpforms                                },
+    { "envira"                                , envira                                 },
+    { "universal-access"                      , universal_access                       },
+    { "person-walking-with-cane"              , person_walking_with_cane               },
+    { "audio-description"                     , audio_description                      },
+    { "phone-volume"                          , phone_volume                           },
+    { "braille"                               , braille                                },
+    { "ear-listen"                            , ear_listen                             },
+    { "hands-asl-interpreting"                , hands_asl_interpreting                 },
+    { "ear-deaf"                              , ear_deaf                               },
+    { "glide"                                 , glide                                  },
+    { "glide-g"                               , glide_g                                },
+    { "hands"                                 , hands                                  },
+    { "eye-low-vision"                        , eye_low_vision                         },
+    { "viadeo"                                , viadeo                                 },
+    { "viadeo-square"                         , viadeo_square                          },
+    { "snapchat"                              , snapchat                               },
+    { "snapchat-square"                       , snapchat_square                        },
+    { "pied-piper"                            , pied_piper                             },
+    { "first-order"                           , first_order                            },
+    { "yoast"                                 , yoast                                  },
+    { "themeisle"                             , themeisle                              },
+    { "google-plus"                           , google_plus                            },
+    { "font-awesome"                          , font_awesome                           },
+    { "handshake"                             , handshake                              },
+    { "envelope-open"                         , envelope_open                          },
+    { "linode"                                , linode                                 },
+    { "address-book"                          , address_book                           },
+    { "address-card"                          , address_card                           },
+    { "circle-user"                           , circle_user                            },
+    { "id-badge"                              , id_badge                               },
+    { "id-card"                               , id_card                                },
+    { "quora"                                 , quora                                  },
+    { "free-code-camp"                        , free_code_camp                         },
+    { "telegram"                              , telegram                               },
+    { "temperature-full"                      , temperature_full                       },
+    { "temperature-three-quarters"            , temperature_three_quarters             },
+    { "temperature-half"                      , temperature_half                       },
+    { "temperature-quarter"                   , temperature_quarter                    },
+    { "temperature-empty"                     , temperature_empty                      },
+    { "shower"                                , shower                                 },
+    { "bath"                                  , bath                                   },
+    { "podcast"                               , podcast                                },
+    { "window-maximize"                       , window_maximize                        },
+    { "window-minimize"                       , window_minimize                        },
+    { "window-restore"                        , window_restore                         },
+    { "square-xmark"                          , square_xmark                           },
+    { "bandcamp"                              , bandcamp                               },
+    { "grav"                                  , grav                                   },
+    { "etsy"                                  , etsy                                   },
+    { "imdb"                                  , imdb                                   },
+    { "ravelry"                               , ravelry                                },
+    { "sellcast"                              , sellcast                               },
+    { "microchip"                             , microchip                              },
+    { "snowflake"                             , snowflake                              },
+    { "superpowers"                           , superpowers                            },
+    { "wpexplorer"                            , wpexplorer                             },
+    { "meetup"                                , meetup                                 },
+    { "spoon"                                 , spoon                                  },
+    { "utensils"                              , utensils                               },
+    { "rotate-left"                           , rotate_left                            },
+    { "trash-can"                             , trash_can                              },
+    { "rotate"                                , rotate                                 },
+    { "stopwatch"                             , stopwatch                              },
+    { "right-from-bracket"                    , right_from_bracket                     },
+    { "right-to-bracket"                      , right_to_bracket                       },
+    { "rotate-right"                          , rotate_right                           },
+    { "poo"                                   , poo                                    },
+    { "images"                                , images                                 },
+    { "pencil"                                , pencil                                 },
+    { "pen"                                   , pen                                    },
+    { "pen-clip"                              , pen_clip                               },
+    { "down-long"                             , down_long                              },
+    { "left-long"                             , left_long                              },
+    { "right-long"                            , right_long                             },
+    { "up-long"                               , up_long                                },
+    { "file-pen"                              , file_pen                               },
+    { "maximize"                              , maximize                               },
+    { "clipboard"                             , clipboard                              },
+    { "left-right"                            , left_right                             },
+    { "up-down"                               , up_down                                },
+    { "circle-down"                           , circle_down                            },
+    { "circle-left"                           , circle_left                            },
+    { "circle-right"                          , circle_right                           },
+    { "circle-up"                             , circle_up                              },
+    { "square-font-awesome-stroke"            , square_font_awesome_stroke             },
+    { "up-right-from-square"                  , up_right_from_square                   },
+    { "square-up-right"                       , square_up_right                        },
+    { "right-left"                            , right_left                             },
+    { "repeat"                                , repeat                                 },
+    { "accessible-icon"                       , accessible_icon                        },
+    { "accusoft"                              , accusoft                               },
+    { "adversal"                              , adversal                               },
+    { "affiliatetheme"                        , affiliatetheme                         },
+    { "algolia"                               , algolia                                },
+    { "amilia"                                , amilia                                 },
+    { "angrycreative"                         , angrycreative                          },
+    { "app-store"                             , app_store                              },
+    { "app-store-ios"                         , app_store_ios                          },
+    { "apper"                                 , apper                                  },
+    { "asymmetrik"                            , asymmetrik                             },
+    { "audible"                               , audible                                },
+    { "avianex"                               , avianex                                },
+    { "aws"                                   , aws                                    },
+    { "bimobject"                             , bimobject                              },
+    { "bitcoin"                               , bitcoin                                },
+    { "bity"                                  , bity                                   },
+    { "blackberry"                            , blackberry                             },
+    { "blogger"                               , blogger                                },
+    { "blogger-b"                             , blogger_b                              },
+    { "buromobelexperte"                      , buromobelexperte                       },
+    { "centercode"                            , centercode                             },
+    { "cloudscale"                            , cloudscale                             },
+    { "cloudsmith"                            , cloudsmith                             },
+    { "cloudversify"                          , cloudversify                           },
+    { "code-commit"                           , code_commit                            },
+    { "code-merge"                            , code_merge                             },
+    { "cpanel"                                , cpanel                                 },
+    { "css3-alt"                              , css3_alt                               },
+    { "cuttlefish"                            , cuttlefish                             },
+    { "d-and-d"                               , d_and_d                                },
+    { "deploydog"                             , deploydog                              },
+    { "deskpro"                               , deskpro                                },
+    { "desktop"                               , desktop                                },
+    { "digital-ocean"                         , digital_ocean                          },
+    { "discord"                               , discord                                },
+    { "discourse"                             , discourse                              },
+    { "dochub"                                , dochub                                 },
+    { "docker"                                , docker                                 },
+    { "draft2digital"                         , draft2digital                          },
+    { "dribbble-square"                       , dribbble_square                        },
+    { "dyalog"                                , dyalog                                 },
+    { "earlybirds"                            , earlybirds                             },
+    { "erlang"                                , erlang                                 },
+    { "facebook-f"                            , facebook_f                             },
+    { "facebook-messenger"                    , facebook_messenger                     },
+    { "firstdraft"                            , firstdraft                             },
+    { "fonticons-fi"                          , fonticons_fi                           },
+    { "fort-awesome-alt"                      , fort_awesome_alt                       },
+    { "freebsd"                               , freebsd                                },
+    { "gem"                                   , gem                                    },
+    { "gitkraken"                             , gitkraken                              },
+    { "gofore"                                , gofore                                 },
+    { "goodreads"                             , goodreads                              },
+    { "goodreads-g"                           , goodreads_g                            },
+    { "google-drive"                          , google_drive                           },
+    { "google-play"                           , google_play                            },
+    { "gripfire"                              , gripfire                               },
+    { "grunt"                                 , grunt                                  },
+    { "gulp"                                  , gulp                                   },
+    { "hacker-news-square"                    , hacker_news_square                     },
+    { "hire-a-helper"                         , hire_a_helper                          },
+    { "hotjar"                                , hotjar                                 },
+    { "hubspot"                               , hubspot                                },
+    { "itunes"                                , itunes                                 },
+    { "itunes-note"                           , itunes_note                            },
+    { "jenkins"                               , jenkins                                },
+    { "joget"                                 , joget                                  },
+    { "js"                                    , js                                     },
+    { "js-square"                             , js_square                              },
+    { "keycdn"                                , keycdn                                 },
+    { "kickstarter"                           , kickstarter                            },
+    { "kickstarter-k"                         , kickstarter_k                          },
+    { "laravel"                               , laravel                                },
+    { "turn-down"                             , turn_down                              },
+    { "turn-up"                               , turn_up                                },
+    { "line"                                  , _line                                  },
+    { "lock-open"                             , lock_open                              },
+    { "lyft"                                  , lyft                                   },
+    { "magento"                               , magento                                },
+    { "location-dot"                          , location_dot                           },
+    { "medapps"                               , medapps                                },
+    { "medrt"                                 , medrt                                  },
+    { "microphone-lines"                      , microphone_lines                       },
+    { "microsoft"                             , microsoft                              },
+    { "mix"                                   , mix                                    },
+    { "mizuni"                                , mizuni                                 },
+    { "mobile-screen-button"                  , mobile_screen_button                   },
+    { "mobile"                                , mobile                                 },
+    { "mobile-screen"                         , mobile_screen                          },
+    { "monero"                                , monero                                 },
+    { "money-bill-1"                          , money_bill_1                           },
+    { "napster"                               , napster                                },
+    { "node-js"                               , node_js                                },
+    { "npm"                                   , npm                                    },
+    { "ns8"                                   , ns8                                    },
+    { "nutritionix"                           , nutritionix                            },
+    { "page4"                                 , page4                                  },
+    { "palfed"                                , palfed                                 },
+    { "patreon"                               , patreon                                },
+    { "periscope"                             , periscope                              },
+    { "phabricator"                           , phabricator                            },
+    { "phoenix-framework"                     , phoenix_framework                      },
+    { "phone-slash"                           , phone_slash                            },
+    { "playstation"                           , playstation                            },
+    { "image-portrait"                        , image_portrait                         },
+    { "pushed"                                , pushed                                 },
+    { "python"                                , python                                 },
+    { "red-river"                             , red_river                              },
+    { "wpressr"                               , wpressr                                },
+    { "reply"                                 , reply                                  },
+    { "replyd"                                , replyd                                 },
+    { "resolving"                             , resolving                              },
+    { "rocketchat"                            , rocketchat                             },
+    { "rockrms"                               , rockrms                                },
+    { "schlix"                                , schlix                                 },
+    { "searchengin"                           , searchengin                            },
+    { "servicestack"                          , servicestack                           },
+    { "shield-halved"                         , shield_halved                          },
+    { "sistrix"                               , sistrix                                },
+    { "speakap"                               , speakap                                },
+    { "staylinked"                            , staylinked                             },
+    { "steam-symbol"                          , steam_symbol                           },
+    { "sticker-mule"                          , sticker_mule                           },
+    { "studiovinari"                          , studiovinari                           },
+    { "supple"                                , supple                                 },
+    { "tablet-screen-button"                  , tablet_screen_button                   },
+    { "tablet"                                , tablet                                 },
+    { "ticket-simple"                         , ticket_simple                          },
+    { "uber"                                  , uber                                   },
+    { "uikit"                                 , uikit                                  },
+    { "uniregistry"                           , uniregistry                            },
+    { "untappd"                               , untappd                                },
+    { "user-large"                            , user_large                             },
+    { "ussunnah"                              , ussunnah                               },
+    { "vaadin"                                , vaadin                                 },
+    { "viber"                                 , viber                                  },
+    { "vimeo"                                 , vimeo                                  },
+    { "vnv"                                   , vnv                                    },
+    { "whatsapp-square"                       , whatsapp_square                        },
+    { "whmcs"                                 , whmcs                                  },
+    { "rectangle-xmark"                       , rectangle_xmark                        },
+    { "wordpress-simple"                      , wordpress_simple                       },
+    { "xbox"                                  , xbox                                   },
+    { "yandex"                                , yandex                                 },
+    { "yandex-international"                  , yandex_international                   },
+    { "apple-pay"                             , apple_pay                              },
+    { "cc-apple-pay"                          , cc_apple_pay                           },
+    { "fly"                                   , fly                                    },
+    { "node"                                  , node                                   },
+    { "osi"                                   , osi                                    },
+    { "react"                                 , react                                  },
+    { "autoprefixer"                          , autoprefixer                           },
+    { "less"                                  , less                                   },
+    { "sass"                                  , sass                                   },
+    { "vuejs"                                 , vuejs                                  },
+    { "angular"                               , angular                                },
+    { "aviato"                                , aviato                                 },
+    { "down-left-and-up-right-to-center"      , down_left_and_up_right_to_center       },
+    { "ember"                                 , ember                                  },
+    { "up-right-and-down-left-from-center"    , up_right_and_down_left_from_center     },
+    { "square-font-awesome"                   , square_font_awesome                    },
+    { "gitter"                                , gitter                                 },
+    { "hooli"                                 , hooli                                  },
+    { "strava"                                , strava                                 },
+    { "stripe"                                , stripe                                 },
+    { "stripe-s"                              , stripe_s                               },
+    { "typo3"                                 , typo3                                  },
+    { "amazon-pay"                            , amazon_pay                             },
+    { "cc-amazon-pay"                         , cc_amazon_pay                          },
+    { "ethereum"                              , ethereum                               },
+    { "korvue"                                , korvue                                 },
+    { "elementor"                             , elementor                              },
+    { "youtube-square"                        , youtube_square                         },
+    { "baseball-bat-ball"                     , baseball_bat_ball                      },
+    { "baseball"                              , baseball                               },
+    { "basketball"                            , basketball                             },
+    { "bowling-ball"                          , bowling_ball                           },
+    { "chess"                                 , chess                                  },
+    { "chess-bishop"                          , chess_bishop                           },
+    { "chess-board"                           , chess_board                            },
+    { "chess-king"                            , chess_king                             },
+    { "chess-knight"                          , chess_knight                           },
+    { "chess-pawn"                            , chess_pawn                             },
+    { "chess-queen"                           , chess_queen                            },
+    { "chess-rook"                            , chess_rook                             },
+    { "dumbbell"                              , dumbbell                               },
+    { "flipboard"                             , flipboard                              },
+    { "football"                              , football                               },
+    { "golf-ball-tee"                         , golf_ball_tee                          },
+    { "hips"                                  , hips                                   },
+    { "hockey-puck"                           , hockey_puck                            },
+    { "php"                                   , php                                    },
+    { "broom-ball"                            , broom_ball                             },
+    { "quinscape"                             , quinscape                              },
+    { "square-full"                           , square_full                            },
+    { "table-tennis-paddle-ball"              , table_tennis_paddle_ball               },
+    { "volleyball"                            , volleyball                             },
+    { "hand-dots"                             , hand_dots                              },
+    { "bandage"                               , bandage                                },
+    { "box"                                   , box                                    },
+    { "boxes-stacked"                         , boxes_stacked                          },
+    { "briefcase-medical"                     , briefcase_medical                      },
+    { "fire-flame-simple"                     , fire_flame_simple                      },
+    { "capsules"                              , capsules                               },
+    { "clipboard-check"                       , clipboard_check                        },
+    { "clipboard-list"                        , clipboard_list                         },
+    { "person-dots-from-line"                 , person_dots_from_line                  },
+    { "dna"                                   , dna                                    },
+    { "dolly"                                 , dolly                                  },
+    { "cart-flatbed"                          , cart_flatbed                           },
+    { "file-medical"                          , file_medical                           },
+    { "file-waveform"                         , file_waveform                          },
+    { "kit-medical"                           , kit_medical                            },
+    { "circle-h"                              , circle_h                               },
+    { "id-card-clip"                          , id_card_clip                           },
+    { "notes-medical"                         , notes_medical                          },
+    { "pallet"                                , pallet                                 },
+    { "pills"                                 , pills                                  },
+    { "prescription-bottle"                   , prescription_bottle                    },
+    { "prescription-bottle-medical"           , prescription_bottle_medical            },
+    { "bed-pulse"                             , bed_pulse                              },
+    { "truck-fast"                            , truck_fast                             },
+    { "smoking"                               , smoking                                },
+    { "syringe"                               , syringe                                },
+    { "tablets"                               , tablets                                },
+    { "thermometer"                           , thermometer                            },
+    { "vial"                                  , vial                                   },
+    { "vials"                                 , vials                                  },
+    { "warehouse"                             , warehouse                              },
+    { "weight-scale"                          , weight_scale                           },
+    { "x-ray"                                 , x_ray                                  },
+    { "box-open"                              , box_open                               },
+    { "comment-dots"                          , comment_dots                           },
+    { "comment-slash"                         , comment_slash                          },
+    { "couch"                                 , couch                                  },
+    { "circle-dollar-to-slot"                 , circle_dollar_to_slot                  },
+    { "dove"                                  , dove                                   },
+    { "hand-holding"                          , hand_holding                           },
+    { "hand-holding-heart"                    , hand_holding_heart                     },
+    { "hand-holding-dollar"                   , hand_holding_dollar                    },
+    { "hand-holding-droplet"                  , hand_holding_droplet                   },
+    { "hands-holding"                         , hands_holding                          },
+    { "handshake-angle"                       , handshake_angle                        },
+    { "handshake-simple"                      , handshake_simple                       },
+    { "parachute-box"                         , parachute_box                          },
+    { "people-carry-box"                      , people_carry_box                       },
+    { "piggy-bank"                            , piggy_bank                             },
+    { "readme"                                , readme                                 },
+    { "ribbon"                                , ribbon                                 },
+    { "route"                                 , route                                  },
+    { "seedling"                              , seedling                               },
+    { "sign-hanging"                          , sign_hanging                           },
+    { "face-smile-wink"                       , face_smile_wink                        },
+    { "tape"                                  , tape                                   },
+    { "truck-ramp-box"                        , truck_ramp_box                         },
+    { "truck-moving"                          , truck_moving                           },
+    { "video-slash"                           , video_slash                            },
+    { "wine-glass"                            , wine_glass                             },
+    { "java"                                  , java                                   },
+    { "pied-piper-hat"                        , pied_piper_hat                         },
+    { "creative-commons-by"                   , creative_commons_by                    },
+    { "creative-commons-nc"                   , creative_commons_nc                    },
+    { "creative-commons-nc-eu"                , creative_commons_nc_eu                 },
+    { "creative-commons-nc-jp"                , creative_commons_nc_jp                 },
+    { "creative-commons-nd"                   , creative_commons_nd                    },
+    { "creative-commons-pd"                   , creative_commons_pd                    },
+    { "creative-commons-pd-alt"               , creative_commons_pd_alt                },
+    { "creative-commons-remix"                , creative_commons_remix                 },
+    { "creative-commons-sa"                   , creative_commons_sa                    },
+    { "creative-commons-sampling"             , creative_commons_sampling              },
+    { "creative-commons-sampling-plus"        , creative_commons_sampling_plus         },
+    { "creative-commons-share"                , creative_commons_share                 },
+    { "creative-commons-zero"                 , creative_commons_zero                  },
+    { "ebay"                                  , ebay                                   },
+    { "keybase"                               , keybase                                },
+    { "mastodon"                              , mastodon                               },
+    { "r-project"                             , r_project                              },
+    { "researchgate"                          , researchgate                           },
+    { "teamspeak"                             , teamspeak                              },
+    { "user-large-slash"                      , user_large_slash                       },
+    { "user-astronaut"                        , user_astronaut                         },
+    { "user-check"                            , user_check                             },
+    { "user-clock"                            , user_clock                             },
+    { "user-gear"                             , user_gear                              },
+    { "user-pen"                              , user_pen                               },
+    { "user-group"                            , user_group                             },
+    { "user-graduate"                         , user_graduate                          },
+    { "user-lock"                             , user_lock                              },
+    { "user-minus"                            , user_minus                             },
+    { "user-ninja"                            , user_ninja                             },
+    { "user-shield"                           , user_shield                            },
+    { "user-slash"                            , user_slash                             },
+    { "user-tag"                              , user_tag                               },
+    { "user-tie"                              , user_tie                               },
+    { "users-gear"                            , users_gear                             },
+    { "first-order-alt"                       , first_order_alt                        },
+    { "fulcrum"                               , fulcrum                                },
+    { "galactic-republic"                     , galactic_republic                      },
+    { "galactic-senate"                       , galactic_senate                        },
+    { "jedi-order"                            , jedi_order                             },
+    { "mandalorian"                           , mandalorian                            },
+    { "old-republic"                          , old_republic                           },
+    { "phoenix-squadron"                      , phoenix_squadron                       },
+    { "sith"                                  , sith                                   },
+    { "trade-federation"                      , trade_federation                       },
+    { "wolf-pack-battalion"                   , wolf_pack_battalion                    },
+    { "scale-unbalanced"                      , scale_unbalanced                       },
+    { "scale-unbalanced-flip"                 , scale_unbalanced_flip                  },
+    { "blender"                               , blender                                },
+    { "book-open"                             , book_open                              },
+    { "tower-broadcast"                       , tower_broadcast                        },
+    { "broom"                                 , broom                                  },
+    { "chalkboard"                            , chalkboard                             },
+    { "chalkboard-user"                       , chalkboard_user                        },
+    { "church"                                , church                                 },
+    { "coins"                                 , coins                                  },
+    { "compact-disc"                          , compact_disc                           },
+    { "crow"                                  , crow                                   },
+    { "crown"                                 , crown                                  },
+    { "dice"                                  , dice                                   },
+    { "dice-five"                             , dice_five                              },
+    { "dice-four"                             , dice_four                              },
+    { "dice-one"                              , dice_one                               },
+    { "dice-six"                              , dice_six                               },
+    { "dice-three"                            , dice_three                             },
+    { "dice-two"                              , dice_two                               },
+    { "divide"                                , divide                                 },
+    { "door-closed"                           , door_closed                            },
+    { "door-open"                             , door_open                              },
+    { "feather"                               , feather                                },
+    { "frog"                                  , frog                                   },
+    { "gas-pump"                              , gas_pump                               },
+    { "glasses"                               , glasses                                },
+    { "greater-than-equal"                    , greater_than_equal                     },
+    { "helicopter"                            , helicopter                             },
+    { "infinity"                              , infinity                               },
+    { "kiwi-bird"                             , kiwi_bird                              },
+    { "less-than-equal"                       , less_than_equal                        },
+    { "memory"                                , memory                                 },
+    { "microphone-lines-slash"                , microphone_lines_slash                 },
+    { "money-bill-wave"                       , money_bill_wave                        },
+    { "money-bill-1-wave"                     , money_bill_1_wave                      },
+    { "money-check"                           , money_check                            },
+    { "money-check-dollar"                    , money_check_dollar                     },
+    { "not-equal"                             , not_equal                              },
+    { "palette"                               , palette                                },
+    { "square-parking"                        , square_parking                         },
+    { "diagram-project"                       , diagram_project                        },
+    { "receipt"                               , receipt                                },
+    { "robot"                                 , robot                                  },
+    { "ruler"                                 , ruler                                  },
+    { "ruler-combined"                        , ruler_combined                         },
+    { "ruler-horizontal"                      , ruler_horizontal                       },
+    { "ruler-vertical"                        , ruler_vertical                         },
+    { "school"                                , school                                 },
+    { "screwdriver"                           , screwdriver                            },
+    { "shoe-prints"                           , shoe_prints                            },
+    { "skull"                                 , skull                                  },
+    { "ban-smoking"                           , ban_smoking                            },
+    { "store"                                 , store                                  },
+    { "shop"                                  , shop                                   },
+    { "bars-staggered"                        , bars_staggered                         },
+    { "stroopwafel"                           , stroopwafel                            },
+    { "toolbox"                               , toolbox                                },
+    { "shirt"                                 , shirt                                  },
+    { "person-walking"                        , person_walking                         },
+    { "wallet"                                , wallet                                 },
+    { "face-angry"                            , face_angry                             },
+    { "archway"                               , archway                                },
+    { "book-atlas"                            , book_atlas                             },
+    { "award"                                 , award                                  },
+    { "delete-left"                           , delete_left                            },
+    { "bezier-curve"                          , bezier_curve                           },
+    { "bong"                                  , bong                                   },
+    { "brush"                                 , brush                                  },
+    { "bus-simple"                            , bus_simple                             },
+    { "cannabis"                              , cannabis                               },
+    { "check-double"                          , check_double                           },
+    { "martini-glass-citrus"                  , martini_glass_citrus                   },
+    { "bell-concierge"                        , bell_concierge                         },
+    { "cookie"                                , cookie                                 },
+    { "cookie-bite"                           , cookie_bite                            },
+    { "crop-simple"                           , crop_simple                            },
+    { "tachograph-digital"                    , tachograph_digital                     },
+    { "face-dizzy"                            , face_dizzy                             },
+    { "compass-drafting"                      , compass_drafting                       },
+    { "drum"                                  , drum                                   },
+    { "drum-steelpan"                         , drum_steelpan                          },
+    { "feather-pointed"                       , feather_pointed                        },
+    { "file-contract"                         , file_contract                          },
+    { "file-arrow-down"                       , file_arrow_down                        },
+    { "file-export"                           , file_export                            },
+    { "file-import"                           , file_import                            },
+    { "file-invoice"                          , file_invoice                           },
+    { "file-invoice-dollar"                   , file_invoice_dollar                    },
+    { "file-prescription"                     , file_prescription                      },
+    { "file-signature"                        , file_signature                         },
+    { "file-arrow-up"                         , file_arrow_up                          },
+    { "fill"                                  , fill                                   },
+    { "fill-drip"                             , fill_drip                              },
+    { "fingerprint"                           , fingerprint                            },
+    { "fish"                                  , fish                                   },
+    { "face-flushed"                          , face_flushed                           },
+    { "face-frown-open"                       , face_frown_open                        },
+    { "martini-glass"                         , martini_glass                          },
+    { "earth-africa"                          , earth_africa                           },
+    { "earth-americas"                        , earth_americas                         },
+    { "earth-asia"                            , earth_asia                             },
+    { "face-grimace"                          , face_grimace                           },
+    { "face-grin"                             , face_grin                              },
+    { "face-grin-wide"                        , face_grin_wide                         },
+    { "face-grin-beam"                        , face_grin_beam                         },
+    { "face-grin-beam-sweat"                  , face_grin_beam_sweat                   },
+    { "face-grin-hearts"                      , face_grin_hearts                       },
+    { "face-grin-squint"                      , face_grin_squint                       },
+    { "face-grin-squint-tears"                , face_grin_squint_tears                 },
+    { "face-grin-stars"                       , face_grin_stars                        },
+    { "face-grin-tears"                       , face_grin_tears                        },
+    { "face-grin-tongue"                      , face_grin_tongue                       },
+    { "face-grin-tongue-squint"               , face_grin_tongue_squint                },
+    { "face-grin-tongue-wink"                 , face_grin_tongue_wink                  },
+    { "face-grin-wink"                        , face_grin_wink                         },
+    { "grip"                                  , grip                                   },
+    { "grip-vertical"                         , grip_vertical                          },
+    { "headphones-simple"                     , headphones_simple                      },
+    { "headset"                               , headset                                },
+    { "highlighter"                           , highlighter                            },
+    { "hornbill"                              , hornbill                               },
+    { "hot-tub-person"                        , hot_tub_person                         },
+    { "hotel"                                 , hotel                                  },
+    { "joint"                                 , joint                                  },
+    { "face-kiss"                             , face_kiss                              },
+    { "face-kiss-beam"                        , face_kiss_beam                         },
+    { "face-kiss-wink-heart"                  , face_kiss_wink_heart                   },
+    { "face-laugh"                            , face_laugh                             },
+    { "face-laugh-beam"                       , face_laugh_beam                        },
+    { "face-laugh-squint"                     , face_laugh_squint                      },
+    { "face-laugh-wink"                       , face_laugh_wink                        },
+    { "cart-flatbed-suitcase"                 , cart_flatbed_suitcase                  },
+    { "mailchimp"                             , mailchimp                              },
+    { "map-location"                          , map_location                           },
+    { "map-location-dot"                      , map_location_dot                       },
+    { "marker"                                , marker                                 },
+    { "medal"                                 , medal                                  },
+    { "megaport"                              , megaport                               },
+    { "face-meh-blank"                        , face_meh_blank                         },
+    { "face-rolling-eyes"                     , face_rolling_eyes                      },
+    { "monument"                              , monument                               },
+    { "mortar-pestle"                         , mortar_pestle                          },
+    { "nimblr"                                , nimblr                                 },
+    { "paint-roller"                          , paint_roller                           },
+    { "passport"                              , passport                               },
+    { "pen-fancy"                             , pen_fancy                              },
+    { "pen-nib"                               , pen_nib                                },
+    { "pen-ruler"                             , pen_ruler                              },
+    { "plane-arrival"                         , plane_arrival                          },
+    { "plane-departure"                       , plane_departure                        },
+    { "prescription"                          , prescription                           },
+    { "rev"                                   , rev                                    },
+    { "face-sad-cry"                          , face_sad_cry                           },
+    { "face-sad-tear"                         , face_sad_tear                          },
+    { "shopware"                              , shopware                               },
+    { "van-shuttle"                           , van_shuttle                            },
+    { "signature"                             , signature                              },
+    { "face-smile-beam"                       , face_smile_beam                        },
+    { "solar-panel"                           , solar_panel                            },
+    { "spa"                                   , spa                                    },
+    { "splotch"                               , splotch                                },
+    { "spray-can"                             , spray_can                              },
+    { "squarespace"                           , squarespace                            },
+    { "stamp"                                 , stamp                                  },
+    { "star-half-stroke"                      , star_half_stroke                       },
+    { "suitcase-rolling"                      , suitcase_rolling                       },
+    { "face-surprise"                         , face_surprise                          },
+    { "swatchbook"                            , swatchbook                             },
+    { "person-swimming"                       , person_swimming                        },
+    { "water-ladder"                          , water_ladder                           },
+    { "themeco"                               , themeco                                },
+    { "droplet-slash"                         , droplet_slash                          },
+    { "face-tired"                            , face_tired                             },
+    { "tooth"                                 , tooth                                  },
+    { "umbrella-beach"                        , umbrella_beach                         },
+    { "vector-square"                         , vector_square                          },
+    { "weebly"                                , weebly                                 },
+    { "weight-hanging"                        , weight_hanging                         },
+    { "wine-glass-empty"                      , wine_glass_empty                       },
+    { "wix"                                   , wix                                    },
+    { "spray-can-sparkles"                    , spray_can_sparkles                     },
+    { "apple-whole"                           , apple_whole                            },
+    { "atom"                                  , atom                                   },
+    { "bone"                                  , bone                                   },
+    { "book-open-reader"                      , book_open_reader                       },
+    { "brain"                                 , brain                                  },
+    { "car-rear"                              , car_rear                               },
+    { "car-battery"                           , car_battery                            },
+    { "car-burst"                             , car_burst                              },
+    { "car-side"                              , car_side                               },
+    { "charging-station"                      , charging_station                       },
+    { "diamond-turn-right"                    , diamond_turn_right                     },
+    { "draw-polygon"                          , draw_polygon                           },
+    { "ello"                                  , ello                                   },
+    { "hackerrank"                            , hackerrank                             },
+    { "kaggle"                                , kaggle                                 },
+    { "laptop-code"                           , laptop_code                            },
+    { "layer-group"                           , layer_group                            },
+    { "location-crosshairs"                   , location_crosshairs                    },
+    { "lungs"                                 , lungs                                  },
+    { "markdown"                              , markdown                               },
+    { "microscope"                            , microscope                             },
+    { "neos"                                  , neos                                   },
+    { "oil-can"                               , oil_can                                },
+    { "poop"                                  , poop                                   },
+    { "shapes"                                , shapes                                 },
+    { "star-of-life"                          , star_of_life                           },
+    { "gauge"                                 , gauge                                  },
+    { "gauge-high"                            , gauge_high                             },
+    { "gauge-simple"                          , gauge_simple                           },
+    { "gauge-simple-high"                     , gauge_simple_high                      },
+    { "teeth"                                 , teeth                                  },
+    { "teeth-open"                            , teeth_open                             },
+    { "masks-theater"                         , masks_theater                          },
+    { "traffic-light"                         , traffic_light                          },
+    { "truck-monster"                         , truck_monster                          },
+    { "truck-pickup"                          , truck_pickup                           },
+    { "zhihu"                                 , zhihu                                  },
+    { "rectangle-ad"                          , rectangle_ad                           },
+    { "alipay"                                , alipay                                 },
+    { "ankh"                                  , ankh                                   },
+    { "book-bible"                            , book_bible                             },
+    { "business-time"                         , business_time                          },
+    { "city"                                  , city                                   },
+    { "comment-dollar"                        , comment_dollar                         },
+    { "comments-dollar"                       , comments_dollar                        },
+    { "cross"                                 , cross                                  },
+    { "dharmachakra"                          , dharmachakra                           },
+    { "envelope-open-text"                    , envelope_open_text                     },
+    { "folder-minus"                          , folder_minus                           },
+    { "folder-plus"                           , folder_plus                            },
+    { "filter-circle-dollar"                  , filter_circle_dollar                   },
+    { "gopuram"                               , gopuram                                },
+    { "hamsa"                                 , hamsa                                  },
+    { "bahai"                                 , bahai                                  },
+    { "jedi"                                  , jedi                                   },
+    { "book-journal-whills"                   , book_journal_whills                    },
+    { "kaaba"                                 , kaaba                                  },
+    { "khanda"                                , khanda                                 },
+    { "landmark"                              , landmark                               },
+    { "envelopes-bulk"                        , envelopes_bulk                         },
+    { "menorah"                               , menorah                                },
+    { "mosque"                                , mosque                                 },
+    { "om"                                    , om                                     },
+    { "spaghetti-monster-flying"              , spaghetti_monster_flying               },
+    { "peace"                                 , peace                                  },
+    { "place-of-worship"                      , place_of_worship                       },
+    { "square-poll-vertical"                  , square_poll_vertical                   },
+    { "square-poll-horizontal"                , square_poll_horizontal                 },
+    { "person-praying"                        , person_praying                         },
+    { "hands-praying"                         , hands_praying                          },
+    { "book-quran"                            , book_quran                             },
+    { "magnifying-glass-dollar"               , magnifying_glass_dollar                },
+    { "magnifying-glass-location"             , magnifying_glass_location              },
+    { "socks"                                 , socks                                  },
+    { "square-root-variable"                  , square_root_variable                   },
+    { "star-and-crescent"                     , star_and_crescent                      },
+    { "star-of-david"                         , star_of_david                          },
+    { "synagogue"                             , synagogue                              },
+    { "the-red-yeti"                          , the_red_yeti                           },
+    { "scroll-torah"                          , scroll_torah                           },
+    { "torii-gate"                            , torii_gate                             },
+    { "vihara"                                , vihara                                 },
+    { "volume-xmark"                          , volume_xmark                           },
+    { "yin-yang"                              , yin_yang                               },
+    { "blender-phone"                         , blender_phone                          },
+    { "book-skull"                            , book_skull                             },
+    { "campground"                            , campground                             },
+    { "cat"                                   , cat                                    },
+    { "chair"                                 , chair                                  },
+    { "cloud-moon"                            , cloud_moon                             },
+    { "cloud-sun"                             , cloud_sun                              },
+    { "cow"                                   , cow                                    },
+    { "critical-role"                         , critical_role                          },
+    { "d-and-d-beyond"                        , d_and_d_beyond                         },
+    { "dev"                                   , dev                                    },
+    { "dice-d20"                              , dice_d20                               },
+    { "dice-d6"                               , dice_d6                                },
+    { "dog"                                   , dog                                    },
+    { "dragon"                                , dragon                                 },
+    { "drumstick-bite"                        , drumstick_bite                         },
+    { "dungeon"                               , dungeon                                },
+    { "fantasy-flight-games"                  , fantasy_flight_games                   },
+    { "file-csv"                              , file_csv                               },
+    { "hand-fist"                             , hand_fist                              },
+    { "ghost"                                 , ghost                                  },
+    { "hammer"                                , hammer                                 },
+    { "hanukiah"                              , hanukiah                               },
+    { "hat-wizard"                            , hat_wizard                             },
+    { "person-hiking"                         , person_hiking                          },
+    { "hippo"                                 , hippo                                  },
+    { "horse"                                 , horse                                  },
+    { "house-chimney-crack"                   , house_chimney_crack                    },
+    { "hryvnia-sign"                          , hryvnia_sign                           },
+    { "mask"                                  , mask                                   },
+    { "mountain"                              , mountain                               },
+    { "network-wired"                         , network_wired                          },
+    { "otter"                                 , otter                                  },
+    { "ring"                                  , ring                                   },
+    { "person-running"                        , person_running                         },
+    { "scroll"                                , scroll                                 },
+    { "skull-crossbones"                      , skull_crossbones                       },
+    { "slash"                                 , slash                                  },
+    { "spider"                                , spider                                 },
+    { "toilet-paper"                          , toilet_paper                           },
+    { "tractor"                               , tractor                                },
+    { "user-injured"                          , user_injured                           },
+    { "vr-cardboard"                          , vr_cardboard                           },
+    { "wand-sparkles"                         , wand_sparkles                          },
+    { "wind"                                  , wind                                   },
+    { "wine-bottle"                           , wine_bottle                            },
+    { "wizards-of-the-coast"                  , wizards_of_the_coast                   },
+    { "think-peaks"                           , think_peaks                            },
+    { "cloud-meatball"                        , cloud_meatball                         },
+    { "cloud-moon-rain"                       , cloud_moon_rain                        },
+    { "cloud-rain"                            , cloud_rain                             },
+    { "cloud-showers-heavy"                   , cloud_showers_heavy                    },
+    { "cloud-sun-rain"                        , cloud_sun_rain                         },
+    { "democrat"                              , democrat                               },
+    { "flag-usa"                              , flag_usa                               },
+    { "hurricane"                             , hurricane                              },
+    { "landmark-dome"                         , landmark_dome                          },
+    { "meteor"                                , meteor                                 },
+    { "person-booth"                          , person_booth                           },
+    { "poo-storm"                             , poo_storm                              },
+    { "rainbow"                               , rainbow                                },
+    { "reacteurope"                           , reacteurope                            },
+    { "republican"                            , republican                             },
+    { "smog"                                  , smog                                   },
+    { "temperature-high"                      , temperature_high                       },
+    { "temperature-low"                       , temperature_low                        },
+    { "cloud-bolt"                            , cloud_bolt                             },
+    { "tornado"                               , tornado                                },
+    { "volcano"                               , volcano                                },
+    { "check-to-slot"                         , check_to_slot                          },
+    { "water"                                 , water                                  },
+    { "artstation"                            , artstation                             },
+    { "atlassian"                             , atlassian                              },
+    { "baby"                                  , baby                                   },
+    { "baby-carriage"                         , baby_carriage                          },
+    { "biohazard"                             , biohazard                              },
+    { "blog"                                  , blog                                   },
+    { "calendar-day"                          , calendar_day                           },
+    { "calendar-week"                         , calendar_week                          },
+    { "canadian-maple-leaf"                   , canadian_maple_leaf                    },
+    { "candy-cane"                            , candy_cane                             },
+    { "carrot"                                , carrot                                 },
+    { "cash-register"                         , cash_register                          },
+    { "centos"                                , centos                                 },
+    { "minimize"                              , minimize                               },
+    { "confluence"                            , confluence                             },
+    { "dhl"                                   , dhl                                    },
+    { "diaspora"                              , diaspora                               },
+    { "dumpster"                              , dumpster                               },
+    { "dumpster-fire"                         , dumpster_fire                          },
+    { "ethernet"                              , ethernet                               },
+    { "fedex"                                 , fedex                                  },
+    { "fedora"                                , fedora                                 },
+    { "figma"                                 , figma                                  },
+    { "gifts"                                 , gifts                                  },
+    { "champagne-glasses"                     , champagne_glasses                      },
+    { "whiskey-glass"                         , whiskey_glass                          },
+    { "earth-europe"                          , earth_europe                           },
+    { "grip-lines"                            , grip_lines                             },
+    { "grip-lines-vertical"                   , grip_lines_vertical                    },
+    { "guitar"                                , guitar                                 },
+    { "heart-crack"                           , heart_crack                            },
+    { "holly-berry"                           , holly_berry                            },
+    { "horse-head"                            , horse_head                             },
+    { "icicles"                               , icicles                                },
+    { "igloo"                                 , igloo                                  },
+    { "intercom"                              , intercom                               },
+    { "invision"                              , invision                               },
+    { "jira"                                  , jira                                   },
+    { "mendeley"                              , mendeley                               },
+    { "mitten"                                , mitten                                 },
+    { "mug-hot"                               , mug_hot                                },
+    { "radiation"                             , radiation                              },
+    { "circle-radiation"                      , circle_radiation                       },
+    { "raspberry-pi"                          , raspberry_pi                           },
+    { "redhat"                                , redhat                                 },
+    { "restroom"                              , restroom                               },
+    { "satellite"                             , satellite                              },
+    { "satellite-dish"                        , satellite_dish                         },
+    { "sd-card"                               , sd_card                                },
+    { "sim-card"                              , sim_card                               },
+    { "person-skating"                        , person_skating                         },
+    { "sketch"                                , sketch                                 },
+    { "person-skiing"                         , person_skiing                          },
+    { "person-skiing-nordic"                  , person_skiing_nordic                   },
+    { "sleigh"                                , sleigh                                 },
+    { "comment-sms"                           , comment_sms                            },
+    { "person-snowboarding"                   , person_snowboarding                    },
+    { "snowman"                               , snowman                                },
+    { "snowplow"                              , snowplow                               },
+    { "sourcetree"                            , sourcetree                             },
+    { "suse"                                  , suse                                   },
+    { "tenge-sign"                            , tenge_sign                             },
+    { "toilet"                                , toilet                                 },
+    { "screwdriver-wrench"                    , screwdriver_wrench                     },
+    { "train-tram"                            , train_tram                             },
+    { "ubuntu"                                , ubuntu                                 },
+    { "ups"                                   , ups                                    },
+    { "usps"                                  , usps                                   },
+    { "yarn"                                  , yarn                                   },
+    { "fire-flame-curved"                     , fire_flame_curved                      },
+    { "bacon"                                 , bacon                                  },
+    { "book-medical"                          , book_medical                           },
+    { "bread-slice"                           , bread_slice                            },
+    { "cheese"                                , cheese                                 },
+    { "house-chimney-medical"                 , house_chimney_medical                  },
+    { "clipboard-user"                        , clipboard_user                         },
+    { "comment-medical"                       , comment_medical                        },
+    { "crutch"                                , crutch                                 },
+    { "disease"                               , disease                                },
+    { "egg"                                   , egg                                    },
+    { "folder-tree"                           , folder_tree                            },
+    { "burger"                                , burger                                 },
+    { "hand-middle-finger"                    , hand_middle_finger                     },
+    { "helmet-safety"                         , helmet_safety                          },
+    { "hospital-user"                         , hospital_user                          },
+    { "hotdog"                                , hotdog                                 },
+    { "ice-cream"                             , ice_cream                              },
+    { "laptop-medical"                        , laptop_medical                         },
+    { "pager"                                 , pager                                  },
+    { "pepper-hot"                            , pepper_hot                             },
+    { "pizza-slice"                           , pizza_slice                            },
+    { "sack-dollar"                           , sack_dollar                            },
+    { "bars-progress"                         , bars_progress                          },
+    { "trash-arrow-up"                        , trash_arrow_up                         },
+    { "trash-can-arrow-up"                    , trash_can_arrow_up                     },
+    { "user-nurse"                            , user_nurse                             },
+    { "airbnb"                                , airbnb                                 },
+    { "battle-net"                            , battle_net                             },
+    { "bootstrap"                             , bootstrap                              },
+    { "buffer"                                , buffer                                 },
+    { "chromecast"                            , chromecast                             },
+    { "evernote"                              , evernote                               },
+    { "itch-io"                               , itch_io                                },
+    { "salesforce"                            , salesforce                             },
+    { "speaker-deck"                          , speaker_deck                           },
+    { "symfony"                               , symfony                                },
+    { "wave-square"                           , wave_square                            },
+    { "waze"                                  , waze                                   },
+    { "yammer"                                , yammer                                 },
+    { "git-alt"                               , git_alt                                },
+    { "stackpath"                             , stackpath                              },
+    { "person-biking"                         , person_biking                          },
+    { "border-all"                            , border_all                             },
+    { "border-none"                           , border_none                            },
+    { "border-top-left"                       , border_top_left                        },
+    { "person-digging"                        , person_digging                         },
+    { "fan"                                   , fan                                    },
+    { "icons"                                 , icons                                  },
+    { "phone-flip"                            , phone_flip                             },
+    { "square-phone-flip"                     , square_phone_flip                      },
+    { "photo-film"                            , photo_film                             },
+    { "text-slash"                            , text_slash                             },
+    { "arrow-down-z-a"                        , arrow_down_z_a                         },
+    { "arrow-up-z-a"                          , arrow_up_z_a                           },
+    { "arrow-down-short-wide"                 , arrow_down_short_wide                  },
+    { "arrow-up-short-wide"                   , arrow_up_short_wide                    },
+    { "arrow-down-9-1"                        , arrow_down_9_1                         },
+    { "arrow-up-9-1"                          , arrow_up_9_1                           },
+    { "spell-check"                           , spell_check                            },
+    { "voicemail"                             , voicemail                              },
+    { "cotton-bureau"                         , cotton_bureau                          },
+    { "buy-n-large"                           , buy_n_large                            },
+    { "hat-cowboy"                            , hat_cowboy                             },
+    { "hat-cowboy-side"                       , hat_cowboy_side                        },
+    { "mdb"                                   , mdb                                    },
+    { "computer-mouse"                        , computer_mouse                         },
+    { "orcid"                                 , orcid                                  },
+    { "radio"                                 , radio                                  },
+    { "record-vinyl"                          , record_vinyl                           },
+    { "swift"                                 , swift                                  },
+    { "umbraco"                               , umbraco                                },
+    { "walkie-talkie"                         , walkie_talkie                          },
+    { "caravan"                               , caravan                                },
+};
+
+constexpr int icon_codes_count = sizeof(icon_codes) / sizeof(icon_codes[0]);
+
+/**
+ * Returns the name of the icon with the code point @a code, or nullptr if
+ * there is none.
+ */
+constexpr const char* icon_name(int code)
+{
+    return detail::find_name(icon_codes, 0, icon_codes_count, icon_codes_count / 2, code);
+}
+
+}
+
+}
+
+#endif // AWESOME_NAMES_H
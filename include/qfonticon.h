@@ -4,6 +4,16 @@
 #include <QIconEngine>
 #include <QVariant>
 #include <QEasingCurve>
+#include <QStringView>
+#include <QFuture>
+#include <QMap>
+#include <QVector>
+#include <QColor>
+#include <QRectF>
+#include <QMetaType>
+
+#include <climits>
+#include <functional>
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 #define QFI6_CONST const
@@ -17,12 +27,142 @@ class QFontIconEngine : public QIconEngine
 public:
     enum { InvalidIcon = -1 };
 
+    // Font id picking, per icon, the first font containing it. See
+    // setFontPriority().
+    enum { AnyFont = -2 };
+
+    enum TrimLevel
+    {
+        TrimPixmaps,    // rendered pixmaps
+        TrimGlyphs,     // and glyph outlines and metrics
+        TrimFonts       // and font data, reloaded on next use
+    };
+
+    enum Cache
+    {
+        FontCache,      // font files
+        GlyphCache,     // glyph outlines and metrics
+        PixmapCache,    // rendered pixmaps
+        DiskCache,      // rendered pixmaps kept across launches
+        AtlasCache,     // QFontIconAtlas pages
+        CacheCount
+    };
+
+    struct MemoryUsage
+    {
+        qint64 bytes[CacheCount]   = {};
+        int    entries[CacheCount] = {};
+
+        qint64 total() const
+        {
+            qint64 t = 0;
+            for(auto b : bytes)
+                t += b;
+            return t;
+        }
+    };
+
+    struct MemoryReport
+    {
+        MemoryUsage            usage;
+        qint64                 budgets[CacheCount] = {}; // -1 if unlimited
+        QMap<int, MemoryUsage> fonts;                    // by font id
+    };
+
+    typedef int (*IconNameResolver)(QStringView name);
+    typedef QString (*IconCodeResolver)(int code);
+
+    struct Statistics
+    {
+        enum { SizeClasses = 6, LatencyBuckets = 12 };
+
+        quint64 paintCalls         = 0;
+        quint64 pixmapCalls        = 0;
+        quint64 outlineCacheHits   = 0;
+        quint64 outlineCacheMisses = 0;
+        quint64 pixmapCacheHits    = 0;
+        quint64 pixmapCacheMisses  = 0;
+        quint64 diskCacheHits      = 0;
+        quint64 diskCacheMisses    = 0;
+        quint64 rasterizations     = 0;
+        quint64 liveEngines        = 0;
+        quint64 activeTimers       = 0;
+        quint64 animationTicks     = 0;
+
+        // paint() durations per icon size class. Bucket 0 counts paints under
+        // 1us, bucket n paints in [2^(n-1), 2^n) us, the last one the rest.
+        quint64 paintLatency[SizeClasses][LatencyBuckets] = {};
+
+        // Largest icon side, in pixels, falling into the given size class.
+        static int sizeClassLimit(int sizeClass)
+        {
+            static const int limits[SizeClasses] = { 16, 24, 32, 48, 64, INT_MAX };
+            return limits[qBound(0, sizeClass, SizeClasses - 1)];
+        }
+    };
+
+    struct TraceEvent
+    {
+        enum { None = -1 };
+
+        const char* name     = nullptr;
+        qint64      start    = 0;       // ns, relative to the first traced span
+        qint64      duration = 0;       // ns
+        quint64     thread   = 0;
+
+        int         font     = None;
+        int         code     = None;
+        int         size     = None;    // largest side, in pixels
+        const char* cache    = nullptr; // "hit", "disk", "miss" or "uncached"
+    };
+
+    typedef std::function<void(const TraceEvent&)> TraceSink;
+
+    // Metrics of one code point of a known font, see registerGlyphMetrics().
+    struct GlyphMetrics
+    {
+        uint    code;
+        quint32 index;          // glyph index
+        quint16 advance;        // font units
+        qint16  bounds[4];      // xMin, yMin, xMax, yMax in font units, y up
+    };
+
+    // Outline of an icon compiled into the application, see registerOutlines().
+    enum OutlineCommand { MoveTo, LineTo, QuadTo, CloseSubpath, CubicTo };
+
+    struct Outline
+    {
+        uint          code;
+        quint32       index;        // glyph index in the font
+        qint16        bounds[4];    // xMin, yMin, xMax, yMax in font units, y up
+        const qint16* points;       // x, y pairs in font units, y up
+        const quint8* commands;     // OutlineCommand values
+        int           commandCount;
+    };
+
+    // An icon to paint with paintMany(), either an engine or an icon and font.
+    struct PaintItem
+    {
+        QRectF                 rect;
+        const QFontIconEngine* engine = nullptr;
+        QIcon::Mode            mode   = QIcon::Normal;
+        QIcon::State           state  = QIcon::Off;
+
+        // Used when engine is null
+        int                    icon   = InvalidIcon;
+        int                    font   = -1;               // defaultFont() if negative, or AnyFont
+        QColor                 color;                     // palette if invalid
+        qreal                  scale  = 0.9;
+    };
+
 public:
     QFontIconEngine();
     QFontIconEngine(const QFontIconEngine& other);
 
     QFontIconEngine(int icon, int font = defaultFont());
     QFontIconEngine(const QString& icon, const QString& font = {});
+    QFontIconEngine(QStringView icon, QStringView font = {});
+    QFontIconEngine(QLatin1String icon, QLatin1String font = QLatin1String());
 
     ~QFontIconEngine() override;
 
@@ -46,8 +186,12 @@ public:
 
     void setIcon(int icon, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
     void setIcon(const QString& name, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
+    void setIcon(QStringView name, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
+    void setIcon(QLatin1String name, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
     void setFont(int font, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
     void setFont(const QString& name, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
+    void setFont(QStringView name, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
+    void setFont(QLatin1String name, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
     void setScaleFactor(qreal scale, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
     void setColor(const QColor& color, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
     void setSpeed(qreal speed, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off);
@@ -64,23 +208,101 @@ public:
     void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) override;
     QPixmap pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state) override;
 
+    static void paintMany(QPainter* painter, const PaintItem* items, int count);
+    static void paintMany(QPainter* painter, const QVector<PaintItem>& items);
+
     void virtual_hook(int id, void* data) override;
 
 public:
     static bool loadFont(const QString& filename, int font = defaultFont(), const QString& name = {});
+    static QFuture<bool> loadFontAsync(const QString& filename, int font = defaultFont(), const QString& name = {});
+    static bool registerFontFile(const QString& filename, int font = defaultFont(), const QString& name = {});
+    static bool registerGlyphMetrics(int font, quint64 checksum, int unitsPerEm, const GlyphMetrics* glyphs, int count);
+    static bool registerOutlines(int font, int unitsPerEm, const Outline* outlines, int count);
+    static bool loadIconPack(const QString& filename, int font = defaultFont(), const QString& name = {});
+    static bool unloadFont(int font);
+    static void trimCaches(TrimLevel level = TrimFonts);
+    static void setCacheBudget(Cache cache, qint64 bytes);
+    static qint64 cacheBudget(Cache cache);
+    static MemoryReport memoryReport();
+    static bool setDiskCache(const QString& directory);
+    static void flushDiskCache();
     static QIcon icon(int icon, int font = defaultFont());
     static QIcon icon(const QString& icon, const QString& font = {});
+    static QIcon icon(QStringView icon, QStringView font = {});
+    static QIcon icon(QLatin1String icon, QLatin1String font = QLatin1String());
     static void setDefaultFont(int font);
     static int defaultFont();
+    static void setFontPriority(const QVector<int>& fonts);
+    static QVector<int> fontPriority();
+    static int findFont(int icon);
 
     static bool registerIconName(QString name, int code);
+    static bool registerIconName(QStringView name, int code);
     static bool registerIconName(const QMap<QString, int>& names);
+    static void registerIconNameResolver(IconNameResolver resolver, IconCodeResolver reverse = nullptr);
 
     static bool registerFontName(QString name, int font);
     static bool registerFontName(const QMap<QString, int>& names);
 
+    static Statistics statistics();
+    static void resetStatistics();
+
+    static void setTraceSink(TraceSink sink);
+    static bool startTraceFile(const QString& filename);
+    static void stopTraceFile();
+
 protected:
     QScopedPointer<QFontIconEnginePrivate> d;
 };
 
+/*
+ * Small trivially copyable font icon, painted without QIcon or any virtual
+ * call. See QFontIcon in qfonticon.cpp.
+ */
+class QFontIcon
+{
+public:
+    QFontIcon() = default;
+    QFontIcon(int icon, int font = QFontIconEngine::defaultFont(), const QColor& color = {}, qreal scale = 0.9);
+
+    static QFontIcon fromName(QStringView name, int font = QFontIconEngine::defaultFont(), const QColor& color = {}, qreal scale = 0.9);
+
+    bool isNull() const { return handle == 0; }
+
+    int icon() const { return code; }
+    int font() const { return fontId; }
+    QColor color() const { return QColor::fromRgba(rgba); }
+    qreal scaleFactor() const { return scale; }
+
+    void setColor(const QColor& color);
+    void setScaleFactor(qreal scale) { this->scale = float(scale); }
+
+    inline void paint(QPainter* painter, const QRectF& rect) const
+    {
+        if(handle)
+            paintGlyph(painter, rect);
+    }
+
+    QIcon toIcon() const;
+
+    bool operator==(const QFontIcon& o) const
+    {
+        return handle == o.handle && rgba == o.rgba && scale == o.scale;
+    }
+
+    bool operator!=(const QFontIcon& o) const { return !(*this == o); }
+
+private:
+    void paintGlyph(QPainter* painter, const QRectF& rect) const;
+
+    quint32 handle = 0;     // shared glyph, 0 when null
+    int     code   = QFontIconEngine::InvalidIcon;
+    int     fontId = 0;
+    QRgb    rgba   = 0;
+    float   scale  = 0.9f;
+};
+
+Q_DECLARE_METATYPE(QFontIcon)
+
 #endif // QFONTICON_H
@@ -0,0 +1,49 @@
+#ifndef QFONTICONATLAS_H
+#define QFONTICONATLAS_H
+
+#include <QImage>
+#include <QRect>
+#include <QColor>
+#include <QScopedPointer>
+
+class QPainter;
+class QFontIconAtlasPrivate;
+class QFontIconAtlas
+{
+public:
+    struct Location
+    {
+        int   page = -1;
+        QRect rect;     // in device pixels
+
+        bool isNull() const { return page < 0; }
+    };
+
+public:
+    explicit QFontIconAtlas(int pageSize = 512, int maxPages = 4);
+    ~QFontIconAtlas();
+
+    Location find(int icon, int font, int size, const QColor& color, qreal dpr = 1, qreal scale = 0.9);
+    bool draw(QPainter* painter, const QRectF& rect, int icon, int font, const QColor& color, qreal scale = 0.9);
+
+    const QImage& page(int index) const;
+    int pageCount() const;
+    int pageSize() const;
+
+    int maxPages() const;
+    void setMaxPages(int pages);
+
+    void evictPage(int index);
+    void clear();
+
+    qint64 memoryUsage() const;
+
+    static QFontIconAtlas* shared();
+
+private:
+    Q_DISABLE_COPY(QFontIconAtlas)
+
+    QScopedPointer<QFontIconAtlasPrivate> d;
+};
+
+#endif // QFONTICONATLAS_H
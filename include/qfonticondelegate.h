@@ -0,0 +1,37 @@
+#ifndef QFONTICONDELEGATE_H
+#define QFONTICONDELEGATE_H
+
+#include <QStyledItemDelegate>
+
+class QFontIconDelegatePrivate;
+class QFontIconDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit QFontIconDelegate(QObject* parent = nullptr);
+    ~QFontIconDelegate() override;
+
+    int iconRole() const;
+    void setIconRole(int role);
+
+    int colorRole() const;
+    void setColorRole(int role);
+
+    int font() const;
+    void setFont(int font);
+
+    QSize iconSize() const;
+    void setIconSize(const QSize& size);
+
+    bool atlasEnabled() const;
+    void setAtlasEnabled(bool en);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+protected:
+    QScopedPointer<QFontIconDelegatePrivate> d;
+};
+
+#endif // QFONTICONDELEGATE_H
@@ -0,0 +1,41 @@
+#ifndef QFONTICONMODEL_H
+#define QFONTICONMODEL_H
+
+#include <QAbstractListModel>
+
+class QFontIconModelPrivate;
+class QFontIconModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles
+    {
+        CodeRole = Qt::UserRole,    // int, as QFontIconDelegate expects
+        NameRole,                   // QString, empty if unnamed
+        IconRole                    // QFontIcon
+    };
+
+public:
+    explicit QFontIconModel(QObject* parent = nullptr);
+    explicit QFontIconModel(int font, QObject* parent = nullptr);
+    ~QFontIconModel() override;
+
+    int font() const;
+    void setFont(int font);
+
+    QString filter() const;
+    void setFilter(const QString& filter);
+
+    int code(int row) const;
+    int row(int code) const;
+
+    int rowCount(const QModelIndex& parent = {}) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+protected:
+    QScopedPointer<QFontIconModelPrivate> d;
+};
+
+#endif // QFONTICONMODEL_H
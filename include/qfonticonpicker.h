@@ -0,0 +1,36 @@
+#ifndef QFONTICONPICKER_H
+#define QFONTICONPICKER_H
+
+#include <QWidget>
+
+class QFontIconModel;
+class QFontIconPickerPrivate;
+class QFontIconPicker : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit QFontIconPicker(QWidget* parent = nullptr);
+    explicit QFontIconPicker(int font, QWidget* parent = nullptr);
+    ~QFontIconPicker() override;
+
+    int iconFont() const;
+    void setIconFont(int font);
+
+    int currentIcon() const;
+    void setCurrentIcon(int icon);
+
+    QSize iconSize() const;
+    void setIconSize(const QSize& size);
+
+    QFontIconModel* model() const;
+
+signals:
+    void currentIconChanged(int icon);
+    void iconActivated(int icon);
+
+protected:
+    QScopedPointer<QFontIconPickerPrivate> d;
+};
+
+#endif // QFONTICONPICKER_H
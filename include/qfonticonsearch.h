@@ -0,0 +1,37 @@
+#ifndef QFONTICONSEARCH_H
+#define QFONTICONSEARCH_H
+
+#include <QString>
+#include <QStringView>
+#include <QVector>
+#include <QScopedPointer>
+
+class QFontIconSearchPrivate;
+class QFontIconSearch
+{
+public:
+    struct Match
+    {
+        int     code;
+        QString name;
+        int     score;
+    };
+
+public:
+    QFontIconSearch();
+    ~QFontIconSearch();
+
+    void rebuild();
+    int size() const;
+
+    QVector<Match> search(QStringView query, int limit = -1);
+
+    static void registerSearchTerms(int code, QLatin1String name, QLatin1String terms);
+
+private:
+    Q_DISABLE_COPY(QFontIconSearch)
+
+    QScopedPointer<QFontIconSearchPrivate> d;
+};
+
+#endif // QFONTICONSEARCH_H
@@ -1,5 +1,5 @@
-import requests
 import json
+import struct
 import sys
 import os
 
@@ -129,18 +129,22 @@ cpp_keywords = [
     'linux'
 ]
 
-def main():
+versions = [
+    ('v5', 'https://raw.githubusercontent.com/FortAwesome/Font-Awesome/5.x/metadata/icons.json'),
+    ('v6', 'https://raw.githubusercontent.com/FortAwesome/Font-Awesome/6.x/metadata/icons.json'),
+]
 
-    json_file = {}
+def load_icons(source):
 
-    if len(sys.argv) == 2:
-        with open(sys.argv[1], 'r') as data:
-            json_file = json.load(data)
+    if source.startswith('https://'):
+        import requests
+        json_file = requests.get(source).json()
     else:
-        # === Extract icons data directly from the source
-        json_file = requests.get("https://raw.githubusercontent.com/FortAwesome/Font-Awesome/6.x/metadata/icons.json").json()
+        with open(source, 'r') as data:
+            json_file = json.load(data)
 
     icons = []
+    aliases = {}
     max_len = 0
 
     for key, value in json_file.items():
@@ -157,11 +161,374 @@ def main():
         # get unicode
         code = '0x{}'.format(value["unicode"])
 
+        # aliases, only in the full metadata
+        aliases[key] = value.get('aliases', {}).get('names', [])
+
         # save
         icons.append((key, name, code))
 
     icons.sort(key=lambda e: e[0])
 
+    return icons, aliases, max_len
+
+def alias_icons(icons, aliases):
+    # Aliases resolve to the enum value of their icon, but never clash with
+    # the name of another icon.
+    keys = set(key for key, name, code in icons)
+    rows = []
+    for key, name, code in icons:
+        for alias in aliases[key]:
+            if alias not in keys:
+                keys.add(alias)
+                rows.append((alias, name, code))
+    return rows
+
+class TrueTypeFont:
+    # Just enough of a TrueType font reader for the tables written here.
+
+    def __init__(self, path):
+        self.path = path
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        self.tables = {}
+        for i in range(self.u16(4)):
+            record = 12 + i * 16
+            self.tables[self.data[record:record + 4].decode('latin-1')] = self.u32(record + 8)
+
+        for tag in ('cmap', 'head', 'hhea', 'hmtx', 'maxp', 'loca', 'glyf'):
+            if tag not in self.tables:
+                sys.exit('{}: no {} table, only TrueType outlines are supported'.format(path, tag))
+
+        head = self.tables['head']
+        self.units_per_em = self.u16(head + 18)
+        self.long_loca    = self.s16(head + 50) == 1
+        self.num_glyphs   = self.u16(self.tables['maxp'] + 4)
+        self.num_metrics  = self.u16(self.tables['hhea'] + 34)
+
+        # Same checksum as QFontIconEnginePrivate::fontChecksum()
+        self.checksum = (self.u32(head + 8) << 32) | len(self.data)
+
+    def u16(self, o): return struct.unpack_from('>H', self.data, o)[0]
+    def s16(self, o): return struct.unpack_from('>h', self.data, o)[0]
+    def u32(self, o): return struct.unpack_from('>I', self.data, o)[0]
+
+    def advance(self, glyph):
+        return self.u16(self.tables['hmtx'] + min(glyph, self.num_metrics - 1) * 4)
+
+    def glyph_range(self, glyph):
+        loca = self.tables['loca']
+        if self.long_loca:
+            return self.u32(loca + glyph * 4), self.u32(loca + glyph * 4 + 4)
+        return self.u16(loca + glyph * 2) * 2, self.u16(loca + glyph * 2 + 2) * 2
+
+    def bounds(self, glyph):
+        start, end = self.glyph_range(glyph)
+        if start == end:
+            return (0, 0, 0, 0)
+        o = self.tables['glyf'] + start
+        return (self.s16(o + 2), self.s16(o + 4), self.s16(o + 6), self.s16(o + 8))
+
+    def cmap(self):
+        # Unicode subtable, full repertoire first, like forEachCodePoint()
+        cmap = self.tables['cmap']
+        best, best_rank = 0, 0
+        for i in range(self.u16(cmap + 2)):
+            record = cmap + 4 + i * 8
+            platform, encoding, offset = self.u16(record), self.u16(record + 2), cmap + self.u32(record + 4)
+            unicode = platform == 0 or (platform == 3 and encoding in (1, 10))
+            fmt = self.u16(offset)
+            rank = 0 if not unicode else 2 if fmt == 12 else 1 if fmt == 4 else 0
+            if rank > best_rank:
+                best, best_rank = offset, rank
+
+        codes = {}
+        if best_rank == 2:
+            for i in range(self.u32(best + 12)):
+                group = best + 16 + i * 12
+                start, end, glyph = self.u32(group), min(self.u32(group + 4), 0x10FFFF), self.u32(group + 8)
+                for c in range(start, end + 1):
+                    if glyph + c - start:
+                        codes.setdefault(c, glyph + c - start)
+        elif best_rank == 1:
+            segments = self.u16(best + 6) // 2
+            ends   = best + 14
+            starts = ends + segments * 2 + 2
+            deltas = starts + segments * 2
+            ranges = deltas + segments * 2
+            for i in range(segments):
+                end, start = self.u16(ends + i * 2), self.u16(starts + i * 2)
+                delta, rng = self.u16(deltas + i * 2), self.u16(ranges + i * 2)
+                for c in range(start, min(end, 0xFFFE) + 1):
+                    if rng == 0:
+                        glyph = (c + delta) & 0xFFFF
+                    else:
+                        glyph = self.u16(ranges + i * 2 + rng + (c - start) * 2)
+                        if glyph:
+                            glyph = (glyph + delta) & 0xFFFF
+                    if glyph:
+                        codes.setdefault(c, glyph)
+        else:
+            sys.exit('{}: no Unicode cmap'.format(self.path))
+
+        return {c: g for c, g in codes.items() if g < self.num_glyphs}
+
+    def glyph_names(self):
+        # Glyph index by name, from a version 2 post table. Font Awesome names
+        # its glyphs after its icons.
+        names = {}
+        post = self.tables.get('post')
+        if post is None or self.u32(post) != 0x00020000:
+            return names
+
+        count = self.u16(post + 32)
+        indexes = [self.u16(post + 34 + i * 2) for i in range(count)]
+
+        strings = []
+        o = post + 34 + count * 2
+        while len(strings) < max([i - 257 for i in indexes] + [0]) + 1 and o < len(self.data):
+            length = self.data[o]
+            strings.append(self.data[o + 1:o + 1 + length].decode('latin-1'))
+            o += 1 + length
+
+        for glyph, index in enumerate(indexes):
+            if index >= 258 and index - 258 < len(strings):
+                names.setdefault(strings[index - 258], glyph)
+        return names
+
+    def contours(self, glyph, depth=0):
+        # Contours as lists of (x, y, on curve) points, in font units, y up.
+        start, end = self.glyph_range(glyph)
+        if start == end or depth > 8:
+            return []
+
+        o = self.tables['glyf'] + start
+        num_contours = self.s16(o)
+        o += 10
+
+        if num_contours < 0:
+            return self.composite_contours(o, depth)
+
+        ends = [self.u16(o + i * 2) for i in range(num_contours)]
+        o += num_contours * 2
+        o += 2 + self.u16(o)    # instructions
+
+        count = ends[-1] + 1 if ends else 0
+        flags = []
+        while len(flags) < count:
+            flag = self.data[o]
+            o += 1
+            repeat = 0
+            if flag & 0x08:
+                repeat = self.data[o]
+                o += 1
+            flags += [flag] * (repeat + 1)
+        flags = flags[:count]
+
+        def coordinates(o, short, same):
+            values, value = [], 0
+            for flag in flags:
+                if flag & short:
+                    delta = self.data[o]
+                    o += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += self.s16(o)
+                    o += 2
+                values.append(value)
+            return values, o
+
+        xs, o = coordinates(o, 0x02, 0x10)
+        ys, o = coordinates(o, 0x04, 0x20)
+
+        contours, first = [], 0
+        for last in ends:
+            contours.append([(xs[i], ys[i], bool(flags[i] & 0x01)) for i in range(first, last + 1)])
+            first = last + 1
+        return contours
+
+    def composite_contours(self, o, depth):
+        contours = []
+        while True:
+            flags, glyph = self.u16(o), self.u16(o + 2)
+            o += 4
+            if flags & 0x0001:
+                dx, dy = self.s16(o), self.s16(o + 2)
+                o += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, o)
+                o += 2
+            if not flags & 0x0002:
+                dx, dy = 0, 0   # point matching, not used by icon fonts
+
+            def f2dot14(o): return self.s16(o) / 16384.0
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = f2dot14(o)
+                o += 2
+            elif flags & 0x0040:
+                a, d = f2dot14(o), f2dot14(o + 2)
+                o += 4
+            elif flags & 0x0080:
+                a, b, c, d = f2dot14(o), f2dot14(o + 2), f2dot14(o + 4), f2dot14(o + 6)
+                o += 8
+
+            for contour in self.contours(glyph, depth + 1):
+                contours.append([(x * a + y * c + dx, x * b + y * d + dy, on) for x, y, on in contour])
+
+            if not flags & 0x0020:
+                return contours
+
+def read_font(path):
+    # Glyph index, advance and bounds of every code point of a TrueType font,
+    # read from its cmap, hmtx and glyf tables.
+    font = TrueTypeFont(path)
+    glyphs = [(c, g, font.advance(g), font.bounds(g)) for c, g in sorted(font.cmap().items())]
+    return font.checksum, font.units_per_em, glyphs
+
+def outline_commands(contours):
+    # QFontIconEngine::OutlineCommand values and their points, implied on
+    # curve points made explicit.
+    MOVE, LINE, QUAD, CLOSE = range(4)
+
+    def mid(a, b):
+        return ((a[0] + b[0]) / 2.0, (a[1] + b[1]) / 2.0)
+
+    commands, points = [], []
+    def emit(command, *pts):
+        commands.append(command)
+        points.extend((int(round(x)), int(round(y))) for x, y in pts)
+
+    for contour in contours:
+        if not contour:
+            continue
+
+        start = next((i for i, p in enumerate(contour) if p[2]), None)
+        if start is None:
+            first = mid(contour[-1][:2], contour[0][:2])
+            rest  = contour
+        else:
+            first = contour[start][:2]
+            rest  = contour[start + 1:] + contour[:start]
+
+        emit(MOVE, first)
+        control = None
+        for x, y, on in rest:
+            if on:
+                if control:
+                    emit(QUAD, control, (x, y))
+                    control = None
+                else:
+                    emit(LINE, (x, y))
+            else:
+                if control:
+                    emit(QUAD, control, mid(control, (x, y)))
+                control = (x, y)
+
+        if control:
+            emit(QUAD, control, first)
+        emit(CLOSE)
+
+    return commands, points
+
+def write_embedded(font_file, style, output, icons):
+    # Outlines of the given icons, by glyph name or code point, as constexpr
+    # arrays painted without loading the font.
+    font  = TrueTypeFont(font_file)
+    cmap  = font.cmap()
+    names = font.glyph_names()
+    glyph_codes = {}
+    for code, glyph in sorted(cmap.items()):
+        glyph_codes.setdefault(glyph, code)
+
+    selected = []
+    for icon in icons:
+        if icon.startswith('0x'):
+            code = int(icon, 16)
+            glyph = cmap.get(code)
+        else:
+            glyph = names.get(icon)
+            code = glyph_codes.get(glyph)
+        if glyph is None or code is None:
+            sys.exit('{}: no icon {}'.format(font_file, icon))
+        if (code, glyph) not in selected:
+            selected.append((code, glyph))
+    selected.sort()
+
+    base = os.path.basename(output)
+    with open(output + '.h', 'w') as file:
+        guard = base.upper() + '_H'
+        file.write(('#ifndef {guard}\n'
+                    '#define {guard}\n\n'
+
+                    '#include <awesome.h>\n\n'
+
+                    '/**\n'
+                    ' * This file has been automatically generated.\n'
+                    ' */\n\n'
+
+                    'namespace fa {{\n\n'
+
+                    '// Registers {count} {style} icons drawn without loading {font}, as\n'
+                    '// icons of the given font id.\n'
+                    'bool register_{base}(int font = {style});\n\n'
+
+                    '}}\n\n'
+
+                    '#endif // {guard}\n').format(guard=guard, count=len(selected), style=style,
+                                                  font=os.path.basename(font_file), base=base))
+
+    with open(output + '.cpp', 'w') as file:
+        file.write(('#include "{base}.h"\n\n'
+
+                    '#include <awesome.h>\n'
+                    '#include <qfonticon.h>\n\n'
+
+                    '/**\n'
+                    ' * This file has been automatically generated from {font}.\n'
+                    ' */\n\n'
+
+                    'namespace fa {{\n\n'
+
+                    'namespace {{\n\n').format(base=base, font=os.path.basename(font_file)))
+
+        entries = []
+        for code, glyph in selected:
+            commands, points = outline_commands(font.contours(glyph))
+            if not commands:
+                entries.append((code, glyph, 'nullptr', 'nullptr', 0))
+                continue
+
+            file.write('constexpr qint16 points_{:04x}[] = {{\n'.format(code))
+            for i in range(0, len(points), 8):
+                file.write('    ' + ' '.join('{}, {},'.format(x, y) for x, y in points[i:i + 8]) + '\n')
+            file.write('};\n\n')
+
+            file.write('constexpr quint8 commands_{:04x}[] = {{\n'.format(code))
+            for i in range(0, len(commands), 24):
+                file.write('    ' + ' '.join('{},'.format(c) for c in commands[i:i + 24]) + '\n')
+            file.write('};\n\n')
+
+            entries.append((code, glyph, 'points_{:04x}'.format(code), 'commands_{:04x}'.format(code), len(commands)))
+
+        file.write('constexpr QFontIconEngine::Outline outlines[] = {\n')
+        for code, glyph, points, commands, count in entries:
+            x_min, y_min, x_max, y_max = font.bounds(glyph)
+            file.write('    {{ 0x{:04x}, {}, {{ {}, {}, {}, {} }}, {}, {}, {} }},\n'.format(
+                code, glyph, x_min, y_min, x_max, y_max, points, commands, count))
+        file.write('};\n\n')
+
+        file.write(('}}\n\n'
+
+                    'bool register_{base}(int font)\n'
+                    '{{\n'
+                    '    return QFontIconEngine::registerOutlines(font, {units_per_em}, outlines,\n'
+                    '                                             int(sizeof(outlines) / sizeof(outlines[0])));\n'
+                    '}}\n\n'
+
+                    '}}\n').format(base=base, units_per_em=font.units_per_em))
+
+def write_header(tables):
     with open('awesome.h', 'w') as file:
         file.write(('#ifndef AWESOME_H\n'
                     '#define AWESOME_H\n\n'
@@ -172,56 +539,317 @@ def main():
 
                     'namespace fa {\n\n'
 
-                    'enum fonts { solid, regular, light, duotone, brands };\n\n'
+                    'enum fonts { solid, regular, light, duotone, brands };\n\n'))
+
+        for version, icons, aliases, max_len in tables:
+            file.write('namespace {} {{\n\n'.format(version))
+            file.write('enum icons {\n')
 
-                    'enum icons {\n'))
+            for key, name, code in icons:
+                line = '    {name:<{len}} = {code},\n'.format(name=name, code=code, len=max_len)
+                file.write(line)
 
-        for key, name, code in icons:
-            line = '    {name:<{len}} = {code},\n'.format(name=name, code=code, len=max_len)
-            file.write(line)
+            file.write(('};\n\n'
 
-        file.write(('};\n\n'
+                        '// When lazy, no name is copied: a resolver querying the static tables of\n'
+                        '// awesome_names.h is installed instead.\n'
+                        'bool register_awesome_names(bool lazy = false);\n\n'
+                        '}\n\n'))
+
+        file.write(('// Registers the glyph metrics of the fonts this file was generated\n'
+                    '// against, see QFontIconEngine::registerGlyphMetrics().\n'
+                    'bool register_awesome_metrics();\n\n'
 
-                    'bool register_awesome_names();\n'
                     '}\n\n'
 
                     '#endif // AWESOME_H\n'))
 
+def write_source(tables):
     with open('awesome.cpp', 'w') as file:
         file.write(('#include <awesome.h>\n'
+                    '#include <awesome_names.h>\n'
                     '#include <qfonticon.h>\n\n'
 
+                    '#include <algorithm>\n\n'
+
                     '/**\n'
                     ' * This file has been automatically generated.\n'
                     ' */\n\n'
 
                     'namespace fa {\n\n'
 
-                    'bool register_awesome_names()\n'
+                    'namespace detail {\n\n'
+
+                    'static int resolve(const name_entry* table, int count, QStringView name)\n'
                     '{\n'
-                    '    bool r = true;\n\n'
-
-                    '    r &= QFontIconEngine::registerFontName({\n'
-                    '        { QStringLiteral("solid"),   solid   },\n'
-                    '        { QStringLiteral("regular"), regular },\n'
-                    '        { QStringLiteral("light"),   light   },\n'
-                    '        { QStringLiteral("duotone"), duotone },\n'
-                    '        { QStringLiteral("brands"),  brands  }\n'
+                    '    auto end = table + count;\n'
+                    '    auto it  = std::lower_bound(table, end, name, [](const name_entry& e, QStringView n)\n'
+                    '    {\n'
+                    '        return n.compare(QLatin1String(e.name)) > 0;\n'
                     '    });\n\n'
 
-                    '    r &= QFontIconEngine::registerIconName({\n'))
+                    '    if(it == end || name.compare(QLatin1String(it->name)) != 0)\n'
+                    '        return QFontIconEngine::InvalidIcon;\n\n'
+
+                    '    return it->code;\n'
+                    '}\n\n'
+
+                    '}\n\n'))
+
+        for version, icons, aliases, max_len in tables:
+            file.write(('namespace {} {{\n\n'
+
+                        'static int resolve_icon_code(QStringView name)\n'
+                        '{{\n'
+                        '    return detail::resolve(icon_names, icon_names_count, name);\n'
+                        '}}\n\n'
+
+                        'static QString resolve_icon_name(int code)\n'
+                        '{{\n'
+                        '    return QLatin1String(icon_name(code));\n'
+                        '}}\n\n'
+
+                        'bool register_awesome_names(bool lazy)\n'
+                        '{{\n'
+                        '    bool r = true;\n\n'
+
+                        '    r &= QFontIconEngine::registerFontName({{\n'
+                        '        {{ QStringLiteral("solid"),   solid   }},\n'
+                        '        {{ QStringLiteral("regular"), regular }},\n'
+                        '        {{ QStringLiteral("light"),   light   }},\n'
+                        '        {{ QStringLiteral("duotone"), duotone }},\n'
+                        '        {{ QStringLiteral("brands"),  brands  }}\n'
+                        '    }});\n\n'
+
+                        '    if(lazy)\n'
+                        '    {{\n'
+                        '        QFontIconEngine::registerIconNameResolver(resolve_icon_code, resolve_icon_name);\n'
+                        '        return r;\n'
+                        '    }}\n\n'
+
+                        '    r &= QFontIconEngine::registerIconName({{\n').format(version))
+
+            for key, name, code in sorted(icons + alias_icons(icons, aliases), key=lambda e: e[0]):
+                string = 'QStringLiteral("{}")'.format(key)
+                pair   = '{string:<{len1}}, {name:<{len2}}'.format(string=string, name=name, len1=max_len+18, len2=max_len)
+                line   = '        { ' + pair + ' },\n'
+                file.write(line)
+
+            file.write(('    });\n\n'
+
+                        '    return r;\n'
+                        '}\n\n'
+                        '}\n\n'))
+
+        file.write('}\n')
+
+def write_names(tables):
+    with open('awesome_names.h', 'w') as file:
+        file.write(('#ifndef AWESOME_NAMES_H\n'
+                    '#define AWESOME_NAMES_H\n\n'
+
+                    '#include <awesome.h>\n\n'
+
+                    '/**\n'
+                    ' * This file has been automatically generated.\n'
+                    ' */\n\n'
+
+                    'namespace fa {\n\n'
+
+                    'namespace detail {\n\n'
+
+                    'struct name_entry\n'
+                    '{\n'
+                    '    const char* name;\n'
+                    '    int         code;\n'
+                    '};\n\n'
+
+                    '// Deliberately not constexpr: reaching it while evaluating a constant\n'
+                    '// expression is what turns an unknown icon name into a compile error.\n'
+                    '// At runtime it yields QFontIconEngine::InvalidIcon.\n'
+                    'inline int unknown_icon_name() { return -1; }\n\n'
+
+                    'constexpr int compare(const char* a, const char* b)\n'
+                    '{\n'
+                    '    return *a != *b ? (*a < *b ? -1 : 1)\n'
+                    '         : *a == 0  ? 0\n'
+                    '                    : compare(a + 1, b + 1);\n'
+                    '}\n\n'
+
+                    'constexpr int find(const name_entry* table, int first, int last, const char* name);\n\n'
+
+                    'constexpr int find_step(const name_entry* table, int first, int last, int mid, int cmp, const char* name)\n'
+                    '{\n'
+                    '    return cmp == 0 ? table[mid].code\n'
+                    '         : cmp < 0  ? find(table, first, mid, name)\n'
+                    '                    : find(table, mid + 1, last, name);\n'
+                    '}\n\n'
+
+                    'constexpr int find(const name_entry* table, int first, int last, const char* name)\n'
+                    '{\n'
+                    '    return first >= last ? unknown_icon_name()\n'
+                    '         : find_step(table, first, last, first + (last - first) / 2,\n'
+                    '                     compare(name, table[first + (last - first) / 2].name), name);\n'
+                    '}\n\n'
+
+                    'constexpr const char* find_name(const name_entry* table, int first, int last, int mid, int code)\n'
+                    '{\n'
+                    '    return first >= last          ? nullptr\n'
+                    '         : table[mid].code == code ? table[mid].name\n'
+                    '         : table[mid].code > code  ? find_name(table, first, mid, first + (mid - first) / 2, code)\n'
+                    '                                   : find_name(table, mid + 1, last, mid + 1 + (last - mid - 1) / 2, code);\n'
+                    '}\n\n'
+
+                    '}\n\n'))
 
-        for key, name, code in icons:
-            string = 'QStringLiteral("{}")'.format(key)
-            pair   = '{string:<{len1}}, {name:<{len2}}'.format(string=string, name=name, len1=max_len+18, len2=max_len)
-            line   = '        { ' + pair + ' },\n'
-            file.write(line)
+        for version, icons, aliases, max_len in tables:
+            file.write(('namespace {} {{\n\n'
 
-        file.write(('    });\n\n'
+                        'constexpr detail::name_entry icon_names[] = {{\n').format(version))
+
+            # Binary searched by icon_code(), must stay sorted the way strcmp would.
+            for key, name, code in sorted(icons + alias_icons(icons, aliases), key=lambda e: e[0].encode()):
+                string = '"{}"'.format(key)
+                line   = '    {{ {string:<{len1}}, {name:<{len2}} }},\n'.format(string=string, name=name, len1=max_len+2, len2=max_len)
+                file.write(line)
+
+            # An icon of this version for the documentation
+            known = dict((key, name) for key, name, code in icons)
+            example = next(((key, known[key]) for key in ('beer', 'beer-mug-empty') if key in known),
+                           (icons[0][0], icons[0][1]))
+
+            file.write(('}};\n\n'
+
+                        'constexpr int icon_names_count = sizeof(icon_names) / sizeof(icon_names[0]);\n\n'
+
+                        '/**\n'
+                        ' * Returns the code point of the icon called @a name.\n'
+                        ' *\n'
+                        ' * Used in a constant expression, the lookup happens at compile time and an\n'
+                        ' * unknown name fails to compile:\n'
+                        ' * @code\n'
+                        ' * constexpr int {2} = fa::{0}::icon_code("{1}");\n'
+                        ' * @endcode\n'
+                        ' */\n'
+                        'constexpr int icon_code(const char* name)\n'
+                        '{{\n'
+                        '    return detail::find(icon_names, 0, icon_names_count, name);\n'
+                        '}}\n\n').format(version, *example))
+
+            file.write('constexpr detail::name_entry icon_codes[] = {\n')
+
+            # Binary searched by icon_name(), sorted by code point. Should two
+            # names share a code point, the first one in name order wins.
+            seen = set()
+            for key, name, code in sorted(icons, key=lambda e: (int(e[2], 16), e[0].encode())):
+                if code in seen:
+                    continue
+                seen.add(code)
+                string = '"{}"'.format(key)
+                line   = '    {{ {string:<{len1}}, {name:<{len2}} }},\n'.format(string=string, name=name, len1=max_len+2, len2=max_len)
+                file.write(line)
+
+            file.write(('}};\n\n'
+
+                        'constexpr int icon_codes_count = sizeof(icon_codes) / sizeof(icon_codes[0]);\n\n'
+
+                        '/**\n'
+                        ' * Returns the name of the icon with the code point @a code, or nullptr if\n'
+                        ' * there is none.\n'
+                        ' */\n'
+                        'constexpr const char* icon_name(int code)\n'
+                        '{{\n'
+                        '    return detail::find_name(icon_codes, 0, icon_codes_count, icon_codes_count / 2, code);\n'
+                        '}}\n\n'
+
+                        '}}\n\n').format(version))
+
+        file.write(('}\n\n'
+
+                    '#endif // AWESOME_NAMES_H\n'))
+
+def write_metrics(fonts):
+    with open('awesome_metrics.cpp', 'w') as file:
+        file.write(('#include <awesome.h>\n'
+                    '#include <qfonticon.h>\n\n'
+
+                    '/**\n'
+                    ' * This file has been automatically generated.\n'
+                    ' */\n\n'
+
+                    'namespace fa {\n\n'))
+
+        for style, path in fonts:
+            checksum, units_per_em, glyphs = read_font(path)
+
+            file.write(('// {path}\n'
+                        'static const QFontIconEngine::GlyphMetrics {style}_metrics[] = {{\n').format(path=os.path.basename(path), style=style))
+
+            for code, glyph, advance, (x_min, y_min, x_max, y_max) in glyphs:
+                file.write('    {{ 0x{:04x}, {:4}, {:4}, {{ {:5}, {:5}, {:5}, {:5} }} }},\n'.format(code, glyph, advance, x_min, y_min, x_max, y_max))
+
+            file.write(('}};\n\n'
+
+                        'static const quint64 {style}_checksum = 0x{checksum:016x}ull;\n'
+                        'static const int {style}_units_per_em = {units_per_em};\n\n').format(style=style, checksum=checksum, units_per_em=units_per_em))
+
+        file.write(('bool register_awesome_metrics()\n'
+                    '{\n'
+                    '    bool r = true;\n\n'))
+
+        for style, path in fonts:
+            file.write(('    r &= QFontIconEngine::registerGlyphMetrics({0}, {0}_checksum, {0}_units_per_em, {0}_metrics,\n'
+                        '                                               int(sizeof({0}_metrics) / sizeof({0}_metrics[0])));\n').format(style))
+
+        file.write(('\n'
+                    '    return r;\n'
+                    '}\n\n'
 
-                    '    return r;'
-                    '}\n'
                     '}\n'))
-        
+
+def main():
+
+    # "--embed <file.ttf> <style> <output> <icon>..." only writes output.h and
+    # output.cpp, with the outlines of the icons named after their glyph or
+    # given as 0x code points. "@file" arguments list icons, one per line.
+    if len(sys.argv) > 1 and sys.argv[1] == '--embed':
+        if len(sys.argv) < 6:
+            sys.exit('usage: {} --embed <file.ttf> <style> <output> <icon>...'.format(sys.argv[0]))
+        icons = []
+        for arg in sys.argv[5:]:
+            if arg.startswith('@'):
+                with open(arg[1:]) as f:
+                    icons += [line.strip() for line in f if line.strip()]
+            else:
+                icons.append(arg)
+        write_embedded(sys.argv[2], sys.argv[3], sys.argv[4], icons)
+        return
+
+    # "--font <style>=<file.ttf>" also emits the glyph metrics of that font,
+    # e.g. --font solid=example/fonts/fa-solid-900.ttf. Without it
+    # awesome_metrics.cpp is left alone.
+    args = sys.argv[1:]
+    fonts = []
+    while '--font' in args:
+        i = args.index('--font')
+        style, path = args[i + 1].split('=', 1)
+        fonts.append((style, path))
+        del args[i:i + 2]
+
+    # Either pass one icons.json per version, in order, or let the script
+    # fetch them from the Font Awesome repository.
+    sources = args if args else [url for version, url in versions]
+
+    tables = []
+    for (version, url), source in zip(versions, sources):
+        icons, aliases, max_len = load_icons(source)
+        tables.append((version, icons, aliases, max_len))
+
+    write_header(tables)
+    write_source(tables)
+    write_names(tables)
+    if fonts:
+        write_metrics(fonts)
+
 if __name__ == '__main__':
     main()
@@ -0,0 +1,306 @@
+import argparse
+import re
+import struct
+import sys
+import os
+
+# Run from build systems, keep the source tree clean
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from generate_fa import TrueTypeFont
+
+# Subsets TrueType icon fonts down to the icons some sources use:
+#
+#   python subset_fa.py --font fa-solid-900.ttf subset/fa-solid-900.ttf \
+#                       --keep spinner 0xf013 --sources main.cpp window.cpp
+#
+# Icons are found as fa::v5:: and fa::v6:: enum values, and as string
+# literals naming an icon, e.g. QFontIconEngine::icon("beer") or
+# fa::v6::icon_code("beer-mug-empty"). Icons only chosen at run time are
+# given with --keep, by name or 0x code point. "@file" arguments list
+# arguments, one per line.
+#
+# Glyphs are renumbered, .notdef first then in code point order. Tables
+# indexed by glyph that icons do not need (kern, GSUB, GPOS, hdmx...) are
+# dropped.
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+kept_tables = ('OS/2', 'cmap', 'cvt ', 'fpgm', 'gasp', 'glyf', 'head', 'hhea',
+               'hmtx', 'loca', 'maxp', 'name', 'post', 'prep')
+
+def read_enums(header):
+    # Code point of every enum value, per version
+    enums, version = {}, None
+    with open(header) as f:
+        for line in f:
+            m = re.match(r'namespace (v\d+) \{', line)
+            if m:
+                version = m.group(1)
+                enums[version] = {}
+                continue
+            m = re.match(r'\s+(\w+)\s*=\s*(0x[0-9a-fA-F]+),', line)
+            if m and version:
+                enums[version][m.group(1)] = int(m.group(2), 16)
+    return enums
+
+def read_names(header, enums):
+    # Code point of every icon name and alias, all versions together
+    names, version = {}, None
+    with open(header) as f:
+        for line in f:
+            m = re.match(r'namespace (v\d+) \{', line)
+            if m:
+                version = m.group(1)
+                continue
+            m = re.match(r'\s+\{ "([^"]+)"\s*,\s*(\w+)\s*\}', line)
+            if m and version in enums and m.group(2) in enums[version]:
+                names.setdefault(m.group(1), set()).add(enums[version][m.group(2)])
+    return names
+
+def scan(sources, enums, names):
+    codes = set()
+    reference = re.compile(r'\bfa\s*::\s*(?:(v\d+)\s*::\s*)?(\w+)')
+    literal   = re.compile(r'"([A-Za-z0-9-]+)"')
+
+    for source in sources:
+        with open(source, encoding='utf-8', errors='replace') as f:
+            text = f.read()
+
+        for version, name in reference.findall(text):
+            for v in ([version] if version else sorted(enums, reverse=True)):
+                if name in enums.get(v, {}):
+                    codes.add(enums[v][name])
+                    break
+
+        for name in literal.findall(text):
+            codes |= names.get(name, set())
+
+    return codes
+
+def checksum(data):
+    data += b'\0' * (-len(data) % 4)
+    return sum(struct.unpack('>{}I'.format(len(data) // 4), data)) & 0xFFFFFFFF
+
+def components(data):
+    # Offsets of the glyph indexes of the components of a composite glyph
+    offsets, o = [], 10
+    while True:
+        flags = struct.unpack_from('>H', data, o)[0]
+        offsets.append(o + 2)
+        o += 4 + (4 if flags & 0x0001 else 2)
+        if flags & 0x0008:
+            o += 2
+        elif flags & 0x0040:
+            o += 4
+        elif flags & 0x0080:
+            o += 8
+        if not flags & 0x0020:
+            return offsets
+
+def glyph_data(font, glyph):
+    start, end = font.glyph_range(glyph)
+    return font.data[font.tables['glyf'] + start:font.tables['glyf'] + end]
+
+def cmap_table(mapping):
+    # Format 4 for the BMP, plus format 12 when some code points are beyond.
+    # One segment per run of consecutive code points and glyphs.
+    def runs(codes):
+        result = []
+        for code in codes:
+            if result and code == result[-1][1] + 1 and mapping[code] == mapping[result[-1][1]] + 1:
+                result[-1][1] = code
+            else:
+                result.append([code, code])
+        return result
+
+    bmp = runs(sorted(c for c in mapping if c < 0xFFFF)) + [[0xFFFF, 0xFFFF]]
+    count = len(bmp)
+    power = 1 << (count.bit_length() - 1)
+    format4 = struct.pack('>HHHHHHH', 4, 16 + count * 8, 0, count * 2, power * 2,
+                          power.bit_length() - 1, (count - power) * 2)
+    format4 += struct.pack('>{}H'.format(count), *[end for start, end in bmp])
+    format4 += struct.pack('>H', 0)
+    format4 += struct.pack('>{}H'.format(count), *[start for start, end in bmp])
+    format4 += struct.pack('>{}H'.format(count), *[(mapping.get(start, 0) - start) & 0xFFFF
+                                                   for start, end in bmp[:-1]] + [1])
+    format4 += struct.pack('>{}H'.format(count), *[0] * count)
+
+    subtables = [((0, 3), format4), ((3, 1), format4)]
+
+    if max(mapping, default=0) > 0xFFFF:
+        groups = runs(sorted(mapping))
+        format12 = struct.pack('>HHIII', 12, 0, 16 + len(groups) * 12, 0, len(groups))
+        for start, end in groups:
+            format12 += struct.pack('>III', start, end, mapping[start])
+        subtables = [((0, 4), format12), ((3, 1), format4), ((3, 10), format12)]
+
+    table = struct.pack('>HH', 0, len(subtables))
+    offset = 4 + len(subtables) * 8
+    offsets = {}
+    for (platform, encoding), data in subtables:
+        if id(data) not in offsets:
+            offsets[id(data)] = offset
+            offset += len(data)
+        table += struct.pack('>HHI', platform, encoding, offsets[id(data)])
+    for key, data in subtables:
+        if offsets.pop(id(data), None) is not None:
+            table += data
+    return table
+
+def post_table(font, glyphs):
+    # Version 2 keeps the glyph names, --embed finds icons by them
+    post = font.tables.get('post')
+    if post is None:
+        return None
+    if font.u32(post) != 0x00020000:
+        return struct.pack('>I', 0x00030000) + font.data[post + 4:post + 32]
+
+    count = font.u16(post + 32)
+    indexes = [font.u16(post + 34 + i * 2) for i in range(count)]
+    strings, o = [], post + 34 + count * 2
+    while len(strings) < max([i - 257 for i in indexes] + [0]) + 1 and o < len(font.data):
+        strings.append(font.data[o + 1:o + 1 + font.data[o]])
+        o += 1 + font.data[o]
+
+    new_indexes, new_strings = [], []
+    for glyph in glyphs:
+        index = indexes[glyph] if glyph < count else 0
+        if index >= 258:
+            new_strings.append(strings[index - 258] if index - 258 < len(strings) else b'')
+            index = 257 + len(new_strings)
+        new_indexes.append(index)
+
+    table = font.data[post:post + 32] + struct.pack('>H', len(glyphs))
+    table += struct.pack('>{}H'.format(len(glyphs)), *new_indexes)
+    for s in new_strings:
+        table += struct.pack('>B', len(s)) + s
+    return table
+
+def lsb(font, glyph):
+    hmtx = font.tables['hmtx']
+    if glyph < font.num_metrics:
+        return font.s16(hmtx + glyph * 4 + 2)
+    return font.s16(hmtx + font.num_metrics * 4 + (glyph - font.num_metrics) * 2)
+
+def table_length(font, tag):
+    for i in range(font.u16(4)):
+        record = 12 + i * 16
+        if font.data[record:record + 4].decode('latin-1') == tag:
+            return font.u32(record + 12)
+    return 0
+
+def subset(font, codes, output):
+    cmap = font.cmap()
+    codes = sorted(c for c in codes if c in cmap)
+
+    # .notdef, the icons, then the components they need
+    glyphs = [0]
+    for code in codes:
+        if cmap[code] not in glyphs:
+            glyphs.append(cmap[code])
+    i = 0
+    while i < len(glyphs):
+        data = glyph_data(font, glyphs[i])
+        if len(data) >= 10 and struct.unpack_from('>h', data, 0)[0] < 0:
+            for o in components(data):
+                component = struct.unpack_from('>H', data, o)[0]
+                if component not in glyphs and component < font.num_glyphs:
+                    glyphs.append(component)
+        i += 1
+    new_index = {g: i for i, g in enumerate(glyphs)}
+
+    glyf, loca = b'', []
+    for glyph in glyphs:
+        data = bytearray(glyph_data(font, glyph))
+        if len(data) >= 10 and struct.unpack_from('>h', data, 0)[0] < 0:
+            for o in components(bytes(data)):
+                struct.pack_into('>H', data, o, new_index.get(struct.unpack_from('>H', data, o)[0], 0))
+        loca.append(len(glyf))
+        glyf += bytes(data) + b'\0' * (-len(data) % 4)
+    loca.append(len(glyf))
+
+    hmtx = b''
+    for glyph in glyphs:
+        hmtx += struct.pack('>Hh', font.advance(glyph), lsb(font, glyph))
+
+    tables = {}
+    for tag in kept_tables:
+        if tag in font.tables:
+            tables[tag] = bytearray(font.data[font.tables[tag]:font.tables[tag] + table_length(font, tag)])
+
+    tables['glyf'] = bytearray(glyf)
+    tables['loca'] = bytearray(struct.pack('>{}I'.format(len(loca)), *loca))
+    tables['hmtx'] = bytearray(hmtx)
+    tables['cmap'] = bytearray(cmap_table({c: new_index[cmap[c]] for c in codes}))
+    post = post_table(font, glyphs)
+    if post is not None:
+        tables['post'] = bytearray(post)
+
+    struct.pack_into('>I', tables['head'], 8, 0)           # checkSumAdjustment
+    struct.pack_into('>h', tables['head'], 50, 1)          # long loca
+    struct.pack_into('>H', tables['hhea'], 34, len(glyphs))
+    struct.pack_into('>H', tables['maxp'], 4, len(glyphs))
+    if 'OS/2' in tables and codes:
+        struct.pack_into('>HH', tables['OS/2'], 64, min(codes[0], 0xFFFF), min(codes[-1], 0xFFFF))
+
+    # Table directory, tags sorted, tables 4 bytes aligned
+    tags = sorted(tables)
+    power = 1 << (len(tags).bit_length() - 1)
+    data = struct.pack('>IHHHH', 0x00010000, len(tags), power * 16, power.bit_length() - 1,
+                       (len(tags) - power) * 16)
+    offset = 12 + len(tags) * 16
+    body = b''
+    for tag in tags:
+        table = bytes(tables[tag])
+        data += struct.pack('>4sIII', tag.encode('latin-1'), checksum(table), offset + len(body), len(table))
+        body += table + b'\0' * (-len(table) % 4)
+    data = bytearray(data + body)
+
+    head = 12 + tags.index('head') * 16
+    head_offset = struct.unpack_from('>I', data, head + 8)[0]
+    struct.pack_into('>I', data, head_offset + 8, (0xB1B0AFBA - checksum(bytes(data))) & 0xFFFFFFFF)
+
+    directory = os.path.dirname(output)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+    with open(output, 'wb') as f:
+        f.write(data)
+
+    return len(codes), len(glyphs)
+
+def main():
+    parser = argparse.ArgumentParser(fromfile_prefix_chars='@',
+                                     description='Subsets TrueType icon fonts to the icons some sources use.')
+    parser.add_argument('--font', nargs=2, action='append', default=[], metavar=('INPUT', 'OUTPUT'),
+                        help='font to subset and where to write the subset')
+    parser.add_argument('--sources', nargs='*', default=[], help='sources to scan for icons')
+    parser.add_argument('--keep', nargs='*', default=[], help='more icons, by name or 0x code point')
+    parser.add_argument('--header', default=os.path.join(root, 'include', 'awesome.h'))
+    parser.add_argument('--names', default=os.path.join(root, 'include', 'awesome_names.h'))
+    args = parser.parse_args()
+
+    if not args.font:
+        parser.error('no --font given')
+
+    enums = read_enums(args.header)
+    names = read_names(args.names, enums)
+    codes = scan([s for s in args.sources if s], enums, names)
+
+    for icon in args.keep:
+        if icon.startswith('0x'):
+            codes.add(int(icon, 16))
+        elif icon in names:
+            codes |= names[icon]
+        else:
+            sys.exit('no icon {}'.format(icon))
+
+    for path, output in args.font:
+        font = TrueTypeFont(path)
+        icons, glyphs = subset(font, codes, output)
+        print('{}: {} icons, {} of {} glyphs, {} bytes'.format(
+            output, icons, glyphs, font.num_glyphs, os.path.getsize(output)))
+
+if __name__ == '__main__':
+    main()
@@ -1,15 +1,46 @@
 #include <awesome.h>
+#include <awesome_names.h>
 #include <qfonticon.h>
 
+#include <algorithm>
+
 /**
  * This file has been automatically generated.
  */
 
 namespace fa {
 
+namespace detail {
+
+static int resolve(const name_entry* table, int count, QStringView name)
+{
+    auto end = table + count;
+    auto it  = std::lower_bound(table, end, name, [](const name_entry& e, QStringView n)
+    {
+        return n.compare(QLatin1String(e.name)) > 0;
+    });
+
+    if(it == end || name.compare(QLatin1String(it->name)) != 0)
+        return QFontIconEngine::InvalidIcon;
+
+    return it->code;
+}
+
+}
+
 namespace v5 {
 
-bool register_awesome_names()
+static int resolve_icon_code(QStringView name)
+{
+    return detail::resolve(icon_names, icon_names_count, name);
+}
+
+static QString resolve_icon_name(int code)
+{
+    return QLatin1String(icon_name(code));
+}
+
+bool register_awesome_names(bool lazy)
 {
     bool r = true;
 
@@ -21,6 +52,12 @@ bool register_awesome_names()
         { QStringLiteral("brands"),  brands  }
     });
 
+    if(lazy)
+    {
+        QFontIconEngine::registerIconNameResolver(resolve_icon_code, resolve_icon_name);
+        return r;
+    }
+
     r &= QFontIconEngine::registerIconName({
         { QStringLiteral("500px")                              , _500px                              },
         { QStringLiteral("abacus")                             , abacus                              },
@@ -2341,7 +2378,17 @@ bool register_awesome_names()
 
 namespace v6 {
 
-bool register_awesome_names()
+static int resolve_icon_code(QStringView name)
+{
+    return detail::resolve(icon_names, icon_names_count, name);
+}
+
+static QString resolve_icon_name(int code)
+{
+    return QLatin1String(icon_name(code));
+}
+
+bool register_awesome_names(bool lazy)
 {
     bool r = true;
 
@@ -2353,6 +2400,12 @@ bool register_awesome_names()
         { QStringLiteral("brands"),  brands  }
     });
 
+    if(lazy)
+    {
+        QFontIconEngine::registerIconNameResolver(resolve_icon_code, resolve_icon_name);
+        return r;
+    }
+
     r &= QFontIconEngine::registerIconName({
         { QStringLiteral("0")                                     , _0                                     },
         { QStringLiteral("1")                                     , _1                                     },
@@ -0,0 +1,1028 @@
+#include <awesome.h>
+#include <qfonticon.h>
+
+/**
+ * This file has been automatically generated.
+ */
+
+namespace fa {
+
+// fa-solid-900.ttf
+static const QFontIconEngine::GlyphMetrics solid_metrics[] = {
+    { 0xe005,    3,  512, {     0,     0,   512,   384 } },
+    { 0xe041,    4,  640, {     0,   -32,   640,   384 } },
+    { 0xe059,    5,  640, {     0,   -65,   640,   449 } },
+    { 0xe05a,    6,  512, {     0,   -64,   512,   449 } },
+    { 0xe05b,    7,  512, {    -1,   -64,   512,   449 } },
+    { 0xe05c,    8,  576, {    -1,   -64,   576,   449 } },
+    { 0xe05d,    9,  640, {     0,   -64,   640,   448 } },
+    { 0xe05e,   10,  576, {    32,   -64,   545,   449 } },
+    { 0xe05f,   11,  640, {     0,   -64,   641,   448 } },
+    { 0xe060,   12,  640, {     0,   -65,   641,   448 } },
+    { 0xe061,   13,  640, {     0,   -64,   640,   448 } },
+    { 0xe062,   14,  640, {     0,   -65,   641,   448 } },
+    { 0xe063,   15,  512, {    -4,   -64,   512,   448 } },
+    { 0xe064,   16,  512, {     0,   -64,   512,   448 } },
+    { 0xe065,   17,  576, {     0,   -64,   576,   448 } },
+    { 0xe066,   18,  640, {     0,   -64,   640,   448 } },
+    { 0xe067,   19,  640, {     0,   -74,   640,   448 } },
+    { 0xe068,   20,  576, {     0,   -64,   576,   448 } },
+    { 0xe069,   21,  640, {     0,   -64,   641,   448 } },
+    { 0xe06a,   22,  384, {    -1,   -64,   384,   449 } },
+    { 0xe06b,   23,  384, {     0,   -64,   384,   448 } },
+    { 0xe06c,   24,  512, {    15,   -64,   496,   448 } },
+    { 0xe06d,   25,  512, {     0,   -64,   512,   449 } },
+    { 0xe06e,   26,  512, {     0,   -64,   512,   448 } },
+    { 0xe06f,   27,  448, {    13,   -66,   433,   448 } },
+    { 0xe070,   28,  640, {    -6,   -64,   646,   449 } },
+    { 0xe071,   29,  640, {     0,   -64,   608,   448 } },
+    { 0xe072,   30,  640, {     0,   -64,   641,   448 } },
+    { 0xe073,   31,  640, {     0,   -65,   641,   448 } },
+    { 0xe074,   32,  512, {    -1,   -64,   513,   449 } },
+    { 0xe075,   33,  640, {    -7,   -65,   647,   455 } },
+    { 0xe076,   34,  640, {     0,   -64,   640,   448 } },
+    { 0xe085,   35,  448, {     0,   -64,   448,   448 } },
+    { 0xe086,   36,  448, {     0,   -64,   448,   448 } },
+    { 0xf000,   37,  512, {    -6,   -64,   518,   448 } },
+    { 0xf001,   38,  512, {     0,   -64,   512,   448 } },
+    { 0xf002,   39,  512, {     0,   -65,   512,   448 } },
+    { 0xf004,   40,  512, {    -3,   -32,   515,   420 } },
+    { 0xf005,   41,  576, {    15,   -70,   561,   449 } },
+    { 0xf007,   42,  448, {     0,   -64,   448,   448 } },
+    { 0xf008,   43,  512, {     0,     0,   512,   384 } },
+    { 0xf009,   44,  512, {     0,   -32,   512,   416 } },
+    { 0xf00a,   45,  512, {     0,   -32,   512,   416 } },
+    { 0xf00b,   46,  512, {     0,   -32,   512,   416 } },
+    { 0xf00c,   47,  512, {     0,     1,   512,   383 } },
+    { 0xf00d,   48,  352, {    -1,    15,   353,   369 } },
+    { 0xf00e,   49,  512, {     0,   -65,   512,   448 } },
+    { 0xf010,   50,  512, {     0,   -65,   512,   448 } },
+    { 0xf011,   51,  512, {     7,   -57,   504,   448 } },
+    { 0xf012,   52,  640, {    24,   -64,   616,   448 } },
+    { 0xf013,   53,  512, {    16,   -63,   496,   447 } },
+    { 0xf015,   54,  576, {    -1,   -32,   577,   416 } },
+    { 0xf017,   55,  512, {     8,   -56,   504,   440 } },
+    { 0xf018,   56,  576, {    -5,     0,   581,   384 } },
+    { 0xf019,   57,  512, {     0,   -64,   512,   448 } },
+    { 0xf01c,   58,  576, {     0,     0,   576,   384 } },
+    { 0xf01e,   59,  512, {     7,   -56,   513,   448 } },
+    { 0xf021,   60,  512, {     0,   -64,   512,   448 } },
+    { 0xf022,   61,  512, {     0,   -32,   512,   416 } },
+    { 0xf023,   62,  448, {     0,   -64,   448,   448 } },
+    { 0xf024,   63,  512, {     8,   -64,   512,   449 } },
+    { 0xf025,   64,  512, {     0,   -32,   512,   416 } },
+    { 0xf026,   65,  256, {     0,    -4,   256,   388 } },
+    { 0xf027,   66,  384, {     0,    -6,   385,   388 } },
+    { 0xf028,   67,  576, {     0,   -50,   576,   434 } },
+    { 0xf029,   68,  448, {     0,   -32,   448,   416 } },
+    { 0xf02a,   69,  512, {     0,     0,   512,   384 } },
+    { 0xf02b,   70,  512, {     0,   -64,   512,   448 } },
+    { 0xf02c,   71,  640, {     0,   -65,   640,   448 } },
+    { 0xf02d,   72,  448, {     0,   -64,   448,   448 } },
+    { 0xf02e,   73,  384, {     0,   -64,   384,   448 } },
+    { 0xf02f,   74,  512, {     0,   -64,   512,   448 } },
+    { 0xf030,   75,  512, {     0,   -32,   512,   416 } },
+    { 0xf031,   76,  448, {     0,   -32,   448,   417 } },
+    { 0xf032,   77,  384, {    18,   -32,   388,   416 } },
+    { 0xf033,   78,  320, {     0,   -32,   320,   416 } },
+    { 0xf034,   79,  576, {     0,   -32,   579,   416 } },
+    { 0xf035,   80,  448, {     0,   -35,   448,   416 } },
+    { 0xf036,   81,  448, {     0,   -32,   448,   416 } },
+    { 0xf037,   82,  448, {     0,   -32,   448,   416 } },
+    { 0xf038,   83,  448, {     0,   -32,   448,   416 } },
+    { 0xf039,   84,  448, {     0,   -32,   448,   416 } },
+    { 0xf03a,   85,  512, {     0,   -16,   512,   400 } },
+    { 0xf03b,   86,  448, {     0,   -32,   448,   416 } },
+    { 0xf03c,   87,  448, {     0,   -32,   448,   416 } },
+    { 0xf03d,   88,  576, {     0,     0,   576,   384 } },
+    { 0xf03e,   89,  512, {     0,     0,   512,   384 } },
+    { 0xf041,   90,  384, {     0,   -65,   384,   448 } },
+    { 0xf042,   91,  512, {     8,   -56,   504,   440 } },
+    { 0xf043,   92,  352, {     0,   -64,   352,   449 } },
+    { 0xf044,   93,  576, {     0,   -64,   576,   448 } },
+    { 0xf048,   94,  448, {    64,   -38,   384,   422 } },
+    { 0xf049,   95,  512, {     0,    -6,   512,   390 } },
+    { 0xf04a,   96,  512, {     0,    -6,   512,   390 } },
+    { 0xf04b,   97,  448, {     0,   -72,   449,   456 } },
+    { 0xf04c,   98,  448, {     0,   -31,   448,   417 } },
+    { 0xf04d,   99,  448, {     0,   -32,   448,   416 } },
+    { 0xf04e,  100,  512, {     0,    -6,   512,   390 } },
+    { 0xf050,  101,  512, {     0,    -6,   512,   390 } },
+    { 0xf051,  102,  448, {    64,   -38,   384,   422 } },
+    { 0xf052,  103,  448, {    -9,   -32,   457,   416 } },
+    { 0xf053,  104,  320, {    27,   -27,   293,   411 } },
+    { 0xf054,  105,  320, {    27,   -27,   293,   411 } },
+    { 0xf055,  106,  512, {     8,   -56,   504,   440 } },
+    { 0xf056,  107,  512, {     8,   -56,   504,   440 } },
+    { 0xf057,  108,  512, {     8,   -56,   504,   440 } },
+    { 0xf058,  109,  512, {     8,   -56,   504,   440 } },
+    { 0xf059,  110,  512, {     8,   -56,   504,   440 } },
+    { 0xf05a,  111,  512, {     8,   -56,   504,   440 } },
+    { 0xf05b,  112,  512, {     0,   -64,   512,   448 } },
+    { 0xf05e,  113,  512, {     8,   -56,   504,   440 } },
+    { 0xf060,  114,  448, {    -1,   -27,   448,   411 } },
+    { 0xf061,  115,  448, {     0,   -27,   449,   411 } },
+    { 0xf062,  116,  448, {     5,   -32,   443,   417 } },
+    { 0xf063,  117,  448, {     5,   -33,   443,   416 } },
+    { 0xf064,  118,  512, {     0,   -36,   513,   421 } },
+    { 0xf065,  119,  448, {     0,   -32,   448,   416 } },
+    { 0xf066,  120,  448, {     0,   -32,   448,   416 } },
+    { 0xf067,  121,  448, {     0,   -32,   448,   416 } },
+    { 0xf068,  122,  448, {     0,   144,   448,   240 } },
+    { 0xf069,  123,  512, {    19,   -64,   493,   448 } },
+    { 0xf06a,  124,  512, {     8,   -56,   504,   440 } },
+    { 0xf06b,  125,  512, {     0,   -32,   512,   416 } },
+    { 0xf06c,  126,  576, {    -3,   -67,   576,   449 } },
+    { 0xf06d,  127,  384, {     0,   -64,   384,   452 } },
+    { 0xf06e,  128,  576, {     0,     0,   576,   384 } },
+    { 0xf070,  129,  640, {     0,   -64,   640,   448 } },
+    { 0xf071,  130,  576, {    -8,   -64,   584,   449 } },
+    { 0xf072,  131,  576, {    -2,   -64,   576,   448 } },
+    { 0xf073,  132,  448, {     0,   -64,   448,   448 } },
+    { 0xf074,  133,  512, {     0,   -37,   513,   421 } },
+    { 0xf075,  134,  512, {    -2,   -32,   512,   416 } },
+    { 0xf076,  135,  512, {     0,   -45,   513,   428 } },
+    { 0xf077,  136,  448, {     5,    59,   443,   325 } },
+    { 0xf078,  137,  448, {     5,    59,   443,   325 } },
+    { 0xf079,  138,  640, {     3,    -4,   637,   388 } },
+    { 0xf07a,  139,  576, {     0,   -64,   578,   448 } },
+    { 0xf07b,  140,  512, {     0,     0,   512,   384 } },
+    { 0xf07c,  141,  576, {     0,     0,   580,   384 } },
+    { 0xf080,  142,  512, {     0,     0,   512,   384 } },
+    { 0xf083,  143,  512, {     0,   -32,   512,   416 } },
+    { 0xf084,  144,  512, {     0,   -64,   512,   449 } },
+    { 0xf085,  145,  640, {    -6,   -66,   642,   451 } },
+    { 0xf086,  146,  576, {    -2,   -32,   578,   416 } },
+    { 0xf089,  147,  576, {    15,   -70,   288,   448 } },
+    { 0xf08d,  148,  384, {     0,   -65,   385,   448 } },
+    { 0xf091,  149,  576, {     0,   -64,   576,   448 } },
+    { 0xf093,  150,  512, {     0,   -64,   512,   448 } },
+    { 0xf094,  151,  512, {    -4,   -68,   516,   452 } },
+    { 0xf095,  152,  512, {    -4,   -64,   512,   452 } },
+    { 0xf098,  153,  448, {     0,   -32,   448,   416 } },
+    { 0xf09c,  154,  448, {     0,   -64,   448,   449 } },
+    { 0xf09d,  155,  576, {     0,   -32,   576,   416 } },
+    { 0xf09e,  156,  448, {     0,   -33,   449,   417 } },
+    { 0xf0a0,  157,  576, {     0,     0,   576,   384 } },
+    { 0xf0a1,  158,  576, {     0,   -64,   576,   448 } },
+    { 0xf0a3,  159,  512, {    -3,   -67,   515,   451 } },
+    { 0xf0a4,  160,  512, {     0,     0,   512,   385 } },
+    { 0xf0a5,  161,  512, {     0,     0,   512,   385 } },
+    { 0xf0a6,  162,  384, {    -1,   -64,   384,   448 } },
+    { 0xf0a7,  163,  384, {    -1,   -64,   384,   448 } },
+    { 0xf0a8,  164,  512, {     8,   -56,   504,   440 } },
+    { 0xf0a9,  165,  512, {     8,   -56,   504,   440 } },
+    { 0xf0aa,  166,  512, {     8,   -56,   504,   440 } },
+    { 0xf0ab,  167,  512, {     8,   -56,   504,   440 } },
+    { 0xf0ac,  168,  496, {     0,   -56,   496,   440 } },
+    { 0xf0ad,  169,  512, {    -1,   -65,   517,   453 } },
+    { 0xf0ae,  170,  512, {    -1,   -16,   512,   417 } },
+    { 0xf0b0,  171,  512, {    -5,   -68,   517,   448 } },
+    { 0xf0b1,  172,  512, {     0,   -32,   512,   416 } },
+    { 0xf0b2,  173,  512, {    -1,   -65,   512,   449 } },
+    { 0xf0c0,  174,  640, {     0,   -32,   640,   416 } },
+    { 0xf0c1,  175,  512, {    -1,   -65,   512,   449 } },
+    { 0xf0c2,  176,  640, {     0,   -32,   640,   416 } },
+    { 0xf0c3,  177,  448, {   -12,   -64,   460,   448 } },
+    { 0xf0c4,  178,  448, {     0,   -32,   453,   416 } },
+    { 0xf0c5,  179,  448, {     0,   -64,   448,   448 } },
+    { 0xf0c6,  180,  448, {    -1,   -65,   449,   449 } },
+    { 0xf0c7,  181,  448, {     0,   -32,   448,   416 } },
+    { 0xf0c8,  182,  448, {     0,   -32,   448,   416 } },
+    { 0xf0c9,  183,  448, {     0,    -4,   448,   388 } },
+    { 0xf0ca,  184,  512, {     0,   -16,   512,   400 } },
+    { 0xf0cb,  185,  512, {    -4,   -32,   512,   416 } },
+    { 0xf0cc,  186,  512, {     0,   -32,   512,   416 } },
+    { 0xf0cd,  187,  448, {     0,   -64,   448,   448 } },
+    { 0xf0ce,  188,  512, {     0,   -32,   512,   416 } },
+    { 0xf0d0,  189,  512, {     0,   -64,   512,   448 } },
+    { 0xf0d1,  190,  640, {     0,   -64,   640,   448 } },
+    { 0xf0d6,  191,  640, {     0,     0,   640,   384 } },
+    { 0xf0d7,  192,  320, {     7,    87,   313,   256 } },
+    { 0xf0d8,  193,  320, {     7,    96,   313,   265 } },
+    { 0xf0d9,  194,  192, {    23,    39,   192,   345 } },
+    { 0xf0da,  195,  192, {     0,    39,   169,   345 } },
+    { 0xf0db,  196,  512, {     0,   -32,   512,   416 } },
+    { 0xf0dc,  197,  320, {    13,    -8,   307,   392 } },
+    { 0xf0dd,  198,  320, {    13,    -8,   307,   160 } },
+    { 0xf0de,  199,  320, {    13,   224,   308,   392 } },
+    { 0xf0e0,  200,  512, {     0,     0,   512,   384 } },
+    { 0xf0e2,  201,  512, {     0,   -56,   505,   448 } },
+    { 0xf0e3,  202,  512, {     0,   -65,   512,   449 } },
+    { 0xf0e7,  203,  320, {    -1,   -64,   324,   448 } },
+    { 0xf0e8,  204,  640, {     0,   -64,   640,   448 } },
+    { 0xf0e9,  205,  576, {    -2,   -64,   578,   448 } },
+    { 0xf0ea,  206,  448, {     0,   -64,   448,   448 } },
+    { 0xf0eb,  207,  352, {     0,   -65,   352,   449 } },
+    { 0xf0f0,  208,  448, {     0,   -64,   448,   448 } },
+    { 0xf0f1,  209,  512, {     0,   -64,   512,   450 } },
+    { 0xf0f2,  210,  512, {     0,   -32,   512,   416 } },
+    { 0xf0f3,  211,  448, {    -1,   -64,   449,   448 } },
+    { 0xf0f4,  212,  640, {    -7,   -32,   640,   416 } },
+    { 0xf0f8,  213,  448, {     0,   -64,   448,   448 } },
+    { 0xf0f9,  214,  640, {     0,   -64,   640,   448 } },
+    { 0xf0fa,  215,  512, {     0,   -32,   512,   416 } },
+    { 0xf0fb,  216,  640, {     0,   -32,   640,   416 } },
+    { 0xf0fc,  217,  448, {     0,   -32,   448,   416 } },
+    { 0xf0fd,  218,  448, {     0,   -32,   448,   416 } },
+    { 0xf0fe,  219,  448, {     0,   -32,   448,   416 } },
+    { 0xf100,  220,  448, {    24,    31,   425,   353 } },
+    { 0xf101,  221,  448, {    24,    31,   424,   353 } },
+    { 0xf102,  222,  320, {    -1,    -8,   321,   392 } },
+    { 0xf103,  223,  320, {    -1,    -8,   321,   392 } },
+    { 0xf104,  224,  256, {    24,    31,   233,   353 } },
+    { 0xf105,  225,  256, {    24,    31,   232,   353 } },
+    { 0xf106,  226,  320, {    -1,    88,   321,   296 } },
+    { 0xf107,  227,  320, {    -1,    88,   320,   296 } },
+    { 0xf108,  228,  576, {     0,   -64,   576,   448 } },
+    { 0xf109,  229,  640, {     0,   -64,   640,   448 } },
+    { 0xf10a,  230,  448, {     0,   -64,   448,   448 } },
+    { 0xf10b,  231,  320, {     0,   -64,   320,   448 } },
+    { 0xf10d,  232,  512, {     0,   -32,   512,   416 } },
+    { 0xf10e,  233,  512, {     0,   -32,   512,   416 } },
+    { 0xf110,  234,  512, {     0,   -64,   512,   448 } },
+    { 0xf111,  235,  512, {     8,   -56,   504,   440 } },
+    { 0xf118,  236,  496, {     0,   -56,   496,   440 } },
+    { 0xf119,  237,  496, {     0,   -56,   496,   440 } },
+    { 0xf11a,  238,  496, {     0,   -56,   496,   440 } },
+    { 0xf11b,  239,  640, {     0,    31,   641,   352 } },
+    { 0xf11c,  240,  576, {     0,     0,   576,   384 } },
+    { 0xf11e,  241,  512, {     8,   -64,   512,   449 } },
+    { 0xf120,  242,  640, {    -1,   -32,   640,   411 } },
+    { 0xf121,  243,  640, {    -6,   -67,   646,   451 } },
+    { 0xf122,  244,  576, {    -1,   -36,   576,   421 } },
+    { 0xf124,  245,  512, {    -5,   -67,   521,   457 } },
+    { 0xf125,  246,  512, {     0,   -64,   519,   455 } },
+    { 0xf126,  247,  384, {     0,   -64,   384,   448 } },
+    { 0xf127,  248,  512, {    -1,   -65,   513,   449 } },
+    { 0xf128,  249,  384, {    24,   -64,   378,   448 } },
+    { 0xf129,  250,  192, {     0,   -64,   192,   448 } },
+    { 0xf12a,  251,  192, {    16,   -64,   176,   448 } },
+    { 0xf12b,  252,  512, {     0,     0,   512,   448 } },
+    { 0xf12c,  253,  512, {     0,   -64,   512,   384 } },
+    { 0xf12d,  254,  512, {    -1,   -32,   512,   417 } },
+    { 0xf12e,  255,  576, {     0,   -65,   576,   448 } },
+    { 0xf130,  256,  352, {     0,   -64,   352,   448 } },
+    { 0xf131,  257,  640, {    -7,   -71,   647,   455 } },
+    { 0xf133,  258,  448, {     0,   -64,   448,   448 } },
+    { 0xf134,  259,  448, {    -2,   -64,   448,   448 } },
+    { 0xf135,  260,  512, {     0,   -64,   513,   448 } },
+    { 0xf137,  261,  512, {     8,   -56,   504,   440 } },
+    { 0xf138,  262,  512, {     8,   -56,   504,   440 } },
+    { 0xf139,  263,  512, {     8,   -56,   504,   440 } },
+    { 0xf13a,  264,  512, {     8,   -56,   504,   440 } },
+    { 0xf13d,  265,  576, {    -2,   -64,   578,   449 } },
+    { 0xf13e,  266,  448, {     0,   -64,   448,   449 } },
+    { 0xf140,  267,  496, {     0,   -56,   496,   440 } },
+    { 0xf141,  268,  512, {     8,   120,   504,   264 } },
+    { 0xf142,  269,  192, {    24,   -56,   168,   440 } },
+    { 0xf143,  270,  448, {     0,   -32,   448,   416 } },
+    { 0xf144,  271,  512, {     8,   -56,   504,   440 } },
+    { 0xf146,  272,  448, {     0,   -32,   448,   416 } },
+    { 0xf14a,  273,  448, {     0,   -32,   448,   416 } },
+    { 0xf14b,  274,  448, {     0,   -32,   448,   416 } },
+    { 0xf14d,  275,  576, {     0,   -64,   577,   453 } },
+    { 0xf14e,  276,  496, {     0,   -56,   496,   440 } },
+    { 0xf150,  277,  448, {     0,   -32,   448,   416 } },
+    { 0xf151,  278,  448, {     0,   -32,   448,   416 } },
+    { 0xf152,  279,  448, {     0,   -32,   448,   416 } },
+    { 0xf153,  280,  320, {     0,   -32,   322,   416 } },
+    { 0xf154,  281,  320, {     0,   -32,   320,   416 } },
+    { 0xf155,  282,  288, {    -4,   -64,   298,   448 } },
+    { 0xf156,  283,  320, {     0,   -32,   320,   416 } },
+    { 0xf157,  284,  384, {    19,   -32,   366,   416 } },
+    { 0xf158,  285,  384, {     0,   -32,   384,   416 } },
+    { 0xf159,  286,  576, {     0,   -32,   576,   416 } },
+    { 0xf15b,  287,  384, {     0,   -64,   384,   448 } },
+    { 0xf15c,  288,  384, {     0,   -64,   384,   448 } },
+    { 0xf15d,  289,  448, {    -3,   -32,   448,   416 } },
+    { 0xf15e,  290,  448, {    -3,   -32,   448,   416 } },
+    { 0xf160,  291,  512, {    -3,   -32,   512,   416 } },
+    { 0xf161,  292,  512, {    -3,   -32,   512,   416 } },
+    { 0xf162,  293,  448, {    -3,   -34,   433,   416 } },
+    { 0xf163,  294,  448, {    -3,   -34,   433,   416 } },
+    { 0xf164,  295,  512, {     0,   -64,   513,   448 } },
+    { 0xf165,  296,  512, {     0,   -64,   513,   448 } },
+    { 0xf182,  297,  256, {     5,   -64,   251,   448 } },
+    { 0xf183,  298,  192, {     0,   -64,   192,   448 } },
+    { 0xf185,  299,  512, {    -1,   -65,   513,   449 } },
+    { 0xf186,  300,  512, {    27,   -64,   488,   448 } },
+    { 0xf187,  301,  512, {     0,   -32,   512,   416 } },
+    { 0xf188,  302,  512, {    -1,   -65,   513,   448 } },
+    { 0xf191,  303,  448, {     0,   -32,   448,   416 } },
+    { 0xf192,  304,  512, {     8,   -56,   504,   440 } },
+    { 0xf193,  305,  512, {     0,   -64,   514,   449 } },
+    { 0xf195,  306,  384, {     0,   -32,   385,   416 } },
+    { 0xf197,  307,  640, {     0,   -32,   640,   416 } },
+    { 0xf199,  308,  448, {     0,   -32,   448,   416 } },
+    { 0xf19c,  309,  512, {    16,   -32,   496,   416 } },
+    { 0xf19d,  310,  640, {     0,     0,   641,   388 } },
+    { 0xf1ab,  311,  640, {     0,    32,   640,   352 } },
+    { 0xf1ac,  312,  512, {     0,   -64,   512,   448 } },
+    { 0xf1ad,  313,  448, {     0,   -64,   448,   448 } },
+    { 0xf1ae,  314,  384, {     0,   -64,   384,   448 } },
+    { 0xf1b0,  315,  512, {    -5,   -32,   517,   421 } },
+    { 0xf1b2,  316,  512, {     0,   -65,   512,   449 } },
+    { 0xf1b3,  317,  512, {     0,   -37,   512,   419 } },
+    { 0xf1b8,  318,  512, {    -4,   -67,   512,   449 } },
+    { 0xf1b9,  319,  512, {    -2,     0,   514,   384 } },
+    { 0xf1ba,  320,  512, {     0,   -32,   512,   416 } },
+    { 0xf1bb,  321,  384, {    -5,   -65,   389,   449 } },
+    { 0xf1c0,  322,  448, {     0,   -64,   448,   448 } },
+    { 0xf1c1,  323,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c2,  324,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c3,  325,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c4,  326,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c5,  327,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c6,  328,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c7,  329,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c8,  330,  384, {     0,   -64,   384,   448 } },
+    { 0xf1c9,  331,  384, {     0,   -64,   384,   448 } },
+    { 0xf1cd,  332,  512, {     8,   -56,   504,   440 } },
+    { 0xf1ce,  333,  512, {     7,   -57,   504,   436 } },
+    { 0xf1d8,  334,  512, {    -1,   -69,   515,   453 } },
+    { 0xf1da,  335,  512, {     8,   -57,   505,   440 } },
+    { 0xf1dc,  336,  512, {    16,   -32,   496,   416 } },
+    { 0xf1dd,  337,  448, {    32,   -32,   448,   416 } },
+    { 0xf1de,  338,  512, {     0,   -32,   512,   416 } },
+    { 0xf1e0,  339,  448, {     0,   -64,   448,   448 } },
+    { 0xf1e1,  340,  448, {     0,   -32,   448,   416 } },
+    { 0xf1e2,  341,  512, {     0,   -64,   512,   448 } },
+    { 0xf1e3,  342,  512, {     8,   -56,   504,   440 } },
+    { 0xf1e4,  343,  512, {     0,   -64,   517,   461 } },
+    { 0xf1e5,  344,  512, {     0,   -32,   512,   416 } },
+    { 0xf1e6,  345,  384, {     0,   -64,   384,   448 } },
+    { 0xf1ea,  346,  576, {     0,     0,   576,   384 } },
+    { 0xf1eb,  347,  640, {    -1,   -32,   641,   431 } },
+    { 0xf1ec,  348,  448, {     0,   -64,   448,   448 } },
+    { 0xf1f6,  349,  640, {    -7,   -71,   647,   455 } },
+    { 0xf1f8,  350,  448, {     0,   -64,   448,   449 } },
+    { 0xf1f9,  351,  512, {     8,   -56,   504,   440 } },
+    { 0xf1fa,  352,  512, {     8,   -56,   504,   440 } },
+    { 0xf1fb,  353,  512, {     0,   -64,   513,   449 } },
+    { 0xf1fc,  354,  512, {    -1,   -64,   512,   448 } },
+    { 0xf1fd,  355,  448, {     0,   -64,   448,   448 } },
+    { 0xf1fe,  356,  512, {     0,     0,   512,   384 } },
+    { 0xf200,  357,  544, {    -4,   -66,   545,   449 } },
+    { 0xf201,  358,  512, {     0,     0,   512,   384 } },
+    { 0xf204,  359,  576, {     0,     0,   576,   384 } },
+    { 0xf205,  360,  576, {     0,     0,   576,   384 } },
+    { 0xf206,  361,  640, {    -1,    -1,   641,   384 } },
+    { 0xf207,  362,  512, {     0,   -64,   512,   448 } },
+    { 0xf20a,  363,  512, {     0,     0,   512,   384 } },
+    { 0xf20b,  364,  448, {     0,   -32,   448,   416 } },
+    { 0xf217,  365,  576, {     0,   -66,   578,   448 } },
+    { 0xf218,  366,  576, {     0,   -66,   578,   448 } },
+    { 0xf21a,  367,  640, {     0,   -64,   640,   448 } },
+    { 0xf21b,  368,  448, {     0,   -64,   448,   450 } },
+    { 0xf21c,  369,  640, {    -1,    -1,   641,   384 } },
+    { 0xf21d,  370,  512, {     0,   -64,   512,   448 } },
+    { 0xf21e,  371,  512, {    -2,   -32,   514,   417 } },
+    { 0xf221,  372,  288, {     0,   -32,   288,   416 } },
+    { 0xf222,  373,  384, {     0,     0,   384,   384 } },
+    { 0xf223,  374,  288, {     0,   -64,   288,   448 } },
+    { 0xf224,  375,  384, {     0,   -64,   384,   448 } },
+    { 0xf225,  376,  480, {     0,   -64,   480,   448 } },
+    { 0xf226,  377,  512, {     0,   -32,   512,   416 } },
+    { 0xf227,  378,  512, {     0,   -64,   512,   448 } },
+    { 0xf228,  379,  576, {     0,   -64,   576,   448 } },
+    { 0xf229,  380,  384, {     0,     0,   385,   384 } },
+    { 0xf22a,  381,  288, {     0,   -32,   289,   452 } },
+    { 0xf22b,  382,  480, {     0,    48,   485,   336 } },
+    { 0xf22c,  383,  288, {     0,   -32,   288,   416 } },
+    { 0xf22d,  384,  288, {     0,    48,   288,   336 } },
+    { 0xf233,  385,  512, {     0,   -32,   512,   416 } },
+    { 0xf234,  386,  640, {     0,   -64,   640,   448 } },
+    { 0xf235,  387,  640, {     0,   -64,   647,   448 } },
+    { 0xf236,  388,  640, {     0,     0,   640,   384 } },
+    { 0xf238,  389,  448, {     0,   -64,   448,   448 } },
+    { 0xf239,  390,  448, {     0,   -64,   448,   448 } },
+    { 0xf240,  391,  640, {     0,    32,   640,   352 } },
+    { 0xf241,  392,  640, {     0,    32,   640,   352 } },
+    { 0xf242,  393,  640, {     0,    32,   640,   352 } },
+    { 0xf243,  394,  640, {     0,    32,   640,   352 } },
+    { 0xf244,  395,  640, {     0,    32,   640,   352 } },
+    { 0xf245,  396,  320, {     0,   -66,   324,   452 } },
+    { 0xf246,  397,  256, {     0,   -65,   256,   449 } },
+    { 0xf247,  398,  512, {     0,   -32,   512,   416 } },
+    { 0xf248,  399,  576, {     0,   -32,   576,   416 } },
+    { 0xf249,  400,  448, {     0,   -32,   448,   416 } },
+    { 0xf24d,  401,  512, {     0,   -64,   512,   448 } },
+    { 0xf24e,  402,  640, {    -1,   -64,   640,   448 } },
+    { 0xf251,  403,  384, {     0,   -64,   384,   448 } },
+    { 0xf252,  404,  384, {     0,   -64,   384,   448 } },
+    { 0xf253,  405,  384, {     0,   -64,   384,   448 } },
+    { 0xf254,  406,  384, {     0,   -64,   384,   448 } },
+    { 0xf255,  407,  512, {     0,   -33,   512,   417 } },
+    { 0xf256,  408,  448, {    -3,   -64,   448,   449 } },
+    { 0xf257,  409,  512, {     0,   -32,   512,   420 } },
+    { 0xf258,  410,  576, {     0,   -32,   576,   416 } },
+    { 0xf259,  411,  512, {     0,   -64,   512,   449 } },
+    { 0xf25a,  412,  448, {    -3,   -64,   448,   448 } },
+    { 0xf25b,  413,  448, {    -4,   -64,   448,   448 } },
+    { 0xf25c,  414,  640, {     0,    32,   641,   352 } },
+    { 0xf25d,  415,  512, {     8,   -56,   504,   440 } },
+    { 0xf26c,  416,  640, {     0,   -64,   640,   448 } },
+    { 0xf271,  417,  448, {     0,   -64,   448,   448 } },
+    { 0xf272,  418,  448, {     0,   -64,   448,   448 } },
+    { 0xf273,  419,  448, {     0,   -64,   448,   448 } },
+    { 0xf274,  420,  448, {     0,   -64,   448,   448 } },
+    { 0xf275,  421,  512, {     0,   -32,   512,   416 } },
+    { 0xf276,  422,  288, {     0,   -64,   288,   448 } },
+    { 0xf277,  423,  512, {    -7,   -64,   519,   448 } },
+    { 0xf279,  424,  576, {     0,   -34,   576,   417 } },
+    { 0xf27a,  425,  512, {     0,   -67,   512,   448 } },
+    { 0xf28b,  426,  512, {     8,   -56,   504,   440 } },
+    { 0xf28d,  427,  512, {     8,   -56,   504,   440 } },
+    { 0xf290,  428,  448, {     0,   -64,   448,   448 } },
+    { 0xf291,  429,  576, {     0,   -32,   576,   418 } },
+    { 0xf292,  430,  448, {    -1,   -32,   449,   416 } },
+    { 0xf295,  431,  448, {    -4,   -64,   452,   448 } },
+    { 0xf29a,  432,  512, {     8,   -56,   504,   440 } },
+    { 0xf29d,  433,  384, {     0,   -67,   384,   448 } },
+    { 0xf29e,  434,  512, {     0,     0,   512,   384 } },
+    { 0xf2a0,  435,  384, {   -12,   -64,   385,   454 } },
+    { 0xf2a1,  436,  640, {     0,     0,   640,   416 } },
+    { 0xf2a2,  437,  512, {     0,   -64,   512,   449 } },
+    { 0xf2a3,  438,  640, {    -6,   -58,   646,   442 } },
+    { 0xf2a4,  439,  512, {    -5,   -64,   517,   453 } },
+    { 0xf2a7,  440,  448, {    -1,   -65,   449,   450 } },
+    { 0xf2a8,  441,  576, {    -8,   -66,   576,   450 } },
+    { 0xf2b5,  442,  640, {     0,    -3,   640,   384 } },
+    { 0xf2b6,  443,  512, {     0,   -64,   512,   449 } },
+    { 0xf2b9,  444,  448, {     0,   -64,   448,   448 } },
+    { 0xf2bb,  445,  576, {     0,   -32,   576,   416 } },
+    { 0xf2bd,  446,  496, {     0,   -56,   496,   440 } },
+    { 0xf2c1,  447,  384, {     0,   -64,   384,   448 } },
+    { 0xf2c2,  448,  576, {     0,   -32,   576,   416 } },
+    { 0xf2c7,  449,  256, {    -1,   -64,   256,   448 } },
+    { 0xf2c8,  450,  256, {    -1,   -64,   256,   448 } },
+    { 0xf2c9,  451,  256, {    -1,   -64,   256,   448 } },
+    { 0xf2ca,  452,  256, {    -1,   -64,   256,   448 } },
+    { 0xf2cb,  453,  256, {    -1,   -64,   256,   448 } },
+    { 0xf2cc,  454,  512, {     0,   -32,   512,   417 } },
+    { 0xf2cd,  455,  512, {     0,   -64,   512,   449 } },
+    { 0xf2ce,  456,  448, {     0,   -64,   448,   448 } },
+    { 0xf2d0,  457,  512, {     0,   -32,   512,   416 } },
+    { 0xf2d1,  458,  512, {     0,   -32,   512,    96 } },
+    { 0xf2d2,  459,  512, {     0,   -64,   512,   448 } },
+    { 0xf2db,  460,  512, {     0,   -64,   512,   448 } },
+    { 0xf2dc,  461,  448, {    -6,   -64,   454,   448 } },
+    { 0xf2e5,  462,  512, {    -1,   -65,   521,   457 } },
+    { 0xf2e7,  463,  416, {     0,   -64,   416,   449 } },
+    { 0xf2ea,  464,  512, {     8,   -56,   505,   441 } },
+    { 0xf2ed,  465,  448, {     0,   -64,   448,   449 } },
+    { 0xf2f1,  466,  512, {     8,   -56,   504,   440 } },
+    { 0xf2f2,  467,  448, {    16,   -64,   438,   448 } },
+    { 0xf2f5,  468,  512, {     0,    -4,   504,   388 } },
+    { 0xf2f6,  469,  512, {     0,   -12,   512,   384 } },
+    { 0xf2f9,  470,  512, {     7,   -56,   504,   441 } },
+    { 0xf2fe,  471,  512, {     0,   -64,   512,   448 } },
+    { 0xf302,  472,  576, {     0,   -32,   576,   416 } },
+    { 0xf303,  473,  512, {    -2,   -66,   513,   448 } },
+    { 0xf304,  474,  512, {    -2,   -66,   513,   448 } },
+    { 0xf305,  475,  512, {    -2,   -66,   513,   449 } },
+    { 0xf309,  476,  256, {    13,   -33,   243,   416 } },
+    { 0xf30a,  477,  448, {    -1,    77,   448,   307 } },
+    { 0xf30b,  478,  448, {     0,    77,   449,   307 } },
+    { 0xf30c,  479,  256, {    13,   -32,   243,   417 } },
+    { 0xf31e,  480,  448, {    -1,   -33,   449,   417 } },
+    { 0xf328,  481,  384, {     0,   -64,   384,   448 } },
+    { 0xf337,  482,  512, {    -1,    77,   513,   307 } },
+    { 0xf338,  483,  256, {    13,   -65,   243,   449 } },
+    { 0xf358,  484,  512, {     8,   -56,   504,   440 } },
+    { 0xf359,  485,  512, {     8,   -56,   504,   440 } },
+    { 0xf35a,  486,  512, {     8,   -56,   504,   440 } },
+    { 0xf35b,  487,  512, {     8,   -56,   504,   440 } },
+    { 0xf35d,  488,  512, {     0,   -64,   512,   448 } },
+    { 0xf360,  489,  448, {     0,   -32,   448,   416 } },
+    { 0xf362,  490,  512, {     0,   -13,   512,   397 } },
+    { 0xf381,  491,  640, {     0,   -32,   640,   416 } },
+    { 0xf382,  492,  640, {     0,   -32,   640,   416 } },
+    { 0xf3a5,  493,  576, {     0,   -64,   576,   448 } },
+    { 0xf3be,  494,  320, {    -3,   -65,   325,   448 } },
+    { 0xf3bf,  495,  320, {    -3,   -64,   325,   449 } },
+    { 0xf3c1,  496,  576, {     0,   -64,   576,   449 } },
+    { 0xf3c5,  497,  384, {     0,   -65,   384,   448 } },
+    { 0xf3c9,  498,  352, {     0,   -64,   352,   448 } },
+    { 0xf3cd,  499,  320, {     0,   -64,   320,   448 } },
+    { 0xf3d1,  500,  640, {     0,     0,   640,   384 } },
+    { 0xf3dd,  501,  640, {    -7,   -71,   641,   455 } },
+    { 0xf3e0,  502,  384, {     0,   -64,   384,   448 } },
+    { 0xf3e5,  503,  512, {    -1,   -36,   512,   421 } },
+    { 0xf3ed,  504,  512, {    16,   -68,   496,   448 } },
+    { 0xf3fa,  505,  448, {     0,   -64,   448,   448 } },
+    { 0xf3fd,  506,  576, {     0,   -32,   576,   416 } },
+    { 0xf3ff,  507,  576, {     0,     0,   576,   384 } },
+    { 0xf406,  508,  512, {     0,   -64,   512,   448 } },
+    { 0xf410,  509,  512, {     0,   -32,   512,   416 } },
+    { 0xf422,  510,  448, {    -7,   -39,   455,   423 } },
+    { 0xf424,  511,  448, {     0,   -32,   448,   416 } },
+    { 0xf433,  512,  496, {     0,   -56,   496,   440 } },
+    { 0xf434,  513,  496, {     0,   -56,   496,   440 } },
+    { 0xf436,  514,  496, {     0,   -56,   496,   440 } },
+    { 0xf439,  515,  512, {     0,   -64,   512,   448 } },
+    { 0xf43a,  516,  320, {     0,   -64,   320,   448 } },
+    { 0xf43c,  517,  512, {     0,   -64,   512,   448 } },
+    { 0xf43f,  518,  448, {     0,   -64,   448,   448 } },
+    { 0xf441,  519,  384, {    -1,   -64,   384,   416 } },
+    { 0xf443,  520,  320, {     0,   -64,   320,   416 } },
+    { 0xf445,  521,  512, {    -1,   -64,   512,   448 } },
+    { 0xf447,  522,  384, {     0,   -64,   384,   416 } },
+    { 0xf44b,  523,  640, {     0,   -32,   640,   416 } },
+    { 0xf44e,  524,  496, {     0,   -56,   496,   440 } },
+    { 0xf450,  525,  416, {     0,   -64,   416,   448 } },
+    { 0xf453,  526,  512, {     0,     0,   512,   384 } },
+    { 0xf458,  527,  640, {     0,   -67,   647,   455 } },
+    { 0xf45c,  528,  512, {     0,   -64,   512,   448 } },
+    { 0xf45d,  529,  512, {    -1,   -65,   521,   448 } },
+    { 0xf45f,  530,  512, {    -3,   -56,   504,   445 } },
+    { 0xf461,  531,  448, {    -3,   -65,   448,   448 } },
+    { 0xf462,  532,  640, {     0,    32,   640,   352 } },
+    { 0xf466,  533,  512, {     0,   -64,   512,   448 } },
+    { 0xf468,  534,  576, {     0,   -64,   576,   448 } },
+    { 0xf469,  535,  512, {     0,   -64,   512,   416 } },
+    { 0xf46a,  536,  384, {     0,   -64,   384,   448 } },
+    { 0xf46b,  537,  576, {     0,   -32,   583,   416 } },
+    { 0xf46c,  538,  384, {     0,   -64,   384,   448 } },
+    { 0xf46d,  539,  384, {     0,   -64,   384,   448 } },
+    { 0xf470,  540,  640, {     0,   -64,   640,   448 } },
+    { 0xf471,  541,  448, {    -1,   -65,   449,   449 } },
+    { 0xf472,  542,  576, {     0,   -71,   578,   448 } },
+    { 0xf474,  543,  640, {     0,   -64,   640,   448 } },
+    { 0xf477,  544,  384, {     0,   -64,   384,   448 } },
+    { 0xf478,  545,  448, {     0,   -64,   448,   448 } },
+    { 0xf479,  546,  576, {     0,   -32,   576,   416 } },
+    { 0xf47d,  547,  576, {     0,   -64,   576,   448 } },
+    { 0xf47e,  548,  512, {     0,   -64,   512,   448 } },
+    { 0xf47f,  549,  576, {     0,   -64,   576,   448 } },
+    { 0xf481,  550,  384, {     0,   -64,   384,   448 } },
+    { 0xf482,  551,  640, {     0,   -64,   640,   448 } },
+    { 0xf484,  552,  576, {     0,   -36,   580,   416 } },
+    { 0xf485,  553,  384, {     0,   -64,   384,   448 } },
+    { 0xf486,  554,  384, {     0,   -64,   384,   448 } },
+    { 0xf487,  555,  640, {     0,   -64,   640,   449 } },
+    { 0xf48b,  556,  640, {     0,   -64,   640,   448 } },
+    { 0xf48d,  557,  640, {     0,   -64,   640,   448 } },
+    { 0xf48e,  558,  512, {    -4,   -68,   516,   452 } },
+    { 0xf490,  559,  640, {    -1,   -64,   644,   452 } },
+    { 0xf491,  560,  512, {    -1,   -64,   513,   451 } },
+    { 0xf492,  561,  480, {    -3,   -49,   484,   436 } },
+    { 0xf493,  562,  640, {     0,   -64,   640,   448 } },
+    { 0xf494,  563,  640, {     0,   -64,   640,   448 } },
+    { 0xf496,  564,  512, {     0,   -64,   512,   448 } },
+    { 0xf497,  565,  640, {     0,   -64,   640,   448 } },
+    { 0xf49e,  566,  640, {    -2,   -34,   642,   418 } },
+    { 0xf4ad,  567,  512, {    -2,   -32,   512,   416 } },
+    { 0xf4b3,  568,  640, {    -7,   -71,   641,   455 } },
+    { 0xf4b8,  569,  640, {     0,     0,   640,   384 } },
+    { 0xf4b9,  570,  512, {     0,   -64,   512,   448 } },
+    { 0xf4ba,  571,  512, {    -2,   -65,   512,   451 } },
+    { 0xf4bd,  572,  576, {     0,   -64,   577,   128 } },
+    { 0xf4be,  573,  576, {     0,   -64,   577,   451 } },
+    { 0xf4c0,  574,  576, {     0,   -64,   577,   448 } },
+    { 0xf4c1,  575,  576, {     0,   -64,   577,   448 } },
+    { 0xf4c2,  576,  640, {     0,   -64,   640,   384 } },
+    { 0xf4c4,  577,  640, {    -3,   -67,   643,   451 } },
+    { 0xf4cd,  578,  512, {    -1,   -64,   513,   448 } },
+    { 0xf4ce,  579,  640, {    -3,   -67,   643,   448 } },
+    { 0xf4d3,  580,  576, {    -3,   -64,   576,   448 } },
+    { 0xf4d6,  581,  448, {    -2,   -72,   450,   449 } },
+    { 0xf4d7,  582,  512, {     0,   -64,   512,   448 } },
+    { 0xf4d8,  583,  512, {     0,   -32,   512,   416 } },
+    { 0xf4d9,  584,  512, {     0,   -64,   512,   448 } },
+    { 0xf4da,  585,  496, {     0,   -56,   496,   440 } },
+    { 0xf4db,  586,  640, {     0,   -32,   640,   416 } },
+    { 0xf4de,  587,  640, {    -2,   -66,   640,   448 } },
+    { 0xf4df,  588,  640, {     0,   -32,   640,   416 } },
+    { 0xf4e2,  589,  640, {    -7,   -71,   641,   455 } },
+    { 0xf4e3,  590,  288, {    -5,   -64,   293,   448 } },
+    { 0xf4fa,  591,  640, {    -7,   -71,   641,   455 } },
+    { 0xf4fb,  592,  448, {     0,   -64,   448,   448 } },
+    { 0xf4fc,  593,  640, {     0,   -64,   645,   448 } },
+    { 0xf4fd,  594,  640, {     0,   -64,   640,   448 } },
+    { 0xf4fe,  595,  640, {     0,   -64,   642,   448 } },
+    { 0xf4ff,  596,  640, {     0,   -65,   640,   448 } },
+    { 0xf500,  597,  640, {     0,   -32,   640,   416 } },
+    { 0xf501,  598,  448, {     0,   -64,   448,   451 } },
+    { 0xf502,  599,  640, {     0,   -64,   640,   448 } },
+    { 0xf503,  600,  640, {     0,   -64,   640,   448 } },
+    { 0xf504,  601,  448, {     0,   -64,   448,   448 } },
+    { 0xf505,  602,  640, {     0,   -67,   640,   448 } },
+    { 0xf506,  603,  640, {    -7,   -71,   641,   455 } },
+    { 0xf507,  604,  640, {     0,   -64,   640,   448 } },
+    { 0xf508,  605,  448, {     0,   -64,   448,   448 } },
+    { 0xf509,  606,  640, {     0,   -32,   642,   416 } },
+    { 0xf515,  607,  640, {    -1,   -64,   640,   450 } },
+    { 0xf516,  608,  640, {    -1,   -64,   641,   450 } },
+    { 0xf517,  609,  512, {     0,   -64,   512,   448 } },
+    { 0xf518,  610,  576, {     0,   -35,   576,   417 } },
+    { 0xf519,  611,  640, {     0,   -66,   640,   448 } },
+    { 0xf51a,  612,  640, {     0,   -67,   647,   455 } },
+    { 0xf51b,  613,  640, {     0,   -64,   640,   448 } },
+    { 0xf51c,  614,  640, {    -1,   -64,   640,   448 } },
+    { 0xf51d,  615,  640, {     0,   -64,   640,   448 } },
+    { 0xf51e,  616,  512, {     0,   -64,   512,   448 } },
+    { 0xf51f,  617,  496, {     0,   -56,   496,   440 } },
+    { 0xf520,  618,  640, {     0,   -68,   640,   448 } },
+    { 0xf521,  619,  640, {     0,   -64,   640,   448 } },
+    { 0xf522,  620,  640, {     0,   -64,   640,   448 } },
+    { 0xf523,  621,  448, {     0,   -32,   448,   416 } },
+    { 0xf524,  622,  448, {     0,   -32,   448,   416 } },
+    { 0xf525,  623,  448, {     0,   -32,   448,   416 } },
+    { 0xf526,  624,  448, {     0,   -32,   448,   416 } },
+    { 0xf527,  625,  448, {     0,   -32,   448,   416 } },
+    { 0xf528,  626,  448, {     0,   -32,   448,   416 } },
+    { 0xf529,  627,  448, {     0,   -32,   448,   416 } },
+    { 0xf52a,  628,  640, {     0,   -64,   640,   448 } },
+    { 0xf52b,  629,  640, {     0,   -64,   640,   451 } },
+    { 0xf52c,  630,  448, {     0,    48,   448,   336 } },
+    { 0xf52d,  631,  512, {     0,   -64,   517,   455 } },
+    { 0xf52e,  632,  576, {    -1,   -32,   576,   416 } },
+    { 0xf52f,  633,  512, {     0,   -64,   512,   448 } },
+    { 0xf530,  634,  576, {     0,   -32,   576,   424 } },
+    { 0xf531,  635,  384, {    -3,    -3,   385,   387 } },
+    { 0xf532,  636,  448, {     0,   -48,   448,   435 } },
+    { 0xf533,  637,  640, {    -2,   -64,   641,   448 } },
+    { 0xf534,  638,  640, {     0,    32,   640,   352 } },
+    { 0xf535,  639,  576, {    -1,   -32,   576,   430 } },
+    { 0xf536,  640,  384, {     0,    -3,   387,   387 } },
+    { 0xf537,  641,  448, {     0,   -48,   448,   435 } },
+    { 0xf538,  642,  640, {     0,     0,   640,   384 } },
+    { 0xf539,  643,  640, {    -7,   -71,   647,   455 } },
+    { 0xf53a,  644,  640, {     0,   -32,   641,   417 } },
+    { 0xf53b,  645,  640, {     0,   -32,   641,   417 } },
+    { 0xf53c,  646,  640, {     0,   -32,   640,   416 } },
+    { 0xf53d,  647,  640, {     0,   -32,   640,   416 } },
+    { 0xf53e,  648,  448, {     0,   -71,   454,   455 } },
+    { 0xf53f,  649,  512, {    -9,   -70,   512,   459 } },
+    { 0xf540,  650,  448, {     0,   -32,   448,   416 } },
+    { 0xf541,  651,  384, {    -1,     0,   384,   385 } },
+    { 0xf542,  652,  640, {     0,   -64,   640,   448 } },
+    { 0xf543,  653,  384, {     0,   -67,   384,   451 } },
+    { 0xf544,  654,  640, {    -1,   -64,   641,   448 } },
+    { 0xf545,  655,  640, {    -3,   -51,   643,   435 } },
+    { 0xf546,  656,  512, {     0,   -64,   512,   448 } },
+    { 0xf547,  657,  576, {     0,    64,   576,   320 } },
+    { 0xf548,  658,  256, {     0,   -64,   256,   448 } },
+    { 0xf549,  659,  640, {     0,   -64,   640,   448 } },
+    { 0xf54a,  660,  512, {     0,   -64,   512,   448 } },
+    { 0xf54b,  661,  640, {     0,   -67,   640,   451 } },
+    { 0xf54c,  662,  512, {     0,   -64,   512,   448 } },
+    { 0xf54d,  663,  512, {     0,   -64,   512,   448 } },
+    { 0xf54e,  664,  616, {   -12,   -64,   628,   448 } },
+    { 0xf54f,  665,  640, {    -6,   -64,   646,   448 } },
+    { 0xf550,  666,  512, {     0,   -32,   512,   416 } },
+    { 0xf551,  667,  512, {     0,   -64,   512,   448 } },
+    { 0xf552,  668,  512, {     0,   -32,   512,   416 } },
+    { 0xf553,  669,  640, {    -2,   -64,   642,   448 } },
+    { 0xf554,  670,  320, {     0,   -67,   323,   448 } },
+    { 0xf555,  671,  512, {     0,   -32,   512,   416 } },
+    { 0xf556,  672,  496, {     0,   -56,   496,   440 } },
+    { 0xf557,  673,  576, {     0,   -64,   576,   448 } },
+    { 0xf558,  674,  448, {     0,   -64,   448,   448 } },
+    { 0xf559,  675,  384, {    -3,   -66,   387,   453 } },
+    { 0xf55a,  676,  640, {    -1,     0,   640,   384 } },
+    { 0xf55b,  677,  640, {     0,   -32,   640,   416 } },
+    { 0xf55c,  678,  448, {     0,   -64,   455,   449 } },
+    { 0xf55d,  679,  384, {     0,   -64,   384,   448 } },
+    { 0xf55e,  680,  512, {     0,   -64,   512,   448 } },
+    { 0xf55f,  681,  512, {    -1,   -64,   514,   448 } },
+    { 0xf560,  682,  512, {    -1,   -65,   512,   449 } },
+    { 0xf561,  683,  576, {    -5,   -64,   576,   448 } },
+    { 0xf562,  684,  512, {     0,     0,   512,   384 } },
+    { 0xf563,  685,  512, {     0,   -70,   518,   454 } },
+    { 0xf564,  686,  512, {     0,   -70,   517,   453 } },
+    { 0xf565,  687,  512, {     0,   -64,   512,   448 } },
+    { 0xf566,  688,  640, {     0,    32,   640,   352 } },
+    { 0xf567,  689,  496, {     0,   -56,   496,   440 } },
+    { 0xf568,  690,  512, {     0,   -66,   512,   448 } },
+    { 0xf569,  691,  512, {     0,   -32,   513,   417 } },
+    { 0xf56a,  692,  576, {     0,   -32,   576,   416 } },
+    { 0xf56b,  693,  512, {     0,   -64,   512,   448 } },
+    { 0xf56c,  694,  384, {     0,   -64,   384,   448 } },
+    { 0xf56d,  695,  384, {     0,   -64,   384,   448 } },
+    { 0xf56e,  696,  576, {     0,   -64,   583,   448 } },
+    { 0xf56f,  697,  512, {     0,   -64,   512,   448 } },
+    { 0xf570,  698,  384, {     0,   -64,   384,   448 } },
+    { 0xf571,  699,  384, {     0,   -64,   384,   448 } },
+    { 0xf572,  700,  384, {     0,   -64,   384,   448 } },
+    { 0xf573,  701,  576, {     0,   -64,   577,   448 } },
+    { 0xf574,  702,  384, {     0,   -64,   384,   448 } },
+    { 0xf575,  703,  512, {     0,   -65,   512,   455 } },
+    { 0xf576,  704,  576, {     0,   -64,   576,   455 } },
+    { 0xf577,  705,  512, {    -2,   -64,   513,   450 } },
+    { 0xf578,  706,  576, {    -2,    32,   576,   352 } },
+    { 0xf579,  707,  496, {     0,   -56,   496,   440 } },
+    { 0xf57a,  708,  496, {     0,   -56,   496,   440 } },
+    { 0xf57b,  709,  512, {    -6,   -64,   518,   448 } },
+    { 0xf57c,  710,  496, {     0,   -56,   496,   440 } },
+    { 0xf57d,  711,  496, {     0,   -56,   496,   440 } },
+    { 0xf57e,  712,  496, {     0,   -56,   496,   440 } },
+    { 0xf57f,  713,  496, {     0,   -56,   496,   440 } },
+    { 0xf580,  714,  496, {     0,   -56,   496,   440 } },
+    { 0xf581,  715,  496, {     0,   -56,   496,   440 } },
+    { 0xf582,  716,  496, {     0,   -56,   496,   440 } },
+    { 0xf583,  717,  504, {     0,   -56,   504,   449 } },
+    { 0xf584,  718,  496, {     0,   -56,   496,   440 } },
+    { 0xf585,  719,  496, {     0,   -56,   496,   440 } },
+    { 0xf586,  720,  512, {    -1,   -65,   513,   449 } },
+    { 0xf587,  721,  496, {     0,   -56,   496,   440 } },
+    { 0xf588,  722,  640, {    -1,   -56,   641,   440 } },
+    { 0xf589,  723,  496, {     0,   -65,   496,   440 } },
+    { 0xf58a,  724,  496, {     0,   -65,   496,   440 } },
+    { 0xf58b,  725,  496, {     0,   -65,   496,   440 } },
+    { 0xf58c,  726,  496, {     0,   -56,   496,   440 } },
+    { 0xf58d,  727,  448, {     0,    32,   448,   352 } },
+    { 0xf58e,  728,  320, {     0,   -32,   320,   416 } },
+    { 0xf58f,  729,  512, {     0,   -32,   512,   416 } },
+    { 0xf590,  730,  512, {     0,   -64,   512,   448 } },
+    { 0xf591,  731,  544, {     0,   -64,   545,   449 } },
+    { 0xf593,  732,  512, {     0,   -64,   512,   448 } },
+    { 0xf594,  733,  576, {     0,   -64,   576,   448 } },
+    { 0xf595,  734,  640, {     0,   -64,   640,   448 } },
+    { 0xf596,  735,  496, {     0,   -56,   496,   440 } },
+    { 0xf597,  736,  496, {     0,   -56,   496,   440 } },
+    { 0xf598,  737,  504, {     0,   -56,   508,   440 } },
+    { 0xf599,  738,  496, {     0,   -56,   496,   440 } },
+    { 0xf59a,  739,  496, {     0,   -56,   496,   440 } },
+    { 0xf59b,  740,  496, {     0,   -56,   496,   440 } },
+    { 0xf59c,  741,  496, {     0,   -56,   496,   440 } },
+    { 0xf59d,  742,  640, {     0,   -64,   640,   448 } },
+    { 0xf59f,  743,  576, {     0,   -65,   576,   448 } },
+    { 0xf5a0,  744,  576, {     0,   -65,   576,   448 } },
+    { 0xf5a1,  745,  512, {    -2,   -66,   513,   449 } },
+    { 0xf5a2,  746,  512, {    -3,   -64,   515,   448 } },
+    { 0xf5a4,  747,  496, {     0,   -56,   496,   440 } },
+    { 0xf5a5,  748,  496, {     0,   -56,   496,   440 } },
+    { 0xf5a6,  749,  384, {     0,   -64,   384,   455 } },
+    { 0xf5a7,  750,  512, {     0,   -64,   515,   448 } },
+    { 0xf5aa,  751,  512, {     0,   -64,   512,   448 } },
+    { 0xf5ab,  752,  448, {     0,   -64,   448,   448 } },
+    { 0xf5ac,  753,  512, {     0,   -64,   519,   460 } },
+    { 0xf5ad,  754,  512, {     0,   -64,   513,   449 } },
+    { 0xf5ae,  755,  512, {    -2,   -66,   513,   449 } },
+    { 0xf5af,  756,  640, {     0,   -64,   640,   450 } },
+    { 0xf5b0,  757,  640, {    -2,   -64,   649,   416 } },
+    { 0xf5b1,  758,  384, {     0,   -39,   391,   416 } },
+    { 0xf5b3,  759,  496, {     0,   -56,   496,   440 } },
+    { 0xf5b4,  760,  496, {     0,   -56,   496,   440 } },
+    { 0xf5b6,  761,  640, {     0,   -32,   640,   416 } },
+    { 0xf5b7,  762,  640, {    -7,     0,   640,   387 } },
+    { 0xf5b8,  763,  496, {     0,   -56,   496,   440 } },
+    { 0xf5ba,  764,  640, {     0,   -65,   640,   448 } },
+    { 0xf5bb,  765,  576, {    -1,   -32,   577,   420 } },
+    { 0xf5bc,  766,  512, {   -12,   -41,   515,   423 } },
+    { 0xf5bd,  767,  512, {     0,   -64,   512,   448 } },
+    { 0xf5bf,  768,  512, {     0,   -64,   512,   455 } },
+    { 0xf5c0,  769,  536, {    -5,   -64,   541,   448 } },
+    { 0xf5c1,  770,  384, {     0,   -64,   384,   448 } },
+    { 0xf5c2,  771,  496, {     0,   -56,   496,   440 } },
+    { 0xf5c3,  772,  512, {     0,   -64,   512,   448 } },
+    { 0xf5c4,  773,  640, {     0,    32,   640,   360 } },
+    { 0xf5c5,  774,  640, {     0,   -32,   640,   416 } },
+    { 0xf5c7,  775,  640, {    -7,   -71,   647,   455 } },
+    { 0xf5c8,  776,  496, {     0,   -56,   496,   440 } },
+    { 0xf5c9,  777,  448, {   -11,   -64,   459,   457 } },
+    { 0xf5ca,  778,  640, {     0,   -64,   642,   452 } },
+    { 0xf5cb,  779,  512, {     0,   -64,   512,   448 } },
+    { 0xf5cd,  780,  512, {    -5,   -64,   517,   448 } },
+    { 0xf5ce,  781,  288, {    -5,   -64,   293,   448 } },
+    { 0xf5d0,  782,  384, {    -4,   -64,   388,   448 } },
+    { 0xf5d1,  783,  448, {    -4,   -65,   452,   448 } },
+    { 0xf5d2,  784,  448, {   -20,   -64,   468,   448 } },
+    { 0xf5d7,  785,  640, {     0,    32,   640,   352 } },
+    { 0xf5da,  786,  512, {     0,   -66,   513,   448 } },
+    { 0xf5dc,  787,  576, {     0,   -64,   576,   448 } },
+    { 0xf5de,  788,  480, {     0,     0,   480,   384 } },
+    { 0xf5df,  789,  512, {     0,     0,   512,   384 } },
+    { 0xf5e1,  790,  640, {    -2,   -69,   644,   450 } },
+    { 0xf5e4,  791,  640, {     0,   -32,   640,   416 } },
+    { 0xf5e7,  792,  576, {     0,   -64,   576,   448 } },
+    { 0xf5eb,  793,  512, {     0,   -65,   512,   448 } },
+    { 0xf5ee,  794,  448, {     0,   -32,   448,   416 } },
+    { 0xf5fc,  795,  640, {     0,   -64,   640,   448 } },
+    { 0xf5fd,  796,  512, {    -1,   -67,   513,   448 } },
+    { 0xf604,  797,  640, {     0,   -74,   640,   448 } },
+    { 0xf610,  798,  512, {     0,   -64,   512,   448 } },
+    { 0xf613,  799,  640, {     0,    32,   640,   352 } },
+    { 0xf619,  800,  512, {     0,   -64,   512,   448 } },
+    { 0xf61f,  801,  512, {     0,   -64,   518,   449 } },
+    { 0xf621,  802,  480, {    -2,   -64,   482,   448 } },
+    { 0xf62e,  803,  640, {     0,   -64,   640,   448 } },
+    { 0xf62f,  804,  640, {     0,   -64,   640,   448 } },
+    { 0xf630,  805,  640, {    -3,   -69,   642,   448 } },
+    { 0xf637,  806,  384, {     0,   -64,   384,   448 } },
+    { 0xf63b,  807,  640, {     0,   -64,   640,   448 } },
+    { 0xf63c,  808,  640, {     0,   -32,   640,   416 } },
+    { 0xf641,  809,  512, {     0,     0,   512,   384 } },
+    { 0xf644,  810,  320, {     0,   -64,   320,   448 } },
+    { 0xf647,  811,  448, {     0,   -64,   448,   448 } },
+    { 0xf64a,  812,  640, {     0,   -64,   640,   448 } },
+    { 0xf64f,  813,  640, {     0,   -64,   640,   448 } },
+    { 0xf651,  814,  512, {     0,   -32,   512,   416 } },
+    { 0xf653,  815,  576, {     0,   -32,   578,   416 } },
+    { 0xf654,  816,  384, {     0,   -64,   384,   448 } },
+    { 0xf655,  817,  512, {     0,   -64,   513,   448 } },
+    { 0xf658,  818,  512, {     0,   -64,   512,   449 } },
+    { 0xf65d,  819,  512, {     0,     0,   512,   384 } },
+    { 0xf65e,  820,  512, {     0,     0,   512,   384 } },
+    { 0xf662,  821,  640, {    -6,   -68,   640,   448 } },
+    { 0xf664,  822,  512, {     0,   -64,   512,   448 } },
+    { 0xf665,  823,  512, {     0,   -64,   512,   448 } },
+    { 0xf666,  824,  512, {    -3,   -64,   515,   448 } },
+    { 0xf669,  825,  576, {    16,   -64,   560,   448 } },
+    { 0xf66a,  826,  448, {     0,   -64,   448,   448 } },
+    { 0xf66b,  827,  576, {     0,   -65,   577,   448 } },
+    { 0xf66d,  828,  512, {   -13,   -65,   523,   448 } },
+    { 0xf66f,  829,  512, {     0,   -64,   512,   448 } },
+    { 0xf674,  830,  576, {     0,   -64,   576,   448 } },
+    { 0xf676,  831,  640, {     0,   -64,   640,   448 } },
+    { 0xf678,  832,  640, {     0,   -64,   640,   448 } },
+    { 0xf679,  833,  512, {    -1,   -64,   512,   453 } },
+    { 0xf67b,  834,  640, {    -1,   -64,   642,   448 } },
+    { 0xf67c,  835,  496, {     0,   -56,   496,   440 } },
+    { 0xf67f,  836,  640, {     0,   -64,   640,   455 } },
+    { 0xf681,  837,  448, {     0,   -32,   448,   416 } },
+    { 0xf682,  838,  448, {     0,   -32,   448,   416 } },
+    { 0xf683,  839,  384, {     0,   -64,   386,   448 } },
+    { 0xf684,  840,  640, {    -1,   -64,   640,   450 } },
+    { 0xf687,  841,  448, {     0,   -64,   448,   448 } },
+    { 0xf688,  842,  512, {     0,   -64,   513,   448 } },
+    { 0xf689,  843,  512, {     0,   -64,   513,   448 } },
+    { 0xf696,  844,  512, {    -6,   -64,   512,   448 } },
+    { 0xf698,  845,  576, {     0,   -64,   583,   448 } },
+    { 0xf699,  846,  512, {     0,   -64,   514,   448 } },
+    { 0xf69a,  847,  464, {    -6,   -64,   470,   448 } },
+    { 0xf69b,  848,  640, {     0,   -64,   640,   457 } },
+    { 0xf6a0,  849,  640, {     0,   -64,   640,   448 } },
+    { 0xf6a1,  850,  512, {     0,   -64,   512,   448 } },
+    { 0xf6a7,  851,  640, {    -2,   -64,   642,   448 } },
+    { 0xf6a9,  852,  512, {     0,    -5,   519,   389 } },
+    { 0xf6ad,  853,  496, {     0,   -56,   496,   440 } },
+    { 0xf6b6,  854,  576, {    -1,   -64,   576,   450 } },
+    { 0xf6b7,  855,  448, {     0,   -64,   448,   448 } },
+    { 0xf6bb,  856,  640, {     0,   -64,   640,   455 } },
+    { 0xf6be,  857,  512, {     0,   -64,   512,   416 } },
+    { 0xf6c0,  858,  448, {    -4,   -64,   452,   448 } },
+    { 0xf6c3,  859,  576, {     0,   -64,   578,   448 } },
+    { 0xf6c4,  860,  640, {     0,   -65,   640,   448 } },
+    { 0xf6cf,  861,  480, {    -2,   -66,   482,   448 } },
+    { 0xf6d1,  862,  448, {     0,   -67,   448,   459 } },
+    { 0xf6d3,  863,  576, {    32,   -64,   544,   419 } },
+    { 0xf6d5,  864,  640, {    -4,   -65,   642,   448 } },
+    { 0xf6d7,  865,  512, {     0,   -65,   515,   449 } },
+    { 0xf6d9,  866,  512, {     0,   -64,   512,   448 } },
+    { 0xf6dd,  867,  384, {     0,   -64,   384,   448 } },
+    { 0xf6de,  868,  384, {     0,   -64,   384,   448 } },
+    { 0xf6e2,  869,  384, {     0,   -71,   384,   451 } },
+    { 0xf6e3,  870,  576, {    -1,   -65,   583,   448 } },
+    { 0xf6e6,  871,  640, {     0,   -64,   640,   448 } },
+    { 0xf6e8,  872,  512, {     0,   -64,   512,   448 } },
+    { 0xf6ec,  873,  384, {    -1,   -65,   384,   448 } },
+    { 0xf6ed,  874,  640, {     0,   -32,   640,   416 } },
+    { 0xf6f0,  875,  576, {     0,   -64,   577,   448 } },
+    { 0xf6f1,  876,  576, {    -7,   -64,   583,   449 } },
+    { 0xf6f2,  877,  384, {     0,   -32,   384,   416 } },
+    { 0xf6fa,  878,  640, {   -15,     0,   661,   384 } },
+    { 0xf6fc,  879,  640, {     0,   -64,   640,   448 } },
+    { 0xf6ff,  880,  640, {     0,   -64,   640,   448 } },
+    { 0xf700,  881,  640, {    -7,   -64,   640,   449 } },
+    { 0xf70b,  882,  512, {     0,     0,   512,   384 } },
+    { 0xf70c,  883,  416, {     0,   -64,   416,   448 } },
+    { 0xf70e,  884,  640, {     0,   -64,   640,   448 } },
+    { 0xf714,  885,  448, {    -2,   -66,   450,   448 } },
+    { 0xf715,  886,  640, {    -7,   -71,   647,   455 } },
+    { 0xf717,  887,  576, {    -7,   -64,   583,   450 } },
+    { 0xf71e,  888,  576, {    -2,   -64,   576,   448 } },
+    { 0xf722,  889,  640, {     0,   -64,   640,   449 } },
+    { 0xf728,  890,  448, {     0,   -64,   448,   448 } },
+    { 0xf729,  891,  640, {     0,     0,   640,   384 } },
+    { 0xf72e,  892,  512, {     0,   -39,   522,   420 } },
+    { 0xf72f,  893,  512, {     0,   -64,   519,   455 } },
+    { 0xf73b,  894,  512, {     0,   -64,   512,   448 } },
+    { 0xf73c,  895,  576, {     0,   -64,   578,   448 } },
+    { 0xf73d,  896,  512, {     0,   -64,   512,   448 } },
+    { 0xf740,  897,  512, {    -2,   -64,   512,   448 } },
+    { 0xf743,  898,  576, {    -1,   -64,   576,   449 } },
+    { 0xf747,  899,  640, {    -6,   -64,   647,   453 } },
+    { 0xf74d,  900,  512, {     0,   -64,   512,   453 } },
+    { 0xf753,  901,  512, {     0,   -65,   512,   448 } },
+    { 0xf756,  902,  576, {     0,   -64,   576,   448 } },
+    { 0xf75a,  903,  448, {     0,   -64,   448,   448 } },
+    { 0xf75b,  904,  576, {     0,   -32,   576,   421 } },
+    { 0xf75e,  905,  640, {     0,   -34,   640,   416 } },
+    { 0xf75f,  906,  640, {     0,   -64,   640,   448 } },
+    { 0xf769,  907,  512, {     0,   -64,   512,   448 } },
+    { 0xf76b,  908,  512, {     0,   -64,   512,   448 } },
+    { 0xf772,  909,  640, {     0,   -32,   640,   416 } },
+    { 0xf773,  910,  576, {     0,    -1,   576,   385 } },
+    { 0xf77c,  911,  384, {    -3,   -64,   387,   448 } },
+    { 0xf77d,  912,  512, {     0,   -64,   512,   451 } },
+    { 0xf780,  913,  576, {    -2,   -74,   578,   451 } },
+    { 0xf781,  914,  512, {     0,   -76,   513,   448 } },
+    { 0xf783,  915,  448, {     0,   -64,   448,   448 } },
+    { 0xf784,  916,  448, {     0,   -64,   448,   448 } },
+    { 0xf786,  917,  512, {    -3,   -64,   524,   448 } },
+    { 0xf787,  918,  512, {    -3,   -66,   512,   448 } },
+    { 0xf788,  919,  512, {    -1,   -64,   513,   448 } },
+    { 0xf78c,  920,  512, {     0,   -71,   512,   448 } },
+    { 0xf793,  921,  576, {    -2,   -32,   578,   416 } },
+    { 0xf794,  922,  640, {    -2,   -32,   640,   417 } },
+    { 0xf796,  923,  512, {     0,     0,   512,   384 } },
+    { 0xf79c,  924,  640, {     0,   -64,   640,   450 } },
+    { 0xf79f,  925,  640, {    -3,   -67,   643,   451 } },
+    { 0xf7a0,  926,  512, {    -2,   -32,   514,   416 } },
+    { 0xf7a2,  927,  496, {     0,   -56,   496,   440 } },
+    { 0xf7a4,  928,  512, {     0,    96,   512,   288 } },
+    { 0xf7a5,  929,  256, {    32,   -64,   224,   448 } },
+    { 0xf7a6,  930,  512, {    -5,   -69,   512,   449 } },
+    { 0xf7a9,  931,  512, {    -2,   -33,   514,   420 } },
+    { 0xf7aa,  932,  448, {    -1,   -68,   450,   448 } },
+    { 0xf7ab,  933,  512, {     0,   -64,   518,   451 } },
+    { 0xf7ad,  934,  512, {    -4,   -65,   515,   448 } },
+    { 0xf7ae,  935,  576, {     0,   -32,   576,   416 } },
+    { 0xf7b5,  936,  448, {   -10,   -64,   451,   458 } },
+    { 0xf7b6,  937,  512, {     0,   -64,   512,   448 } },
+    { 0xf7b9,  938,  496, {    -1,   -56,   497,   398 } },
+    { 0xf7ba,  939,  496, {     0,   -56,   496,   440 } },
+    { 0xf7bd,  940,  640, {    32,   -64,   643,   448 } },
+    { 0xf7bf,  941,  512, {    -1,   -65,   513,   449 } },
+    { 0xf7c0,  942,  512, {    -8,   -72,   513,   448 } },
+    { 0xf7c2,  943,  384, {     0,   -64,   384,   448 } },
+    { 0xf7c4,  944,  384, {     0,   -64,   384,   448 } },
+    { 0xf7c5,  945,  448, {    -7,   -64,   448,   448 } },
+    { 0xf7c9,  946,  512, {    -2,   -64,   512,   448 } },
+    { 0xf7ca,  947,  576, {     0,   -64,   576,   448 } },
+    { 0xf7cc,  948,  640, {     0,   -32,   643,   416 } },
+    { 0xf7cd,  949,  512, {    -2,   -32,   512,   416 } },
+    { 0xf7ce,  950,  512, {    -2,   -64,   514,   451 } },
+    { 0xf7d0,  951,  512, {    -1,   -64,   514,   449 } },
+    { 0xf7d2,  952,  640, {     0,   -64,   640,   448 } },
+    { 0xf7d7,  953,  384, {     0,   -32,   384,   416 } },
+    { 0xf7d8,  954,  384, {     0,   -64,   384,   448 } },
+    { 0xf7d9,  955,  512, {    -1,   -65,   517,   453 } },
+    { 0xf7da,  956,  512, {    -2,   -64,   514,   448 } },
+    { 0xf7e4,  957,  448, {     0,   -64,   448,   448 } },
+    { 0xf7e5,  958,  576, {    -1,   -64,   577,   448 } },
+    { 0xf7e6,  959,  448, {     0,   -64,   448,   448 } },
+    { 0xf7ec,  960,  576, {     0,   -64,   576,   448 } },
+    { 0xf7ef,  961,  512, {     0,   -32,   512,   417 } },
+    { 0xf7f2,  962,  576, {    -1,   -64,   576,   449 } },
+    { 0xf7f5,  963,  512, {     0,   -32,   512,   416 } },
+    { 0xf7f7,  964,  512, {    -1,   -65,   512,   448 } },
+    { 0xf7fa,  965,  512, {   -12,   -41,   515,   423 } },
+    { 0xf7fb,  966,  384, {     0,   -64,   384,   448 } },
+    { 0xf805,  967,  512, {     0,   -32,   512,   416 } },
+    { 0xf806,  968,  512, {    32,   -64,   480,   449 } },
+    { 0xf807,  969,  512, {     0,     0,   512,   384 } },
+    { 0xf80d,  970,  640, {     0,   -64,   641,   448 } },
+    { 0xf80f,  971,  512, {    -2,   -66,   514,   450 } },
+    { 0xf810,  972,  448, {    32,   -65,   416,   449 } },
+    { 0xf812,  973,  640, {     0,   -64,   640,   448 } },
+    { 0xf815,  974,  512, {     0,     0,   512,   384 } },
+    { 0xf816,  975,  512, {     0,   -64,   512,   448 } },
+    { 0xf818,  976,  512, {     0,   -64,   513,   449 } },
+    { 0xf829,  977,  448, {     0,   -64,   448,   449 } },
+    { 0xf82a,  978,  448, {     0,   -64,   448,   449 } },
+    { 0xf82f,  979,  448, {     0,   -64,   448,   448 } },
+    { 0xf83e,  980,  640, {     0,   -32,   640,   416 } },
+    { 0xf84a,  981,  640, {     0,   -64,   640,   448 } },
+    { 0xf84c,  982,  448, {     0,   -32,   448,   416 } },
+    { 0xf850,  983,  448, {     0,   -32,   448,   416 } },
+    { 0xf853,  984,  448, {     0,   -32,   448,   416 } },
+    { 0xf863,  985,  512, {    -1,   -65,   513,   449 } },
+    { 0xf86d,  986,  512, {    -2,   -64,   514,   450 } },
+    { 0xf879,  987,  512, {     0,   -64,   512,   449 } },
+    { 0xf87b,  988,  448, {     0,   -32,   448,   416 } },
+    { 0xf87c,  989,  640, {     0,   -64,   640,   448 } },
+    { 0xf87d,  990,  640, {     0,   -64,   640,   448 } },
+    { 0xf881,  991,  448, {    -3,   -33,   448,   416 } },
+    { 0xf882,  992,  448, {    -3,   -33,   448,   416 } },
+    { 0xf884,  993,  512, {    -3,   -32,   512,   416 } },
+    { 0xf885,  994,  512, {    -3,   -32,   512,   416 } },
+    { 0xf886,  995,  448, {    -3,   -32,   433,   424 } },
+    { 0xf887,  996,  448, {    -3,   -32,   433,   424 } },
+    { 0xf891,  997,  576, {     0,   -65,   577,   448 } },
+    { 0xf897,  998,  640, {    -1,    32,   640,   320 } },
+    { 0xf8c0,  999,  640, {     0,   -32,   640,   384 } },
+    { 0xf8c1, 1000,  640, {    -5,   -32,   640,   385 } },
+    { 0xf8cc, 1001,  384, {     0,   -64,   384,   448 } },
+    { 0xf8d9, 1002,  512, {     8,   -56,   504,   440 } },
+    { 0xf8ff, 1003,  640, {     0,   -32,   640,   448 } },
+};
+
+static const quint64 solid_checksum = 0x47003d0500031ef0ull;
+static const int solid_units_per_em = 512;
+
+bool register_awesome_metrics()
+{
+    bool r = true;
+
+    r &= QFontIconEngine::registerGlyphMetrics(solid, solid_checksum, solid_units_per_em, solid_metrics,
+                                               int(sizeof(solid_metrics) / sizeof(solid_metrics[0])));
+
+    return r;
+}
+
+}
@@ -1,6 +1,10 @@
-#include <qfonticon.h>
+#include "qfonticon_p.h"
+#include "qfonticonpack_p.h"
 
 #include <QMap>
+#include <QHash>
+#include <QVector>
+#include <QVarLengthArray>
 #include <QRawFont>
 #include <QIconEngine>
 #include <QTimer>
@@ -13,101 +17,238 @@
 #include <QFontDatabase>
 #include <QPainterPath>
 #include <QFile>
+#include <QResource>
+#include <QSharedPointer>
+#include <QSet>
+#include <QtConcurrent>
+#include <QCache>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QSaveFile>
+#include <QDir>
+#include <QtEndian>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+#ifndef QFONTICON_VERSION
+#define QFONTICON_VERSION "unknown"
+#endif
+
+DiskPixmapCache::Header DiskPixmapCache::header()
+{
+    Header h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "QFIPACK", 8);
+    h.format = 1;
+    h.qt     = QT_VERSION;
+    qstrncpy(h.library, QFONTICON_VERSION, sizeof(h.library));
+    return h;
+}
 
-template<class T>
-class StateMap : public QMap<QPair<QIcon::Mode, QIcon::State>, T>
+bool DiskPixmapCache::open(const QString& dir)
 {
-public:
-    typedef QPair<QIcon::Mode, QIcon::State> Key;
+    if(!QDir().mkpath(dir))
+        return false;
 
-public:
-    StateMap() : QMap<Key, T>() {}
-    StateMap(StateMap<T> &&other) noexcept : QMap<Key, T>(other) {}
-    StateMap(const StateMap<T> &other) : QMap<Key, T>(other) {}
-    StateMap(std::initializer_list<std::pair<Key, T>> list)  : QMap<Key, T>(list) {}
-    StateMap<T>& operator=(StateMap<T> &&other) noexcept {  QMap<Key, T>::operator=(other); return *this; }
-    StateMap<T>& operator=(const StateMap<T> &other) noexcept {  QMap<Key, T>::operator=(other); return *this; }
-    ~StateMap() = default;
+    directory = QDir(dir).absolutePath();
+    map();
+    return true;
+}
 
-    T get(const Key& k, const T& defaultValue = {}) const
-    {
-        auto it = this->find(k);
-        if(it != this->end())
-            return it.value();
+void DiskPixmapCache::close(const QHash<int, quint64>& fontHashes)
+{
+    flush(fontHashes);
+    unmap();
+    directory.clear();
+}
 
-        if(k.first != QIcon::Normal)
-            return get(QIcon::Normal, k.second, defaultValue);
+void DiskPixmapCache::map()
+{
+    unmap();
 
-        if(k.second != QIcon::Off)
-            return get(QIcon::Normal, QIcon::Off, defaultValue);
+    QScopedPointer<QFile> f(new QFile(fileName()));
+    if(!f->open(QIODevice::ReadOnly) || f->size() < qint64(sizeof(Header)))
+        return;
 
-        return defaultValue;
-    }
+    auto p = f->map(0, f->size());
+    if(!p)
+        return;
 
-    T get(QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off, const T& defaultValue = {}) const
-    {
-        return get(Key{mode, state}, defaultValue);
-    }
+    // Anything written by another version is discarded on next flush.
+    Header expected = header();
+    Header h;
+    memcpy(&h, p, sizeof(h));
+
+    if(memcmp(&h, &expected, offsetof(Header, count)) != 0 ||
+       f->size() < qint64(sizeof(Header) + h.count * sizeof(Entry)))
+        return;
+
+    file.swap(f);
+    data  = p;
+    index = reinterpret_cast<const Entry*>(p + sizeof(Header));
+    count = h.count;
+}
 
-    void set(const T& value, const Key& k) { this->insert(k, value); }
+void DiskPixmapCache::unmap()
+{
+    file.reset();
+    data  = nullptr;
+    index = nullptr;
+    count = 0;
+    used.clear();
+}
 
-    void set(const T& value, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off)
+bool DiskPixmapCache::find(const Key& key, QImage& image)
+{
+    auto pit = pending.constFind(key);
+    if(pit != pending.cend())
     {
-        set(value, {mode, state});
+        image = pit.value();
+        return true;
     }
-};
-
 
+    auto end = index + count;
+    auto it = std::lower_bound(index, end, key, [](const Entry& e, const Key& k){ return e.key < k; });
+    if(it == end || !(it->key == key))
+        return false;
 
-// =============================================================================
+    quint64 bytes = quint64(key.width) * quint64(key.height) * 4;
+    if(it->bytes != bytes || it->offset + bytes > quint64(file->size()))
+        return false;
 
+    used.insert(quint32(it - index));
 
+    // Wraps the mapping, the caller converts it before the pack is remapped.
+    image = QImage(data + it->offset, key.width, key.height, key.width * 4, QImage::Format_ARGB32_Premultiplied);
+    return true;
+}
 
-class QFontIconEnginePrivate
+void DiskPixmapCache::insert(const Key& key, const QImage& image)
 {
-public:
-    QFontIconEnginePrivate();
-    ~QFontIconEnginePrivate();
+    auto img = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    if(img.bytesPerLine() != img.width() * 4)
+        return;
 
-    void setupTimer();
-    QSizeF resizeFont(const QSizeF& size, QRawFont& font, qreal scale, quint32 glyphIndex) const;
+    pending.insert(key, img);
+    pendingBytes += img.sizeInBytes();
 
-    StateMap<int> icons;
-    StateMap<int> fonts;
-    StateMap<qreal> scales;
-    StateMap<QColor> colors;
-    StateMap<qreal> speeds;
-    StateMap<QEasingCurve> curves;
+    if(budget >= 0 && pendingBytes > budget)
+        flush({});
+}
 
-    QWidget* widget = nullptr;
+void DiskPixmapCache::flush(const QHash<int, quint64>& fontHashes)
+{
+    if(pending.isEmpty() || !isOpen())
+        return;
 
-    bool badge = false;
+    struct Item
+    {
+        Key          key;
+        const uchar* bits;
+        quint64      bytes;
+    };
 
-    QScopedPointer<QTimer> timer;
-    StateMap<qreal> progress;
-    StateMap<qreal> angles;
+    // Images rendered or used this session come first, entries of fonts
+    // that changed since are dropped.
+    QVector<Item> items;
+    qint64 total = 0;
 
-    struct FontInfo
+    auto add = [&](const Key& k, const uchar* bits, quint64 bytes)
     {
-        int     appId = -1;
-        QString family;
-        QString style;
-        QFont   font;
+        auto hash = fontHashes.constFind(k.font);
+        if(hash != fontHashes.cend() && hash.value() != k.fontHash)
+            return;
+
+        if(budget >= 0 && total + qint64(bytes) > budget)
+            return;
+
+        total += bytes;
+        items.append({ k, bits, bytes });
     };
 
-    static int defaultFont;
-    static QMap<int, QRawFont> availableFonts;
-    static QRawFont& getFont(int font);
+    for(auto it = pending.cbegin(); it != pending.cend(); ++it)
+        add(it.key(), it->constBits(), quint64(it->sizeInBytes()));
+
+    for(int pass = 0; pass < 2; ++pass)
+    {
+        for(quint32 i = 0; i < count; ++i)
+        {
+            const auto& e = index[i];
+            if(used.contains(i) != (pass == 0) || pending.contains(e.key))
+                continue;
+
+            if(e.offset + e.bytes <= quint64(file->size()))
+                add(e.key, data + e.offset, e.bytes);
+        }
+    }
+
+    std::sort(items.begin(), items.end(), [](const Item& a, const Item& b){ return a.key < b.key; });
+
+    QSaveFile out(fileName());
+    if(!out.open(QIODevice::WriteOnly))
+    {
+        qWarning() << "QFontIcon: Cannot write disk cache" << fileName();
+        return;
+    }
+
+    Header h = header();
+    h.count = quint32(items.size());
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+
+    quint64 offset = sizeof(Header) + items.size() * sizeof(Entry);
+    for(const auto& i : items)
+    {
+        Entry e = { i.key, offset, i.bytes };
+        out.write(reinterpret_cast<const char*>(&e), sizeof(e));
+        offset += i.bytes;
+    }
+
+    for(const auto& i : items)
+        out.write(reinterpret_cast<const char*>(i.bits), qint64(i.bytes));
+
+    // The old pack cannot stay mapped while being replaced on every platform.
+    unmap();
+
+    if(!out.commit())
+        qWarning() << "QFontIcon: Cannot write disk cache" << fileName();
+
+    pending.clear();
+    pendingBytes = 0;
+    map();
+}
+
+
+
+// =============================================================================
+
+
+
+QFontIconEnginePrivate::QFontIconEnginePrivate()
+{
+    count(counters.liveEngines);
+}
 
-    static QMap<QString, int> iconNames;
-    static QMap<QString, int> fontNames;
-};
+QFontIconEnginePrivate::~QFontIconEnginePrivate()
+{
+    if(timer)
+        counters.activeTimers.fetch_sub(1, std::memory_order_relaxed);
 
-QFontIconEnginePrivate::QFontIconEnginePrivate() {}
-QFontIconEnginePrivate::~QFontIconEnginePrivate() {}
+    counters.liveEngines.fetch_sub(1, std::memory_order_relaxed);
+}
 
 void QFontIconEnginePrivate::setupTimer()
 {
+    if(timer)
+        counters.activeTimers.fetch_sub(1, std::memory_order_relaxed);
+
     timer.reset();
 
     if(!widget)
@@ -124,6 +265,9 @@ void QFontIconEnginePrivate::setupTimer()
                      widget, SLOT(update()));
     QObject::connect(timer.data(), &QTimer::timeout, [this]()
     {
+        TraceSpan span("tick");
+        count(counters.animationTicks);
+
         StateMap<qreal> new_progress;
         StateMap<qreal> new_angles;
 
@@ -151,628 +295,2905 @@ void QFontIconEnginePrivate::setupTimer()
     });
 
     timer->start();
+    count(counters.activeTimers);
 }
 
-QSizeF QFontIconEnginePrivate::resizeFont(const QSizeF& size, QRawFont& font, qreal scale, quint32 glyphIndex) const
+QColor QFontIconEnginePrivate::defaultColor(QIcon::Mode mode)
 {
-    qreal drawSize = qMax(size.width(), size.height())*scale;
-    font.setPixelSize(drawSize);
+    auto p = QGuiApplication::palette();
 
-    auto rect = font.boundingRect(glyphIndex);
+    switch (mode)
+    {
+    case QIcon::Active:
+        return p.color(QPalette::Active, QPalette::ButtonText);
 
-    auto rsize = rect.size();
+    case QIcon::Normal:
+        return p.color(QPalette::Normal, QPalette::ButtonText);
 
-    if(rsize.width() > size.width() || rsize.height() > size.height())
-    {
-        auto nsize = rsize.scaled(size, Qt::KeepAspectRatio);
-        qreal ratio = nsize.height() / rsize.height();
-        font.setPixelSize(drawSize * ratio);
-        return nsize;
+    case QIcon::Disabled:
+        return p.color(QPalette::Disabled, QPalette::ButtonText);
+
+    case QIcon::Selected:
+        return p.color(QPalette::Active, QPalette::ButtonText);
     }
-    else
-        return size;
+
+    return {};
+}
+
+bool QFontIconEnginePrivate::fontsLoading() const
+{
+    return std::any_of(fonts.begin(), fonts.end(), [](int f){ return isLoading(f); });
 }
 
 int QFontIconEnginePrivate::defaultFont = 0;
-QMap<int, QRawFont> QFontIconEnginePrivate::availableFonts;
+QMutex QFontIconEnginePrivate::fontsMutex;
+QMap<int, QFontIconEnginePrivate::FontData> QFontIconEnginePrivate::availableFonts;
+QHash<int, quint64> QFontIconEnginePrivate::loadingFonts;
+quint64 QFontIconEnginePrivate::loadRequests = 0;
 
-QRawFont& QFontIconEnginePrivate::getFont(int font)
+bool QFontIconEnginePrivate::hasFont(int font)
 {
-    Q_ASSERT(availableFonts.contains(font));
-    return availableFonts[font];
+    QMutexLocker lock(&fontsMutex);
+    return outlineTables.contains(font) || iconPacks.contains(font) || ensureLoaded(font, false);
 }
 
-QMap<QString, int> QFontIconEnginePrivate::iconNames;
-QMap<QString, int> QFontIconEnginePrivate::fontNames;
+// Must be called with fontsMutex held, which also makes concurrent first uses
+// of a registered font wait for a single load. The font file is mapped,
+// nothing is read from it.
+bool QFontIconEnginePrivate::ensureMapped(int font)
+{
+    auto it = availableFonts.find(font);
+    if(it == availableFonts.end())
+        return false;
 
+    auto& f = it.value();
+    f.lastUse = ++fontClock;
 
+    if(!f.data.isEmpty())
+        return true;
 
-// =============================================================================
+    TraceSpan span("loadFont");
+    span.event.font = font;
 
-/**
- * @class QFontIconEngine
- * @brief QIconEngine subclass to handle font glyphs as icons.
- *
- * QFontIconEngine can be used with any fonts. You presumably have embedded your
- * favourite glyph font in a @c .qrc file. The first thing you need to do is
- * loading you font using the loadFont() static function:
- *
- * @code
- * QFontIconEngine::loadFont(":/path/to/my_font.ttf");
- * @endcode
- *
- * Then you can use the icon() static helper function to easily create icons from
- * the font you just loaded:
- * @code
- * QIcon icon = QFontIconEngine::icon(0xf82b) // This is the code point of the glyph
- *
- * // Alternatively, you can make an enumeration and / or register string base names
- * enum glyph_code {
- *     super_glyph = 0xf82b
- * };
- *
- * QFontIconEngine::registerIconName("super-glyph", super_glyph);
- *
- * // And then use names instead:
- * QIcon otherIcon = QFontIconEngine::icon("super-glyph");
- * @endcode
- *
- * QFontIconEngine supports stateful icons. That means you can set different
- * glyphs and various other properties on a per-state basis, depending on
- * @c QIcon::Mode and @c QIcon::State . For example:
- *
- * @code
- * // Assuming you have registered icon names
- * // create the engine and then set properties
- * auto engine = new QFontIconEngine();
- * engine->setIcon("toggle-on",  QIcon::Normal, QIcon::On);
- * engine->setIcon("toggle-off", QIcon::Normal, QIcon::Off);
- *
- * engine->setColor(Qt::green, QIcon::Normal, QIcon::On);
- * engine->setColor(Qt::red,   QIcon::Normal, QIcon::Off);
- *
- * // Pass it to a QIcon. Note that QIcon takes the ownership of the engine so.
- * // Therefore it's unsafe to reuse if afterward.
- * QIcon icon(engine);
- * @endcode
- *
- * The default state is { QIcon::Normal, QIcon::Off }  It is the
- * one set by default when using helper fuctions. If you create and engine from
- * scratch, this state must be set.
- *
- * If a value is not available in a given state { M, S } , it will
- * first try to find a { QIcon::Normal, S } and if still not
- * successful, will ultimately default to { QIcon::Normal, QIcon::Off }.
- *
- * Properties also include a spinning animation. (Yep)
- * @code
- * // Assuming you'll put it on a button
- * auto btn = new QPushButton();
- *
- * auto engine = new QFontIconEngine();
- * engine->setIcon("spinner");
- *
- * engine->setWidget(btn); // You need to tell the engine which widget to update
- * engine->setSpeed(180); // speed is in degree per second. 180 <=> 1 turn in 2s
- * engine->setCurve(QEasingCurve::InOutSine); // You can even set non-linear rotation.
- *
- * // Pass it to a QIcon and profits
- * QIcon icon(engine);
- * @endcode
- *
- * You can load multiple fonts and use them seamlessly.
- * When loading a font you can specify a arbitrary font id and name which will
- * help you differenciate the fonts.
- * @code
- * enum icon_set
- * {
- *     primary_font,
- *     secondary_font
- * };
- *
- * QFontIconEngine::loadFont(":/path/to/my_font.ttf", primary_font, "primary");
- * QFontIconEngine::loadFont(":/path/to/my_font.ttf", secondary_font, "secondary");
- *
- * // Set a default
- * QFontIconEngine::setDefaultFont(primary_font);
- *
- * // Then you can pass either the font id of the font name depending on the
- * // overload you use:
- * QIcon icon = QFontIconEngine::icon("super-glyph", "secondary");
- *
- * // This one will use the default font set earlier
- * QIcon icon2 = QFontIconEngine::icon("super-glyph");
- * @endcode
- */
+    if(!mapFont(f.path, f))
+    {
+        qWarning() << "QFontIcon: Cannot read font" << f.path;
+        availableFonts.erase(it);
+        return false;
+    }
 
-/**
- * Construct and engine with the defaultFont() set but no icon. It is therefore
- * invalid.
- *
- * @see isValid()
- */
-QFontIconEngine::QFontIconEngine() :
-    d(new QFontIconEnginePrivate)
-{
-    setFont(defaultFont());
+    f.prepared = false;
+    enforceFontBudget(font);
+    return true;
 }
 
-/**
- * @brief Copy constructor.
- */
-QFontIconEngine::QFontIconEngine(const QFontIconEngine& other) :
-    d(new QFontIconEnginePrivate)
+// Must be called with fontsMutex held. The font is mapped and prepared, and
+// unless @a parse is false, parsed.
+bool QFontIconEnginePrivate::ensureLoaded(int font, bool parse)
 {
-    auto& od = other.d;
+    if(!ensureMapped(font))
+        return false;
 
-    d->icons = od->icons;
-    d->fonts = od->fonts;
-    d->colors = od->colors;
-    d->speeds = od->speeds;
-    d->curves = od->curves;
+    auto& f = availableFonts[font];
+    if(!f.prepared)
+        prepareFont(font, f);
 
-    d->widget = od->widget;
+    // QRawFont is bound to the thread creating it, fonts loaded in the
+    // background are only parsed there to be validated.
+    if(parse && !f.raw.isValid())
+    {
+        f.raw.loadFromData(f.data, 32, QFont::PreferDefaultHinting);
+        if(!f.raw.isValid())
+        {
+            qWarning() << "QFontIcon: Invalid font" << f.path;
+            availableFonts.remove(font);
+            return false;
+        }
+    }
 
-    d->setupTimer();
+    return true;
 }
 
-/**
- * @brief Construct and engine using @a icon and @a font.
- *
- * @a icon and @a font will set the { QIcon::Normal, QIcon::Off } state and
- * therefore be used by default.
- *
- * @param icon the code point fo the icon to use
- * @param font the font id to use
+/*
+ * 64 bits of the SHA-1 of the font file, computed once per load. The font is
+ * only mapped, not parsed nor prepared, so warm disk cache hits cost a read
+ * through the file. Returns 0 if the font is not available.
  */
-QFontIconEngine::QFontIconEngine(int icon, int font) :
-    QFontIconEngine()
+quint64 QFontIconEnginePrivate::fontHash(int font)
 {
-    setIcon(icon);
-    setFont(font);
+    QMutexLocker lock(&fontsMutex);
+
+    if(!ensureMapped(font))
+        return 0;
+
+    auto& f = availableFonts[font];
+    if(!f.hash)
+    {
+        auto sha1 = QCryptographicHash::hash(f.data, QCryptographicHash::Sha1);
+        f.hash = qMax<quint64>(1, qFromBigEndian<quint64>(reinterpret_cast<const uchar*>(sha1.constData())));
+    }
+
+    return f.hash;
 }
 
-/**
- * @brief Construct and engine using @a icon and @a font.
- *
- * @overload
- *
- * @param icon the glyph name fo the icon to use
- * @param font the font name to use
- */
-QFontIconEngine::QFontIconEngine(const QString& icon, const QString& font) :
-    QFontIconEngine()
+template<class T>
+static T readBE(const QByteArray& data, quint32 offset)
 {
-    setIcon(icon);
-    if(font.isEmpty())
-        setFont(defaultFont());
-    else
-        setFont(font);
+    return qFromBigEndian<T>(reinterpret_cast<const uchar*>(data.constData()) + offset);
 }
 
-QFontIconEngine::~QFontIconEngine() {}
-
-/**
- * @brief Whether the engine is valid.
- *
- * Invalid engine results in null icon and wont draw.
- *
- * An engine is considered valid if:
- * - it has an default and valid icon (valid code point or name)
- * - it has a default and valid font (loaded font and valid name)
+/*
+ * Walks the cmap table, preferring the full Unicode subtables (format 12)
+ * over the BMP ones (format 4). Returns false if the font has neither.
  */
-bool QFontIconEngine::isValid() const
+bool QFontIconEnginePrivate::forEachCodePoint(const QByteArray& data, const std::function<void(uint code, quint32 glyph)>& f)
 {
-    if(d->icons.empty())
-        return false;
+    auto size = quint32(data.size());
+    auto fits = [size](quint32 offset, quint32 length) { return offset <= size && length <= size - offset; };
 
-    if(d->fonts.empty())
+    if(!fits(0, 12))
+        return false;
+
+    // Table directory
+    quint32 cmap = 0;
+    quint16 tables = readBE<quint16>(data, 4);
+    for(quint16 i = 0; i < tables && fits(12 + i * 16, 16); ++i)
+    {
+        quint32 record = 12 + i * 16;
+        if(memcmp(data.constData() + record, "cmap", 4) == 0)
+        {
+            cmap = readBE<quint32>(data, record + 8);
+            break;
+        }
+    }
+
+    if(!cmap || !fits(cmap, 4))
+        return false;
+
+    // Best subtable: Unicode full repertoire first, then Unicode BMP.
+    quint32 best = 0;
+    int bestRank = 0;
+    quint16 subtables = readBE<quint16>(data, cmap + 2);
+    for(quint16 i = 0; i < subtables && fits(cmap + 4 + i * 8, 8); ++i)
+    {
+        quint32 record = cmap + 4 + i * 8;
+        quint16 platform = readBE<quint16>(data, record);
+        quint16 encoding = readBE<quint16>(data, record + 2);
+        quint32 offset   = cmap + readBE<quint32>(data, record + 4);
+
+        if(!fits(offset, 2))
+            continue;
+
+        quint16 format = readBE<quint16>(data, offset);
+        bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+
+        int rank = !unicode ? 0 : format == 12 ? 2 : format == 4 ? 1 : 0;
+        if(rank > bestRank)
+        {
+            best = offset;
+            bestRank = rank;
+        }
+    }
+
+    if(bestRank == 2)
+    {
+        if(!fits(best, 16))
+            return false;
+
+        quint32 groups = readBE<quint32>(data, best + 12);
+        for(quint32 i = 0; i < groups && fits(best + 16 + i * 12, 12); ++i)
+        {
+            quint32 group = best + 16 + i * 12;
+            quint32 start = readBE<quint32>(data, group);
+            quint32 end   = qMin<quint32>(readBE<quint32>(data, group + 4), 0x10FFFF);
+            quint32 glyph = readBE<quint32>(data, group + 8);
+
+            for(quint32 c = start; c <= end; ++c)
+            {
+                if(glyph + (c - start))
+                    f(c, glyph + (c - start));
+            }
+        }
+
+        return true;
+    }
+
+    if(bestRank == 1)
+    {
+        if(!fits(best, 14))
+            return false;
+
+        quint16 segments = readBE<quint16>(data, best + 6) / 2;
+        quint32 ends     = best + 14;
+        quint32 starts   = ends + segments * 2 + 2;
+        quint32 deltas   = starts + segments * 2;
+        quint32 ranges   = deltas + segments * 2;
+
+        if(!fits(ranges, segments * 2))
+            return false;
+
+        for(quint16 i = 0; i < segments; ++i)
+        {
+            quint16 end   = readBE<quint16>(data, ends + i * 2);
+            quint16 start = readBE<quint16>(data, starts + i * 2);
+            quint16 delta = readBE<quint16>(data, deltas + i * 2);
+            quint16 range = readBE<quint16>(data, ranges + i * 2);
+
+            for(quint32 c = start; c <= end && c != 0xFFFF; ++c)
+            {
+                quint16 glyph;
+                if(range == 0)
+                    glyph = quint16(c + delta);
+                else
+                {
+                    quint32 at = ranges + i * 2 + range + (c - start) * 2;
+                    if(!fits(at, 2))
+                        break;
+
+                    glyph = readBE<quint16>(data, at);
+                    if(glyph)
+                        glyph = quint16(glyph + delta);
+                }
+
+                if(glyph)
+                    f(c, glyph);
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Code points mapped by the font, its compiled in outlines or its icon pack,
+ * in ascending order.
+ */
+QVector<uint> QFontIconEnginePrivate::codePoints(int font)
+{
+    QVector<uint> codes;
+    QByteArray data;
+    {
+        QMutexLocker lock(&fontsMutex);
+
+        // Compiled in outlines and icon packs have no cmap, list their glyphs.
+        auto outlines = outlineTables.constFind(font);
+        if(outlines != outlineTables.cend())
+        {
+            for(int i = 0; i < outlines->count; ++i)
+                codes.append(outlines->outlines[i].code);
+        }
+
+        auto pack = iconPacks.constFind(font);
+        if(pack != iconPacks.cend())
+        {
+            using namespace QFontIconPack;
+            for(quint32 i = 0; i < pack->glyphCount; ++i)
+                codes.append(readLE<quint32>(pack->data.constData(), pack->glyphs + i * GlyphSize + GlyphCode));
+        }
+
+        if(ensureLoaded(font, false))
+            data = availableFonts[font].data;
+    }
+
+    if(!data.isEmpty())
+        forEachCodePoint(data, [&codes](uint code, quint32) { codes.append(code); });
+
+    std::sort(codes.begin(), codes.end());
+    codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+    return codes;
+}
+
+/*
+ * One bit per code point up to the largest one mapped by the font. Never null,
+ * even for fonts without a readable cmap, so it is only built once.
+ */
+QBitArray QFontIconEnginePrivate::coverage(const QByteArray& data)
+{
+    uint last = 0;
+    forEachCodePoint(data, [&last](uint code, quint32) { last = qMax(last, code); });
+
+    QBitArray bits(int(last) + 1);
+    forEachCodePoint(data, [&bits](uint code, quint32) { bits.setBit(int(code)); });
+    return bits;
+}
+
+QBitArray QFontIconEnginePrivate::coverage(const MetricsTable& metrics)
+{
+    QBitArray bits(int(metrics.glyphs[metrics.count - 1].code) + 1);
+    for(int i = 0; i < metrics.count; ++i)
+        bits.setBit(int(metrics.glyphs[i].code));
+    return bits;
+}
+
+QHash<int, QFontIconEnginePrivate::MetricsTable> QFontIconEnginePrivate::metricsTables;
+
+/*
+ * The whole font checksum stored in the head table, with the file size. Cheap
+ * enough to check every font against its registered metrics, unlike
+ * fontHash(). Returns 0 if the font has no head table.
+ */
+quint64 QFontIconEnginePrivate::fontChecksum(const QByteArray& data)
+{
+    auto size = quint32(data.size());
+    if(size < 12)
+        return 0;
+
+    quint16 tables = readBE<quint16>(data, 4);
+    for(quint16 i = 0; i < tables && 12 + i * 16 + 16 <= size; ++i)
+    {
+        quint32 record = 12 + i * 16;
+        if(memcmp(data.constData() + record, "head", 4) != 0)
+            continue;
+
+        quint32 head = readBE<quint32>(data, record + 8);
+        if(head > size || size - head < 12)
+            return 0;
+
+        return (quint64(readBE<quint32>(data, head + 8)) << 32) | size;
+    }
+
+    return 0;
+}
+
+// Must be called with fontsMutex held, once the font is mapped. Registered
+// metrics matching the font replace its cmap when building the coverage.
+void QFontIconEnginePrivate::prepareFont(int font, FontData& f)
+{
+    auto it = metricsTables.constFind(font);
+    if(it != metricsTables.cend() && it->checksum == fontChecksum(f.data))
+        f.metrics = it.value();
+    else
+        f.metrics = MetricsTable {};
+
+    if(f.coverage.isNull())
+        f.coverage = f.metrics.count ? coverage(f.metrics) : coverage(f.data);
+
+    f.prepared = true;
+}
+
+QHash<int, QFontIconEnginePrivate::OutlineTable> QFontIconEnginePrivate::outlineTables;
+
+const QFontIconEngine::Outline* QFontIconEnginePrivate::findOutline(const OutlineTable& table, int code)
+{
+    auto end = table.outlines + table.count;
+    auto it = std::lower_bound(table.outlines, end, uint(code), [](const QFontIconEngine::Outline& o, uint c) { return o.code < c; });
+    return it != end && it->code == uint(code) ? it : nullptr;
+}
+
+QHash<int, QFontIconEnginePrivate::IconPack> QFontIconEnginePrivate::iconPacks;
+
+/*
+ * Maps the pack and checks its header and section bounds, nothing more: the
+ * glyphs are only read when first drawn.
+ */
+bool QFontIconEnginePrivate::openIconPack(const QString& filename, IconPack& pack)
+{
+    using namespace QFontIconPack;
+
+    FontData f;
+    if(!mapFont(filename, f))
+    {
+        qWarning() << "QFontIcon: Cannot read icon pack" << filename;
+        return false;
+    }
+
+    const char* d = f.data.constData();
+    auto size = quint32(f.data.size());
+    auto fits = [size](quint32 offset, quint64 length) { return offset <= size && length <= size - offset; };
+
+    bool valid = size >= HeaderSize && memcmp(d, Magic, 4) == 0 &&
+                 readLE<quint16>(d, VersionField) == Version &&
+                 readLE<quint32>(d, SizeField) == size;
+
+    if(valid)
+    {
+        pack.unitsPerEm = readLE<quint16>(d, UnitsPerEmField);
+        pack.shift      = readLE<quint16>(d, ShiftField);
+        pack.glyphCount = readLE<quint32>(d, GlyphCountField);
+        pack.nameCount  = readLE<quint32>(d, NameCountField);
+        pack.glyphs     = readLE<quint32>(d, GlyphsField);
+        pack.names      = readLE<quint32>(d, NamesField);
+        pack.strings    = readLE<quint32>(d, StringsField);
+        pack.commands   = readLE<quint32>(d, CommandsField);
+        pack.points     = readLE<quint32>(d, PointsField);
+
+        valid = pack.unitsPerEm > 0 && pack.shift <= 8 &&
+                pack.glyphs >= HeaderSize && fits(pack.glyphs, quint64(pack.glyphCount) * GlyphSize) &&
+                pack.names >= HeaderSize && fits(pack.names, quint64(pack.nameCount) * NameSize) &&
+                pack.strings <= pack.commands && pack.commands <= pack.points && pack.points <= size;
+    }
+
+    if(!valid)
+    {
+        qWarning() << "QFontIcon: Invalid icon pack" << filename;
+        return false;
+    }
+
+    pack.file = f.file;
+    pack.data = f.data;
+    return true;
+}
+
+// Offset of the glyph record of @a code, 0 if the pack has none.
+quint32 QFontIconEnginePrivate::findPackGlyph(const IconPack& pack, int code)
+{
+    using namespace QFontIconPack;
+
+    const char* d = pack.data.constData();
+    auto codeAt = [d, &pack](quint32 i) { return readLE<quint32>(d, pack.glyphs + i * GlyphSize + GlyphCode); };
+
+    quint32 lo = 0;
+    quint32 hi = pack.glyphCount;
+    while(lo < hi)
+    {
+        quint32 mid = lo + (hi - lo) / 2;
+        if(codeAt(mid) < uint(code))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo < pack.glyphCount && codeAt(lo) == uint(code) ? pack.glyphs + lo * GlyphSize : 0;
+}
+
+int QFontIconEnginePrivate::resolvePackName(QStringView name)
+{
+    using namespace QFontIconPack;
+
+    QMutexLocker lock(&fontsMutex);
+
+    for(const auto& pack : iconPacks)
+    {
+        const char* d = pack.data.constData();
+        auto nameAt = [d, &pack](quint32 i) -> QLatin1String
+        {
+            quint32 record = pack.names + i * NameSize;
+            quint32 string = pack.strings + readLE<quint32>(d, record + NameString);
+            quint32 length = readLE<quint32>(d, record + NameLength);
+
+            if(string > pack.commands || length > pack.commands - string)
+                return QLatin1String();
+
+            return QLatin1String(d + string, int(length));
+        };
+
+        quint32 lo = 0;
+        quint32 hi = pack.nameCount;
+        while(lo < hi)
+        {
+            quint32 mid = lo + (hi - lo) / 2;
+            if(name.compare(nameAt(mid)) > 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        if(lo < pack.nameCount && name.compare(nameAt(lo)) == 0)
+            return int(readLE<quint32>(d, pack.names + lo * NameSize + NameCode));
+    }
+
+    return QFontIconEngine::InvalidIcon;
+}
+
+// Linear in the number of names, reverse lookups are rare.
+QString QFontIconEnginePrivate::resolvePackCode(int code)
+{
+    using namespace QFontIconPack;
+
+    QMutexLocker lock(&fontsMutex);
+
+    for(const auto& pack : iconPacks)
+    {
+        const char* d = pack.data.constData();
+        for(quint32 i = 0; i < pack.nameCount; ++i)
+        {
+            quint32 record = pack.names + i * NameSize;
+            if(readLE<quint32>(d, record + NameCode) != uint(code))
+                continue;
+
+            quint32 string = pack.strings + readLE<quint32>(d, record + NameString);
+            quint32 length = readLE<quint32>(d, record + NameLength);
+            if(string <= pack.commands && length <= pack.commands - string)
+                return QString::fromLatin1(d + string, int(length));
+        }
+    }
+
+    return {};
+}
+
+QVector<int> QFontIconEnginePrivate::fontPriority;
+std::atomic<quint64> QFontIconEnginePrivate::fontGeneration(1);
+
+/*
+ * The first font, in priority order, mapping @a code. Fonts only registered
+ * are mapped to read their coverage. Returns AnyFont if none does.
+ */
+int QFontIconEnginePrivate::findFont(int code)
+{
+    if(code < 0)
+        return QFontIconEngine::AnyFont;
+
+    QMutexLocker lock(&fontsMutex);
+
+    // Loading a font may drop it, iterate over a copy of the ids.
+    QVector<int> order = fontPriority;
+    if(order.isEmpty())
+        order = knownFonts();
+
+    for(int font : order)
+    {
+        auto outlines = outlineTables.constFind(font);
+        if(outlines != outlineTables.cend() && findOutline(*outlines, code))
+            return font;
+
+        auto pack = iconPacks.constFind(font);
+        if(pack != iconPacks.cend() && findPackGlyph(*pack, code))
+            return font;
+
+        if(!ensureLoaded(font, false))
+            continue;
+
+        const auto& bits = availableFonts[font].coverage;
+        if(code < bits.size() && bits.testBit(code))
+            return font;
+    }
+
+    return QFontIconEngine::AnyFont;
+}
+
+/*
+ * Every font id with a font, compiled in outlines or an icon pack, in
+ * ascending order. Must be called with fontsMutex held.
+ */
+QVector<int> QFontIconEnginePrivate::knownFonts()
+{
+    QVector<int> ids;
+    for(auto it = availableFonts.cbegin(); it != availableFonts.cend(); ++it)
+        ids.append(it.key());
+    for(auto it = outlineTables.cbegin(); it != outlineTables.cend(); ++it)
+        ids.append(it.key());
+    for(auto it = iconPacks.cbegin(); it != iconPacks.cend(); ++it)
+        ids.append(it.key());
+
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+int QFontIconEnginePrivate::resolveFont(QIcon::Mode mode, QIcon::State state, int icon)
+{
+    quint64 generation = fontGeneration.load(std::memory_order_relaxed);
+    if(resolvedGeneration != generation)
+    {
+        resolvedFonts.clear();
+        resolvedGeneration = generation;
+    }
+
+    StateMap<int>::Key key { mode, state };
+
+    auto it = resolvedFonts.constFind(key);
+    if(it != resolvedFonts.cend())
+        return it.value();
+
+    int font = findFont(icon);
+    resolvedFonts.set(font, key);
+    return font;
+}
+
+qint64 QFontIconEnginePrivate::fontBudget = -1;
+quint64 QFontIconEnginePrivate::fontClock = 0;
+bool QFontIconEnginePrivate::atlasUnlimited = false;
+
+// Must be called with fontsMutex held. The font being used is never released.
+void QFontIconEnginePrivate::enforceFontBudget(int keep)
+{
+    if(fontBudget < 0)
+        return;
+
+    qint64 total = 0;
+    for(const auto& f : availableFonts)
+        total += f.data.size();
+
+    while(total > fontBudget)
+    {
+        auto lru = availableFonts.end();
+        for(auto it = availableFonts.begin(); it != availableFonts.end(); ++it)
+        {
+            if(it.key() == keep || it->data.isEmpty())
+                continue;
+
+            if(lru == availableFonts.end() || it->lastUse < lru->lastUse)
+                lru = it;
+        }
+
+        if(lru == availableFonts.end())
+            break;
+
+        total -= lru->data.size();
+        releaseFont(lru.value());
+    }
+}
+
+bool QFontIconEnginePrivate::isLoading(int font)
+{
+    QMutexLocker lock(&fontsMutex);
+    return loadingFonts.contains(font);
+}
+
+QRawFont QFontIconEnginePrivate::getFont(int font)
+{
+    QMutexLocker lock(&fontsMutex);
+
+    if(!ensureLoaded(font))
+        return {};
+
+    return availableFonts.value(font).raw;
+}
+
+bool QFontIconEnginePrivate::mapFont(const QString& filename, FontData& font)
+{
+    if(filename.startsWith(QLatin1String(":/")) || filename.startsWith(QLatin1String("qrc:/")))
+    {
+        // Resources already live in memory, use them in place.
+        QResource resource(filename.startsWith(QLatin1Char(':')) ? filename : filename.mid(3));
+        if(!resource.isValid())
+            return false;
+
+        if(resource.compressionAlgorithm() == QResource::NoCompression)
+            font.data = QByteArray::fromRawData(reinterpret_cast<const char*>(resource.data()), int(resource.size()));
+        else
+            font.data = resource.uncompressedData();
+
+        return !font.data.isEmpty();
+    }
+
+    QSharedPointer<QFile> file(new QFile(filename));
+    if(!file->open(QIODevice::ReadOnly))
+        return false;
+
+    // Mapped pages are shared with every other process using the same file.
+    if(auto p = file->map(0, file->size()))
+    {
+        font.file = file;
+        font.data = QByteArray::fromRawData(reinterpret_cast<const char*>(p), int(file->size()));
+    }
+    else
+        font.data = file->readAll();
+
+    return !font.data.isEmpty();
+}
+
+static QString codeToString(int code)
+{
+    uint ucs4 = uint(code);
+    if(QChar::requiresSurrogates(ucs4))
+        return QString({ QChar(QChar::highSurrogate(ucs4)), QChar(QChar::lowSurrogate(ucs4)) });
+
+    return QString(QChar(ucs4));
+}
+
+static quint64 glyphKey(int font, int code)
+{
+    return (quint64(uint(font)) << 32) | uint(code);
+}
+
+AccountedCache<quint64, QFontIconEnginePrivate::Glyph> QFontIconEnginePrivate::glyphs(2 * 1024 * 1024);
+
+QFontIconEnginePrivate::Glyph QFontIconEnginePrivate::glyph(int font, int code)
+{
+    auto key = glyphKey(font, code);
+
+    if(auto cached = glyphs.object(key))
+    {
+        count(counters.outlineCacheHits);
+        return *cached;
+    }
+
+    count(counters.outlineCacheMisses);
+
+    TraceSpan span("outlineFill");
+    span.event.font = font;
+    span.event.code = code;
+
+    Glyph g;
+    if(!embeddedGlyph(font, code, g) && !packGlyph(font, code, g))
+    {
+        // Extract the outline at one pixel per font unit, painting only
+        // scales it.
+        QRawFont raw = getFont(font);
+        if(!raw.isValid())
+            return {};
+
+        raw.setPixelSize(raw.unitsPerEm());
+
+        if(!glyphMetrics(font, code, g))
+        {
+            // Codes the font does not map stay empty rather than drawing
+            // glyph 0, the missing glyph box.
+            if(covers(font, code))
+                g.index = raw.glyphIndexesForString(codeToString(code)).value(0);
+
+            if(g.index)
+            {
+                g.unitsPerEm = raw.unitsPerEm();
+                g.bounds     = raw.boundingRect(g.index);
+            }
+        }
+
+        if(g.index)
+            g.path = raw.pathForGlyph(g.index);
+    }
+
+    int cost = int(sizeof(Glyph) + size_t(g.path.elementCount()) * sizeof(QPainterPath::Element));
+    glyphs.insert(key, new Glyph(g), cost);
+    return g;
+}
+
+// Whether the loaded font maps @a code, from its coverage bitmap.
+bool QFontIconEnginePrivate::covers(int font, int code)
+{
+    QMutexLocker lock(&fontsMutex);
+
+    auto it = availableFonts.constFind(font);
+    return it != availableFonts.cend() && code >= 0 && code < it->coverage.size() && it->coverage.testBit(code);
+}
+
+// Index and bounds of the glyph from the registered metrics of the font, if
+// they match it.
+bool QFontIconEnginePrivate::glyphMetrics(int font, int code, Glyph& glyph)
+{
+    QMutexLocker lock(&fontsMutex);
+
+    auto it = availableFonts.constFind(font);
+    if(it == availableFonts.cend() || !it->metrics.count)
+        return false;
+
+    const auto& m = it->metrics;
+    auto end = m.glyphs + m.count;
+    auto e = std::lower_bound(m.glyphs, end, uint(code), [](const QFontIconEngine::GlyphMetrics& g, uint c) { return g.code < c; });
+    if(e == end || e->code != uint(code))
+        return false;
+
+    // QRawFont bounds are y down
+    glyph.index      = e->index;
+    glyph.unitsPerEm = m.unitsPerEm;
+    glyph.bounds     = QRectF(e->bounds[0], -e->bounds[3], e->bounds[2] - e->bounds[0], e->bounds[3] - e->bounds[1]);
+    return true;
+}
+
+/*
+ * Appends outline @a commands to @a path, taking points from @a point(i), y
+ * up. Returns false if a command is unknown or needs more than @a points
+ * points.
+ */
+template<class Point>
+static bool buildOutline(QPainterPath& path, const quint8* commands, int count, quint32 points, Point point)
+{
+    path.setFillRule(Qt::WindingFill);
+
+    quint32 p = 0;
+    for(int i = 0; i < count; ++i)
+    {
+        quint32 needed = commands[i] == QFontIconEngine::CubicTo      ? 3
+                       : commands[i] == QFontIconEngine::QuadTo       ? 2
+                       : commands[i] == QFontIconEngine::CloseSubpath ? 0 : 1;
+        if(needed > points - p)
+            return false;
+
+        switch(commands[i])
+        {
+        case QFontIconEngine::MoveTo:       path.moveTo(point(p)); break;
+        case QFontIconEngine::LineTo:       path.lineTo(point(p)); break;
+        case QFontIconEngine::QuadTo:       path.quadTo(point(p), point(p + 1)); break;
+        case QFontIconEngine::CubicTo:      path.cubicTo(point(p), point(p + 1), point(p + 2)); break;
+        case QFontIconEngine::CloseSubpath: path.closeSubpath(); break;
+        default:                            return false;
+        }
+
+        p += needed;
+    }
+
+    return true;
+}
+
+// Builds the glyph from the outlines registered for the font, if it has one.
+bool QFontIconEnginePrivate::embeddedGlyph(int font, int code, Glyph& glyph)
+{
+    const QFontIconEngine::Outline* o = nullptr;
+    int unitsPerEm = 0;
+    {
+        QMutexLocker lock(&fontsMutex);
+
+        auto it = outlineTables.constFind(font);
+        if(it == outlineTables.cend() || !(o = findOutline(*it, code)))
+            return false;
+
+        unitsPerEm = it->unitsPerEm;
+    }
+
+    // Outlines are y up, paths y down like the QRawFont ones.
+    const qint16* points = o->points;
+    QPainterPath path;
+    buildOutline(path, o->commands, o->commandCount, UINT_MAX, [points](quint32 i)
+    {
+        return QPointF(points[2 * i], -points[2 * i + 1]);
+    });
+
+    glyph.index      = o->index;
+    glyph.unitsPerEm = unitsPerEm;
+    glyph.bounds     = QRectF(o->bounds[0], -o->bounds[3], o->bounds[2] - o->bounds[0], o->bounds[3] - o->bounds[1]);
+    glyph.path       = path;
+    return true;
+}
+
+// Decodes the glyph from the icon pack loaded for the font, if it has one.
+bool QFontIconEnginePrivate::packGlyph(int font, int code, Glyph& glyph)
+{
+    using namespace QFontIconPack;
+
+    IconPack pack;
+    {
+        QMutexLocker lock(&fontsMutex);
+
+        auto it = iconPacks.constFind(font);
+        if(it == iconPacks.cend())
+            return false;
+
+        pack = it.value();
+    }
+
+    quint32 record = findPackGlyph(pack, code);
+    if(!record)
+        return false;
+
+    const char* d = pack.data.constData();
+    quint32 commands = readLE<quint32>(d, record + GlyphCommands);
+    quint32 count    = readLE<quint32>(d, record + GlyphCommandCount);
+    quint32 first    = readLE<quint32>(d, record + GlyphPoints);
+
+    quint32 commandBytes = pack.points - pack.commands;
+    quint32 pointCount   = (quint32(pack.data.size()) - pack.points) / 4;
+
+    QPainterPath path;
+    bool valid = commands <= commandBytes && count <= commandBytes - commands && count <= INT_MAX && first <= pointCount;
+    if(valid)
+    {
+        const char* points = d + pack.points + first * 4;
+        qreal unit = 1.0 / (1 << pack.shift);
+
+        valid = buildOutline(path, reinterpret_cast<const quint8*>(d + pack.commands + commands), int(count),
+                             pointCount - first, [points, unit](quint32 i)
+        {
+            return QPointF(readLE<qint16>(points, i * 4) * unit, -readLE<qint16>(points, i * 4 + 2) * unit);
+        });
+    }
+
+    if(!valid)
+    {
+        qWarning() << "QFontIcon: Invalid icon pack glyph" << code;
+        return false;
+    }
+
+    qint16 b[4];
+    for(int i = 0; i < 4; ++i)
+        b[i] = readLE<qint16>(d, record + GlyphBounds + i * 2);
+
+    glyph.index      = readLE<quint32>(d, record + GlyphIndex);
+    glyph.unitsPerEm = pack.unitsPerEm;
+    glyph.bounds     = QRectF(b[0], -b[3], b[2] - b[0], b[3] - b[1]);
+    glyph.path       = path;
+    return true;
+}
+
+QTransform QFontIconEnginePrivate::glyphTransform(const Glyph& glyph, const QRectF& rect, qreal scale, qreal angle)
+{
+    // Same sizing as a font set to the largest side of rect times scale, then
+    // shrunk if the glyph would overflow.
+    auto size = rect.size();
+    qreal k = qMax(size.width(), size.height()) * scale / glyph.unitsPerEm;
+
+    auto gsize = glyph.bounds.size() * k;
+    if(!gsize.isEmpty() && (gsize.width() > size.width() || gsize.height() > size.height()))
+        k *= gsize.scaled(size, Qt::KeepAspectRatio).height() / gsize.height();
+
+    auto center = rect.center();
+    auto gcenter = glyph.bounds.center();
+
+    QTransform t;
+    t.translate(center.x(), center.y());
+    if(angle != 0)
+        t.rotate(angle);
+    t.scale(k, k);
+    t.translate(-gcenter.x(), -gcenter.y());
+    return t;
+}
+
+AccountedCache<QFontIconEnginePrivate::PixmapKey, QPixmap> QFontIconEnginePrivate::pixmaps(4 * 1024 * 1024);
+
+// Drops the bytes and parsed font, keeping the path to reload it on next use.
+void QFontIconEnginePrivate::releaseFont(FontData& font)
+{
+    font.raw      = QRawFont();
+    font.data     = QByteArray();
+    font.hash     = 0;
+    font.prepared = false;
+    font.file.reset();
+}
+
+DiskPixmapCache QFontIconEnginePrivate::diskCache;
+
+// Hashes of the fonts used this session, fonts hashed differently on disk
+// have changed.
+QHash<int, quint64> QFontIconEnginePrivate::fontHashes()
+{
+    QMutexLocker lock(&fontsMutex);
+
+    QHash<int, quint64> hashes;
+    for(auto it = availableFonts.cbegin(); it != availableFonts.cend(); ++it)
+    {
+        if(it->hash)
+            hashes.insert(it.key(), it->hash);
+    }
+
+    return hashes;
+}
+
+void QFontIconEnginePrivate::flushDiskCache()
+{
+    diskCache.flush(fontHashes());
+}
+
+void QFontIconEnginePrivate::purgeFont(int font)
+{
+    for(auto k : glyphs.keys())
+    {
+        if(int(k >> 32) == font)
+            glyphs.remove(k);
+    }
+
+    for(const auto& k : pixmaps.keys())
+    {
+        if(k.font == font)
+            pixmaps.remove(k);
+    }
+
+    for(auto atlas : QFontIconAtlasPrivate::atlases())
+        atlas->removeFont(font);
+
+    // AnyFont handles may have picked this font, they pick again.
+    for(auto& h : handles)
+    {
+        if(h.font == font || h.font == QFontIconEngine::AnyFont)
+        {
+            h.loaded = false;
+            h.glyph  = Glyph();
+        }
+    }
+}
+
+QVector<QFontIconEnginePrivate::Handle> QFontIconEnginePrivate::handles;
+QHash<quint64, quint32> QFontIconEnginePrivate::handleIndex;
+
+quint32 QFontIconEnginePrivate::glyphHandle(int font, int code)
+{
+    auto key = glyphKey(font, code);
+
+    auto it = handleIndex.constFind(key);
+    if(it != handleIndex.cend())
+        return it.value();
+
+    handles.append({ font, code, false, 0, Glyph() });
+    quint32 handle = quint32(handles.size());
+    handleIndex.insert(key, handle);
+    return handle;
+}
+
+const QFontIconEnginePrivate::Glyph& QFontIconEnginePrivate::handleGlyph(quint32 handle)
+{
+    auto& h = handles[int(handle) - 1];
+
+    // Missing glyphs and AnyFont picks may change with the fonts available
+    quint64 generation = fontGeneration.load(std::memory_order_relaxed);
+    bool stale = h.generation != generation && (h.glyph.path.isEmpty() || h.font == QFontIconEngine::AnyFont);
+    if(!h.loaded || stale)
+    {
+        int font = h.font == QFontIconEngine::AnyFont ? findFont(h.code) : h.font;
+        h.glyph      = glyph(font, h.code);
+        h.loaded     = true;
+        h.generation = generation;
+    }
+
+    return h.glyph;
+}
+
+QFontIconEnginePrivate::Counters QFontIconEnginePrivate::counters;
+
+std::atomic<bool> QFontIconEnginePrivate::tracing(false);
+QMutex QFontIconEnginePrivate::traceMutex;
+QElapsedTimer QFontIconEnginePrivate::traceClock;
+QFontIconEngine::TraceSink QFontIconEnginePrivate::traceSink;
+QScopedPointer<QFile> QFontIconEnginePrivate::traceFile;
+bool QFontIconEnginePrivate::traceFirstEvent = true;
+
+void QFontIconEnginePrivate::startTracing()
+{
+    if(!traceClock.isValid())
+        traceClock.start();
+
+    tracing.store(traceSink || traceFile, std::memory_order_relaxed);
+}
+
+void QFontIconEnginePrivate::trace(const QFontIconEngine::TraceEvent& event)
+{
+    QMutexLocker lock(&traceMutex);
+
+    if(traceSink)
+        traceSink(event);
+
+    if(traceFile)
+        writeTraceEvent(event);
+}
+
+void QFontIconEnginePrivate::writeTraceEvent(const QFontIconEngine::TraceEvent& event)
+{
+    // Chrome trace event format, complete events in a JSON array.
+    QByteArray json;
+    json.reserve(256);
+
+    json += traceFirstEvent ? "[\n" : ",\n";
+    json += "{\"name\":\"";
+    json += event.name;
+    json += "\",\"cat\":\"QFontIcon\",\"ph\":\"X\",\"ts\":";
+    json += QByteArray::number(event.start / 1000.0, 'f', 3);
+    json += ",\"dur\":";
+    json += QByteArray::number(event.duration / 1000.0, 'f', 3);
+    json += ",\"pid\":";
+    json += QByteArray::number(QCoreApplication::applicationPid());
+    json += ",\"tid\":";
+    json += QByteArray::number(event.thread);
+    json += ",\"args\":{";
+
+    QByteArray args;
+    if(event.font != QFontIconEngine::TraceEvent::None)
+        args += ",\"font\":" + QByteArray::number(event.font);
+    if(event.code != QFontIconEngine::TraceEvent::None)
+        args += ",\"glyph\":" + QByteArray::number(event.code);
+    if(event.size != QFontIconEngine::TraceEvent::None)
+        args += ",\"size\":" + QByteArray::number(event.size);
+    if(event.cache)
+        args += ",\"cache\":\"" + QByteArray(event.cache) + "\"";
+
+    json += args.mid(1);
+    json += "}}";
+
+    traceFile->write(json);
+    traceFirstEvent = false;
+}
+
+void QFontIconEnginePrivate::recordPaint(const QSize& size, qint64 nsecs)
+{
+    typedef QFontIconEngine::Statistics S;
+
+    int pixels = qMax(size.width(), size.height());
+    int sizeClass = 0;
+    while(sizeClass < S::SizeClasses - 1 && pixels > S::sizeClassLimit(sizeClass))
+        ++sizeClass;
+
+    quint64 usecs = quint64(qMax<qint64>(0, nsecs)) / 1000;
+    int bucket = usecs ? 64 - qCountLeadingZeroBits(usecs) : 0;
+    bucket = qMin<int>(bucket, S::LatencyBuckets - 1);
+
+    count(counters.paintLatency[sizeClass][bucket]);
+}
+
+NameTable QFontIconEnginePrivate::iconNames;
+NameTable QFontIconEnginePrivate::fontNames;
+QHash<int, QString> QFontIconEnginePrivate::iconCodes;
+QHash<int, QString> QFontIconEnginePrivate::fontIds;
+QVector<QPair<QFontIconEngine::IconNameResolver, QFontIconEngine::IconCodeResolver>> QFontIconEnginePrivate::iconResolvers;
+
+template<class K>
+void QFontIconEnginePrivate::registerName(NameTable& names, QHash<int, QString>& index, K name, int value)
+{
+    auto it = names.lowerBound(name);
+    if(it != names.end() && QStringView(it->first).compare(name) == 0)
+    {
+        int old = it->second;
+        if(old == value)
+            return;
+
+        it->second = value;
+
+        // The name was indexing its previous value, look for another one.
+        auto idx = index.find(old);
+        if(idx != index.end() && idx.value() == it->first)
+        {
+            index.erase(idx);
+            for(auto& n : names)
+            {
+                if(n.second == old)
+                {
+                    index.insert(old, n.first);
+                    break;
+                }
+            }
+        }
+    }
+    else
+        it = names.insert(it, toString(name), value);
+
+    auto& indexed = index[value];
+    if(indexed.isEmpty() || it->first < indexed)
+        indexed = it->first;
+}
+
+int QFontIconEnginePrivate::resolveIconName(QLatin1String name)
+{
+    auto it = iconNames.find(name);
+    if(it != iconNames.end())
+        return it->second;
+
+    if(iconResolvers.isEmpty())
+        return QFontIconEngine::InvalidIcon;
+
+    // Resolvers take a QStringView, widen Latin-1 names on the stack.
+    QVarLengthArray<QChar, 64> buffer;
+    for(auto c : name)
+        buffer.append(QLatin1Char(c));
+
+    for(auto& r : iconResolvers)
+    {
+        int code = r.first(QStringView(buffer.constData(), buffer.size()));
+        if(code != QFontIconEngine::InvalidIcon)
+            return code;
+    }
+
+    return QFontIconEngine::InvalidIcon;
+}
+
+int QFontIconEnginePrivate::resolveIconName(QStringView name)
+{
+    auto it = iconNames.find(name);
+    if(it != iconNames.end())
+        return it->second;
+
+    for(auto& r : iconResolvers)
+    {
+        int code = r.first(name);
+        if(code != QFontIconEngine::InvalidIcon)
+            return code;
+    }
+
+    return QFontIconEngine::InvalidIcon;
+}
+
+template<class K>
+bool QFontIconEnginePrivate::resolveFontName(K name, int& font)
+{
+    auto it = fontNames.find(name);
+    if(it == fontNames.end())
+        return false;
+
+    font = it->second;
+    return true;
+}
+
+QString QFontIconEnginePrivate::resolveIconCode(int code)
+{
+    auto it = iconCodes.find(code);
+    if(it != iconCodes.end())
+        return it.value();
+
+    for(auto& r : iconResolvers)
+    {
+        if(!r.second)
+            continue;
+
+        auto name = r.second(code);
+        if(!name.isNull())
+            return name;
+    }
+
+    return {};
+}
+
+
+
+// =============================================================================
+
+/**
+ * @class QFontIconEngine
+ * @brief QIconEngine subclass to handle font glyphs as icons.
+ *
+ * QFontIconEngine can be used with any fonts. You presumably have embedded your
+ * favourite glyph font in a @c .qrc file. The first thing you need to do is
+ * loading you font using the loadFont() static function:
+ *
+ * @code
+ * QFontIconEngine::loadFont(":/path/to/my_font.ttf");
+ * @endcode
+ *
+ * Then you can use the icon() static helper function to easily create icons from
+ * the font you just loaded:
+ * @code
+ * QIcon icon = QFontIconEngine::icon(0xf82b) // This is the code point of the glyph
+ *
+ * // Alternatively, you can make an enumeration and / or register string base names
+ * enum glyph_code {
+ *     super_glyph = 0xf82b
+ * };
+ *
+ * QFontIconEngine::registerIconName("super-glyph", super_glyph);
+ *
+ * // And then use names instead:
+ * QIcon otherIcon = QFontIconEngine::icon("super-glyph");
+ * @endcode
+ *
+ * QFontIconEngine supports stateful icons. That means you can set different
+ * glyphs and various other properties on a per-state basis, depending on
+ * @c QIcon::Mode and @c QIcon::State . For example:
+ *
+ * @code
+ * // Assuming you have registered icon names
+ * // create the engine and then set properties
+ * auto engine = new QFontIconEngine();
+ * engine->setIcon("toggle-on",  QIcon::Normal, QIcon::On);
+ * engine->setIcon("toggle-off", QIcon::Normal, QIcon::Off);
+ *
+ * engine->setColor(Qt::green, QIcon::Normal, QIcon::On);
+ * engine->setColor(Qt::red,   QIcon::Normal, QIcon::Off);
+ *
+ * // Pass it to a QIcon. Note that QIcon takes the ownership of the engine so.
+ * // Therefore it's unsafe to reuse if afterward.
+ * QIcon icon(engine);
+ * @endcode
+ *
+ * The default state is { QIcon::Normal, QIcon::Off }  It is the
+ * one set by default when using helper fuctions. If you create and engine from
+ * scratch, this state must be set.
+ *
+ * If a value is not available in a given state { M, S } , it will
+ * first try to find a { QIcon::Normal, S } and if still not
+ * successful, will ultimately default to { QIcon::Normal, QIcon::Off }.
+ *
+ * Properties also include a spinning animation. (Yep)
+ * @code
+ * // Assuming you'll put it on a button
+ * auto btn = new QPushButton();
+ *
+ * auto engine = new QFontIconEngine();
+ * engine->setIcon("spinner");
+ *
+ * engine->setWidget(btn); // You need to tell the engine which widget to update
+ * engine->setSpeed(180); // speed is in degree per second. 180 <=> 1 turn in 2s
+ * engine->setCurve(QEasingCurve::InOutSine); // You can even set non-linear rotation.
+ *
+ * // Pass it to a QIcon and profits
+ * QIcon icon(engine);
+ * @endcode
+ *
+ * You can load multiple fonts and use them seamlessly.
+ * When loading a font you can specify a arbitrary font id and name which will
+ * help you differenciate the fonts.
+ * @code
+ * enum icon_set
+ * {
+ *     primary_font,
+ *     secondary_font
+ * };
+ *
+ * QFontIconEngine::loadFont(":/path/to/my_font.ttf", primary_font, "primary");
+ * QFontIconEngine::loadFont(":/path/to/my_font.ttf", secondary_font, "secondary");
+ *
+ * // Set a default
+ * QFontIconEngine::setDefaultFont(primary_font);
+ *
+ * // Then you can pass either the font id of the font name depending on the
+ * // overload you use:
+ * QIcon icon = QFontIconEngine::icon("super-glyph", "secondary");
+ *
+ * // This one will use the default font set earlier
+ * QIcon icon2 = QFontIconEngine::icon("super-glyph");
+ * @endcode
+ */
+
+/**
+ * Construct and engine with the defaultFont() set but no icon. It is therefore
+ * invalid.
+ *
+ * @see isValid()
+ */
+QFontIconEngine::QFontIconEngine() :
+    d(new QFontIconEnginePrivate)
+{
+    setFont(defaultFont());
+}
+
+/**
+ * @brief Copy constructor.
+ */
+QFontIconEngine::QFontIconEngine(const QFontIconEngine& other) :
+    d(new QFontIconEnginePrivate)
+{
+    auto& od = other.d;
+
+    d->icons = od->icons;
+    d->fonts = od->fonts;
+    d->colors = od->colors;
+    d->speeds = od->speeds;
+    d->curves = od->curves;
+
+    d->widget = od->widget;
+
+    d->setupTimer();
+}
+
+/**
+ * @brief Construct and engine using @a icon and @a font.
+ *
+ * @a icon and @a font will set the { QIcon::Normal, QIcon::Off } state and
+ * therefore be used by default.
+ *
+ * @param icon the code point fo the icon to use
+ * @param font the font id to use
+ */
+QFontIconEngine::QFontIconEngine(int icon, int font) :
+    QFontIconEngine()
+{
+    setIcon(icon);
+    setFont(font);
+}
+
+/**
+ * @brief Construct and engine using @a icon and @a font.
+ *
+ * @overload
+ *
+ * @param icon the glyph name fo the icon to use
+ * @param font the font name to use
+ */
+QFontIconEngine::QFontIconEngine(const QString& icon, const QString& font) :
+    QFontIconEngine(QStringView(icon), QStringView(font))
+{}
+
+/**
+ * @brief Construct and engine using @a icon and @a font.
+ *
+ * @overload
+ */
+QFontIconEngine::QFontIconEngine(QStringView icon, QStringView font) :
+    QFontIconEngine()
+{
+    setIcon(icon);
+    if(font.isEmpty())
+        setFont(defaultFont());
+    else
+        setFont(font);
+}
+
+/**
+ * @brief Construct and engine using @a icon and @a font.
+ *
+ * @overload
+ */
+QFontIconEngine::QFontIconEngine(QLatin1String icon, QLatin1String font) :
+    QFontIconEngine()
+{
+    setIcon(icon);
+    if(font.isEmpty())
+        setFont(defaultFont());
+    else
+        setFont(font);
+}
+
+QFontIconEngine::~QFontIconEngine() {}
+
+/**
+ * @brief Whether the engine is valid.
+ *
+ * Invalid engine results in null icon and wont draw.
+ *
+ * An engine is considered valid if:
+ * - it has an default and valid icon (valid code point or name)
+ * - it has a default and valid font (loaded font and valid name)
+ */
+bool QFontIconEngine::isValid() const
+{
+    if(d->icons.empty())
+        return false;
+
+    if(d->fonts.empty())
         return false;
 
     if(std::any_of(d->icons.begin(), d->icons.end(),
                    [](int i){ return i == InvalidIcon; }))
         return false;
 
-    if(std::any_of(d->fonts.begin(), d->fonts.end(),
-                   [](int f){ return !QFontIconEnginePrivate::availableFonts.contains(f); }))
+    for(auto it = d->fonts.cbegin(); it != d->fonts.cend(); ++it)
+    {
+        if(!QFontIconEnginePrivate::hasFont(font(it.key().first, it.key().second)))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns the icon code point set for the given state.
+ */
+int QFontIconEngine::icon(QIcon::Mode mode, QIcon::State state) const
+{
+    return d->icons.get(mode, state, InvalidIcon);
+}
+
+/**
+ * @brief Returns the default icon name.
+ */
+QString QFontIconEngine::iconName() QFI6_CONST
+{
+    return iconName(QIcon::Normal, QIcon::Off);
+}
+
+/**
+ * @brief Returns the icon name set for the given state.
+ */
+QString QFontIconEngine::iconName(QIcon::Mode mode, QIcon::State state) const
+{
+    int i = icon(mode, state);
+    return QFontIconEnginePrivate::resolveIconCode(i);
+}
+
+/**
+ * @brief Returns the icon code point as a text string for the given state.
+ */
+QString QFontIconEngine::text(QIcon::Mode mode, QIcon::State state) const
+{
+    return codeToString(icon(mode, state));
+}
+
+/**
+ * @brief Returns the icon glyph index in the font. (which is different from the codepoint)
+ */
+quint32 QFontIconEngine::glyphIndex(QIcon::Mode mode, QIcon::State state) const
+{
+    return QFontIconEnginePrivate::glyph(font(mode, state), icon(mode, state)).index;
+}
+
+/**
+ * @brief Returns the font id set for the given state.
+ */
+int QFontIconEngine::font(QIcon::Mode mode, QIcon::State state) const
+{
+    int font = d->fonts.get(mode, state, defaultFont());
+    if(font == AnyFont)
+        font = d->resolveFont(mode, state, icon(mode, state));
+
+    return font;
+}
+
+/**
+ * @brief Returns the font name set for the given state.
+ */
+QString QFontIconEngine::fontName(QIcon::Mode mode, QIcon::State state) const
+{
+    int f = font(mode, state);
+    return QFontIconEnginePrivate::fontIds.value(f);
+}
+
+/**
+ * @brief Returns the scale factor set for the given state.
+ */
+qreal QFontIconEngine::scaleFactor(QIcon::Mode mode, QIcon::State state) const
+{
+    return d->scales.get(mode, state, 0.9);
+}
+
+/**
+ * @brief Returns the color set for the given state.
+ */
+QColor QFontIconEngine::color(QIcon::Mode mode, QIcon::State state) const
+{
+    auto c = d->colors.get(mode, state);
+
+    if(!c.isValid())
+        c = QFontIconEnginePrivate::defaultColor(mode);
+
+    return c;
+}
+
+/**
+ * @brief Returns the rotation speed set for the given state.
+ */
+qreal QFontIconEngine::speed(QIcon::Mode mode, QIcon::State state) const
+{
+    return d->speeds.get(mode, state, 0);
+}
+
+/**
+ * @brief Returns the easing curve set for the given state.
+ */
+QEasingCurve QFontIconEngine::curve(QIcon::Mode mode, QIcon::State state) const
+{
+    return d->curves.get(mode, state);
+}
+
+/**
+ * @brief Returns the widget the rotation animation displays on.
+ */
+QWidget* QFontIconEngine::widget() const
+{
+    return d->widget;
+}
+
+/**
+ * @brief Returns whether to display a red badge on the icon
+ */
+bool QFontIconEngine::badgeEnabled() const
+{
+    return d->badge;
+}
+
+/**
+ * @brief Set the icon code point for the given state.
+ */
+void QFontIconEngine::setIcon(int icon, QIcon::Mode mode, QIcon::State state)
+{
+    d->icons.set(icon, mode, state);
+    d->resolvedFonts.clear();
+}
+
+/**
+ * @brief Set the icon name for the given state.
+ */
+void QFontIconEngine::setIcon(const QString& name, QIcon::Mode mode, QIcon::State state)
+{
+    setIcon(QStringView(name), mode, state);
+}
+
+/**
+ * @brief Set the icon name for the given state.
+ *
+ * @overload
+ *
+ * Looking the name up does not allocate.
+ */
+void QFontIconEngine::setIcon(QStringView name, QIcon::Mode mode, QIcon::State state)
+{
+    int code = QFontIconEnginePrivate::resolveIconName(name);
+    if(code == InvalidIcon)
+    {
+        qWarning() << "QFontIcon: Invalid icon name";
+        return;
+    }
+
+    setIcon(code, mode, state);
+}
+
+/**
+ * @brief Set the icon name for the given state.
+ *
+ * @overload
+ *
+ * Looking the name up does not allocate.
+ */
+void QFontIconEngine::setIcon(QLatin1String name, QIcon::Mode mode, QIcon::State state)
+{
+    int code = QFontIconEnginePrivate::resolveIconName(name);
+    if(code == InvalidIcon)
+    {
+        qWarning() << "QFontIcon: Invalid icon name";
+        return;
+    }
+
+    setIcon(code, mode, state);
+}
+
+/**
+ * @brief Set the font id for the given state.
+ */
+void QFontIconEngine::setFont(int font, QIcon::Mode mode, QIcon::State state)
+{
+    d->fonts.set(font, mode, state);
+    d->resolvedFonts.clear();
+}
+
+/**
+ * @brief Set the font name for the given state.
+ */
+void QFontIconEngine::setFont(const QString& name, QIcon::Mode mode, QIcon::State state)
+{
+    setFont(QStringView(name), mode, state);
+}
+
+/**
+ * @brief Set the font name for the given state.
+ *
+ * @overload
+ *
+ * Looking the name up does not allocate.
+ */
+void QFontIconEngine::setFont(QStringView name, QIcon::Mode mode, QIcon::State state)
+{
+    int font;
+    if(!QFontIconEnginePrivate::resolveFontName(name, font))
+    {
+        qWarning() << "QFontIcon: Invalid font name";
+        return;
+    }
+
+    setFont(font, mode, state);
+}
+
+/**
+ * @brief Set the font name for the given state.
+ *
+ * @overload
+ *
+ * Looking the name up does not allocate.
+ */
+void QFontIconEngine::setFont(QLatin1String name, QIcon::Mode mode, QIcon::State state)
+{
+    int font;
+    if(!QFontIconEnginePrivate::resolveFontName(name, font))
+    {
+        qWarning() << "QFontIcon: Invalid font name";
+        return;
+    }
+
+    setFont(font, mode, state);
+}
+
+/**
+ * @brief Set the scale factor for the given state.
+ */
+void QFontIconEngine::setScaleFactor(qreal scale, QIcon::Mode mode, QIcon::State state)
+{
+    d->scales.set(scale, mode, state);
+}
+
+/**
+ * @brief Set the color for the given state.
+ */
+void QFontIconEngine::setColor(const QColor& color, QIcon::Mode mode, QIcon::State state)
+{
+    d->colors.set(color, mode, state);
+}
+
+/**
+ * @brief Set the rotation speed for the given state.
+ */
+void QFontIconEngine::setSpeed(qreal speed, QIcon::Mode mode, QIcon::State state)
+{
+    d->speeds.set(speed, mode, state);
+    d->setupTimer();
+}
+
+/**
+ * @brief Set the easing curve point for the given state.
+ */
+void QFontIconEngine::setCurve(const QEasingCurve& curve, QIcon::Mode mode, QIcon::State state)
+{
+    d->curves.set(curve, mode, state);
+}
+
+/**
+ * @brief Set the widget the rotation animation displays on.
+ */
+void QFontIconEngine::setWidget(QWidget* widget)
+{
+    d->widget = widget;
+    d->setupTimer();
+}
+
+/**
+ * @brief Set if the red badge should be enabled
+ */
+void QFontIconEngine::setBadgeEnabled(bool en)
+{
+    d->badge = en;
+}
+
+QFontIconEngine* QFontIconEngine::QFontIconEngine::clone() const
+{
+    return new QFontIconEngine(*this);
+}
+
+QSize QFontIconEngine::actualSize(const QSize &size, QIcon::Mode mode, QIcon::State state)
+{
+    Q_UNUSED(mode);
+    Q_UNUSED(state);
+
+    if(!isValid())
+    {
+        if(!d->fontsLoading())
+            qWarning() << "QFontIconEngine: Invalid object";
+        return {};
+    }
+
+    return size;
+}
+
+void QFontIconEngine::paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state)
+{
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.paintCalls);
+
+    TraceSpan span("paint");
+
+    if(!isValid())
+    {
+        // Draw nothing until the font is available
+        if(!d->fontsLoading())
+            qWarning() << "QFontIcon: Invalid QFontIcon object";
+        return;
+    }
+
+    span.event.font = font(mode, state);
+    span.event.code = icon(mode, state);
+    span.event.size = qMax(rect.width(), rect.height());
+
+    auto r  = QRectF(rect); // Use floating for more precision
+    auto g  = QFontIconEnginePrivate::glyph(font(mode, state), icon(mode, state));
+    auto sf = scaleFactor(mode, state);
+    auto c  = color(mode, state);
+    auto a  = d->angles.get(mode, state);
+
+    painter->save();
+
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setTransform(QFontIconEnginePrivate::glyphTransform(g, r, sf, a), true);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(c);
+    painter->drawPath(g.path);
+
+    painter->restore();
+
+    if(d->badge)
+    {
+        painter->save();
+
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(QColor(255, 0, 0, 200));
+
+        auto bs = r.size() / 3.0;
+
+        if(bs.width() < 8 || bs.height() < 8)
+            bs = r.size() / 2.0;
+
+        QRectF badgeRect(r.right()-bs.width(), r.top(), bs.width(), bs.height());
+
+        painter->drawEllipse(badgeRect);
+
+        painter->restore();
+    }
+
+    QFontIconEnginePrivate::recordPaint(rect.size(), elapsed.nsecsElapsed());
+}
+
+/**
+ * @brief Paint @a count icons at once.
+ *
+ * Each item is either an engine, painted in the item mode and state at its
+ * current animation angle, or an icon and font painted with the item color
+ * and scale. Items are resolved up front, then drawn in order with one
+ * painter save and restore for the whole batch, so later items stack over
+ * earlier ones as with separate paint() calls.
+ *
+ * Invalid items are skipped. Items are drawn in the painter's coordinates.
+ */
+void QFontIconEngine::paintMany(QPainter* painter, const PaintItem* items, int count)
+{
+    if(!painter || !items || count <= 0)
+        return;
+
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    TraceSpan span("paintMany");
+    span.event.size = count;
+
+    struct Resolved
+    {
+        QRgb         color;
+        QTransform   transform;
+        QPainterPath path;
+        bool         badge;
+        QRectF       rect;
+    };
+
+    QVector<Resolved> resolved;
+    resolved.reserve(count);
+
+    for(int i = 0; i < count; ++i)
+    {
+        const auto& item = items[i];
+        if(item.rect.isEmpty())
+            continue;
+
+        Resolved r;
+        r.rect = item.rect;
+
+        int font;
+        int code;
+        qreal scale;
+        qreal angle = 0;
+        QColor c;
+
+        if(item.engine)
+        {
+            auto e = item.engine;
+            if(!e->isValid())
+                continue;
+
+            code    = e->icon(item.mode, item.state);
+            c       = e->color(item.mode, item.state);
+            scale   = e->scaleFactor(item.mode, item.state);
+            angle   = e->d->angles.get(item.mode, item.state);
+            font    = e->font(item.mode, item.state);
+            r.badge = e->d->badge;
+        }
+        else
+        {
+            code    = item.icon;
+            c       = item.color.isValid() ? item.color : QFontIconEnginePrivate::defaultColor(item.mode);
+            scale   = item.scale;
+            font    = item.font < 0 && item.font != AnyFont ? defaultFont() : item.font;
+            r.badge = false;
+
+            if(font == AnyFont)
+                font = QFontIconEnginePrivate::findFont(code);
+
+            if(code == InvalidIcon || !QFontIconEnginePrivate::hasFont(font))
+                continue;
+        }
+
+        auto g = QFontIconEnginePrivate::glyph(font, code);
+        r.color     = c.rgba();
+        r.transform = QFontIconEnginePrivate::glyphTransform(g, item.rect, scale, angle);
+        r.path      = g.path;
+
+        resolved.append(r);
+    }
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(Qt::NoPen);
+
+    // Only the transform and brush change between items, the shared paths
+    // are filled as they are.
+    auto base  = painter->transform();
+    QRgb brush = 0;
+    bool first = true;
+
+    for(const auto& r : resolved)
+    {
+        if(first || r.color != brush)
+        {
+            painter->setBrush(QColor::fromRgba(r.color));
+            brush = r.color;
+            first = false;
+        }
+
+        painter->setTransform(r.transform * base);
+        painter->drawPath(r.path);
+
+        if(!r.badge)
+            continue;
+
+        auto bs = r.rect.size() / 3.0;
+
+        if(bs.width() < 8 || bs.height() < 8)
+            bs = r.rect.size() / 2.0;
+
+        painter->setTransform(base);
+        painter->setBrush(QColor(255, 0, 0, 200));
+        painter->drawEllipse(QRectF(r.rect.right()-bs.width(), r.rect.top(), bs.width(), bs.height()));
+        first = true;
+    }
+
+    painter->restore();
+
+    // Counted as that many paint() calls, sharing the time of the batch
+    QFontIconEnginePrivate::counters.paintCalls.fetch_add(quint64(resolved.size()), std::memory_order_relaxed);
+
+    qint64 nsecs = resolved.isEmpty() ? 0 : elapsed.nsecsElapsed() / resolved.size();
+    for(const auto& r : resolved)
+        QFontIconEnginePrivate::recordPaint(r.rect.size().toSize(), nsecs);
+}
+
+/**
+ * @brief Paint the icons of @a items at once.
+ *
+ * @overload
+ */
+void QFontIconEngine::paintMany(QPainter* painter, const QVector<PaintItem>& items)
+{
+    paintMany(painter, items.constData(), items.size());
+}
+
+QPixmap QFontIconEngine::pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state)
+{
+    QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.pixmapCalls);
+
+    TraceSpan span("pixmap");
+
+    if(!size.isValid() || size.isEmpty())
+        return {};
+
+    // Rotating icons change every frame, caching them would only churn.
+    bool still = d->angles.get(mode, state) == 0;
+
+    QFontIconEnginePrivate::PixmapKey key {
+        font(mode, state),
+        icon(mode, state),
+        size,
+        color(mode, state).rgba(),
+        scaleFactor(mode, state),
+        d->badge
+    };
+
+    span.event.font  = key.font;
+    span.event.code  = key.code;
+    span.event.size  = qMax(size.width(), size.height());
+    span.event.cache = "uncached";
+
+    if(still)
+    {
+        if(auto cached = QFontIconEnginePrivate::pixmaps.object(key))
+        {
+            QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.pixmapCacheHits);
+            span.event.cache = "hit";
+            return *cached;
+        }
+
+        QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.pixmapCacheMisses);
+        span.event.cache = "miss";
+    }
+
+    // Warm starts are served from the disk cache before the font is checked,
+    // it is only mapped to be hashed. Only valid icons are ever stored.
+    DiskPixmapCache::Key diskKey = {};
+    bool onDisk = still && QFontIconEnginePrivate::diskCache.isOpen();
+    if(onDisk)
+    {
+        diskKey.fontHash = QFontIconEnginePrivate::fontHash(key.font);
+        diskKey.font     = key.font;
+
+        // Compiled in outlines have no font file to hash.
+        onDisk = diskKey.fontHash != 0;
+    }
+
+    if(onDisk)
+    {
+        diskKey.code     = key.code;
+        diskKey.width    = size.width();
+        diskKey.height   = size.height();
+        diskKey.color    = key.color;
+        diskKey.badge    = key.badge;
+        diskKey.scale    = key.scale;
+
+        QImage image;
+        if(QFontIconEnginePrivate::diskCache.find(diskKey, image))
+        {
+            QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.diskCacheHits);
+            span.event.cache = "disk";
+
+            QPixmap pm = QPixmap::fromImage(image.copy());
+            QFontIconEnginePrivate::pixmaps.insert(key, new QPixmap(pm), size.width() * size.height() * 4);
+            return pm;
+        }
+
+        QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.diskCacheMisses);
+    }
+
+    bool cacheable = still && isValid();
+
+    QPixmap pm(size);
+    {
+        TraceSpan fill("pixmapFill");
+        fill.event.font = key.font;
+        fill.event.code = key.code;
+        fill.event.size = span.event.size;
+
+        pm.fill( Qt::transparent ); // we need transparency
+        QPainter p(&pm);
+        paint(&p, QRect(QPoint(0,0),size), mode, state);
+    }
+
+    QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.rasterizations);
+
+    if(cacheable)
+        QFontIconEnginePrivate::pixmaps.insert(key, new QPixmap(pm), size.width() * size.height() * 4);
+
+    if(onDisk && cacheable)
+        QFontIconEnginePrivate::diskCache.insert(diskKey, pm.toImage());
+
+    return pm;
+}
+
+void QFontIconEngine::virtual_hook(int id, void* data)
+{
+    if(id == QIconEngine::IsNullHook)
+        *static_cast<bool*>(data) = !isValid();
+    else
+        QIconEngine::virtual_hook(id, data);
+}
+
+/**
+ * @brief load the font located at @a filename.
+ *
+ * You can pass an arbitrary font id and font name if you're using multiple
+ * fonts.
+ *
+ * The font bytes are not copied: files are memory mapped, so their pages are
+ * shared by every process using the font, and uncompressed resources are used
+ * in place. Returns @c false if the file cannot be read or is not a font.
+ */
+bool QFontIconEngine::loadFont(const QString& filename, int font, const QString& name)
+{
+    TraceSpan span("loadFont");
+    span.event.font = font;
+
+    // Open it
+    QFontIconEnginePrivate::FontData data;
+    data.path = filename;
+    if(!QFontIconEnginePrivate::mapFont(filename, data))
+    {
+        qWarning() << "QFontIcon: Cannot read font" << filename;
+        return false;
+    }
+
+    data.raw.loadFromData(data.data, 32, QFont::PreferDefaultHinting);
+    if(!data.raw.isValid())
+    {
+        qWarning() << "QFontIcon: Invalid font" << filename;
         return false;
+    }
+
+    QFontIconEnginePrivate::purgeFont(font);
+
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        QFontIconEnginePrivate::prepareFont(font, data);
+        data.lastUse = ++QFontIconEnginePrivate::fontClock;
+        QFontIconEnginePrivate::availableFonts[font] = data;
+        QFontIconEnginePrivate::loadingFonts.remove(font);
+        QFontIconEnginePrivate::enforceFontBudget(font);
+    }
+
+    QFontIconEnginePrivate::fontsChanged();
+
+    if(!name.isEmpty())
+        registerFontName(name, font);
 
     return true;
 }
 
 /**
- * @brief Returns the icon code point set for the given state.
+ * @brief Load the font located at @a filename on a worker thread.
+ *
+ * Same as loadFont() but reading and validating the font happen in the
+ * background. The returned future reports whether that succeeded.
+ *
+ * Until it is done, engines using @a font are invalid and silently draw
+ * nothing. Any font previously loaded with this id is unloaded right away.
+ * @a name is registered immediately.
+ *
+ * Only the latest request for @a font is kept: the future of a request
+ * overtaken by another loadFontAsync(), or by loadFont() or
+ * registerFontFile() with the same id, reports @c false. Must be called from
+ * the GUI thread.
  */
-int QFontIconEngine::icon(QIcon::Mode mode, QIcon::State state) const
+QFuture<bool> QFontIconEngine::loadFontAsync(const QString& filename, int font, const QString& name)
 {
-    return d->icons.get(mode, state, InvalidIcon);
+    if(!name.isEmpty())
+        registerFontName(name, font);
+
+    QFontIconEnginePrivate::purgeFont(font);
+
+    quint64 request;
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        QFontIconEnginePrivate::availableFonts.remove(font);
+        request = ++QFontIconEnginePrivate::loadRequests;
+        QFontIconEnginePrivate::loadingFonts.insert(font, request);
+    }
+
+    QFontIconEnginePrivate::fontsChanged();
+
+    return QtConcurrent::run([filename, font, request]()
+    {
+        TraceSpan span("loadFont");
+        span.event.font = font;
+
+        QFontIconEnginePrivate::FontData data;
+        data.path = filename;
+        bool ok = QFontIconEnginePrivate::mapFont(filename, data);
+
+        if(!ok)
+            qWarning() << "QFontIcon: Cannot read font" << filename;
+        else
+        {
+            // The QRawFont used for painting is created on first use, on the
+            // painting thread.
+            QRawFont probe;
+            probe.loadFromData(data.data, 32, QFont::PreferDefaultHinting);
+            ok = probe.isValid();
+
+            if(!ok)
+                qWarning() << "QFontIcon: Invalid font" << filename;
+        }
+
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+
+        // Unloaded, loaded again or overtaken while loading, do not bring
+        // this file back.
+        auto it = QFontIconEnginePrivate::loadingFonts.find(font);
+        if(it == QFontIconEnginePrivate::loadingFonts.end() || it.value() != request)
+            return false;
+
+        QFontIconEnginePrivate::loadingFonts.erase(it);
+
+        if(ok)
+        {
+            QFontIconEnginePrivate::prepareFont(font, data);
+            data.lastUse = ++QFontIconEnginePrivate::fontClock;
+            QFontIconEnginePrivate::availableFonts.insert(font, data);
+            QFontIconEnginePrivate::fontsChanged();
+
+            // Caches and other fonts belong to the GUI thread, which may be
+            // painting with them: drop what was derived while the font was
+            // missing, and release fonts over budget, from there.
+            if(auto app = QCoreApplication::instance())
+            {
+                QMetaObject::invokeMethod(app, [font]()
+                {
+                    QFontIconEnginePrivate::purgeFont(font);
+
+                    QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+                    QFontIconEnginePrivate::enforceFontBudget(font);
+                }, Qt::QueuedConnection);
+            }
+        }
+
+        return ok;
+    });
 }
 
 /**
- * @brief Returns the default icon name.
+ * @brief Register the font located at @a filename without loading it.
+ *
+ * The font is mapped and parsed the first time an engine using @a font is
+ * validated or painted. This is safe to trigger from several threads at once,
+ * the first one loads the font while the others wait for it.
+ *
+ * Returns @c false if @a filename does not exist.
+ *
+ * @see loadFont()
  */
-QString QFontIconEngine::iconName() QFI6_CONST
+bool QFontIconEngine::registerFontFile(const QString& filename, int font, const QString& name)
 {
-    return iconName(QIcon::Normal, QIcon::Off);
+    if(!QFile::exists(filename))
+    {
+        qWarning() << "QFontIcon: Cannot find font" << filename;
+        return false;
+    }
+
+    QFontIconEnginePrivate::purgeFont(font);
+
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+
+        QFontIconEnginePrivate::FontData data;
+        data.path = filename;
+        QFontIconEnginePrivate::availableFonts[font] = data;
+        QFontIconEnginePrivate::loadingFonts.remove(font);
+    }
+
+    QFontIconEnginePrivate::fontsChanged();
+
+    if(!name.isEmpty())
+        registerFontName(name, font);
+
+    return true;
 }
 
 /**
- * @brief Returns the icon name set for the given state.
+ * @brief Register precomputed metrics for the font loaded as @a font.
+ *
+ * @a glyphs lists, sorted by code point, the glyph index, advance and bounds
+ * of the @a count code points of the font, measured in @a unitsPerEm. While
+ * the loaded font matches @a checksum, icons take their glyph index and
+ * bounds from there: the font's character map and metrics are never read,
+ * only outlines are. Fonts not matching are used as usual.
+ *
+ * @a checksum is the checkSumAdjustment field of the head table in the high
+ * 32 bits, and the file size in the low 32 bits. The table is not copied and
+ * must outlive its use, as static data does. scripts/generate_fa.py writes
+ * such tables for Font Awesome fonts, see fa::register_awesome_metrics().
  */
-QString QFontIconEngine::iconName(QIcon::Mode mode, QIcon::State state) const
+bool QFontIconEngine::registerGlyphMetrics(int font, quint64 checksum, int unitsPerEm, const GlyphMetrics* glyphs, int count)
 {
-    int i = icon(mode, state);
-    return QFontIconEnginePrivate::iconNames.key(i);
+    auto byCode = [](const GlyphMetrics& a, const GlyphMetrics& b) { return a.code < b.code; };
+    if(!glyphs || count <= 0 || unitsPerEm <= 0 || !std::is_sorted(glyphs, glyphs + count, byCode))
+    {
+        qWarning() << "QFontIcon: Invalid glyph metrics for font" << font;
+        return false;
+    }
+
+    QFontIconEnginePrivate::MetricsTable table;
+    table.checksum   = checksum;
+    table.unitsPerEm = unitsPerEm;
+    table.glyphs     = glyphs;
+    table.count      = count;
+
+    QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+    QFontIconEnginePrivate::metricsTables.insert(font, table);
+
+    auto it = QFontIconEnginePrivate::availableFonts.find(font);
+    if(it != QFontIconEnginePrivate::availableFonts.end() && !it->data.isEmpty())
+        QFontIconEnginePrivate::prepareFont(font, it.value());
+
+    return true;
 }
 
 /**
- * @brief Returns the icon code point as a text string for the given state.
+ * @brief Register outlines compiled into the application for @a font.
+ *
+ * @a outlines lists, sorted by code point, @a count icons measured in
+ * @a unitsPerEm. They are drawn from there, whether @a font is loaded or
+ * not, so icons needed before or without the font file cost no parsing at
+ * all. Other icons of @a font still come from the loaded font.
+ *
+ * The table is not copied and must outlive its use, as static data does.
+ * scripts/generate_fa.py --embed writes such tables for a list of icons:
+ *
+ * @code
+ * // generate_fa.py --embed fa-solid-900.ttf solid tool_icons beer star
+ * #include "tool_icons.h"
+ *
+ * fa::register_tool_icons();
+ * auto icon = QFontIconEngine::icon(fa::v6::star, fa::solid);
+ * @endcode
+ *
+ * Must be called from the GUI thread. Returns @c false if the table is
+ * invalid.
  */
-QString QFontIconEngine::text(QIcon::Mode mode, QIcon::State state) const
+bool QFontIconEngine::registerOutlines(int font, int unitsPerEm, const Outline* outlines, int count)
 {
-    return { QChar(icon(mode, state)) };
+    auto byCode = [](const Outline& a, const Outline& b) { return a.code < b.code; };
+    if(!outlines || count <= 0 || unitsPerEm <= 0 || !std::is_sorted(outlines, outlines + count, byCode))
+    {
+        qWarning() << "QFontIcon: Invalid outlines for font" << font;
+        return false;
+    }
+
+    QFontIconEnginePrivate::OutlineTable table;
+    table.unitsPerEm = unitsPerEm;
+    table.outlines   = outlines;
+    table.count      = count;
+
+    QFontIconEnginePrivate::purgeFont(font);
+
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        QFontIconEnginePrivate::outlineTables.insert(font, table);
+    }
+
+    QFontIconEnginePrivate::fontsChanged();
+    return true;
 }
 
 /**
- * @brief Returns the icon glyph index in the font. (which is different from the codepoint)
+ * @brief Load the icon pack located at @a filename as @a font.
+ *
+ * Icon packs are written by the qfonticonpack tool from TrueType or OpenType
+ * fonts. They hold quantized glyph outlines, their bounds and the icon
+ * names. Loading one only maps the file and checks its header, whatever its
+ * size; each glyph is decoded into a path the first time it is drawn,
+ * without QRawFont or FreeType.
+ *
+ * @code
+ * // qfonticonpack fa-solid-900.ttf solid.qfip
+ * QFontIconEngine::loadIconPack(":/icons/solid.qfip", fa::solid, "solid");
+ *
+ * auto icon = QFontIconEngine::icon("beer", "solid");
+ * @endcode
+ *
+ * The pack names are looked up after the registered ones. Must be called
+ * from the GUI thread. Returns @c false if the file cannot be read or is not
+ * a valid icon pack.
+ *
+ * @see unloadFont()
  */
-quint32 QFontIconEngine::glyphIndex(QIcon::Mode mode, QIcon::State state) const
+bool QFontIconEngine::loadIconPack(const QString& filename, int font, const QString& name)
 {
-    auto& f = QFontIconEnginePrivate::getFont(font(mode, state));
-    auto v = f.glyphIndexesForString(text(mode, state));
-    Q_ASSERT(v.count() == 1);
-    return v.first();
+    TraceSpan span("loadIconPack");
+    span.event.font = font;
+
+    QFontIconEnginePrivate::IconPack pack;
+    if(!QFontIconEnginePrivate::openIconPack(filename, pack))
+        return false;
+
+    QFontIconEnginePrivate::purgeFont(font);
+
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        QFontIconEnginePrivate::iconPacks.insert(font, pack);
+    }
+
+    QFontIconEnginePrivate::fontsChanged();
+
+    static bool resolving = false;
+    if(!resolving)
+    {
+        registerIconNameResolver(QFontIconEnginePrivate::resolvePackName, QFontIconEnginePrivate::resolvePackCode);
+        resolving = true;
+    }
+
+    if(!name.isEmpty())
+        registerFontName(name, font);
+
+    return true;
 }
 
 /**
- * @brief Returns the font id set for the given state.
+ * @brief Unload @a font and drop everything derived from it.
+ *
+ * Glyph outlines, metrics and rendered pixmaps of the font are released along
+ * with the font itself. Engines still using @a font become invalid and draw
+ * nothing until a font is loaded again with the same id. A pending
+ * loadFontAsync() for @a font is abandoned, an icon pack loaded as @a font
+ * is closed. Font names, and outlines registered with registerOutlines(),
+ * are kept.
+ *
+ * Like the caches it clears, this must be called from the GUI thread.
+ * Returns @c false if no font was loaded, loading or registered with this id.
+ *
+ * @see trimCaches()
  */
-int QFontIconEngine::font(QIcon::Mode mode, QIcon::State state) const
+bool QFontIconEngine::unloadFont(int font)
 {
-    return d->fonts.get(mode, state, defaultFont());
+    TraceSpan span("unloadFont");
+    span.event.font = font;
+
+    QFontIconEnginePrivate::purgeFont(font);
+    QFontIconEnginePrivate::fontsChanged();
+
+    QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+    bool loading = QFontIconEnginePrivate::loadingFonts.remove(font) > 0;
+    bool pack = QFontIconEnginePrivate::iconPacks.remove(font) > 0;
+    return QFontIconEnginePrivate::availableFonts.remove(font) > 0 || loading || pack;
 }
 
 /**
- * @brief Returns the font name set for the given state.
+ * @brief Release cached data, down to the given @a level.
+ *
+ * - TrimPixmaps drops the rendered pixmaps and the shared atlas pages, and
+ *   writes the pixmaps waiting for the disk cache.
+ * - TrimGlyphs also drops glyph outlines and metrics.
+ * - TrimFonts also releases the font files and parsed fonts. Fonts stay
+ *   registered and are loaded again the next time they are used, just like
+ *   registerFontFile() ones.
+ *
+ * Nothing is unloaded: engines keep working, at the cost of refilling the
+ * caches. Must be called from the GUI thread.
+ *
+ * @see unloadFont()
  */
-QString QFontIconEngine::fontName(QIcon::Mode mode, QIcon::State state) const
+void QFontIconEngine::trimCaches(TrimLevel level)
 {
-    int f = font(mode, state);
-    return QFontIconEnginePrivate::fontNames.key(f);
+    TraceSpan span("trimCaches");
+
+    QFontIconEnginePrivate::pixmaps.clear();
+    QFontIconEnginePrivate::flushDiskCache();
+    QFontIconAtlas::shared()->clear();
+
+    if(level < TrimGlyphs)
+        return;
+
+    QFontIconEnginePrivate::glyphs.clear();
+
+    for(auto& h : QFontIconEnginePrivate::handles)
+    {
+        h.loaded = false;
+        h.glyph  = QFontIconEnginePrivate::Glyph();
+    }
+
+    if(level < TrimFonts)
+        return;
+
+    QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+    for(auto& f : QFontIconEnginePrivate::availableFonts)
+        QFontIconEnginePrivate::releaseFont(f);
 }
 
 /**
- * @brief Returns the scale factor set for the given state.
+ * @brief Set the memory budget of @a cache, in bytes.
+ *
+ * Entries are evicted least recently used first, as soon as the budget is
+ * exceeded, including right away when it is lowered. A negative budget means
+ * unlimited. Evicted font data is mapped again on next use, see trimCaches().
+ *
+ * The defaults are unlimited for fonts, 2 MB for glyph outlines and metrics,
+ * 4 MB for rendered pixmaps, 16 MB for the disk cache, which only applies
+ * when it is written, and 4 MB for the shared atlas, which is rounded down to
+ * whole pages but keeps at least one. Must be called from the GUI thread.
+ *
+ * @see memoryReport()
  */
-qreal QFontIconEngine::scaleFactor(QIcon::Mode mode, QIcon::State state) const
+void QFontIconEngine::setCacheBudget(Cache cache, qint64 bytes)
 {
-    return d->scales.get(mode, state, 0.9);
+    switch(cache)
+    {
+    case FontCache:
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        QFontIconEnginePrivate::fontBudget = bytes < 0 ? -1 : bytes;
+        QFontIconEnginePrivate::enforceFontBudget(InvalidIcon);
+        break;
+    }
+
+    case GlyphCache:
+        QFontIconEnginePrivate::glyphs.setBudget(bytes);
+        break;
+
+    case PixmapCache:
+        QFontIconEnginePrivate::pixmaps.setBudget(bytes);
+        break;
+
+    case DiskCache:
+        QFontIconEnginePrivate::diskCache.budget = bytes < 0 ? -1 : bytes;
+        break;
+
+    case AtlasCache:
+    {
+        auto atlas = QFontIconAtlas::shared();
+        qint64 page = qint64(atlas->pageSize()) * atlas->pageSize() * 4;
+        atlas->setMaxPages(bytes < 0 ? INT_MAX : int(qMin<qint64>(bytes / page, INT_MAX)));
+        QFontIconEnginePrivate::atlasUnlimited = bytes < 0;
+        break;
+    }
+
+    default:
+        break;
+    }
 }
 
 /**
- * @brief Returns the color set for the given state.
+ * @brief Returns the memory budget of @a cache, in bytes, or -1 if unlimited.
  */
-QColor QFontIconEngine::color(QIcon::Mode mode, QIcon::State state) const
+qint64 QFontIconEngine::cacheBudget(Cache cache)
 {
-    auto c = d->colors.get(mode, state);
+    qint64 budget = -1;
 
-    if(!c.isValid())
+    switch(cache)
     {
-        auto p = QGuiApplication::palette();
+    case FontCache:
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        budget = QFontIconEnginePrivate::fontBudget;
+        break;
+    }
 
-        switch (mode)
-        {
-        case QIcon::Active:
-            c = p.color(QPalette::Active, QPalette::ButtonText);
-            break;
+    case GlyphCache:
+        budget = QFontIconEnginePrivate::glyphs.budget();
+        break;
 
-        case QIcon::Normal:
-            c = p.color(QPalette::Normal, QPalette::ButtonText);
-            break;
+    case PixmapCache:
+        budget = QFontIconEnginePrivate::pixmaps.budget();
+        break;
 
-        case QIcon::Disabled:
-            c = p.color(QPalette::Disabled, QPalette::ButtonText);
-            break;
+    case DiskCache:
+        budget = QFontIconEnginePrivate::diskCache.budget;
+        break;
 
-        case QIcon::Selected:
-            c = p.color(QPalette::Active, QPalette::ButtonText);
-            break;
-        }
+    case AtlasCache:
+    {
+        auto atlas = QFontIconAtlas::shared();
+        if(QFontIconEnginePrivate::atlasUnlimited)
+            return -1;
+
+        budget = qint64(atlas->pageSize()) * atlas->pageSize() * 4 * atlas->maxPages();
+        break;
     }
 
-    return c;
-}
+    default:
+        break;
+    }
 
-/**
- * @brief Returns the rotation speed set for the given state.
- */
-qreal QFontIconEngine::speed(QIcon::Mode mode, QIcon::State state) const
-{
-    return d->speeds.get(mode, state, 0);
+    return budget;
 }
 
 /**
- * @brief Returns the easing curve set for the given state.
+ * @brief Returns the memory used by each cache, in total and per font id.
+ *
+ * Font bytes count the font files as loaded, whether mapped or read. Glyph
+ * and pixmap bytes are estimates of the cached outlines and images. Disk
+ * bytes count the images in the pack file and those waiting to be written.
+ * Atlas bytes cover every QFontIconAtlas.
  */
-QEasingCurve QFontIconEngine::curve(QIcon::Mode mode, QIcon::State state) const
+QFontIconEngine::MemoryReport QFontIconEngine::memoryReport()
 {
-    return d->curves.get(mode, state);
-}
+    MemoryReport r;
 
-/**
- * @brief Returns the widget the rotation animation displays on.
- */
-QWidget* QFontIconEngine::widget() const
-{
-    return d->widget;
-}
+    for(int c = 0; c < CacheCount; ++c)
+        r.budgets[c] = cacheBudget(Cache(c));
 
-/**
- * @brief Returns whether to display a red badge on the icon
- */
-bool QFontIconEngine::badgeEnabled() const
-{
-    return d->badge;
-}
+    auto add = [&r](int font, Cache cache, qint64 bytes)
+    {
+        auto& u = r.fonts[font];
+        u.bytes[cache] += bytes;
+        u.entries[cache] += 1;
+        r.usage.bytes[cache] += bytes;
+        r.usage.entries[cache] += 1;
+    };
 
-/**
- * @brief Set the icon code point for the given state.
- */
-void QFontIconEngine::setIcon(int icon, QIcon::Mode mode, QIcon::State state)
-{
-    d->icons.set(icon, mode, state);
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        auto& fonts = QFontIconEnginePrivate::availableFonts;
+        for(auto it = fonts.cbegin(); it != fonts.cend(); ++it)
+        {
+            if(!it->data.isEmpty())
+                add(it.key(), FontCache, it->data.size());
+        }
+
+        auto& packs = QFontIconEnginePrivate::iconPacks;
+        for(auto it = packs.cbegin(); it != packs.cend(); ++it)
+            add(it.key(), FontCache, it->data.size());
+    }
+
+    QFontIconEnginePrivate::glyphs.forEachCost([&add](quint64 key, int cost)
+    {
+        add(int(key >> 32), GlyphCache, cost);
+    });
+
+    // Handle paths share their data with the cached glyphs, only the
+    // handles themselves are counted.
+    for(const auto& h : QFontIconEnginePrivate::handles)
+    {
+        if(h.loaded)
+            add(h.font, GlyphCache, qint64(sizeof(h)));
+    }
+
+    QFontIconEnginePrivate::pixmaps.forEachCost([&add](const QFontIconEnginePrivate::PixmapKey& key, int cost)
+    {
+        add(key.font, PixmapCache, cost);
+    });
+
+    QFontIconEnginePrivate::diskCache.forEachEntry([&add](const DiskPixmapCache::Key& key, qint64 bytes)
+    {
+        add(key.font, DiskCache, bytes);
+    });
+
+    // Fonts are charged for the area of their icons, the total for whole pages.
+    for(auto atlas : QFontIconAtlasPrivate::atlases())
+    {
+        for(auto it = atlas->entries.cbegin(); it != atlas->entries.cend(); ++it)
+        {
+            auto& u = r.fonts[it.key().font];
+            u.bytes[AtlasCache] += qint64(it->rect.width()) * it->rect.height() * 4;
+            u.entries[AtlasCache] += 1;
+            r.usage.entries[AtlasCache] += 1;
+        }
+
+        for(const auto& page : atlas->pages)
+            r.usage.bytes[AtlasCache] += page.image.sizeInBytes();
+    }
+
+    return r;
 }
 
 /**
- * @brief Set the icon name for the given state.
+ * @brief Keep rendered pixmaps in @a directory across launches.
+ *
+ * Pixmaps of non rotating icons are stored in a single pack file, keyed by a
+ * hash of the font file contents and the rendering parameters. On later
+ * launches the pack is memory mapped and cached icons are served from it
+ * without parsing the font or rendering, the font file is only mapped to be
+ * hashed. Fonts registered with registerFontFile() benefit the most.
+ *
+ * Entries of a font whose file changed are dropped, and the whole pack is
+ * when the library or Qt version changes. New pixmaps are written by
+ * flushDiskCache(), when exceeding the DiskCache budget, and when the
+ * application exits.
+ *
+ * Pass an empty @a directory to disable it. Must be called from the GUI
+ * thread. Returns @c false if @a directory cannot be created.
  */
-void QFontIconEngine::setIcon(const QString& name, QIcon::Mode mode, QIcon::State state)
+bool QFontIconEngine::setDiskCache(const QString& directory)
 {
-    auto it = QFontIconEnginePrivate::iconNames.find(name);
-    if(it == QFontIconEnginePrivate::iconNames.end())
+    auto& cache = QFontIconEnginePrivate::diskCache;
+
+    if(cache.isOpen())
+        cache.close(QFontIconEnginePrivate::fontHashes());
+
+    if(directory.isEmpty())
+        return true;
+
+    static bool cleanup = false;
+    if(!cleanup)
+    {
+        qAddPostRoutine(flushDiskCache);
+        cleanup = true;
+    }
+
+    if(!cache.open(directory))
     {
-        qWarning() << "QFontIcon: Invalid icon name";
-        return;
+        qWarning() << "QFontIcon: Cannot use disk cache" << directory;
+        return false;
     }
 
-    setIcon(it.value(), mode, state);
+    return true;
 }
 
 /**
- * @brief Set the font id for the given state.
+ * @brief Write the pixmaps rendered since the last flush to the disk cache.
  */
-void QFontIconEngine::setFont(int font, QIcon::Mode mode, QIcon::State state)
+void QFontIconEngine::flushDiskCache()
 {
-    d->fonts.set(font, mode, state);
+    TraceSpan span("flushDiskCache");
+    QFontIconEnginePrivate::flushDiskCache();
 }
 
 /**
- * @brief Set the font name for the given state.
+ * @brief Convenience function that returns an icon.
  */
-void QFontIconEngine::setFont(const QString& name, QIcon::Mode mode, QIcon::State state)
+QIcon QFontIconEngine::icon(int icon, int font)
 {
-    auto it = QFontIconEnginePrivate::fontNames.find(name);
-    if(it == QFontIconEnginePrivate::fontNames.end())
-    {
-        qWarning() << "QFontIcon: Invalid font name";
-        return;
-    }
-
-    setFont(it.value(), mode, state);
+    return QIcon(new QFontIconEngine(icon, font));
 }
 
 /**
- * @brief Set the scale factor for the given state.
+ * @brief Convenience function that returns an icon.
  */
-void QFontIconEngine::setScaleFactor(qreal scale, QIcon::Mode mode, QIcon::State state)
+QIcon QFontIconEngine::icon(const QString& icon, const QString& font)
 {
-    d->scales.set(scale, mode, state);
+    return QIcon(new QFontIconEngine(icon, font));
 }
 
 /**
- * @brief Set the color for the given state.
+ * @brief Convenience function that returns an icon.
+ *
+ * @overload
  */
-void QFontIconEngine::setColor(const QColor& color, QIcon::Mode mode, QIcon::State state)
+QIcon QFontIconEngine::icon(QStringView icon, QStringView font)
 {
-    d->colors.set(color, mode, state);
+    return QIcon(new QFontIconEngine(icon, font));
 }
 
 /**
- * @brief Set the rotation speed for the given state.
+ * @brief Convenience function that returns an icon.
+ *
+ * @overload
  */
-void QFontIconEngine::setSpeed(qreal speed, QIcon::Mode mode, QIcon::State state)
+QIcon QFontIconEngine::icon(QLatin1String icon, QLatin1String font)
 {
-    d->speeds.set(speed, mode, state);
-    d->setupTimer();
+    return QIcon(new QFontIconEngine(icon, font));
 }
 
 /**
- * @brief Set the easing curve point for the given state.
+ * @brief Set the default font to use.
+ *
+ * Before calling this function, the default font is set to 0.
  */
-void QFontIconEngine::setCurve(const QEasingCurve& curve, QIcon::Mode mode, QIcon::State state)
+void QFontIconEngine::setDefaultFont(int font)
 {
-    d->curves.set(curve, mode, state);
+    QFontIconEnginePrivate::defaultFont = font;
 }
 
 /**
- * @brief Set the widget the rotation animation displays on.
+ * @brief Returns the currently set default font.
  */
-void QFontIconEngine::setWidget(QWidget* widget)
+int QFontIconEngine::defaultFont()
 {
-    d->widget = widget;
-    d->setupTimer();
+    return QFontIconEnginePrivate::defaultFont;
 }
 
 /**
- * @brief Set if the red badge should be enabled
+ * @brief Set the order in which AnyFont looks for icons.
+ *
+ * With the solid, regular and brands Font Awesome styles loaded, the code
+ * point alone does not tell which font has the icon. Engines set to AnyFont
+ * use the first font of @a fonts containing their icon:
+ *
+ * @code
+ * QFontIconEngine::setFontPriority({ fa::solid, fa::regular, fa::brands });
+ * QFontIconEngine::setDefaultFont(QFontIconEngine::AnyFont);
+ *
+ * auto github = QFontIconEngine::icon(fa::v6::github); // from fa::brands
+ * @endcode
+ *
+ * An empty list, the default, means every font by ascending id. The font
+ * is picked once per engine and state, from coverage bitmaps built when
+ * fonts are loaded, and picked again after fonts are loaded or unloaded.
  */
-void QFontIconEngine::setBadgeEnabled(bool en)
+void QFontIconEngine::setFontPriority(const QVector<int>& fonts)
 {
-    d->badge = en;
+    {
+        QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+        QFontIconEnginePrivate::fontPriority = fonts;
+    }
+
+    QFontIconEnginePrivate::fontsChanged();
 }
 
-QFontIconEngine* QFontIconEngine::QFontIconEngine::clone() const
+/**
+ * @brief Returns the order in which AnyFont looks for icons.
+ */
+QVector<int> QFontIconEngine::fontPriority()
 {
-    return new QFontIconEngine(*this);
+    QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+    return QFontIconEnginePrivate::fontPriority;
 }
 
-QSize QFontIconEngine::actualSize(const QSize &size, QIcon::Mode mode, QIcon::State state)
+/**
+ * @brief Returns the first font, in fontPriority() order, containing
+ * @a icon, or AnyFont if none does.
+ */
+int QFontIconEngine::findFont(int icon)
 {
-    Q_UNUSED(mode);
-    Q_UNUSED(state);
-
-    if(!isValid())
-    {
-        qWarning() << "QFontIconEngine: Invalid object";
-        return {};
-    }
-
-    return size;
+    return QFontIconEnginePrivate::findFont(icon);
 }
 
-void QFontIconEngine::paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state)
+/**
+ * @brief Returns a snapshot of the rendering statistics.
+ *
+ * Counters are updated with relaxed atomic operations and are always
+ * compiled in.
+ *
+ * @see resetStatistics()
+ */
+QFontIconEngine::Statistics QFontIconEngine::statistics()
 {
-    if(!isValid())
-    {
-        qWarning() << "QFontIcon: Invalid QFontIcon object";
-        return;
-    }
-
-    painter->save();
-
-    painter->setRenderHint(QPainter::Antialiasing);
-
-    auto r  = QRectF(rect); // Use floating for more precision
-    auto s  = r.size();
-    auto g  = glyphIndex(mode, state);
-    int id  = font(mode, state);
-    auto f  = QFontIconEnginePrivate::getFont(id);
-    auto sf = scaleFactor(mode, state);
-    auto c  = color(mode, state);
-
-    d->resizeFont(s, f, sf, g);
-
-    auto a = d->angles.get(mode, state);
-
-    if(a != 0)
+    auto& c = QFontIconEnginePrivate::counters;
+
+    Statistics s;
+    s.paintCalls         = c.paintCalls.load(std::memory_order_relaxed);
+    s.pixmapCalls        = c.pixmapCalls.load(std::memory_order_relaxed);
+    s.outlineCacheHits   = c.outlineCacheHits.load(std::memory_order_relaxed);
+    s.outlineCacheMisses = c.outlineCacheMisses.load(std::memory_order_relaxed);
+    s.pixmapCacheHits    = c.pixmapCacheHits.load(std::memory_order_relaxed);
+    s.pixmapCacheMisses  = c.pixmapCacheMisses.load(std::memory_order_relaxed);
+    s.diskCacheHits      = c.diskCacheHits.load(std::memory_order_relaxed);
+    s.diskCacheMisses    = c.diskCacheMisses.load(std::memory_order_relaxed);
+    s.rasterizations     = c.rasterizations.load(std::memory_order_relaxed);
+    s.liveEngines        = c.liveEngines.load(std::memory_order_relaxed);
+    s.activeTimers       = c.activeTimers.load(std::memory_order_relaxed);
+    s.animationTicks     = c.animationTicks.load(std::memory_order_relaxed);
+
+    for(int i = 0; i < Statistics::SizeClasses; ++i)
     {
-        auto center = r.center();
-        painter->translate(center.x(), center.y());
-        painter->rotate(a);
-        painter->translate(-center.x(), -center.y());
+        for(int j = 0; j < Statistics::LatencyBuckets; ++j)
+            s.paintLatency[i][j] = c.paintLatency[i][j].load(std::memory_order_relaxed);
     }
 
-    auto bounds = f.boundingRect(g);
-    auto glyph = f.pathForGlyph(g);
-
-    painter->translate(r.center() - bounds.center());
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(c);
-    painter->drawPath(glyph);
-
-    painter->restore();
-
-    if(d->badge)
-    {
-        painter->save();
-
-        painter->setPen(Qt::NoPen);
-        painter->setBrush(QColor(255, 0, 0, 200));
-
-        auto bs = r.size() / 3.0;
-
-        if(bs.width() < 8 || bs.height() < 8)
-            bs = r.size() / 2.0;
-
-        QRectF badgeRect(r.right()-bs.width(), r.top(), bs.width(), bs.height());
-
-        painter->drawEllipse(badgeRect);
-
-        painter->restore();
-    }
+    return s;
 }
 
-QPixmap QFontIconEngine::pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state)
+/**
+ * @brief Reset the statistics counters to zero.
+ *
+ * The live engines and active timers gauges are left untouched.
+ */
+void QFontIconEngine::resetStatistics()
 {
-    if(size.isValid() && !size.isEmpty())
+    auto& c = QFontIconEnginePrivate::counters;
+
+    c.paintCalls.store(0, std::memory_order_relaxed);
+    c.pixmapCalls.store(0, std::memory_order_relaxed);
+    c.outlineCacheHits.store(0, std::memory_order_relaxed);
+    c.outlineCacheMisses.store(0, std::memory_order_relaxed);
+    c.pixmapCacheHits.store(0, std::memory_order_relaxed);
+    c.pixmapCacheMisses.store(0, std::memory_order_relaxed);
+    c.diskCacheHits.store(0, std::memory_order_relaxed);
+    c.diskCacheMisses.store(0, std::memory_order_relaxed);
+    c.rasterizations.store(0, std::memory_order_relaxed);
+    c.animationTicks.store(0, std::memory_order_relaxed);
+
+    for(auto& sizeClass : c.paintLatency)
     {
-        QPixmap pm(size);
-        pm.fill( Qt::transparent ); // we need transparency
-        {
-            QPainter p(&pm);
-            paint(&p, QRect(QPoint(0,0),size), mode, state);
-        }
-        return pm;
+        for(auto& bucket : sizeClass)
+            bucket.store(0, std::memory_order_relaxed);
     }
-    else
-        return {};
 }
 
-void QFontIconEngine::virtual_hook(int id, void* data)
+/**
+ * @brief Deliver trace spans to @a sink.
+ *
+ * Spans cover loadFont(), paint(), pixmap(), cache fills and animation ticks.
+ * The sink is called with an internal lock held, from whichever thread the
+ * span ended on. Pass an empty function to remove it.
+ *
+ * When no sink and no trace file are set, spans cost a single atomic load.
+ *
+ * @see startTraceFile()
+ */
+void QFontIconEngine::setTraceSink(TraceSink sink)
 {
-    if(id == QIconEngine::IsNullHook)
-        *static_cast<bool*>(data) = !isValid();
-    else
-        QIconEngine::virtual_hook(id, data);
+    QMutexLocker lock(&QFontIconEnginePrivate::traceMutex);
+    QFontIconEnginePrivate::traceSink = sink;
+    QFontIconEnginePrivate::startTracing();
 }
 
 /**
- * @brief load the font located at @a filename.
+ * @brief Write trace spans to @a filename in the Chrome trace event format.
  *
- * You can pass an arbitrary font id and font name if you're using multiple
- * fonts.
+ * The file can be opened in Perfetto or chrome://tracing. It is completed by
+ * stopTraceFile(), or when the application exits.
  */
-bool QFontIconEngine::loadFont(const QString& filename, int font, const QString& name)
+bool QFontIconEngine::startTraceFile(const QString& filename)
 {
-    // Open it
-    QRawFont rawFont(filename, 32);
+    QScopedPointer<QFile> file(new QFile(filename));
+    if(!file->open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "QFontIcon: Cannot open trace file" << filename;
+        return false;
+    }
 
-    QFontIconEnginePrivate::availableFonts[font] = rawFont;
+    stopTraceFile();
 
-    if(!name.isEmpty())
-        registerFontName(name, font);
+    static bool cleanup = false;
+    if(!cleanup)
+    {
+        qAddPostRoutine(stopTraceFile);
+        cleanup = true;
+    }
 
+    QMutexLocker lock(&QFontIconEnginePrivate::traceMutex);
+    QFontIconEnginePrivate::traceFile.swap(file);
+    QFontIconEnginePrivate::traceFirstEvent = true;
+    QFontIconEnginePrivate::startTracing();
     return true;
 }
 
 /**
- * @brief Convenience function that returns an icon.
+ * @brief Complete and close the trace file, if any.
  */
-QIcon QFontIconEngine::icon(int icon, int font)
+void QFontIconEngine::stopTraceFile()
 {
-    return QIcon(new QFontIconEngine(icon, font));
-}
+    QMutexLocker lock(&QFontIconEnginePrivate::traceMutex);
 
-/**
- * @brief Convenience function that returns an icon.
- */
-QIcon QFontIconEngine::icon(const QString& icon, const QString& font)
-{
-    return QIcon(new QFontIconEngine(icon, font));
-}
+    auto& file = QFontIconEnginePrivate::traceFile;
+    if(!file)
+        return;
 
-/**
- * @brief Set the default font to use.
- *
- * Before calling this function, the default font is set to 0.
- */
-void QFontIconEngine::setDefaultFont(int font)
-{
-    QFontIconEnginePrivate::defaultFont = font;
+    file->write(QFontIconEnginePrivate::traceFirstEvent ? "[]\n" : "\n]\n");
+    file.reset();
+
+    QFontIconEnginePrivate::startTracing();
 }
 
 /**
- * @brief Returns the currently set default font.
+ * @brief Register a name for the given code point
  */
-int QFontIconEngine::defaultFont()
+bool QFontIconEngine::registerIconName(QString name, int code)
 {
-    return QFontIconEnginePrivate::defaultFont;
+    name = name.trimmed();
+    if(name.isEmpty())
+    {
+        qWarning() << "QFontIcon: Invalid icon name";
+        return false;
+    }
+
+    QFontIconEnginePrivate::registerName(QFontIconEnginePrivate::iconNames,
+                                         QFontIconEnginePrivate::iconCodes,
+                                         name, code);
+    return true;
 }
 
 /**
  * @brief Register a name for the given code point
+ *
+ * @overload
+ *
+ * The name is only copied if it was not registered yet.
  */
-bool QFontIconEngine::registerIconName(QString name, int code)
+bool QFontIconEngine::registerIconName(QStringView name, int code)
 {
     name = name.trimmed();
     if(name.isEmpty())
@@ -781,7 +3202,9 @@ bool QFontIconEngine::registerIconName(QString name, int code)
         return false;
     }
 
-    QFontIconEnginePrivate::iconNames[name] = code;
+    QFontIconEnginePrivate::registerName(QFontIconEnginePrivate::iconNames,
+                                         QFontIconEnginePrivate::iconCodes,
+                                         name, code);
     return true;
 }
 
@@ -790,12 +3213,33 @@ bool QFontIconEngine::registerIconName(QString name, int code)
  */
 bool QFontIconEngine::registerIconName(const QMap<QString, int>& names)
 {
+    QFontIconEnginePrivate::iconNames.reserve(QFontIconEnginePrivate::iconNames.size() + names.size());
+    QFontIconEnginePrivate::iconCodes.reserve(QFontIconEnginePrivate::iconCodes.size() + names.size());
+
     bool r = true;
     for(auto it = names.begin(); it != names.end(); ++it)
         r &= registerIconName(it.key(), it.value());
     return r;
 }
 
+/**
+ * @brief Register a function resolving icon names on demand.
+ *
+ * Names that are not registered with registerIconName() are passed to the
+ * resolvers, in registration order, until one returns a valid code point.
+ * This lets large static tables be queried directly instead of being copied.
+ * The optional @a reverse function is used the same way by iconName().
+ */
+void QFontIconEngine::registerIconNameResolver(IconNameResolver resolver, IconCodeResolver reverse)
+{
+    if(!resolver)
+        return;
+
+    auto r = qMakePair(resolver, reverse);
+    if(!QFontIconEnginePrivate::iconResolvers.contains(r))
+        QFontIconEnginePrivate::iconResolvers.append(r);
+}
+
 /**
  * @brief Register a font name for the given font id
  */
@@ -808,7 +3252,9 @@ bool QFontIconEngine::registerFontName(QString name, int font)
         return false;
     }
 
-    QFontIconEnginePrivate::fontNames[name] = font;
+    QFontIconEnginePrivate::registerName(QFontIconEnginePrivate::fontNames,
+                                         QFontIconEnginePrivate::fontIds,
+                                         name, font);
     return true;
 }
 
@@ -822,3 +3268,115 @@ bool QFontIconEngine::registerFontName(const QMap<QString, int>& names)
         r &= registerFontName(it.key(), it.value());
     return r;
 }
+
+
+
+// =============================================================================
+
+static_assert(std::is_trivially_copyable<QFontIcon>::value, "QFontIcon must stay trivially copyable");
+
+/**
+ * @class QFontIcon
+ * @brief Lightweight font icon value.
+ *
+ * QFontIcon holds a handle to a shared glyph outline along with a font id, a
+ * color and a scale factor. It is trivially copyable, can be stored in a
+ * QVariant, and paint() draws it without going through QIcon, QIconEngine
+ * virtuals or name lookups:
+ *
+ * @code
+ * QFontIcon star(fa::v6::star, fa::solid, Qt::darkYellow);
+ *
+ * star.paint(painter, rect);
+ *
+ * // When an API wants a QIcon
+ * button->setIcon(star.toIcon());
+ * @endcode
+ *
+ * Outlines are shared with QFontIconEngine and released when their font is
+ * unloaded. A QFontIcon whose font is not available paints nothing. Values
+ * must be created and painted from the GUI thread.
+ */
+
+/**
+ * @brief Construct an icon for @a icon of @a font.
+ *
+ * An invalid @a color is replaced by the current palette button text color.
+ * With QFontIconEngine::AnyFont, the font holding the icon is picked when
+ * painting, and picked again whenever fonts are loaded or unloaded. font()
+ * then returns AnyFont.
+ */
+QFontIcon::QFontIcon(int icon, int font, const QColor& color, qreal scale) :
+    code(icon),
+    fontId(font),
+    scale(float(scale))
+{
+    if(icon != QFontIconEngine::InvalidIcon)
+        handle = QFontIconEnginePrivate::glyphHandle(fontId, icon);
+
+    setColor(color);
+}
+
+/**
+ * @brief Returns the icon registered as @a name, or a null icon.
+ */
+QFontIcon QFontIcon::fromName(QStringView name, int font, const QColor& color, qreal scale)
+{
+    int icon = QFontIconEnginePrivate::resolveIconName(name);
+    if(icon == QFontIconEngine::InvalidIcon)
+    {
+        qWarning() << "QFontIcon: Invalid icon name";
+        return {};
+    }
+
+    return QFontIcon(icon, font, color, scale);
+}
+
+/**
+ * @brief Set the color, an invalid @a color means the palette button text
+ * color.
+ */
+void QFontIcon::setColor(const QColor& color)
+{
+    rgba = (color.isValid() ? color : QFontIconEnginePrivate::defaultColor(QIcon::Normal)).rgba();
+}
+
+/**
+ * @brief Returns a QIcon painting the same icon.
+ */
+QIcon QFontIcon::toIcon() const
+{
+    if(isNull())
+        return {};
+
+    auto engine = new QFontIconEngine(code, fontId);
+    engine->setColor(color());
+    engine->setScaleFactor(scale);
+    return QIcon(engine);
+}
+
+void QFontIcon::paintGlyph(QPainter* painter, const QRectF& rect) const
+{
+    const auto& g = QFontIconEnginePrivate::handleGlyph(handle);
+    if(g.path.isEmpty())
+        return;
+
+    QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.paintCalls);
+
+    // Restoring the few states changed is much cheaper than save() / restore().
+    auto transform = painter->transform();
+    auto brush     = painter->brush();
+    auto pen       = painter->pen();
+    bool aa        = painter->testRenderHint(QPainter::Antialiasing);
+
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QColor::fromRgba(rgba));
+    painter->setTransform(QFontIconEnginePrivate::glyphTransform(g, rect, scale, 0), true);
+    painter->drawPath(g.path);
+
+    painter->setTransform(transform);
+    painter->setBrush(brush);
+    painter->setPen(pen);
+    painter->setRenderHint(QPainter::Antialiasing, aa);
+}
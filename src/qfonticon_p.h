@@ -0,0 +1,672 @@
+#ifndef QFONTICON_P_H
+#define QFONTICON_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QFontIcon API. It is shared by the library
+// sources and may change from version to version without notice.
+//
+
+#include <qfonticon.h>
+#include <qfonticonatlas.h>
+
+#include <QMap>
+#include <QHash>
+#include <QVector>
+#include <QSet>
+#include <QBitArray>
+#include <QRawFont>
+#include <QTimer>
+#include <QFile>
+#include <QSharedPointer>
+#include <QCache>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+#include <QPainterPath>
+#include <QImage>
+#include <QPixmap>
+
+#include <atomic>
+#include <climits>
+#include <functional>
+#include <tuple>
+
+template<class T>
+class StateMap : public QMap<QPair<QIcon::Mode, QIcon::State>, T>
+{
+public:
+    typedef QPair<QIcon::Mode, QIcon::State> Key;
+
+public:
+    StateMap() : QMap<Key, T>() {}
+    StateMap(StateMap<T> &&other) noexcept : QMap<Key, T>(other) {}
+    StateMap(const StateMap<T> &other) : QMap<Key, T>(other) {}
+    StateMap(std::initializer_list<std::pair<Key, T>> list)  : QMap<Key, T>(list) {}
+    StateMap<T>& operator=(StateMap<T> &&other) noexcept {  QMap<Key, T>::operator=(other); return *this; }
+    StateMap<T>& operator=(const StateMap<T> &other) noexcept {  QMap<Key, T>::operator=(other); return *this; }
+    ~StateMap() = default;
+
+    T get(const Key& k, const T& defaultValue = {}) const
+    {
+        auto it = this->find(k);
+        if(it != this->end())
+            return it.value();
+
+        if(k.first != QIcon::Normal)
+            return get(QIcon::Normal, k.second, defaultValue);
+
+        if(k.second != QIcon::Off)
+            return get(QIcon::Normal, QIcon::Off, defaultValue);
+
+        return defaultValue;
+    }
+
+    T get(QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off, const T& defaultValue = {}) const
+    {
+        return get(Key{mode, state}, defaultValue);
+    }
+
+    void set(const T& value, const Key& k) { this->insert(k, value); }
+
+    void set(const T& value, QIcon::Mode mode = QIcon::Normal, QIcon::State state = QIcon::Off)
+    {
+        set(value, {mode, state});
+    }
+};
+
+
+
+// =============================================================================
+
+
+
+/*
+ * Name -> value table kept sorted so it can be searched with QString,
+ * QStringView or QLatin1String keys alike. Looking a name up never allocates.
+ */
+class NameTable
+{
+public:
+    typedef QPair<QString, int> Entry;
+    typedef QVector<Entry>::iterator iterator;
+    typedef QVector<Entry>::const_iterator const_iterator;
+
+public:
+    template<class K>
+    iterator lowerBound(K name)
+    {
+        return std::lower_bound(entries.begin(), entries.end(), name,
+                                [](const Entry& e, K n){ return QStringView(e.first).compare(n) < 0; });
+    }
+
+    template<class K>
+    const_iterator find(K name) const
+    {
+        auto it = std::lower_bound(entries.cbegin(), entries.cend(), name,
+                                   [](const Entry& e, K n){ return QStringView(e.first).compare(n) < 0; });
+
+        if(it != entries.cend() && QStringView(it->first).compare(name) == 0)
+            return it;
+
+        return entries.cend();
+    }
+
+    iterator insert(iterator before, const QString& name, int value) { return entries.insert(before, { name, value }); }
+    void reserve(int size) { entries.reserve(size); }
+    int size() const { return entries.size(); }
+
+    iterator begin() { return entries.begin(); }
+    iterator end() { return entries.end(); }
+    const_iterator begin() const { return entries.cbegin(); }
+    const_iterator end() const { return entries.cend(); }
+
+private:
+    QVector<Entry> entries;
+};
+
+inline QString toString(const QString& s) { return s; }
+inline QString toString(QStringView s) { return s.toString(); }
+
+
+
+// =============================================================================
+
+
+
+/*
+ * QCache remembering the cost of its entries, so the memory they use can be
+ * reported without touching the LRU order. Evicted entries are forgotten
+ * lazily.
+ */
+template<class K, class T>
+class AccountedCache : public QCache<K, T>
+{
+public:
+    explicit AccountedCache(qint64 budget) : QCache<K, T>(maxCost(budget)), bytes(budget < 0 ? -1 : budget) {}
+
+    void setBudget(qint64 budget)
+    {
+        bytes = budget < 0 ? -1 : budget;
+        this->setMaxCost(maxCost(budget));
+    }
+
+    // The budget as set, -1 if unlimited. Costs are capped at INT_MAX.
+    qint64 budget() const { return bytes; }
+
+    bool insert(const K& key, T* object, int cost)
+    {
+        if(costs.size() > 2 * this->size() + 64)
+            prune();
+
+        costs.insert(key, cost);
+        QCache<K, T>::insert(key, object, cost);
+        return this->contains(key);
+    }
+
+    bool remove(const K& key)
+    {
+        costs.remove(key);
+        return QCache<K, T>::remove(key);
+    }
+
+    void clear()
+    {
+        costs.clear();
+        QCache<K, T>::clear();
+    }
+
+    // Calls f(key, cost) for every cached entry.
+    template<class F>
+    void forEachCost(F f)
+    {
+        prune();
+        for(auto it = costs.cbegin(); it != costs.cend(); ++it)
+            f(it.key(), it.value());
+    }
+
+    // A negative budget means unlimited.
+    static int maxCost(qint64 budget)
+    {
+        return budget < 0 ? INT_MAX : int(qMin<qint64>(budget, INT_MAX));
+    }
+
+private:
+    void prune()
+    {
+        for(auto it = costs.begin(); it != costs.end();)
+        {
+            if(this->contains(it.key()))
+                ++it;
+            else
+                it = costs.erase(it);
+        }
+    }
+
+    QHash<K, int> costs;
+    qint64 bytes;
+};
+
+
+
+// =============================================================================
+
+
+
+/*
+ * Rendered icons kept across launches in a single pack file: a header, an
+ * index sorted by key, then raw premultiplied ARGB32 images. The file is
+ * mapped and searched in place, new images are kept in memory until flushed.
+ * The pack is machine local and written in native byte order.
+ */
+class DiskPixmapCache
+{
+public:
+    struct Key
+    {
+        quint64 fontHash;   // content hash of the font file, see fontHash()
+        qint32  font;
+        qint32  code;
+        qint32  width;
+        qint32  height;
+        quint32 color;
+        quint32 badge;
+        double  scale;
+
+        bool operator<(const Key& o) const
+        {
+            return std::tie(fontHash, font, code, width, height, color, badge, scale) <
+                   std::tie(o.fontHash, o.font, o.code, o.width, o.height, o.color, o.badge, o.scale);
+        }
+
+        bool operator==(const Key& o) const { return !(*this < o) && !(o < *this); }
+    };
+
+    struct Entry
+    {
+        Key     key;
+        quint64 offset;
+        quint64 bytes;
+    };
+
+    struct Header
+    {
+        char    magic[8];
+        quint32 format;
+        quint32 qt;
+        char    library[16];
+        quint32 count;
+        quint32 reserved;
+    };
+
+public:
+    bool isOpen() const { return !directory.isEmpty(); }
+    bool open(const QString& dir);
+    void close(const QHash<int, quint64>& fontHashes);
+    void flush(const QHash<int, quint64>& fontHashes);
+
+    bool find(const Key& key, QImage& image);
+    void insert(const Key& key, const QImage& image);
+
+    qint64 budget = 16 * 1024 * 1024;
+
+    template<class F>
+    void forEachEntry(F f) const
+    {
+        for(quint32 i = 0; i < count; ++i)
+            f(index[i].key, qint64(index[i].bytes));
+        for(auto it = pending.cbegin(); it != pending.cend(); ++it)
+            f(it.key(), qint64(it->sizeInBytes()));
+    }
+
+private:
+    static Header header();
+    QString fileName() const { return directory + QLatin1String("/qfonticon.pack"); }
+    void map();
+    void unmap();
+
+    QString               directory;
+    QScopedPointer<QFile> file;
+    const uchar*          data = nullptr;
+    const Entry*          index = nullptr;
+    quint32               count = 0;
+    QSet<quint32>         used;      // index entries hit this session
+    QMap<Key, QImage>     pending;
+    qint64                pendingBytes = 0;
+};
+
+
+
+// =============================================================================
+
+
+
+class QFontIconEnginePrivate
+{
+public:
+    QFontIconEnginePrivate();
+    ~QFontIconEnginePrivate();
+
+    void setupTimer();
+    bool fontsLoading() const;
+    static QColor defaultColor(QIcon::Mode mode);
+
+    StateMap<int> icons;
+    StateMap<int> fonts;
+    StateMap<qreal> scales;
+    StateMap<QColor> colors;
+    StateMap<qreal> speeds;
+    StateMap<QEasingCurve> curves;
+
+    QWidget* widget = nullptr;
+
+    bool badge = false;
+
+    QScopedPointer<QTimer> timer;
+    StateMap<qreal> progress;
+    StateMap<qreal> angles;
+
+    // Fonts picked for AnyFont states, valid as long as fontGeneration is.
+    StateMap<int> resolvedFonts;
+    quint64 resolvedGeneration = 0;
+    int resolveFont(QIcon::Mode mode, QIcon::State state, int icon);
+
+    struct FontInfo
+    {
+        int     appId = -1;
+        QString family;
+        QString style;
+        QFont   font;
+    };
+
+    static int defaultFont;
+
+    // Glyph metrics registered for a font id, see registerGlyphMetrics().
+    // They are used instead of the font's own while its checksum matches.
+    struct MetricsTable
+    {
+        quint64                              checksum;
+        int                                  unitsPerEm;
+        const QFontIconEngine::GlyphMetrics* glyphs;
+        int                                  count;
+    };
+
+    // A loaded font. Its bytes are either mapped from disk, used in place
+    // from the resources, or owned when neither was possible. Fonts
+    // registered with registerFontFile(), or released by trimCaches(), only
+    // have a path until next used.
+    struct FontData
+    {
+        QString               path;
+        QSharedPointer<QFile> file; // keeps the mapping alive
+        QByteArray            data;
+        QRawFont              raw;
+        quint64               lastUse = 0;
+        quint64               hash = 0;     // see fontHash()
+        bool                  prepared = false; // prepareFont() ran since mapped
+        QBitArray             coverage;     // code points mapped, kept when released
+        MetricsTable          metrics {};   // registered metrics, if they match
+    };
+
+    // Fonts can be loaded from worker threads, availableFonts and loadingFonts
+    // are guarded by fontsMutex. loadingFonts maps each font id to its latest
+    // loadFontAsync() request, older requests are dropped when they finish.
+    static QMutex fontsMutex;
+    static QMap<int, FontData> availableFonts;
+    static QHash<int, quint64> loadingFonts;
+    static quint64 loadRequests;
+    static bool hasFont(int font);
+    static bool isLoading(int font);
+    static QRawFont getFont(int font);
+    static bool mapFont(const QString& filename, FontData& font);
+    static bool ensureMapped(int font);
+    static bool ensureLoaded(int font, bool parse = true);
+    static quint64 fontHash(int font);
+
+    // Reads the character to glyph map of a TrueType / OpenType font.
+    static bool forEachCodePoint(const QByteArray& data, const std::function<void(uint code, quint32 glyph)>& f);
+    static QVector<uint> codePoints(int font);
+    static QBitArray coverage(const QByteArray& data);
+    static QBitArray coverage(const MetricsTable& metrics);
+
+    static QHash<int, MetricsTable> metricsTables;
+
+    // Outlines compiled into the application, see registerOutlines(). Their
+    // fonts need not be loaded.
+    struct OutlineTable
+    {
+        int                             unitsPerEm;
+        const QFontIconEngine::Outline* outlines;
+        int                             count;
+    };
+
+    static QHash<int, OutlineTable> outlineTables;
+    static const QFontIconEngine::Outline* findOutline(const OutlineTable& table, int code);
+
+    // Mapped icon packs, see loadIconPack(). Their fonts need not be loaded.
+    struct IconPack
+    {
+        QSharedPointer<QFile> file;     // keeps the mapping alive
+        QByteArray            data;
+        int                   unitsPerEm;
+        int                   shift;
+        quint32               glyphCount;
+        quint32               nameCount;
+        quint32               glyphs;   // section offsets
+        quint32               names;
+        quint32               strings;
+        quint32               commands;
+        quint32               points;
+    };
+
+    static QHash<int, IconPack> iconPacks;
+    static bool openIconPack(const QString& filename, IconPack& pack);
+    static quint32 findPackGlyph(const IconPack& pack, int code);
+    static int resolvePackName(QStringView name);
+    static QString resolvePackCode(int code);
+    static quint64 fontChecksum(const QByteArray& data);
+    static void prepareFont(int font, FontData& f);
+
+    // AnyFont resolution. fontGeneration changes whenever the answer of
+    // findFont() may, so engines can keep theirs until then.
+    static QVector<int> fontPriority;
+    static std::atomic<quint64> fontGeneration;
+    static int findFont(int code);
+    static QVector<int> knownFonts();
+    static void fontsChanged() { fontGeneration.fetch_add(1, std::memory_order_relaxed); }
+
+    // Font data budget, least recently used fonts are released first.
+    static qint64 fontBudget;
+    static quint64 fontClock;
+    static bool atlasUnlimited;
+    static void enforceFontBudget(int keep);
+
+    // Glyph outlines in font units, keyed by font id and code point.
+    struct Glyph
+    {
+        quint32      index = 0;
+        qreal        unitsPerEm = 1;
+        QRectF       bounds;
+        QPainterPath path;
+    };
+
+    static AccountedCache<quint64, Glyph> glyphs;
+    static Glyph glyph(int font, int code);
+    static bool glyphMetrics(int font, int code, Glyph& glyph);
+    static bool covers(int font, int code);
+    static bool embeddedGlyph(int font, int code, Glyph& glyph);
+    static bool packGlyph(int font, int code, Glyph& glyph);
+    static QTransform glyphTransform(const Glyph& glyph, const QRectF& rect, qreal scale, qreal angle);
+
+    // Rendered pixmaps of non rotating icons, keyed by everything that
+    // influences the rendering.
+    struct PixmapKey
+    {
+        int   font;
+        int   code;
+        QSize size;
+        QRgb  color;
+        qreal scale;
+        bool  badge;
+
+        bool operator==(const PixmapKey& o) const
+        {
+            return font == o.font && code == o.code && size == o.size &&
+                   color == o.color && scale == o.scale && badge == o.badge;
+        }
+    };
+
+    static AccountedCache<PixmapKey, QPixmap> pixmaps;
+
+    // Glyphs referenced by QFontIcon values. Handles index this table, one
+    // based, and are never reused; outlines are dropped with their font.
+    // Empty glyphs, e.g. looked up while their font was loading, are looked
+    // up again once fontGeneration changes.
+    struct Handle
+    {
+        int     font;
+        int     code;
+        bool    loaded;
+        quint64 generation;
+        Glyph   glyph;
+    };
+
+    static QVector<Handle> handles;
+    static QHash<quint64, quint32> handleIndex;
+    static quint32 glyphHandle(int font, int code);
+    static const Glyph& handleGlyph(quint32 handle);
+
+    static void purgeFont(int font);
+    static void releaseFont(FontData& font);
+
+    // Rendered pixmaps kept across launches, see setDiskCache().
+    static DiskPixmapCache diskCache;
+    static QHash<int, quint64> fontHashes();
+    static void flushDiskCache();
+
+    // Statistics counters, see QFontIconEngine::statistics()
+    struct Counters
+    {
+        std::atomic<quint64> paintCalls;
+        std::atomic<quint64> pixmapCalls;
+        std::atomic<quint64> outlineCacheHits;
+        std::atomic<quint64> outlineCacheMisses;
+        std::atomic<quint64> pixmapCacheHits;
+        std::atomic<quint64> pixmapCacheMisses;
+        std::atomic<quint64> diskCacheHits;
+        std::atomic<quint64> diskCacheMisses;
+        std::atomic<quint64> rasterizations;
+        std::atomic<quint64> liveEngines;
+        std::atomic<quint64> activeTimers;
+        std::atomic<quint64> animationTicks;
+        std::atomic<quint64> paintLatency[QFontIconEngine::Statistics::SizeClasses][QFontIconEngine::Statistics::LatencyBuckets];
+    };
+
+    static Counters counters;
+    static void count(std::atomic<quint64>& counter) { counter.fetch_add(1, std::memory_order_relaxed); }
+    static void recordPaint(const QSize& size, qint64 nsecs);
+
+    // Tracing, see QFontIconEngine::setTraceSink()
+    static std::atomic<bool> tracing;
+    static QMutex traceMutex;
+    static QElapsedTimer traceClock;
+    static QFontIconEngine::TraceSink traceSink;
+    static QScopedPointer<QFile> traceFile;
+    static bool traceFirstEvent;
+    static void startTracing();
+    static void trace(const QFontIconEngine::TraceEvent& event);
+    static void writeTraceEvent(const QFontIconEngine::TraceEvent& event);
+
+    static NameTable iconNames;
+    static NameTable fontNames;
+
+    // Reverse indexes, code point / font id to name. When several names share
+    // a value, the smallest one is indexed, just like QMap::key() would return.
+    static QHash<int, QString> iconCodes;
+    static QHash<int, QString> fontIds;
+
+    template<class K>
+    static void registerName(NameTable& names, QHash<int, QString>& index, K name, int value);
+
+    static QVector<QPair<QFontIconEngine::IconNameResolver, QFontIconEngine::IconCodeResolver>> iconResolvers;
+    static int resolveIconName(QStringView name);
+    static int resolveIconName(QLatin1String name);
+    template<class K>
+    static bool resolveFontName(K name, int& font);
+    static QString resolveIconCode(int code);
+};
+
+/*
+ * Scoped trace span. When tracing is disabled it costs one relaxed load.
+ */
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char* name) :
+        active(QFontIconEnginePrivate::tracing.load(std::memory_order_relaxed))
+    {
+        event.name = name;
+        if(active)
+            event.start = QFontIconEnginePrivate::traceClock.nsecsElapsed();
+    }
+
+    ~TraceSpan()
+    {
+        if(!active)
+            return;
+
+        event.duration = QFontIconEnginePrivate::traceClock.nsecsElapsed() - event.start;
+        event.thread   = quint64(quintptr(QThread::currentThreadId()));
+        QFontIconEnginePrivate::trace(event);
+    }
+
+    QFontIconEngine::TraceEvent event;
+
+private:
+    bool active;
+};
+
+inline uint qHash(const QFontIconEnginePrivate::PixmapKey& k, uint seed = 0)
+{
+    return qHash(qMakePair(k.font, k.code), seed) ^
+           qHash(qMakePair(k.size.width(), k.size.height()), seed) ^
+           qHash(qMakePair(k.color, k.badge), seed) ^
+           qHash(k.scale, seed);
+}
+
+
+
+// =============================================================================
+
+
+
+class QFontIconAtlasPrivate
+{
+public:
+    QFontIconAtlasPrivate(int pageSize, int maxPages);
+    ~QFontIconAtlasPrivate();
+
+    struct Key
+    {
+        int   font;
+        int   code;
+        int   size;
+        QRgb  color;
+        qreal dpr;
+        qreal scale;
+
+        bool operator==(const Key& o) const
+        {
+            return font == o.font && code == o.code && size == o.size &&
+                   color == o.color && dpr == o.dpr && scale == o.scale;
+        }
+    };
+
+    // Icons are packed in rows, a shelf is a row of icons of similar heights.
+    struct Shelf
+    {
+        int y;
+        int height;
+        int x;
+    };
+
+    struct Page
+    {
+        QImage          image;
+        QVector<Shelf>  shelves;
+        int             bottom  = 0;
+        int             icons   = 0;
+        quint64         lastUse = 0;
+    };
+
+    struct Entry
+    {
+        int   page;
+        QRect rect;
+    };
+
+    int                 pageSize;
+    int                 maxPages;
+    QVector<Page>       pages;
+    QHash<Key, Entry>   entries;
+    quint64             clock = 0;
+
+    bool allocate(Page& page, const QSize& size, QRect& rect) const;
+    int place(const QSize& size, QRect& rect);
+    void resetPage(int index);
+    void removeFont(int font);
+
+    // Every live atlas, so fonts can be purged from all of them.
+    static QSet<QFontIconAtlasPrivate*>& atlases();
+};
+
+inline uint qHash(const QFontIconAtlasPrivate::Key& k, uint seed = 0)
+{
+    return qHash(qMakePair(k.font, k.code), seed) ^
+           qHash(qMakePair(k.size, k.color), seed) ^
+           qHash(qMakePair(k.dpr, k.scale), seed);
+}
+
+#endif // QFONTICON_P_H
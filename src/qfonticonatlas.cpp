@@ -0,0 +1,336 @@
+#include "qfonticon_p.h"
+
+#include <QPainter>
+#include <QPaintDevice>
+#include <QtMath>
+
+QFontIconAtlasPrivate::QFontIconAtlasPrivate(int pageSize, int maxPages) :
+    pageSize(qMax(1, pageSize)),
+    maxPages(qMax(1, maxPages))
+{
+    atlases().insert(this);
+}
+
+QFontIconAtlasPrivate::~QFontIconAtlasPrivate()
+{
+    atlases().remove(this);
+}
+
+QSet<QFontIconAtlasPrivate*>& QFontIconAtlasPrivate::atlases()
+{
+    static QSet<QFontIconAtlasPrivate*> set;
+    return set;
+}
+
+bool QFontIconAtlasPrivate::allocate(Page& page, const QSize& size, QRect& rect) const
+{
+    // Use the lowest shelf that fits, wasting at most a quarter of its height.
+    Shelf* best = nullptr;
+    for(auto& s : page.shelves)
+    {
+        if(s.height < size.height() || s.height > size.height() + size.height() / 4)
+            continue;
+
+        if(s.x + size.width() > pageSize)
+            continue;
+
+        if(!best || s.height < best->height)
+            best = &s;
+    }
+
+    if(!best)
+    {
+        if(page.bottom + size.height() > pageSize)
+            return false;
+
+        page.shelves.append({ page.bottom, size.height(), 0 });
+        page.bottom += size.height();
+        best = &page.shelves.last();
+    }
+
+    rect = QRect(QPoint(best->x, best->y), size);
+    best->x += size.width();
+    return true;
+}
+
+int QFontIconAtlasPrivate::place(const QSize& size, QRect& rect)
+{
+    for(int i = 0; i < pages.size(); ++i)
+    {
+        if(allocate(pages[i], size, rect))
+            return i;
+    }
+
+    if(pages.size() < maxPages)
+    {
+        Page page;
+        page.image = QImage(pageSize, pageSize, QImage::Format_ARGB32_Premultiplied);
+        page.image.fill(Qt::transparent);
+        pages.append(page);
+
+        return allocate(pages.last(), size, rect) ? pages.size() - 1 : -1;
+    }
+
+    // Every page is full, recycle the least recently used one.
+    int lru = 0;
+    for(int i = 1; i < pages.size(); ++i)
+    {
+        if(pages[i].lastUse < pages[lru].lastUse)
+            lru = i;
+    }
+
+    resetPage(lru);
+    return allocate(pages[lru], size, rect) ? lru : -1;
+}
+
+void QFontIconAtlasPrivate::resetPage(int index)
+{
+    for(auto it = entries.begin(); it != entries.end();)
+    {
+        if(it->page == index)
+            it = entries.erase(it);
+        else
+            ++it;
+    }
+
+    auto& page = pages[index];
+    page.image.fill(Qt::transparent);
+    page.shelves.clear();
+    page.bottom = 0;
+    page.icons  = 0;
+}
+
+void QFontIconAtlasPrivate::removeFont(int font)
+{
+    for(auto it = entries.begin(); it != entries.end();)
+    {
+        if(it.key().font != font)
+        {
+            ++it;
+            continue;
+        }
+
+        // The space is only reclaimed once the whole page is unused.
+        int page = it->page;
+        it = entries.erase(it);
+
+        if(--pages[page].icons == 0)
+            resetPage(page);
+    }
+}
+
+
+
+// =============================================================================
+
+/**
+ * @class QFontIconAtlas
+ * @brief Rendered font icons packed into a few large images.
+ *
+ * Drawing thousands of small icons, in item views or icon pickers, is
+ * cheaper from a handful of large images than from one pixmap or one path
+ * fill per icon. QFontIconAtlas renders each (icon, font, size, color,
+ * device pixel ratio, scale factor) once into a page and hands out its
+ * location:
+ *
+ * @code
+ * auto atlas = QFontIconAtlas::shared();
+ *
+ * // In a delegate, one drawImage() per icon
+ * atlas->draw(painter, option.rect, fa::v6::star, fa::solid, Qt::darkYellow);
+ * @endcode
+ *
+ * Icons are packed in shelves. When every page is full, the least recently
+ * used page is cleared and reused. Locations are therefore only valid until
+ * the next find() or draw().
+ *
+ * Icons are scaled as QFontIconEngine::setScaleFactor() does, 0.9 by
+ * default. AnyFont is resolved per icon, as engines do. Atlases must be used
+ * from the GUI thread.
+ */
+
+/**
+ * @brief Construct an atlas of at most @a maxPages square pages of
+ * @a pageSize pixels.
+ */
+QFontIconAtlas::QFontIconAtlas(int pageSize, int maxPages) :
+    d(new QFontIconAtlasPrivate(pageSize, maxPages))
+{}
+
+QFontIconAtlas::~QFontIconAtlas() {}
+
+/**
+ * @brief Returns where @a icon of @a font is, rendering it if needed.
+ *
+ * @a size is the side of the icon in device independent pixels, the
+ * returned rectangle is in device pixels. The glyph fills @a scale of it.
+ * Returns a null location if the font is not available or the icon does not
+ * fit in a page.
+ */
+QFontIconAtlas::Location QFontIconAtlas::find(int icon, int font, int size, const QColor& color, qreal dpr, qreal scale)
+{
+    if(font == QFontIconEngine::AnyFont)
+        font = QFontIconEnginePrivate::findFont(icon);
+
+    QFontIconAtlasPrivate::Key key { font, icon, size, color.rgba(), dpr, scale };
+
+    auto it = d->entries.constFind(key);
+    if(it != d->entries.cend())
+    {
+        d->pages[it->page].lastUse = ++d->clock;
+        return { it->page, it->rect };
+    }
+
+    auto g = QFontIconEnginePrivate::glyph(font, icon);
+    if(g.path.isEmpty())
+        return {};
+
+    // One pixel of padding keeps neighbours out of smooth scaled draws.
+    int pixels = qCeil(size * dpr);
+    QSize cell(pixels + 2, pixels + 2);
+    if(pixels <= 0 || cell.width() > d->pageSize)
+        return {};
+
+    QRect rect;
+    int index = d->place(cell, rect);
+    if(index < 0)
+        return {};
+
+    rect.adjust(1, 1, -1, -1);
+
+    TraceSpan span("atlasFill");
+    span.event.font = font;
+    span.event.code = icon;
+    span.event.size = pixels;
+
+    auto& page = d->pages[index];
+    {
+        QPainter p(&page.image);
+        p.setRenderHint(QPainter::Antialiasing);
+        p.setClipRect(rect);
+        p.setPen(Qt::NoPen);
+        p.setBrush(color);
+        p.setTransform(QFontIconEnginePrivate::glyphTransform(g, QRectF(rect), scale, 0));
+        p.drawPath(g.path);
+    }
+
+    page.icons += 1;
+    page.lastUse = ++d->clock;
+    d->entries.insert(key, { index, rect });
+
+    QFontIconEnginePrivate::count(QFontIconEnginePrivate::counters.rasterizations);
+
+    return { index, rect };
+}
+
+/**
+ * @brief Draw @a icon of @a font centered in @a rect, with a single
+ * drawImage() call.
+ *
+ * The icon is a square as large as the smallest side of @a rect, rendered
+ * for the device pixel ratio of the painter's device, the glyph filling
+ * @a scale of it. Returns @c false if nothing was drawn.
+ */
+bool QFontIconAtlas::draw(QPainter* painter, const QRectF& rect, int icon, int font, const QColor& color, qreal scale)
+{
+    qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+    int size = qFloor(qMin(rect.width(), rect.height()));
+
+    auto loc = find(icon, font, size, color, dpr, scale);
+    if(loc.isNull())
+        return false;
+
+    QRectF target(0, 0, size, size);
+    target.moveCenter(rect.center());
+
+    painter->drawImage(target, d->pages[loc.page].image, loc.rect);
+    return true;
+}
+
+/**
+ * @brief Returns the image of page @a index.
+ */
+const QImage& QFontIconAtlas::page(int index) const
+{
+    return d->pages[index].image;
+}
+
+/**
+ * @brief Returns the number of pages allocated so far.
+ */
+int QFontIconAtlas::pageCount() const
+{
+    return d->pages.size();
+}
+
+/**
+ * @brief Returns the side of the pages, in pixels.
+ */
+int QFontIconAtlas::pageSize() const
+{
+    return d->pageSize;
+}
+
+/**
+ * @brief Returns the maximum number of pages.
+ */
+int QFontIconAtlas::maxPages() const
+{
+    return d->maxPages;
+}
+
+/**
+ * @brief Set the maximum number of pages.
+ *
+ * Pages beyond the new maximum are released right away.
+ */
+void QFontIconAtlas::setMaxPages(int pages)
+{
+    d->maxPages = qMax(1, pages);
+
+    while(d->pages.size() > d->maxPages)
+    {
+        d->resetPage(d->pages.size() - 1);
+        d->pages.removeLast();
+    }
+}
+
+/**
+ * @brief Clear page @a index, its icons are rendered again on next use.
+ */
+void QFontIconAtlas::evictPage(int index)
+{
+    if(index >= 0 && index < d->pages.size())
+        d->resetPage(index);
+}
+
+/**
+ * @brief Release every page.
+ */
+void QFontIconAtlas::clear()
+{
+    d->entries.clear();
+    d->pages.clear();
+}
+
+/**
+ * @brief Returns the memory used by the pages, in bytes.
+ */
+qint64 QFontIconAtlas::memoryUsage() const
+{
+    qint64 bytes = 0;
+    for(const auto& p : d->pages)
+        bytes += p.image.sizeInBytes();
+    return bytes;
+}
+
+/**
+ * @brief Returns the atlas shared by the application.
+ *
+ * Its size is set with QFontIconEngine::setCacheBudget(QFontIconEngine::AtlasCache).
+ */
+QFontIconAtlas* QFontIconAtlas::shared()
+{
+    static QFontIconAtlas atlas;
+    return &atlas;
+}
@@ -0,0 +1,204 @@
+#include <qfonticondelegate.h>
+#include <qfonticon.h>
+#include <qfonticonatlas.h>
+
+#include <QApplication>
+#include <QPainter>
+
+class QFontIconDelegatePrivate
+{
+public:
+    int   iconRole  = Qt::UserRole;
+    int   colorRole = -1;
+    int   font      = QFontIconEngine::defaultFont();
+    QSize iconSize;
+    bool  atlas     = true;
+};
+
+/**
+ * @class QFontIconDelegate
+ * @brief Item delegate drawing font icons directly.
+ *
+ * The icon is read from iconRole(), either as a code point of font() or as a
+ * QFontIcon. It is painted from the shared glyph atlas, or from the glyph
+ * outlines, without going through QStyle or creating a QIcon or a QPixmap
+ * per cell:
+ *
+ * @code
+ * // data(index, Qt::UserRole) returns fa::v6::star or QVariant::fromValue(QFontIcon(...))
+ * auto delegate = new QFontIconDelegate(view);
+ * delegate->setFont(fa::solid);
+ * delegate->setColorRole(Qt::UserRole + 1); // optional, per row colors
+ *
+ * view->setItemDelegateForColumn(0, delegate);
+ * @endcode
+ *
+ * The color is taken from colorRole() when set and valid. Otherwise selected
+ * cells use the highlighted text color, and other cells the QFontIcon color
+ * or the text color. The cell background and focus frame are drawn by the
+ * style, as for any item. Cells whose icon role holds anything else are
+ * painted by QStyledItemDelegate.
+ */
+
+QFontIconDelegate::QFontIconDelegate(QObject* parent) :
+    QStyledItemDelegate(parent),
+    d(new QFontIconDelegatePrivate)
+{}
+
+QFontIconDelegate::~QFontIconDelegate() {}
+
+/**
+ * @brief Returns the role holding the icon, Qt::UserRole by default.
+ */
+int QFontIconDelegate::iconRole() const
+{
+    return d->iconRole;
+}
+
+/**
+ * @brief Set the role holding the icon, as a code point or a QFontIcon.
+ */
+void QFontIconDelegate::setIconRole(int role)
+{
+    d->iconRole = role;
+}
+
+/**
+ * @brief Returns the role holding the icon color, -1 if none.
+ */
+int QFontIconDelegate::colorRole() const
+{
+    return d->colorRole;
+}
+
+/**
+ * @brief Set the role holding the icon color, -1 to use the palette.
+ */
+void QFontIconDelegate::setColorRole(int role)
+{
+    d->colorRole = role;
+}
+
+/**
+ * @brief Returns the font id of code points, the default font when created.
+ */
+int QFontIconDelegate::font() const
+{
+    return d->font;
+}
+
+/**
+ * @brief Set the font id of code points.
+ */
+void QFontIconDelegate::setFont(int font)
+{
+    d->font = font;
+}
+
+/**
+ * @brief Returns the icon size, invalid to use the view decoration size.
+ */
+QSize QFontIconDelegate::iconSize() const
+{
+    return d->iconSize;
+}
+
+/**
+ * @brief Set the icon size, invalid to use the view decoration size.
+ */
+void QFontIconDelegate::setIconSize(const QSize& size)
+{
+    d->iconSize = size;
+}
+
+/**
+ * @brief Returns whether icons are drawn from QFontIconAtlas::shared().
+ */
+bool QFontIconDelegate::atlasEnabled() const
+{
+    return d->atlas;
+}
+
+/**
+ * @brief Set whether icons are drawn from QFontIconAtlas::shared(), which is
+ * the default, or from the glyph outlines.
+ *
+ * The atlas is faster for many small icons, outlines keep memory down and
+ * suit large icons.
+ */
+void QFontIconDelegate::setAtlasEnabled(bool en)
+{
+    d->atlas = en;
+}
+
+void QFontIconDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    auto value = index.data(d->iconRole);
+
+    bool fontIcon = value.userType() == qMetaTypeId<QFontIcon>();
+    if(!fontIcon && value.userType() != QMetaType::Int && value.userType() != QMetaType::UInt)
+    {
+        QStyledItemDelegate::paint(painter, option, index);
+        return;
+    }
+
+    // Selection, hover and alternate backgrounds as the style draws them
+    auto widget = option.widget;
+    auto style  = widget ? widget->style() : QApplication::style();
+    style->drawPrimitive(QStyle::PE_PanelItemViewItem, &option, painter, widget);
+
+    bool selected = option.state & QStyle::State_Selected;
+
+    QColor color;
+    if(d->colorRole >= 0)
+        color = index.data(d->colorRole).value<QColor>();
+
+    if(!color.isValid())
+    {
+        if(selected)
+            color = option.palette.color(QPalette::HighlightedText);
+        else if(!fontIcon)
+            color = option.palette.color(QPalette::Text);
+    }
+
+    // Code points get the color right away, no palette lookup
+    QFontIcon icon = fontIcon ? value.value<QFontIcon>() : QFontIcon(value.toInt(), d->font, color);
+    if(!color.isValid())
+        color = icon.color();
+    else if(fontIcon)
+        icon.setColor(color);
+
+    if(!icon.isNull())
+    {
+        auto size = d->iconSize.isValid() ? d->iconSize : option.decorationSize;
+        if(!size.isValid())
+            size = option.rect.size();
+
+        QRectF rect(QPointF(), QSizeF(size).boundedTo(option.rect.size()));
+        rect.moveCenter(QRectF(option.rect).center());
+
+        if(d->atlas)
+            QFontIconAtlas::shared()->draw(painter, rect, icon.icon(), icon.font(), color, icon.scaleFactor());
+        else
+            icon.paint(painter, rect);
+    }
+
+    if(option.state & QStyle::State_HasFocus)
+    {
+        QStyleOptionFocusRect focus;
+        focus.QStyleOption::operator=(option);
+        focus.backgroundColor = option.palette.color(selected ? QPalette::Highlight : QPalette::Window);
+        style->drawPrimitive(QStyle::PE_FrameFocusRect, &focus, painter, widget);
+    }
+}
+
+QSize QFontIconDelegate::sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    auto value = index.data(d->iconRole);
+    if(value.userType() != qMetaTypeId<QFontIcon>() &&
+       value.userType() != QMetaType::Int && value.userType() != QMetaType::UInt)
+        return QStyledItemDelegate::sizeHint(option, index);
+
+    auto size = d->iconSize.isValid() ? d->iconSize : option.decorationSize;
+    return size + QSize(4, 4);
+}
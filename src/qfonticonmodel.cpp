@@ -0,0 +1,215 @@
+#include "qfonticon_p.h"
+
+#include <qfonticonmodel.h>
+#include <qfonticonsearch.h>
+
+#include <numeric>
+
+class QFontIconModelPrivate
+{
+public:
+    struct Entry
+    {
+        int     code;
+        QString name;
+    };
+
+    void reload();
+    void applyFilter();
+
+    int              font = QFontIconEngine::defaultFont();
+    QString          filter;
+    QVector<Entry>   entries;   // every glyph of the font
+    QVector<int>     rows;      // entries matching the filter, best first
+
+    // Built on the first filter, names registered later are indexed when
+    // the font is set again.
+    QScopedPointer<QFontIconSearch> index;
+
+    int entry(int code) const;
+};
+
+int QFontIconModelPrivate::entry(int code) const
+{
+    auto it = std::lower_bound(entries.cbegin(), entries.cend(), code, [](const Entry& e, int c){ return e.code < c; });
+    return it != entries.cend() && it->code == code ? int(it - entries.cbegin()) : -1;
+}
+
+void QFontIconModelPrivate::reload()
+{
+    entries.clear();
+
+    // The character map is read straight from the font data, or the glyph
+    // records of compiled in outlines and icon packs. Names come from the
+    // registered names and resolvers.
+    for(auto code : QFontIconEnginePrivate::codePoints(font))
+        entries.append({ int(code), QFontIconEnginePrivate::resolveIconCode(int(code)) });
+
+    index.reset();
+    applyFilter();
+}
+
+void QFontIconModelPrivate::applyFilter()
+{
+    rows.clear();
+
+    if(filter.isEmpty())
+    {
+        rows.resize(entries.size());
+        std::iota(rows.begin(), rows.end(), 0);
+        return;
+    }
+
+    // Ranked like any other search, names of other fonts are skipped.
+    if(!index)
+        index.reset(new QFontIconSearch);
+
+    for(const auto& m : index->search(filter))
+    {
+        int e = entry(m.code);
+        if(e >= 0)
+            rows.append(e);
+    }
+}
+
+/**
+ * @class QFontIconModel
+ * @brief List model of every glyph of a font.
+ *
+ * Rows are the code points the font maps, read from its character map, in
+ * ascending order, or best match first while a filter is set. Names are
+ * those registered with QFontIconEngine::registerIconName() or its
+ * resolvers.
+ *
+ * Nothing is rendered up front. Views only ask for the rows they show, and
+ * the icon roles are cheap: CodeRole works with QFontIconDelegate, IconRole
+ * returns a QFontIcon. Qt::DecorationRole creates a QIcon per call and is
+ * only there for views using the default delegate.
+ *
+ * @see QFontIconPicker
+ */
+
+QFontIconModel::QFontIconModel(QObject* parent) :
+    QFontIconModel(QFontIconEngine::defaultFont(), parent)
+{}
+
+QFontIconModel::QFontIconModel(int font, QObject* parent) :
+    QAbstractListModel(parent),
+    d(new QFontIconModelPrivate)
+{
+    d->font = font;
+    d->reload();
+}
+
+QFontIconModel::~QFontIconModel() {}
+
+/**
+ * @brief Returns the font id whose glyphs are listed.
+ */
+int QFontIconModel::font() const
+{
+    return d->font;
+}
+
+/**
+ * @brief List the glyphs of @a font.
+ */
+void QFontIconModel::setFont(int font)
+{
+    beginResetModel();
+    d->font = font;
+    d->reload();
+    endResetModel();
+}
+
+/**
+ * @brief Returns the current name filter.
+ */
+QString QFontIconModel::filter() const
+{
+    return d->filter;
+}
+
+/**
+ * @brief Only list glyphs matching @a filter, best first, as QFontIconSearch
+ * ranks them. An empty filter lists every glyph in code point order.
+ */
+void QFontIconModel::setFilter(const QString& filter)
+{
+    if(filter == d->filter)
+        return;
+
+    beginResetModel();
+    d->filter = filter;
+    d->applyFilter();
+    endResetModel();
+}
+
+/**
+ * @brief Returns the code point at @a row, or QFontIconEngine::InvalidIcon.
+ */
+int QFontIconModel::code(int row) const
+{
+    if(row < 0 || row >= d->rows.size())
+        return QFontIconEngine::InvalidIcon;
+
+    return d->entries.at(d->rows.at(row)).code;
+}
+
+/**
+ * @brief Returns the row of @a code, or -1 if it is not listed.
+ */
+int QFontIconModel::row(int code) const
+{
+    int entry = d->entry(code);
+    if(entry < 0 || d->filter.isEmpty())
+        return entry;
+
+    return d->rows.indexOf(entry);
+}
+
+int QFontIconModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : d->rows.size();
+}
+
+QVariant QFontIconModel::data(const QModelIndex& index, int role) const
+{
+    if(!index.isValid() || index.row() >= d->rows.size())
+        return {};
+
+    const auto& e = d->entries.at(d->rows.at(index.row()));
+
+    switch(role)
+    {
+    case Qt::DisplayRole:
+    case Qt::ToolTipRole:
+        if(e.name.isEmpty())
+            return QStringLiteral("U+%1").arg(e.code, 4, 16, QLatin1Char('0')).toUpper();
+        return e.name;
+
+    case CodeRole:
+        return e.code;
+
+    case NameRole:
+        return e.name;
+
+    case IconRole:
+        return QVariant::fromValue(QFontIcon(e.code, d->font));
+
+    case Qt::DecorationRole:
+        return QFontIconEngine::icon(e.code, d->font);
+
+    default:
+        return {};
+    }
+}
+
+QHash<int, QByteArray> QFontIconModel::roleNames() const
+{
+    auto names = QAbstractListModel::roleNames();
+    names.insert(CodeRole, "code");
+    names.insert(NameRole, "name");
+    names.insert(IconRole, "icon");
+    return names;
+}
@@ -0,0 +1,85 @@
+#ifndef QFONTICONPACK_P_H
+#define QFONTICONPACK_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QFontIcon API. It is shared by the library
+// sources and the qfonticonpack tool and may change from version to version
+// without notice.
+//
+
+#include <QtEndian>
+#include <QtGlobal>
+
+/*
+ * Icon pack file format, written by the qfonticonpack tool and read by
+ * QFontIconEngine::loadIconPack(). Every field is little endian, every
+ * section is 4 bytes aligned:
+ *
+ *   Header     magic "QFIP", format version and section offsets
+ *   Glyphs     one record per code point, sorted by code point
+ *   Names      one record per icon name, sorted by name bytes
+ *   Strings    Latin-1 icon names, not terminated
+ *   Commands   QFontIconEngine::OutlineCommand bytes of every glyph
+ *   Points     qint16 x, y pairs of every glyph, in font units times
+ *              2^shift, y up
+ *
+ * Loading only checks the header and the section bounds. Glyph records are
+ * checked when their outline is first decoded.
+ */
+namespace QFontIconPack {
+
+enum { Version = 1 };
+
+static const char Magic[4] = { 'Q', 'F', 'I', 'P' };
+
+// Header, HeaderSize bytes at offset 0
+enum HeaderField
+{
+    MagicField          = 0,    // char[4]
+    VersionField        = 4,    // quint16
+    UnitsPerEmField     = 6,    // quint16
+    ShiftField          = 8,    // quint16
+    GlyphCountField     = 12,   // quint32
+    NameCountField      = 16,   // quint32
+    GlyphsField         = 20,   // quint32 offset of the glyph records
+    NamesField          = 24,   // quint32 offset of the name records
+    StringsField        = 28,   // quint32 offset of the strings
+    CommandsField       = 32,   // quint32 offset of the commands
+    PointsField         = 36,   // quint32 offset of the points
+    SizeField           = 40,   // quint32 size of the whole file
+    HeaderSize          = 44
+};
+
+// Glyph record, GlyphSize bytes
+enum GlyphField
+{
+    GlyphCode           = 0,    // quint32 code point
+    GlyphIndex          = 4,    // quint32 glyph index in the source font
+    GlyphBounds         = 8,    // qint16[4] xMin, yMin, xMax, yMax, font units, y up
+    GlyphCommands       = 16,   // quint32 first command, from the commands section
+    GlyphCommandCount   = 20,   // quint32
+    GlyphPoints         = 24,   // quint32 first point, from the points section
+    GlyphSize           = 28
+};
+
+// Name record, NameSize bytes
+enum NameField
+{
+    NameString          = 0,    // quint32 offset, from the strings section
+    NameLength          = 4,    // quint32
+    NameCode            = 8,    // quint32 code point
+    NameSize            = 12
+};
+
+template<class T>
+inline T readLE(const char* data, quint32 offset)
+{
+    return qFromLittleEndian<T>(reinterpret_cast<const uchar*>(data) + offset);
+}
+
+}
+
+#endif // QFONTICONPACK_P_H
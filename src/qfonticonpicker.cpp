@@ -0,0 +1,165 @@
+#include <qfonticonpicker.h>
+#include <qfonticonmodel.h>
+#include <qfonticondelegate.h>
+#include <qfonticon.h>
+
+#include <QLineEdit>
+#include <QListView>
+#include <QVBoxLayout>
+
+class QFontIconPickerPrivate
+{
+public:
+    QLineEdit*          search   = nullptr;
+    QListView*          view     = nullptr;
+    QFontIconModel*     model    = nullptr;
+    QFontIconDelegate*  delegate = nullptr;
+
+    void updateGrid();
+};
+
+void QFontIconPickerPrivate::updateGrid()
+{
+    // Uniform cells let the view lay out any number of rows in constant time.
+    auto size = delegate->iconSize();
+    view->setIconSize(size);
+    view->setGridSize(size * 2);
+}
+
+/**
+ * @class QFontIconPicker
+ * @brief Widget to choose a glyph of a font.
+ *
+ * A search field above a grid of every glyph of iconFont(), see
+ * QFontIconModel. Typing ranks the glyphs by name, alias and search terms
+ * with QFontIconSearch, best match first.
+ * The grid only draws visible cells, from the shared glyph atlas, so
+ * scrolling through thousands of icons stays smooth.
+ *
+ * @code
+ * auto picker = new QFontIconPicker(fa::solid);
+ * connect(picker, &QFontIconPicker::iconActivated, button, [button](int icon)
+ * {
+ *     button->setIcon(QFontIconEngine::icon(icon, fa::solid));
+ * });
+ * @endcode
+ */
+
+QFontIconPicker::QFontIconPicker(QWidget* parent) :
+    QFontIconPicker(QFontIconEngine::defaultFont(), parent)
+{}
+
+QFontIconPicker::QFontIconPicker(int font, QWidget* parent) :
+    QWidget(parent),
+    d(new QFontIconPickerPrivate)
+{
+    d->search = new QLineEdit(this);
+    d->search->setPlaceholderText(tr("Search"));
+    d->search->setClearButtonEnabled(true);
+
+    d->model = new QFontIconModel(font, this);
+
+    d->delegate = new QFontIconDelegate(this);
+    d->delegate->setFont(font);
+    d->delegate->setIconRole(QFontIconModel::CodeRole);
+    d->delegate->setIconSize(QSize(24, 24));
+
+    d->view = new QListView(this);
+    d->view->setViewMode(QListView::IconMode);
+    d->view->setMovement(QListView::Static);
+    d->view->setResizeMode(QListView::Adjust);
+    d->view->setUniformItemSizes(true);
+    d->view->setSelectionMode(QAbstractItemView::SingleSelection);
+    d->view->setModel(d->model);
+    d->view->setItemDelegate(d->delegate);
+    d->updateGrid();
+
+    auto layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(d->search);
+    layout->addWidget(d->view);
+
+    connect(d->search, &QLineEdit::textChanged, this, [this](const QString& text)
+    {
+        int current = currentIcon();
+        d->model->setFilter(text);
+        setCurrentIcon(current);
+    });
+
+    connect(d->view->selectionModel(), &QItemSelectionModel::currentChanged, this, [this](const QModelIndex& index)
+    {
+        emit currentIconChanged(d->model->code(index.row()));
+    });
+
+    connect(d->view, &QListView::activated, this, [this](const QModelIndex& index)
+    {
+        emit iconActivated(d->model->code(index.row()));
+    });
+}
+
+QFontIconPicker::~QFontIconPicker() {}
+
+/**
+ * @brief Returns the font id whose glyphs are shown.
+ */
+int QFontIconPicker::iconFont() const
+{
+    return d->model->font();
+}
+
+/**
+ * @brief Show the glyphs of @a font.
+ */
+void QFontIconPicker::setIconFont(int font)
+{
+    d->delegate->setFont(font);
+    d->model->setFont(font);
+}
+
+/**
+ * @brief Returns the selected code point, or QFontIconEngine::InvalidIcon.
+ */
+int QFontIconPicker::currentIcon() const
+{
+    auto index = d->view->currentIndex();
+    return index.isValid() ? d->model->code(index.row()) : int(QFontIconEngine::InvalidIcon);
+}
+
+/**
+ * @brief Select @a icon, if it is listed.
+ */
+void QFontIconPicker::setCurrentIcon(int icon)
+{
+    int row = d->model->row(icon);
+    if(row < 0)
+        return;
+
+    auto index = d->model->index(row);
+    d->view->setCurrentIndex(index);
+    d->view->scrollTo(index);
+}
+
+/**
+ * @brief Returns the size of the icons in the grid.
+ */
+QSize QFontIconPicker::iconSize() const
+{
+    return d->delegate->iconSize();
+}
+
+/**
+ * @brief Set the size of the icons in the grid, 24x24 by default.
+ */
+void QFontIconPicker::setIconSize(const QSize& size)
+{
+    d->delegate->setIconSize(size);
+    d->updateGrid();
+}
+
+/**
+ * @brief Returns the model listing the glyphs.
+ */
+QFontIconModel* QFontIconPicker::model() const
+{
+    return d->model;
+}
@@ -0,0 +1,392 @@
+#include "qfonticon_p.h"
+
+#include <qfonticonsearch.h>
+
+#include <algorithm>
+#include <numeric>
+
+class QFontIconSearchPrivate
+{
+public:
+    enum Kind { Name, Word, Alias, Term };
+
+    struct Entry
+    {
+        int        code;
+        QString    name;
+        QByteArray key;         // lower case name
+        QByteArray haystack;    // every key of the entry, space separated
+    };
+
+    // Every word of every entry, sorted: a prefix is a contiguous range, which
+    // each keystroke narrows like a step down a trie.
+    struct Token
+    {
+        QByteArray text;
+        int        entry;
+        int        kind;
+    };
+
+    // Search state after each character of the current query, so typing one
+    // more character only filters the previous candidates, and deleting one
+    // goes back to a saved state.
+    struct State
+    {
+        QByteArray   query;
+        QVector<int> candidates;
+        int          first;
+        int          last;
+    };
+
+    QVector<Entry>  entries;
+    QVector<Token>  tokens;
+    QVector<State>  states;
+
+    void addKey(int entry, const QByteArray& key, Kind kind);
+    void narrow(State& state, char c) const;
+
+    static bool isSubsequence(const QByteArray& query, const QByteArray& text);
+    static int fuzzyScore(const QByteArray& query, const QByteArray& text);
+
+    struct Registered
+    {
+        int           code;
+        QLatin1String name;
+        QLatin1String terms;
+    };
+
+    static QVector<Registered>& registered();
+};
+
+QVector<QFontIconSearchPrivate::Registered>& QFontIconSearchPrivate::registered()
+{
+    static QVector<Registered> r;
+    return r;
+}
+
+void QFontIconSearchPrivate::addKey(int entry, const QByteArray& key, Kind kind)
+{
+    if(key.isEmpty())
+        return;
+
+    auto& e = entries[entry];
+    if(!e.haystack.isEmpty())
+        e.haystack += ' ';
+    e.haystack += key;
+
+    tokens.append({ key, entry, kind });
+
+    // Dashed names are also found by each of their words.
+    if(kind == Name || kind == Alias)
+    {
+        auto words = key.split('-');
+        if(words.size() > 1)
+        {
+            for(const auto& w : words)
+            {
+                if(!w.isEmpty())
+                    tokens.append({ w, entry, kind == Name ? Word : Alias });
+            }
+        }
+    }
+}
+
+void QFontIconSearchPrivate::narrow(State& state, char c) const
+{
+    // Tokens in [first, last) share the state query as a prefix, and are
+    // sorted by their next character, shorter tokens first.
+    int depth = state.query.size();
+    auto at = [depth](const Token& t) { return t.text.size() > depth ? int(uchar(t.text.at(depth))) : -1; };
+
+    auto begin = tokens.cbegin() + state.first;
+    auto end   = tokens.cbegin() + state.last;
+
+    auto lo = std::lower_bound(begin, end, int(uchar(c)), [&at](const Token& t, int v) { return at(t) < v; });
+    auto hi = std::upper_bound(lo, end, int(uchar(c)), [&at](int v, const Token& t) { return v < at(t); });
+
+    state.first = int(lo - tokens.cbegin());
+    state.last  = int(hi - tokens.cbegin());
+}
+
+bool QFontIconSearchPrivate::isSubsequence(const QByteArray& query, const QByteArray& text)
+{
+    int i = 0;
+    for(int j = 0; i < query.size() && j < text.size(); ++j)
+    {
+        if(query.at(i) == text.at(j))
+            ++i;
+    }
+
+    return i == query.size();
+}
+
+int QFontIconSearchPrivate::fuzzyScore(const QByteArray& query, const QByteArray& text)
+{
+    // Greedy subsequence match, rewarding consecutive characters and word
+    // starts. Stays under substring scores.
+    int score = 100;
+    int last  = -2;
+    int i     = 0;
+
+    for(int j = 0; i < query.size() && j < text.size(); ++j)
+    {
+        if(query.at(i) != text.at(j))
+            continue;
+
+        if(j == last + 1)
+            score += 10;
+        else if(j == 0 || text.at(j - 1) == '-' || text.at(j - 1) == ' ')
+            score += 8;
+        else
+            score -= 2;
+
+        last = j;
+        ++i;
+    }
+
+    return i == query.size() ? qBound(1, score, 199) : 0;
+}
+
+/**
+ * @class QFontIconSearch
+ * @brief As-you-type search over icon names, aliases and search terms.
+ *
+ * The index is built from every name registered with
+ * QFontIconEngine::registerIconName() and the search terms registered with
+ * registerSearchTerms(). Names only known to resolvers, as with
+ * fa::v6::register_awesome_names(true), are those their reverse functions
+ * give for the code points of the fonts loaded or registered so far. Rebuild
+ * it after registering more names or fonts.
+ *
+ * Results are ranked: exact names first, then name prefixes, prefixes of the
+ * words of dashed names and aliases, prefixes of search terms, substrings
+ * and finally fuzzy matches whose characters merely appear in order:
+ *
+ * @code
+ * QFontIconSearch index;
+ * for(const auto& m : index.search(u"mug", 10))
+ *     qDebug() << m.name << m.code << m.score;
+ * @endcode
+ *
+ * Each call is answered from the previous query's candidates when the new
+ * query extends it, and from a saved state when characters were removed, so
+ * typing costs little more than the number of remaining candidates.
+ */
+
+QFontIconSearch::QFontIconSearch() :
+    d(new QFontIconSearchPrivate)
+{
+    rebuild();
+}
+
+QFontIconSearch::~QFontIconSearch() {}
+
+/**
+ * @brief Index the names and search terms registered so far.
+ *
+ * Naming the code points of every font through resolvers maps fonts only
+ * registered, and costs a lookup per code point.
+ */
+void QFontIconSearch::rebuild()
+{
+    d->entries.clear();
+    d->tokens.clear();
+    d->states.clear();
+
+    QHash<int, int> byCode;
+    auto entry = [this, &byCode](int code, const QString& name)
+    {
+        auto it = byCode.constFind(code);
+        if(it != byCode.cend())
+            return it.value();
+
+        int index = d->entries.size();
+        d->entries.append({ code, name, name.toLatin1().toLower(), {} });
+        d->addKey(index, d->entries.last().key, QFontIconSearchPrivate::Name);
+        byCode.insert(code, index);
+        return index;
+    };
+
+    for(const auto& n : QFontIconEnginePrivate::iconNames)
+    {
+        int e = entry(n.second, QFontIconEnginePrivate::iconCodes.value(n.second, n.first));
+
+        auto key = n.first.toLatin1().toLower();
+        if(key != d->entries.at(e).key)
+            d->addKey(e, key, QFontIconSearchPrivate::Alias);
+    }
+
+    // Resolvers cannot list their names, lazily registered tables included.
+    // Their reverse functions name the code points of every font instead.
+    auto& resolvers = QFontIconEnginePrivate::iconResolvers;
+    if(std::any_of(resolvers.cbegin(), resolvers.cend(), [](const QPair<QFontIconEngine::IconNameResolver, QFontIconEngine::IconCodeResolver>& r) { return r.second != nullptr; }))
+    {
+        QVector<int> fonts;
+        {
+            QMutexLocker lock(&QFontIconEnginePrivate::fontsMutex);
+            fonts = QFontIconEnginePrivate::knownFonts();
+        }
+
+        for(int font : fonts)
+        {
+            for(auto code : QFontIconEnginePrivate::codePoints(font))
+            {
+                if(byCode.contains(int(code)))
+                    continue;
+
+                auto name = QFontIconEnginePrivate::resolveIconCode(int(code));
+                if(!name.isEmpty())
+                    entry(int(code), name);
+            }
+        }
+    }
+
+    for(const auto& r : QFontIconSearchPrivate::registered())
+    {
+        int e = entry(r.code, r.name);
+
+        QByteArray key(r.name.data(), r.name.size());
+        key = key.toLower();
+        if(key != d->entries.at(e).key)
+            d->addKey(e, key, QFontIconSearchPrivate::Alias);
+
+        for(const auto& term : QByteArray(r.terms.data(), r.terms.size()).toLower().split(' '))
+            d->addKey(e, term, QFontIconSearchPrivate::Term);
+    }
+
+    std::sort(d->tokens.begin(), d->tokens.end(), [](const QFontIconSearchPrivate::Token& a, const QFontIconSearchPrivate::Token& b)
+    {
+        return a.text < b.text;
+    });
+
+    QFontIconSearchPrivate::State all;
+    all.first = 0;
+    all.last  = d->tokens.size();
+    all.candidates.resize(d->entries.size());
+    std::iota(all.candidates.begin(), all.candidates.end(), 0);
+    d->states.append(all);
+}
+
+/**
+ * @brief Returns the number of icons indexed.
+ */
+int QFontIconSearch::size() const
+{
+    return d->entries.size();
+}
+
+/**
+ * @brief Returns the icons matching @a query, best first.
+ *
+ * The search is case insensitive. At most @a limit matches are returned,
+ * all of them if @a limit is negative. An empty query lists every icon in
+ * name order.
+ */
+QVector<QFontIconSearch::Match> QFontIconSearch::search(QStringView query, int limit)
+{
+    TraceSpan span("search");
+
+    auto q = query.trimmed().toLatin1().toLower();
+
+    // Back to the longest saved state the query extends, then one state per
+    // additional character.
+    while(d->states.size() > 1 && !q.startsWith(d->states.last().query))
+        d->states.removeLast();
+
+    while(d->states.last().query.size() < q.size())
+    {
+        const auto& previous = d->states.last();
+
+        QFontIconSearchPrivate::State next;
+        next.query = q.left(previous.query.size() + 1);
+        next.first = previous.first;
+        next.last  = previous.last;
+        d->narrow(next, q.at(previous.query.size()));
+
+        next.candidates.reserve(previous.candidates.size());
+        for(int c : previous.candidates)
+        {
+            if(QFontIconSearchPrivate::isSubsequence(next.query, d->entries.at(c).haystack))
+                next.candidates.append(c);
+        }
+
+        d->states.append(next);
+    }
+
+    const auto& state = d->states.last();
+
+    // Prefix matches come straight from the token range.
+    QHash<int, int> prefixScores;
+    if(!q.isEmpty())
+    {
+        for(int i = state.first; i < state.last; ++i)
+        {
+            const auto& t = d->tokens.at(i);
+            int extra = qMin(99, t.text.size() - q.size());
+
+            int score;
+            switch(t.kind)
+            {
+            case QFontIconSearchPrivate::Name:  score = extra == 0 ? 1000 : 900 - extra; break;
+            case QFontIconSearchPrivate::Word:  score = 700 - extra; break;
+            case QFontIconSearchPrivate::Alias: score = extra == 0 ? 950 : 700 - extra; break;
+            default:                            score = 500 - extra; break;
+            }
+
+            auto& best = prefixScores[t.entry];
+            best = qMax(best, score);
+        }
+    }
+
+    QVector<Match> matches;
+    matches.reserve(state.candidates.size());
+
+    for(int c : state.candidates)
+    {
+        const auto& e = d->entries.at(c);
+
+        int score = prefixScores.value(c);
+        if(!score && !q.isEmpty())
+        {
+            int pos = e.key.indexOf(q);
+            if(pos >= 0)
+                score = 400 - qMin(99, pos);
+            else if(e.haystack.contains(q))
+                score = 200;
+            else if(int f = QFontIconSearchPrivate::fuzzyScore(q, e.key))
+                score = f;
+            else
+                score = 50;
+        }
+
+        matches.append({ e.code, e.name, score });
+    }
+
+    auto byScore = [](const Match& a, const Match& b)
+    {
+        return a.score != b.score ? a.score > b.score : a.name < b.name;
+    };
+
+    if(limit >= 0 && limit < matches.size())
+    {
+        std::partial_sort(matches.begin(), matches.begin() + limit, matches.end(), byScore);
+        matches.resize(limit);
+    }
+    else
+        std::sort(matches.begin(), matches.end(), byScore);
+
+    return matches;
+}
+
+/**
+ * @brief Register search @a terms, separated by spaces, for the icon @a name
+ * with the code point @a code.
+ *
+ * The strings are not copied, they must live as long as the application, as
+ * string literals do. Registering the icon name here makes it searchable
+ * even if it is only known to a resolver.
+ */
+void QFontIconSearch::registerSearchTerms(int code, QLatin1String name, QLatin1String terms)
+{
+    QFontIconSearchPrivate::registered().append({ code, name, terms });
+}
@@ -0,0 +1,232 @@
+#include "qfonticon_p.h"
+#include "qfonticonpack_p.h"
+
+#include <awesome.h>
+
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QSet>
+#include <QtMath>
+#include <QDebug>
+
+/*
+ * Converts a TrueType or OpenType font into an icon pack, loaded with
+ * QFontIconEngine::loadIconPack(). Outlines are read through QRawFont, so
+ * any font Qt can load works, CFF ones included.
+ *
+ *   qfonticonpack [--names v5|v6|none] fa-solid-900.ttf solid.qfip
+ *
+ * Icon names are those of the Font Awesome tables of awesome.cpp whose code
+ * point the font maps.
+ */
+
+struct PackGlyph
+{
+    quint32 code;
+    quint32 index;
+    qint16  bounds[4];
+    quint32 commands;
+    quint32 commandCount;
+    quint32 points;
+};
+
+static QString codeToString(uint code)
+{
+    if(QChar::requiresSurrogates(code))
+        return QString({ QChar(QChar::highSurrogate(code)), QChar(QChar::lowSurrogate(code)) });
+
+    return QString(QChar(code));
+}
+
+static qint16 toInt16(qreal v)
+{
+    return qint16(qBound<qreal>(-32768, qRound(v), 32767));
+}
+
+static void pad(QDataStream& s, qint64 size)
+{
+    for(; size % 4; ++size)
+        s << quint8(0);
+}
+
+int main(int argc, char* argv[])
+{
+    if(!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Converts a font into a QFontIcon icon pack."));
+    parser.addHelpOption();
+    parser.addOption({ QStringLiteral("names"), QStringLiteral("Font Awesome names to include: v5, v6 or none."), QStringLiteral("version"), QStringLiteral("v6") });
+    parser.addPositionalArgument(QStringLiteral("font"), QStringLiteral("TrueType or OpenType font."));
+    parser.addPositionalArgument(QStringLiteral("output"), QStringLiteral("Icon pack to write."));
+    parser.process(app);
+
+    auto args = parser.positionalArguments();
+    if(args.size() != 2)
+        parser.showHelp(1);
+
+    const int font = 0;
+    if(!QFontIconEngine::loadFont(args[0], font))
+        return 1;
+
+    auto names = parser.value(QStringLiteral("names"));
+    if(names == QLatin1String("v5"))
+        fa::v5::register_awesome_names();
+    else if(names == QLatin1String("v6"))
+        fa::v6::register_awesome_names();
+
+    QRawFont raw = QFontIconEnginePrivate::getFont(font);
+    raw.setPixelSize(raw.unitsPerEm());
+
+    // Outlines, y up, in font units
+    QVector<PackGlyph> glyphs;
+    QByteArray commands;
+    QVector<QPointF> points;
+    QSet<int> codes;
+
+    for(uint code : QFontIconEnginePrivate::codePoints(font))
+    {
+        quint32 index = raw.glyphIndexesForString(codeToString(code)).value(0);
+        if(!index)
+            continue;
+
+        auto bounds = raw.boundingRect(index);
+        auto path   = raw.pathForGlyph(index);
+
+        PackGlyph g;
+        g.code      = code;
+        g.index     = index;
+        g.bounds[0] = toInt16(qFloor(bounds.left()));
+        g.bounds[1] = toInt16(qFloor(-bounds.bottom()));
+        g.bounds[2] = toInt16(qCeil(bounds.right()));
+        g.bounds[3] = toInt16(qCeil(-bounds.top()));
+        g.commands  = quint32(commands.size());
+        g.points    = quint32(points.size());
+
+        for(int i = 0; i < path.elementCount(); ++i)
+        {
+            auto e = path.elementAt(i);
+            switch(e.type)
+            {
+            case QPainterPath::MoveToElement:
+                if(i > 0)
+                    commands.append(char(QFontIconEngine::CloseSubpath));
+                commands.append(char(QFontIconEngine::MoveTo));
+                points.append(QPointF(e.x, -e.y));
+                break;
+
+            case QPainterPath::LineToElement:
+                commands.append(char(QFontIconEngine::LineTo));
+                points.append(QPointF(e.x, -e.y));
+                break;
+
+            case QPainterPath::CurveToElement:
+                if(i + 2 >= path.elementCount())
+                    break;
+
+                commands.append(char(QFontIconEngine::CubicTo));
+                for(int j = 0; j < 3; ++j)
+                    points.append(QPointF(path.elementAt(i + j).x, -path.elementAt(i + j).y));
+                i += 2;
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        if(path.elementCount())
+            commands.append(char(QFontIconEngine::CloseSubpath));
+
+        g.commandCount = quint32(commands.size()) - g.commands;
+        glyphs.append(g);
+        codes.insert(int(code));
+    }
+
+    // Finest grid the coordinates fit in
+    qreal extent = 1;
+    for(const auto& p : points)
+        extent = qMax(extent, qMax(qAbs(p.x()), qAbs(p.y())));
+
+    int shift = 0;
+    while(shift < 4 && extent * (1 << (shift + 1)) <= 32767)
+        ++shift;
+
+    // Names, already sorted
+    QVector<QPair<QByteArray, int>> packNames;
+    for(const auto& n : QFontIconEnginePrivate::iconNames)
+    {
+        if(codes.contains(n.second))
+            packNames.append({ n.first.toLatin1(), n.second });
+    }
+
+    using namespace QFontIconPack;
+
+    quint32 stringBytes = 0;
+    for(const auto& n : packNames)
+        stringBytes += quint32(n.first.size());
+
+    auto align = [](quint32 offset) { return (offset + 3) & ~3u; };
+
+    quint32 glyphsOffset   = HeaderSize;
+    quint32 namesOffset    = glyphsOffset + quint32(glyphs.size()) * GlyphSize;
+    quint32 stringsOffset  = namesOffset + quint32(packNames.size()) * NameSize;
+    quint32 commandsOffset = align(stringsOffset + stringBytes);
+    quint32 pointsOffset   = align(commandsOffset + quint32(commands.size()));
+    quint32 size           = pointsOffset + quint32(points.size()) * 4;
+
+    QSaveFile file(args[1]);
+    if(!file.open(QIODevice::WriteOnly))
+    {
+        qWarning() << "qfonticonpack: Cannot write" << args[1];
+        return 1;
+    }
+
+    QDataStream s(&file);
+    s.setByteOrder(QDataStream::LittleEndian);
+
+    s.writeRawData(Magic, 4);
+    s << quint16(Version) << quint16(raw.unitsPerEm()) << quint16(shift) << quint16(0);
+    s << quint32(glyphs.size()) << quint32(packNames.size());
+    s << glyphsOffset << namesOffset << stringsOffset << commandsOffset << pointsOffset << size;
+
+    for(const auto& g : glyphs)
+    {
+        s << g.code << g.index;
+        for(auto b : g.bounds)
+            s << b;
+        s << g.commands << g.commandCount << g.points;
+    }
+
+    quint32 string = 0;
+    for(const auto& n : packNames)
+    {
+        s << string << quint32(n.first.size()) << quint32(n.second);
+        string += quint32(n.first.size());
+    }
+
+    for(const auto& n : packNames)
+        s.writeRawData(n.first.constData(), n.first.size());
+    pad(s, stringsOffset + stringBytes);
+
+    s.writeRawData(commands.constData(), commands.size());
+    pad(s, commandsOffset + commands.size());
+
+    for(const auto& p : points)
+        s << toInt16(p.x() * (1 << shift)) << toInt16(p.y() * (1 << shift));
+
+    if(s.status() != QDataStream::Ok || file.pos() != size || !file.commit())
+    {
+        qWarning() << "qfonticonpack: Cannot write" << args[1];
+        return 1;
+    }
+
+    qInfo().noquote() << QStringLiteral("%1: %2 glyphs, %3 names, %4 bytes")
+                         .arg(args[1]).arg(glyphs.size()).arg(packNames.size()).arg(size);
+    return 0;
+}